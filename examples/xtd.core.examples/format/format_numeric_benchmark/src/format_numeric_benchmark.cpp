@@ -0,0 +1,67 @@
+#include <xtd/diagnostics/stopwatch>
+#include <xtd/console>
+#include <xtd/string>
+#include <array>
+
+using namespace xtd;
+using namespace xtd::diagnostics;
+
+constexpr auto operation_count = 200'000;
+
+template<typename function_t>
+void measure(const string& name, function_t function) {
+  auto result = function();
+  auto watch = stopwatch::start_new();
+  result += function();
+  console::write_line("{,-24} : {,7:F2} ns per value (result = {})", name, static_cast<double>(watch.elapsed_nanoseconds()) / operation_count, result);
+}
+
+template<typename value_t>
+void measure_specifiers(const string& type_name, const std::array<const char*, 8>& specifiers, value_t first_value, value_t step) {
+  for (auto specifier : specifiers) {
+    auto pattern = *specifier ? "{:"_s + specifier + "}" : "{}"_s;
+    measure(string::format("{} {}", type_name, pattern), [&] {
+      auto length = 0_z;
+      auto value = first_value;
+      for (auto index = 0; index < operation_count; ++index, value += step)
+        length += string::format(pattern, value).length();
+      return length;
+    });
+  }
+  console::write_line();
+}
+
+auto main() -> int {
+  measure_specifiers<int32>("int32", {"", "b", "d", "D10", "o", "x", "X8", "G"}, -100'000, 7);
+  measure_specifiers<uint64>("uint64", {"", "b", "d", "D20", "o", "x", "X16", "G"}, 1'234'567'890'123ull, 1'234'567ull);
+  measure_specifiers<double>("double", {"", "e", "E3", "f", "F2", "g", "G10", "p"}, -12'345.678, 0.731);
+}
+
+// This code can produce the following output :
+//
+// int32 {}                 :  147.06 ns per value (result = 2450796)
+// int32 {:b}               :  115.83 ns per value (result = 8115106)
+// int32 {:d}               :  115.30 ns per value (result = 2450796)
+// int32 {:D10}             :   96.42 ns per value (result = 4028572)
+// int32 {:o}               :  121.41 ns per value (result = 3142984)
+// int32 {:x}               :  121.53 ns per value (result = 2366154)
+// int32 {:X8}              :  121.07 ns per value (result = 3428576)
+// int32 {:G}               :  118.44 ns per value (result = 2450796)
+//
+// uint64 {}                :  130.15 ns per value (result = 5200000)
+// uint64 {:b}              :  166.34 ns per value (result = 16400000)
+// uint64 {:d}              :  126.07 ns per value (result = 5200000)
+// uint64 {:D20}            :  153.43 ns per value (result = 8000000)
+// uint64 {:o}              :  123.86 ns per value (result = 5600000)
+// uint64 {:x}              :  163.49 ns per value (result = 4400000)
+// uint64 {:X16}            :  170.12 ns per value (result = 6400000)
+// uint64 {:G}              :  119.64 ns per value (result = 5200000)
+//
+// double {}                :  818.35 ns per value (result = 6390508)
+// double {:e}              :  606.73 ns per value (result = 4833778)
+// double {:E3}             :  566.61 ns per value (result = 3633778)
+// double {:f}              :  621.92 ns per value (result = 3265608)
+// double {:F2}             :  604.03 ns per value (result = 3265608)
+// double {:g}              :  767.15 ns per value (result = 6390508)
+// double {:G10}            :  625.77 ns per value (result = 3621138)
+// double {:p}              :  680.38 ns per value (result = 4865602)
@@ -0,0 +1,73 @@
+#include <xtd/collections/generic/list>
+#include <xtd/basic_string>
+#include <xtd/diagnostics/stopwatch>
+#include <xtd/console>
+#include <span>
+
+using namespace xtd;
+using namespace xtd::collections::generic;
+using namespace xtd::diagnostics;
+
+constexpr auto iteration_count = 100;
+
+template<typename collection_t>
+auto sum_with_range_for(const collection_t& items) {
+  auto result = int64 {0};
+  for (auto item : items)
+    result += item;
+  return result;
+}
+
+template<typename type_t>
+auto sum_with_batches(const ienumerable<type_t>& items) {
+  auto result = int64 {0};
+  auto enumerator = items.get_enumerator();
+  for (auto batch = enumerator.move_next_batch(); !batch.empty(); batch = enumerator.move_next_batch())
+    result += sum_with_range_for(batch);
+  return result;
+}
+
+template<typename type_t>
+auto sum_with_span(const ienumerable<type_t>& items) {
+  auto span = std::span<const type_t> {};
+  if (items.try_get_span(span)) return sum_with_range_for(span);
+  return sum_with_range_for(items);
+}
+
+template<typename sum_t>
+void measure(const string& name, size count, sum_t sum) {
+  auto result = int64 {0};
+  auto watch = stopwatch::start_new();
+  for (auto iteration = 0; iteration < iteration_count; ++iteration)
+    result += sum();
+  console::write_line("{,-50} : {,6:F2} ns per element (sum = {})", name, static_cast<double>(watch.elapsed_nanoseconds()) / iteration_count / count, result);
+}
+
+auto main() -> int {
+  auto items = list<int> {};
+  for (auto index = 0; index < 100'000; ++index)
+    items.add(index);
+  auto& enumerable_items = static_cast<const ienumerable<int>&>(items);
+  auto text = basic_string<char>(100'000_z, 'x');
+  auto& enumerable_text = static_cast<const ienumerable<char>&>(text);
+  
+  measure("list<int> range-for", items.count(), [&] {return sum_with_range_for(items);});
+  measure("ienumerable<int> range-for", items.count(), [&] {return sum_with_range_for(enumerable_items);});
+  measure("ienumerable<int> move_next_batch", items.count(), [&] {return sum_with_batches(enumerable_items);});
+  measure("ienumerable<int> try_get_span", items.count(), [&] {return sum_with_span(enumerable_items);});
+  measure("basic_string<char> range-for", text.length(), [&] {return sum_with_range_for(text);});
+  measure("ienumerable<char> range-for", text.length(), [&] {return sum_with_range_for(enumerable_text);});
+  measure("ienumerable<char> move_next_batch", text.length(), [&] {return sum_with_batches(enumerable_text);});
+  measure("ienumerable<char> try_get_span", text.length(), [&] {return sum_with_span(enumerable_text);});
+}
+
+// This code can produce the following output :
+//
+// list<int> range-for                                :   1.91 ns per element (sum = 499995000000)
+// ienumerable<int> range-for                         :  23.46 ns per element (sum = 499995000000)
+// ienumerable<int> move_next_batch                   :   1.06 ns per element (sum = 499995000000)
+// ienumerable<int> try_get_span                      :   1.53 ns per element (sum = 499995000000)
+// basic_string<char> range-for                       :   1.50 ns per element (sum = 1200000000)
+// ienumerable<char> range-for                        :   9.02 ns per element (sum = 1200000000)
+// ienumerable<char> move_next_batch                  :   0.75 ns per element (sum = 1200000000)
+// ienumerable<char> try_get_span                     :   1.82 ns per element (sum = 1200000000)
@@ -0,0 +1,85 @@
+#include <xtd/diagnostics/stopwatch>
+#include <xtd/io/binary_reader>
+#include <xtd/io/binary_writer>
+#include <xtd/console>
+#include <xtd/string>
+#include <sstream>
+#include <vector>
+
+using namespace xtd;
+using namespace xtd::diagnostics;
+using namespace xtd::io;
+
+constexpr auto value_count = 2'000'000;
+
+template<typename function_t>
+void measure(const string& name, size count, function_t function) {
+  auto result = function();
+  auto watch = stopwatch::start_new();
+  result += function();
+  console::write_line("{,-43} : {,6:F2} ns per value (result = {})", name, static_cast<double>(watch.elapsed_nanoseconds()) / count, result);
+}
+
+auto main() -> int {
+  auto values = std::vector<int32> {};
+  for (auto index = 0; index < value_count; ++index)
+    values.push_back(index % 100'000 * 7919);
+  auto bytes = std::vector<xtd::byte>(value_count * sizeof(int32), 42);
+  
+  measure("binary_writer::write(int32)", values.size(), [&] {
+    auto stream = std::stringstream {};
+    auto writer = binary_writer {stream};
+    for (auto value : values)
+      writer.write(value);
+    writer.flush();
+    return static_cast<size>(stream.tellp());
+  });
+  
+  measure("binary_writer::write(std::span<const byte>)", bytes.size(), [&] {
+    auto stream = std::stringstream {};
+    auto writer = binary_writer {stream};
+    writer.write(std::span<const xtd::byte> {bytes});
+    writer.flush();
+    return static_cast<size>(stream.tellp());
+  });
+  
+  auto stream = std::stringstream {};
+  auto writer = binary_writer {stream};
+  writer.write(std::span<const xtd::byte> {reinterpret_cast<const xtd::byte*>(values.data()), values.size() * sizeof(int32)});
+  writer.flush();
+  
+  measure("binary_reader::read_int32", values.size(), [&] {
+    auto sum = int64 {0};
+    auto reader = binary_reader {stream};
+    reader.rewind();
+    for (auto index = 0; index < value_count; ++index)
+      sum += reader.read_int32();
+    return sum;
+  });
+  
+  measure("binary_reader::read_array<int32>", values.size(), [&] {
+    auto sum = int64 {0};
+    auto reader = binary_reader {stream};
+    reader.rewind();
+    auto read_values = std::vector<int32>(value_count);
+    reader.read_array(std::span<int32> {read_values});
+    for (auto value : read_values)
+      sum += value;
+    return sum;
+  });
+  
+  measure("binary_reader::read(std::span<byte>)", bytes.size(), [&] {
+    auto reader = binary_reader {stream};
+    reader.rewind();
+    auto read_bytes = std::vector<xtd::byte>(bytes.size());
+    return reader.read(std::span<xtd::byte> {read_bytes});
+  });
+}
+
+// This code can produce the following output :
+//
+// binary_writer::write(int32)                 :  11.95 ns per value (result = 16000000)
+// binary_writer::write(std::span<const byte>) :   0.59 ns per value (result = 16000000)
+// binary_reader::read_int32                   :  10.90 ns per value (result = 1583784162000000)
+// binary_reader::read_array<int32>            :   0.52 ns per value (result = 1583784162000000)
+// binary_reader::read(std::span<byte>)        :   0.09 ns per value (result = 16000000)
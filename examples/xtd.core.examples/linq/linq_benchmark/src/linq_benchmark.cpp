@@ -0,0 +1,78 @@
+#include <xtd/collections/generic/list>
+#include <xtd/linq/enumerable>
+#include <xtd/diagnostics/stopwatch>
+#include <xtd/console>
+#include <xtd/environment>
+
+using namespace xtd;
+using namespace xtd::collections::generic;
+using namespace xtd::diagnostics;
+using namespace xtd::linq;
+
+constexpr auto iteration_count = 20;
+
+template<typename function_t>
+void measure(const string& name, size count, function_t function) {
+  auto result = function();
+  auto watch = stopwatch::start_new();
+  for (auto iteration = 0; iteration < iteration_count; ++iteration)
+    result += function();
+  console::write_line("{,-45} : {,6:F2} ns per element (result = {})", name, static_cast<double>(watch.elapsed_nanoseconds()) / iteration_count / count, result);
+}
+
+auto main() -> int {
+  auto items = list<int> {};
+  for (auto index = 0; index < 1'000'000; ++index)
+    items.add(index);
+  auto& enumerable_items = static_cast<const ienumerable<int>&>(items);
+  auto is_even = [](int item) {return item % 2 == 0;};
+  auto square = [](int item) {return int64 {item} * item;};
+  
+  console::write_line("{} processor(s)", environment::processor_count());
+  console::write_line();
+  
+  measure("where + select + sum : hand-written loop", items.count(), [&] {
+    auto sum = int64 {0};
+    for (auto item : items)
+      if (is_even(item)) sum += square(item);
+    return sum;
+  });
+  measure("where + select + sum : query", items.count(), [&] {return enumerable::from(items).where(is_even).select(square).sum();});
+  measure("where + select + sum : ienumerable query", items.count(), [&] {return enumerable::from(enumerable_items).where(is_even).select(square).sum();});
+  measure("where + select + sum : parallel query", items.count(), [&] {return enumerable::from(items).as_parallel().where(is_even).select(square).sum();});
+  console::write_line();
+  
+  measure("where + select + to_list : hand-written loop", items.count(), [&] {
+    auto result = list<int64> {};
+    for (auto item : items)
+      if (is_even(item)) result.add(square(item));
+    return static_cast<int64>(result.count());
+  });
+  measure("where + select + to_list : query", items.count(), [&] {return static_cast<int64>(enumerable::from(items).where(is_even).select(square).to_list().count());});
+  measure("where + select + to_list : parallel query", items.count(), [&] {return static_cast<int64>(enumerable::from(items).as_parallel().where(is_even).select(square).to_list().count());});
+  console::write_line();
+  
+  measure("skip + take + count : hand-written loop", items.count(), [&] {
+    auto count = int64 {0};
+    for (auto iterator = items.begin() + 1'000, last = items.begin() + 501'000; iterator != last; ++iterator)
+      if (is_even(*iterator)) ++count;
+    return count;
+  });
+  measure("skip + take + count : query", items.count(), [&] {return static_cast<int64>(enumerable::from(items).skip(1'000).take(500'000).count(is_even));});
+}
+
+// This code can produce the following output :
+//
+// 1 processor(s)
+//
+// where + select + sum : hand-written loop      :   2.08 ns per element (result = 3499989500007000000)
+// where + select + sum : query                  :   1.30 ns per element (result = 3499989500007000000)
+// where + select + sum : ienumerable query      :   1.50 ns per element (result = 3499989500007000000)
+// where + select + sum : parallel query         :   1.96 ns per element (result = 3499989500007000000)
+//
+// where + select + to_list : hand-written loop  :  15.24 ns per element (result = 10500000)
+// where + select + to_list : query              :  14.00 ns per element (result = 10500000)
+// where + select + to_list : parallel query     :  17.71 ns per element (result = 10500000)
+//
+// skip + take + count : hand-written loop       :   0.79 ns per element (result = 5250000)
+// skip + take + count : query                   :   0.53 ns per element (result = 5250000)
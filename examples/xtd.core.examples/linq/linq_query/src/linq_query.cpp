@@ -0,0 +1,52 @@
+#include <xtd/collections/generic/list>
+#include <xtd/linq/enumerable>
+#include <xtd/console>
+
+using namespace xtd;
+using namespace xtd::collections::generic;
+using namespace xtd::linq;
+
+struct pet {
+  string name;
+  string owner;
+  int age = 0;
+  
+  bool operator ==(const pet& other) const = default;
+};
+
+auto main() -> int {
+  auto pets = list<pet> {{"Barley", "Ana", 8}, {"Boots", "Ben", 4}, {"Whiskers", "Ana", 1}, {"Daisy", "Carl", 4}, {"Rex", "Ben", 6}};
+  
+  console::write_line("Pets older than 3 years, by age :");
+  for (auto name : enumerable::from(pets).where([](const pet& pet) {return pet.age > 3;}).order_by([](const pet& pet) {return pet.age;}).select([](const pet& pet) {return pet.name;}))
+    console::write_line("  {}", name);
+  
+  console::write_line();
+  console::write_line("Pets by owner :");
+  for (const auto& group : enumerable::from(pets).group_by([](const pet& pet) {return pet.owner;}))
+    console::write_line("  {} : {} pet(s), {} year(s) in total", group.key(), group.count(), enumerable::from(group).select([](const pet& pet) {return pet.age;}).sum());
+  
+  console::write_line();
+  console::write_line("Oldest pet : {}", enumerable::from(pets).order_by_descending([](const pet& pet) {return pet.age;}).first().name);
+  console::write_line("Average age : {}", enumerable::from(pets).select([](const pet& pet) {return pet.age;}).average());
+  console::write_line("Squares of even numbers : {}", enumerable::range(1, 10).where([](int number) {return number % 2 == 0;}).select([](int number) {return number * number;}).to_list());
+  console::write_line("Sum of squares in parallel : {}", enumerable::range(int64 {1}, 1'000'000).as_parallel().select([](int64 number) {return number * number;}).sum());
+}
+
+// This code can produce the following output :
+//
+// Pets older than 3 years, by age :
+//   Boots
+//   Daisy
+//   Rex
+//   Barley
+//
+// Pets by owner :
+//   Ana : 2 pet(s), 9 year(s) in total
+//   Ben : 2 pet(s), 10 year(s) in total
+//   Carl : 1 pet(s), 4 year(s) in total
+//
+// Oldest pet : Barley
+// Average age : 4.6
+// Squares of even numbers : [4, 16, 36, 64, 100]
+// Sum of squares in parallel : 333333833333500000
@@ -0,0 +1,91 @@
+#include <xtd/diagnostics/stopwatch>
+#include <xtd/io/stream_writer>
+#include <xtd/net/sockets/network_stream>
+#include <xtd/net/ip_end_point>
+#include <xtd/threading/thread>
+#include <xtd/console>
+#include <vector>
+
+using namespace xtd;
+using namespace xtd::diagnostics;
+using namespace xtd::io;
+using namespace xtd::net;
+using namespace xtd::net::sockets;
+using namespace xtd::threading;
+
+constexpr auto byte_count = size_t {256} * 1024 * 1024;
+
+std::pair<socket, socket> create_loopback_connection() {
+  auto listener = socket {address_family::inter_network, socket_type::stream, protocol_type::tcp};
+  listener.bind(ip_end_point {ip_address::loopback, 0});
+  listener.listen();
+  auto client = socket {address_family::inter_network, socket_type::stream, protocol_type::tcp};
+  client.connect(ip_address::loopback, std::dynamic_pointer_cast<ip_end_point>(listener.local_end_point())->port());
+  auto server = listener.accept();
+  listener.close();
+  return {client, server};
+}
+
+// Sends byte_count bytes with the send function on one thread, receives them with a network_stream on another, and shows the throughput.
+template<typename send_t>
+void measure(const string& name, send_t send) {
+  auto [client, server] = create_loopback_connection();
+  auto watch = stopwatch::start_new();
+  auto sender = thread::start_new([&, client = client] {
+    send(client);
+  });
+  auto stream = network_stream {server, true};
+  auto buffer = std::vector<xtd::byte>(65536);
+  auto total = 0_z;
+  for (auto count = stream.read(buffer); count != 0; count = stream.read(buffer))
+    total += count;
+  sender.join();
+  console::write_line("{,-46} : {,8:F1} MB/s (received = {})", name, total / (watch.elapsed_nanoseconds() / 1'000'000'000.0) / 1'000'000, total);
+}
+
+auto main() -> int {
+  auto data = std::vector<xtd::byte>(1024 * 1024, 42);
+
+  measure("network_stream::write (64 bytes)", [&](socket client) {
+    auto stream = network_stream {client, true};
+    for (auto offset = 0_z; offset < byte_count; offset += 64)
+      stream.write(std::span<const xtd::byte> {data}.first(64));
+  });
+
+  measure("network_stream::write (4 KiB)", [&](socket client) {
+    auto stream = network_stream {client, true};
+    for (auto offset = 0_z; offset < byte_count; offset += 4096)
+      stream.write(std::span<const xtd::byte> {data}.first(4096));
+  });
+
+  measure("network_stream::write (1 MiB)", [&](socket client) {
+    auto stream = network_stream {client, true};
+    for (auto offset = 0_z; offset < byte_count; offset += data.size())
+      stream.write(data);
+  });
+
+  measure("stream_writer::write (64 characters, no flush)", [&](socket client) {
+    auto stream = network_stream {client, true};
+    stream.unsetf(std::ios_base::unitbuf);
+    auto writer = stream_writer {stream};
+    auto line = string(63, 'x');
+    for (auto offset = 0_z; offset < byte_count; offset += 64)
+      writer.write_line(line);
+    writer.flush();
+  });
+
+  measure("socket::send (4 KiB)", [&](socket client) {
+    for (auto offset = 0_z; offset < byte_count; offset += 4096)
+      client.send(data, 0, 4096, socket_flags::none);
+    client.shutdown(socket_shutdown::both);
+    client.close();
+  });
+}
+
+// This code can produce the following output :
+//
+// network_stream::write (64 bytes)               :    104.3 MB/s (received = 268435456)
+// network_stream::write (4 KiB)                  :   4167.8 MB/s (received = 268435456)
+// network_stream::write (1 MiB)                  :   5590.9 MB/s (received = 268435456)
+// stream_writer::write (64 characters, no flush) :   1783.1 MB/s (received = 268435456)
+// socket::send (4 KiB)                           :   4569.3 MB/s (received = 268435456)
@@ -0,0 +1,72 @@
+#include <xtd/diagnostics/stopwatch>
+#include <xtd/io/file>
+#include <xtd/io/path>
+#include <xtd/net/sockets/socket>
+#include <xtd/net/ip_end_point>
+#include <xtd/threading/thread>
+#include <xtd/console>
+#include <fstream>
+#include <vector>
+
+using namespace xtd;
+using namespace xtd::diagnostics;
+using namespace xtd::io;
+using namespace xtd::net;
+using namespace xtd::net::sockets;
+using namespace xtd::threading;
+
+constexpr auto file_size = size_t {256} * 1024 * 1024;
+
+std::pair<socket, socket> create_loopback_connection() {
+  auto listener = socket {address_family::inter_network, socket_type::stream, protocol_type::tcp};
+  listener.bind(ip_end_point {ip_address::loopback, 0});
+  listener.listen();
+  auto client = socket {address_family::inter_network, socket_type::stream, protocol_type::tcp};
+  client.connect(ip_address::loopback, std::dynamic_pointer_cast<ip_end_point>(listener.local_end_point())->port());
+  auto server = listener.accept();
+  listener.close();
+  return {client, server};
+}
+
+// Sends the file with the send function on one thread, drains the connection on another, and shows the throughput.
+template<typename send_t>
+void measure(const string& name, send_t send) {
+  auto [client, server] = create_loopback_connection();
+  auto watch = stopwatch::start_new();
+  auto sender = thread::start_new([&, client = client]() mutable {
+    send(client);
+    client.shutdown(socket_shutdown::both);
+    client.close();
+  });
+  auto buffer = std::vector<xtd::byte>(65536);
+  auto total = 0_z;
+  for (auto count = server.receive(buffer); count != 0; count = server.receive(buffer))
+    total += count;
+  sender.join();
+  server.close();
+  console::write_line("{,-37} : {,8:F1} MB/s (received = {})", name, total / (watch.elapsed_nanoseconds() / 1'000'000'000.0) / 1'000'000, total);
+}
+
+auto main() -> int {
+  auto file_name = path::get_temp_file_name();
+  auto content = std::vector<char>(file_size, 42);
+  std::ofstream {file_name, std::ios::binary}.write(content.data(), static_cast<std::streamsize>(content.size()));
+
+  measure("std::ifstream (64 KiB) + socket::send", [&](socket client) {
+    auto stream = std::ifstream {file_name, std::ios::binary};
+    auto buffer = std::vector<xtd::byte>(65536);
+    while (stream.read(reinterpret_cast<char*>(buffer.data()), static_cast<std::streamsize>(buffer.size())) || stream.gcount() != 0)
+      client.send(buffer, 0, static_cast<size_t>(stream.gcount()), socket_flags::none);
+  });
+
+  measure("socket::send_file", [&](socket client) {
+    client.send_file(file_name);
+  });
+
+  file::remove(file_name);
+}
+
+// This code can produce the following output :
+//
+// std::ifstream (64 KiB) + socket::send :   4823.9 MB/s (received = 268435456)
+// socket::send_file                     :   5000.2 MB/s (received = 268435456)
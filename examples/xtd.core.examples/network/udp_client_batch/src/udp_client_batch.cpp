@@ -0,0 +1,68 @@
+#include <xtd/diagnostics/stopwatch>
+#include <xtd/net/sockets/datagram_buffer>
+#include <xtd/net/sockets/socket_exception>
+#include <xtd/net/sockets/udp_client>
+#include <xtd/net/ip_end_point>
+#include <xtd/threading/thread>
+#include <xtd/console>
+
+using namespace xtd;
+using namespace xtd::diagnostics;
+using namespace xtd::net;
+using namespace xtd::net::sockets;
+using namespace xtd::threading;
+
+constexpr auto datagram_count = 200'000_z;
+constexpr auto datagram_size = 64_z;
+constexpr auto batch_size = 64_z;
+
+auto measure(const string& name, bool batch) {
+  auto receiver = udp_client {ip_end_point {ip_address::loopback, 0}};
+  receiver.client().receive_buffer_size(4 * 1024 * 1024);
+  receiver.client().receive_timeout(500);
+  auto receiver_end_point = *std::dynamic_pointer_cast<ip_end_point>(receiver.client().local_end_point());
+  
+  auto sender = thread {[&] {
+    auto udp = udp_client {};
+    if (!batch) {
+      auto datagram = std::vector<xtd::byte>(datagram_size);
+      for (auto index = 0_z; index < datagram_count; ++index)
+        udp.send(datagram, datagram.size(), receiver_end_point);
+    } else {
+      auto datagrams = std::vector<datagram_buffer>(batch_size, datagram_buffer {datagram_size});
+      for (auto& datagram : datagrams)
+        datagram.size(datagram_size).remote_end_point(receiver_end_point);
+      for (auto index = 0_z; index < datagram_count; index += batch_size)
+        udp.send_batch(datagrams);
+    }
+  }};
+  
+  auto received = 0_z;
+  auto elapsed = time_span {};
+  auto watch = stopwatch::start_new();
+  sender.start();
+  try {
+    auto remote_end_point = ip_end_point {};
+    auto datagrams = std::vector<datagram_buffer>(batch_size, datagram_buffer {datagram_size});
+    while (received < datagram_count) {
+      if (batch) received += receiver.receive_batch(datagrams);
+      else if (receiver.receive(remote_end_point).size()) ++received;
+      elapsed = watch.elapsed();
+    }
+  } catch (const socket_exception&) {
+    // The receive timed out : the operating system dropped the remaining datagrams.
+  }
+  sender.join();
+  
+  console::write_line("{} : {} datagrams received in {} ms ({} packets/s)", name, received, static_cast<int64>(elapsed.total_milliseconds()), static_cast<int64>(received / elapsed.total_seconds()));
+}
+
+auto main() -> int {
+  measure("receive/send            ", false);
+  measure("receive_batch/send_batch", true);
+}
+
+// This code can produce the following output :
+//
+// receive/send             : 200000 datagrams received in 1254 ms (159489 packets/s)
+// receive_batch/send_batch : 200000 datagrams received in 311 ms (643086 packets/s)
@@ -0,0 +1,101 @@
+#include <xtd/diagnostics/stopwatch>
+#include <xtd/console>
+#include <xtd/parse>
+#include <xtd/string>
+#include <charconv>
+#include <string>
+#include <vector>
+
+using namespace xtd;
+using namespace xtd::diagnostics;
+
+template<typename function_t>
+void measure(const string& name, size count, function_t function) {
+  auto result = function();
+  auto watch = stopwatch::start_new();
+  result += function();
+  console::write_line("{,-40} : {,7:F2} ns per value (result = {})", name, static_cast<double>(watch.elapsed_nanoseconds()) / count, result);
+}
+
+auto main() -> int {
+  auto integers = std::vector<std::string> {};
+  auto hex_integers = std::vector<std::string> {};
+  auto doubles = std::vector<std::string> {};
+  for (auto index = 0; index < 200'000; ++index) {
+    integers.push_back(std::to_string(index * 7919 - 500'000'000));
+    hex_integers.push_back(string::format("{:X}", index * 7919));
+    doubles.push_back(std::to_string((index - 100'000) * 0.731));
+  }
+  
+  measure("parse<int32>", integers.size(), [&] {
+    auto sum = int64 {0};
+    for (const auto& value : integers)
+      sum += parse<int32>(value);
+    return sum;
+  });
+  
+  measure("parse<int32> (hex_number)", hex_integers.size(), [&] {
+    auto sum = int64 {0};
+    for (const auto& value : hex_integers)
+      sum += parse<int32>(value, number_styles::hex_number);
+    return sum;
+  });
+  
+  measure("try_parse<int32> (const char*)", integers.size(), [&] {
+    auto sum = int64 {0};
+    for (const auto& value : integers) {
+      auto result = int32 {0};
+      if (try_parse(value.c_str(), result)) sum += result;
+    }
+    return sum;
+  });
+  
+  measure("std::from_chars (int32)", integers.size(), [&] {
+    auto sum = int64 {0};
+    for (const auto& value : integers) {
+      auto result = int32 {0};
+      std::from_chars(value.data(), value.data() + value.size(), result);
+      sum += result;
+    }
+    return sum;
+  });
+  
+  console::write_line();
+  
+  measure("parse<double>", doubles.size(), [&] {
+    auto sum = 0.0;
+    for (const auto& value : doubles)
+      sum += parse<double>(value);
+    return static_cast<int64>(sum);
+  });
+  
+  measure("try_parse<double> (const char*)", doubles.size(), [&] {
+    auto sum = 0.0;
+    for (const auto& value : doubles) {
+      auto result = 0.0;
+      if (try_parse(value.c_str(), result)) sum += result;
+    }
+    return static_cast<int64>(sum);
+  });
+  
+  measure("std::from_chars (double)", doubles.size(), [&] {
+    auto sum = 0.0;
+    for (const auto& value : doubles) {
+      auto result = 0.0;
+      std::from_chars(value.data(), value.data() + value.size(), result);
+      sum += result;
+    }
+    return static_cast<int64>(sum);
+  });
+}
+
+// This code can produce the following output :
+//
+// parse<int32>                             :   34.87 ns per value (result = 116758416200000)
+// parse<int32> (hex_number)                :   46.12 ns per value (result = 316758416200000)
+// try_parse<int32> (const char*)           :   36.62 ns per value (result = 116758416200000)
+// std::from_chars (int32)                  :   25.82 ns per value (result = 116758416200000)
+//
+// parse<double>                            :  149.34 ns per value (result = -146198)
+// try_parse<double> (const char*)          :   73.69 ns per value (result = -146198)
+// std::from_chars (double)                 :   34.06 ns per value (result = -146198)
@@ -0,0 +1,71 @@
+#include <xtd/basic_string>
+#include <xtd/diagnostics/stopwatch>
+#include <xtd/text/string_builder>
+#include <xtd/console>
+#include <xtd/string>
+
+using namespace xtd;
+using namespace xtd::diagnostics;
+using namespace xtd::text;
+
+constexpr auto iteration_count = 20;
+
+template<typename function_t>
+void measure(const string& name, size count, function_t function) {
+  auto result = function();
+  auto watch = stopwatch::start_new();
+  for (auto iteration = 0; iteration < iteration_count; ++iteration)
+    result += function();
+  console::write_line("{,-48} : {,6:F2} ns per character (result = {})", name, static_cast<double>(watch.elapsed_nanoseconds()) / iteration_count / count, result);
+}
+
+auto main() -> int {
+  auto ascii_words = std::basic_string<char> {};
+  auto latin_words = std::basic_string<char> {};
+  for (auto index = 0; ascii_words.size() < 1'000'000; ++index) {
+    ascii_words += index % 10 == 9 ? "The Quick Brown Fox Jumps,\n" : "over THE lazy DOG ";
+    latin_words += index % 10 == 9 ? "L'\u00C9l\u00E8ve \u00C0 l'\u00C9cole,\n" : "une cr\u00C8ME br\u00FBl\u00E9e ";
+  }
+  auto ascii_text = basic_string<char> {ascii_words};
+  auto ascii_upper_text = ascii_text.to_upper();
+  auto latin_text = basic_string<char> {latin_words};
+  auto latin_upper_text = latin_text.to_upper();
+  auto u32_text = basic_string<char32> {latin_text};
+  auto legacy_text = string {ascii_words};
+  auto legacy_upper_text = legacy_text.to_upper();
+  auto builder = string_builder {ascii_words};
+  
+  console::write_line("{} characters", ascii_text.size());
+  console::write_line();
+  
+  measure("basic_string::to_lower (ASCII)", ascii_text.size(), [&] {return static_cast<int64>(ascii_text.to_lower().size());});
+  measure("basic_string::to_upper (ASCII)", ascii_text.size(), [&] {return static_cast<int64>(ascii_text.to_upper().size());});
+  measure("basic_string::to_lower (UTF-8 Latin)", latin_text.size(), [&] {return static_cast<int64>(latin_text.to_lower().size());});
+  measure("basic_string<char32>::to_lower", u32_text.size(), [&] {return static_cast<int64>(u32_text.to_lower().size());});
+  measure("basic_string::compare (ASCII, ignore case)", ascii_text.size(), [&] {return static_cast<int64>(basic_string<char>::compare(ascii_text, ascii_upper_text, true));});
+  measure("basic_string::equals (UTF-8 Latin, ignore case)", latin_text.size(), [&] {return static_cast<int64>(latin_text.equals(latin_upper_text, true));});
+  measure("basic_string::starts_with (ignore case)", ascii_text.size(), [&] {return static_cast<int64>(ascii_text.starts_with("OVER the", true));});
+  measure("basic_string::ends_with (ignore case)", ascii_text.size(), [&] {return static_cast<int64>(ascii_text.ends_with("lazy dog ", true));});
+  console::write_line();
+  
+  measure("string::to_lower", legacy_text.size(), [&] {return static_cast<int64>(legacy_text.to_lower().size());});
+  measure("string::compare (ignore case)", legacy_text.size(), [&] {return static_cast<int64>(string::compare(legacy_text, legacy_upper_text, true));});
+  measure("string_builder::to_lower (in place)", builder.size(), [&] {return static_cast<int64>(builder.to_lower().size());});
+}
+
+// This code can produce the following output :
+//
+// 1000017 characters
+//
+// basic_string::to_lower (ASCII)                   :   0.39 ns per character (result = 21000357)
+// basic_string::to_upper (ASCII)                   :   0.59 ns per character (result = 21000357)
+// basic_string::to_lower (UTF-8 Latin)             :   4.31 ns per character (result = 22555953)
+// basic_string<char32>::to_lower                   :   3.67 ns per character (result = 19111449)
+// basic_string::compare (ASCII, ignore case)       :   0.54 ns per character (result = 0)
+// basic_string::equals (UTF-8 Latin, ignore case)  :   6.12 ns per character (result = 21)
+// basic_string::starts_with (ignore case)          :   0.00 ns per character (result = 21)
+// basic_string::ends_with (ignore case)            :   0.00 ns per character (result = 21)
+//
+// string::to_lower                                 :   0.60 ns per character (result = 21000357)
+// string::compare (ignore case)                    :   0.72 ns per character (result = 0)
+// string_builder::to_lower (in place)              :   0.44 ns per character (result = 21000357)
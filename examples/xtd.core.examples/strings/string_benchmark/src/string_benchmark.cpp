@@ -0,0 +1,65 @@
+#include <xtd/basic_string>
+#include <xtd/diagnostics/stopwatch>
+#include <xtd/console>
+#include <xtd/string>
+
+using namespace xtd;
+using namespace xtd::diagnostics;
+
+constexpr auto iteration_count = 20;
+
+template<typename function_t>
+void measure(const string& name, size count, function_t function) {
+  auto result = function();
+  auto watch = stopwatch::start_new();
+  for (auto iteration = 0; iteration < iteration_count; ++iteration)
+    result += function();
+  console::write_line("{,-36} : {,6:F2} ns per character (result = {})", name, static_cast<double>(watch.elapsed_nanoseconds()) / iteration_count / count, result);
+}
+
+auto main() -> int {
+  auto words = std::basic_string<char> {};
+  for (auto index = 0; words.size() < 1'000'000; ++index)
+    words += index % 10 == 9 ? "the quick brown fox jumps,\n" : "over the lazy dog ";
+  auto text = basic_string<char> {words};
+  auto legacy_text = string {words};
+  auto padded_text = string {std::basic_string<char>(100'000, ' ') + "text" + std::basic_string<char>(100'000, ' ')};
+  
+  console::write_line("{} characters", text.size());
+  console::write_line();
+  
+  measure("basic_string::index_of (char)", text.size(), [&] {return static_cast<int64>(text.index_of('#') == text.npos);});
+  measure("basic_string::index_of (string)", text.size(), [&] {return static_cast<int64>(text.index_of("jumps over the cat") == text.npos);});
+  measure("basic_string::contains", text.size(), [&] {return static_cast<int64>(text.contains("lazy cat"));});
+  measure("basic_string::index_of_any", text.size(), [&] {return static_cast<int64>(text.index_of_any({'#', '@', '$'}) == text.npos);});
+  measure("basic_string::last_index_of_any", text.size(), [&] {return static_cast<int64>(text.last_index_of_any({'#', '@', '$'}) == text.npos);});
+  measure("basic_string::split", text.size(), [&] {return static_cast<int64>(text.split({' ', ',', '\n'}).size());});
+  measure("basic_string::split_view", text.size(), [&] {return static_cast<int64>(text.split_view({' ', ',', '\n'}).size());});
+  measure("basic_string::replace (char)", text.size(), [&] {return static_cast<int64>(text.replace(',', ';').size());});
+  measure("basic_string::replace (string)", text.size(), [&] {return static_cast<int64>(text.replace("fox", "kitten").size());});
+  console::write_line();
+  
+  measure("string::index_of_any", legacy_text.size(), [&] {return static_cast<int64>(legacy_text.index_of_any({'#', '@', '$'}) == legacy_text.npos);});
+  measure("string::split", legacy_text.size(), [&] {return static_cast<int64>(legacy_text.split({' ', ',', '\n'}).size());});
+  measure("string::replace (string)", legacy_text.size(), [&] {return static_cast<int64>(legacy_text.replace("fox", "kitten").size());});
+  measure("string::trim", padded_text.size(), [&] {return static_cast<int64>(padded_text.trim().size());});
+}
+
+// This code can produce the following output :
+//
+// 1000017 characters
+//
+// basic_string::index_of (char)        :   0.02 ns per character (result = 21)
+// basic_string::index_of (string)      :   0.08 ns per character (result = 21)
+// basic_string::contains               :   0.82 ns per character (result = 0)
+// basic_string::index_of_any           :   0.90 ns per character (result = 21)
+// basic_string::last_index_of_any      :   0.85 ns per character (result = 21)
+// basic_string::split                  :  75.64 ns per character (result = 4666746)
+// basic_string::split_view             :   5.64 ns per character (result = 4666746)
+// basic_string::replace (char)         :   0.12 ns per character (result = 21000357)
+// basic_string::replace (string)       :   0.24 ns per character (result = 21333690)
+//
+// string::index_of_any                 :   0.85 ns per character (result = 21)
+// string::split                        :  25.49 ns per character (result = 4666746)
+// string::replace (string)             :   0.48 ns per character (result = 21333690)
+// string::trim                         :   2.04 ns per character (result = 84)
@@ -0,0 +1,96 @@
+#include <xtd/basic_string>
+#include <xtd/diagnostics/stopwatch>
+#include <xtd/text/unicode/utf8>
+#include <xtd/console>
+#include <vector>
+
+using namespace xtd;
+using namespace xtd::diagnostics;
+using namespace xtd::text::unicode;
+
+constexpr auto iteration_count = 20;
+
+template<typename function_t>
+void measure(const string& name, size count, function_t function) {
+  auto result = function();
+  auto watch = stopwatch::start_new();
+  for (auto iteration = 0; iteration < iteration_count; ++iteration)
+    result += function();
+  console::write_line("{,-36} : {,6:F2} ns per character (result = {})", name, static_cast<double>(watch.elapsed_nanoseconds()) / iteration_count / count, result);
+}
+
+void measure_corpus(const string& corpus_name, const std::basic_string<char>& words) {
+  auto utf8_text = basic_string<char> {words};
+  auto utf16_text = basic_string<char16> {utf8_text};
+  auto utf32_text = basic_string<char32> {utf8_text};
+  auto wide_text = basic_string<wchar> {utf8_text};
+  auto count = utf32_text.size();
+  auto destination = std::vector<char16>(utf8::get_char16_count(utf8_text.chars()));
+  
+  console::write_line("{} : {} characters, {} UTF-8 bytes", corpus_name, count, utf8_text.size());
+  measure("UTF-8 to UTF-16", count, [&] {return static_cast<int64>(basic_string<char16> {utf8_text}.size());});
+  measure("UTF-16 to UTF-8", count, [&] {return static_cast<int64>(basic_string<char> {utf16_text}.size());});
+  measure("UTF-8 to UTF-32", count, [&] {return static_cast<int64>(basic_string<char32> {utf8_text}.size());});
+  measure("UTF-32 to UTF-8", count, [&] {return static_cast<int64>(basic_string<char> {utf32_text}.size());});
+  measure("UTF-16 to UTF-32", count, [&] {return static_cast<int64>(basic_string<char32> {utf16_text}.size());});
+  measure("UTF-8 to wchar", count, [&] {return static_cast<int64>(basic_string<wchar> {utf8_text}.size());});
+  measure("wchar to UTF-8", count, [&] {return static_cast<int64>(basic_string<char> {wide_text}.size());});
+  measure("utf8::to_utf16 (span to span)", count, [&] {
+    auto bytes_read = size {0};
+    auto chars_written = size {0};
+    utf8::to_utf16(utf8_text.chars(), destination, bytes_read, chars_written);
+    return static_cast<int64>(chars_written);
+  });
+  measure("utf8::is_valid", count, [&] {return static_cast<int64>(utf8::is_valid(utf8_text.chars()));});
+  console::write_line();
+}
+
+auto main() -> int {
+  auto ascii_words = std::basic_string<char> {};
+  auto latin_words = std::basic_string<char> {};
+  auto cjk_words = std::basic_string<char> {};
+  for (auto index = 0; ascii_words.size() < 1'000'000; ++index) {
+    ascii_words += index % 10 == 9 ? "The Quick Brown Fox Jumps,\n" : "over THE lazy DOG ";
+    latin_words += index % 10 == 9 ? "L'Élève À l'École,\n" : "une crème brûlée ";
+    cjk_words += index % 10 == 9 ? "敦捉狐狸。\n" : "敏捷的棕色狐狸 ";
+  }
+  
+  measure_corpus("ASCII", ascii_words);
+  measure_corpus("Latin", latin_words);
+  measure_corpus("CJK", cjk_words);
+}
+
+// This code can produce the following output :
+//
+// ASCII : 1000017 characters, 1000017 UTF-8 bytes
+// UTF-8 to UTF-16                      :   1.70 ns per character (result = 21000357)
+// UTF-16 to UTF-8                      :   3.63 ns per character (result = 21000357)
+// UTF-8 to UTF-32                      :   1.14 ns per character (result = 21000357)
+// UTF-32 to UTF-8                      :   2.49 ns per character (result = 21000357)
+// UTF-16 to UTF-32                     :   2.31 ns per character (result = 21000357)
+// UTF-8 to wchar                       :   1.40 ns per character (result = 21000357)
+// wchar to UTF-8                       :   4.46 ns per character (result = 21000357)
+// utf8::to_utf16 (span to span)        :   1.14 ns per character (result = 21000357)
+// utf8::is_valid                       :   0.09 ns per character (result = 21)
+//
+// Latin : 910069 characters, 1074093 UTF-8 bytes
+// UTF-8 to UTF-16                      :   3.54 ns per character (result = 19111449)
+// UTF-16 to UTF-8                      :   6.02 ns per character (result = 22555953)
+// UTF-8 to UTF-32                      :   3.20 ns per character (result = 19111449)
+// UTF-32 to UTF-8                      :   4.19 ns per character (result = 22555953)
+// UTF-16 to UTF-32                     :   3.51 ns per character (result = 19111449)
+// UTF-8 to wchar                       :   2.24 ns per character (result = 19111449)
+// wchar to UTF-8                       :   3.52 ns per character (result = 22555953)
+// utf8::to_utf16 (span to span)        :   3.38 ns per character (result = 19111449)
+// utf8::is_valid                       :   1.47 ns per character (result = 21)
+//
+// CJK : 412706 characters, 1132296 UTF-8 bytes
+// UTF-8 to UTF-16                      :   9.31 ns per character (result = 8666826)
+// UTF-16 to UTF-8                      :   8.13 ns per character (result = 23778216)
+// UTF-8 to UTF-32                      :   7.03 ns per character (result = 8666826)
+// UTF-32 to UTF-8                      :   6.06 ns per character (result = 23778216)
+// UTF-16 to UTF-32                     :   6.39 ns per character (result = 8666826)
+// UTF-8 to wchar                       :   7.52 ns per character (result = 8666826)
+// wchar to UTF-8                       :   8.13 ns per character (result = 23778216)
+// utf8::to_utf16 (span to span)        :   8.82 ns per character (result = 8666826)
+// utf8::is_valid                       :   6.43 ns per character (result = 21)
@@ -0,0 +1,64 @@
+#include <xtd/diagnostics/stopwatch>
+#include <xtd/threading/monitor>
+#include <xtd/threading/thread>
+#include <xtd/console>
+#include <array>
+#include <mutex>
+#include <vector>
+
+using namespace xtd;
+using namespace xtd::diagnostics;
+using namespace xtd::threading;
+
+constexpr auto operation_count = 400'000;
+
+// Runs the operation on thread_count threads, each one operation_count / thread_count times, and returns the time per operation.
+template<typename operation_t>
+double measure(int32 thread_count, operation_t operation) {
+  auto threads = std::vector<thread> {};
+  auto watch = stopwatch::start_new();
+  for (auto index = 0; index < thread_count; ++index)
+    threads.push_back(thread::start_new([&, index] {
+      for (auto iteration = 0; iteration < operation_count / thread_count; ++iteration)
+        operation(index);
+    }));
+  for (auto& thread : threads)
+    thread.join();
+  return static_cast<double>(watch.elapsed_nanoseconds()) / operation_count;
+}
+
+auto main() -> int {
+  auto shared_object = object {};
+  auto distinct_objects = std::array<object, 64> {};
+  auto shared_mutex = std::mutex {};
+  auto counter = 0_z;
+  
+  console::write_line("{,7} | {,24} | {,24} | {,24}", "threads", "monitor shared object", "monitor distinct objects", "std::mutex shared");
+  for (auto thread_count : {1, 2, 4, 8, 16, 32, 64}) {
+    auto shared = measure(thread_count, [&](int32) {
+      monitor::enter(shared_object);
+      ++counter;
+      monitor::exit(shared_object);
+    });
+    auto distinct = measure(thread_count, [&](int32 index) {
+      monitor::enter(distinct_objects[index]);
+      monitor::exit(distinct_objects[index]);
+    });
+    auto reference = measure(thread_count, [&](int32) {
+      auto lock = std::lock_guard<std::mutex> {shared_mutex};
+      ++counter;
+    });
+    console::write_line("{,7} | {,21:F1} ns | {,21:F1} ns | {,21:F1} ns", thread_count, shared, distinct, reference);
+  }
+}
+
+// This code can produce the following output :
+//
+// threads |    monitor shared object | monitor distinct objects |        std::mutex shared
+//       1 |                 120.0 ns |                 128.4 ns |                  23.8 ns
+//       2 |                 120.3 ns |                 123.0 ns |                  33.9 ns
+//       4 |                 121.3 ns |                 131.3 ns |                  24.0 ns
+//       8 |                 131.9 ns |                 126.5 ns |                  34.5 ns
+//      16 |                 115.0 ns |                 124.6 ns |                  32.9 ns
+//      32 |                 127.3 ns |                 129.5 ns |                  25.4 ns
+//      64 |                 135.6 ns |                 123.9 ns |                  38.7 ns
@@ -0,0 +1,51 @@
+#define __XTD_CORE_NATIVE_LIBRARY__
+#include <xtd/native/memory_mapped_file>
+#undef __XTD_CORE_NATIVE_LIBRARY__
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+using namespace xtd::native;
+
+bool memory_mapped_file::advise(void* address, size_t size, int32_t advice) {
+  static constexpr int advices[] = {MADV_NORMAL, MADV_SEQUENTIAL, MADV_RANDOM, MADV_WILLNEED, MADV_DONTNEED};
+  if (advice < 0 || advice >= static_cast<int32_t>(sizeof(advices) / sizeof(advices[0]))) return false;
+  return madvise(address, size, advices[advice]) == 0;
+}
+
+size_t memory_mapped_file::allocation_granularity() {
+  return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+}
+
+void memory_mapped_file::close(intmax_t handle) {
+  if (handle != -1) ::close(static_cast<int>(handle));
+}
+
+bool memory_mapped_file::flush(void* address, size_t size) {
+  return msync(address, size, MS_SYNC) == 0;
+}
+
+void* memory_mapped_file::map(intmax_t handle, size_t offset, size_t size, bool writable) {
+  auto address = mmap(nullptr, size, writable ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, static_cast<int>(handle), static_cast<off_t>(offset));
+  return address == MAP_FAILED ? nullptr : address;
+}
+
+intmax_t memory_mapped_file::open(const std::string& path, bool writable) {
+  return ::open(path.c_str(), (writable ? O_RDWR : O_RDONLY) | O_CLOEXEC);
+}
+
+bool memory_mapped_file::set_size(intmax_t handle, size_t size) {
+  return ftruncate(static_cast<int>(handle), static_cast<off_t>(size)) == 0;
+}
+
+size_t memory_mapped_file::size(intmax_t handle) {
+  using struct_stat = struct stat;
+  auto status = struct_stat {};
+  if (fstat(static_cast<int>(handle), &status) != 0) return 0;
+  return static_cast<size_t>(status.st_size);
+}
+
+bool memory_mapped_file::unmap(void* address, size_t size) {
+  return munmap(address, size) == 0;
+}
@@ -9,20 +9,36 @@
 #include <xtd/native/socket_shutdown_constants>
 #include <xtd/native/socket_type_constants>
 #undef __XTD_CORE_NATIVE_LIBRARY__
+#include <algorithm>
+#include <atomic>
 #include <map>
+#include <cstring>
 #include <errno.h>
 #include <fcntl.h>
+#include <limits.h>
 #include <poll.h>
 #include <unistd.h>
 #include <netinet/in.h>
+#include <netinet/udp.h>
 #include <sys/select.h>
+#include <sys/sendfile.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <sys/ioctl.h>
 
 using namespace std;
 using namespace xtd::native;
 
 namespace {
+  // select_mode_constants values index these tables.
+  static constexpr int16_t poll_events[] = {POLLIN, POLLOUT, POLLPRI};
+  // Like select, a socket is readable or writable when an error or a hang up is pending, so that the next call reports it.
+  static constexpr int16_t poll_ready_events[] = {POLLIN | POLLHUP | POLLERR, POLLOUT | POLLHUP | POLLERR, POLLPRI | POLLERR};
+
+  static int32_t to_poll_timeout(int32_t microseconds) {
+    return microseconds < 0 ? -1 : microseconds / 1000 + (microseconds % 1000 != 0 ? 1 : 0);
+  }
+
   static int32_t native_to_socket_error(int32_t error) {
     static auto socket_errors = map<int32_t, int32_t> {{0, SOCKET_ERROR_SUCCESS}, {EINTR, SOCKET_ERROR_INTERRUPTED}, {EACCES, SOCKET_ERROR_ACCESS_DENIED}, {EFAULT, SOCKET_ERROR_FAULT}, {EINVAL, SOCKET_ERROR_INVALID_ARGUMENT}, {EMFILE, SOCKET_ERROR_TOO_MANY_OPEN_SOCKETS}, {EAGAIN, SOCKET_ERROR_WOULD_BLOCK}, {EINPROGRESS, SOCKET_ERROR_IN_PROGRESS}, {EALREADY, SOCKET_ERROR_ALREADY_IN_PROGRESS}, {ENOTSOCK, SOCKET_ERROR_NOT_SOCKET}, {EDESTADDRREQ, SOCKET_ERROR_DESTINATION_ADDRESS_REQUIRED}, {EMSGSIZE, SOCKET_ERROR_MESSAGE_SIZE}, {EPROTOTYPE, SOCKET_ERROR_PROTOCOL_TYPE}, {ENOPROTOOPT, SOCKET_ERROR_PROTOCOL_OPTION}, {EPROTONOSUPPORT, SOCKET_ERROR_PROTOCOL_NOT_SUPPORTED}, {ESOCKTNOSUPPORT, SOCKET_ERROR_SOCKET_NOT_SUPPORTED}, {ENOTSUP, SOCKET_ERROR_OPERATION_NOT_SUPPORTED}, {EPFNOSUPPORT, SOCKET_ERROR_PROTOCOL_FAMILY_NOT_SUPPORTED}, {EAFNOSUPPORT, SOCKET_ERROR_ADDRESS_FAMILY_NOT_SUPPORTED}, {EADDRINUSE, SOCKET_ERROR_ADDRESS_ALREADY_IN_USE}, {EADDRNOTAVAIL, SOCKET_ERROR_ADDRESS_NOT_AVAILABLE}, {ENETDOWN, SOCKET_ERROR_NETWORK_DOWN}, {ENETUNREACH, SOCKET_ERROR_NETWORK_UNREACHABLE}, {ENETRESET, SOCKET_ERROR_NETWORK_RESET}, {ECONNABORTED, SOCKET_ERROR_CONNECTION_ABORTED}, {ECONNRESET, SOCKET_ERROR_CONNECTION_RESET}, {ENOBUFS, SOCKET_ERROR_NO_BUFFER_SPACE_AVAILABLE}, {EISCONN, SOCKET_ERROR_IS_CONNECTED}, {ENOTCONN, SOCKET_ERROR_NOT_CONNECTED}, {ESHUTDOWN, SOCKET_ERROR_SHUTDOWN}, {ETIMEDOUT, SOCKET_ERROR_TIMED_OUT}, {ECONNREFUSED, SOCKET_ERROR_CONNECTION_REFUSED}, {EHOSTDOWN, SOCKET_ERROR_HOST_DOWN}, {EHOSTUNREACH, SOCKET_ERROR_HOST_UNREACHABLE}, {EOPNOTSUPP, SOCKET_ERROR_SOCKET_NOT_SUPPORTED}};
     auto it = socket_errors.find(error);
@@ -57,6 +73,61 @@ namespace {
     if (it == socket_types.end()) return SOCK_STREAM;
     return it->second;
   }
+
+#if defined(IOV_MAX)
+  static constexpr size_t max_io_vectors = IOV_MAX;
+#else
+  static constexpr size_t max_io_vectors = 16;
+#endif
+
+  // recvmmsg and sendmmsg handle at most UIO_MAXIOV messages per call.
+  static constexpr size_t max_messages = 1024;
+  // UDP_SEGMENT limits : at most 64 segments, and the whole payload must fit in one IPv6 packet.
+  static constexpr size_t max_segments = 64;
+  static constexpr size_t max_segmented_size = 0xFFFF - 40 - 8;
+  static atomic<bool> segmentation_offload_supported {true};
+
+  // A blocking socket reports EAGAIN when its receive timeout expires, and a non-blocking socket when no data is available.
+  static bool is_blocking(intmax_t handle) {
+    auto error = errno;
+    auto flags = fcntl(static_cast<int32_t>(handle), F_GETFL, 0);
+    errno = error;
+    return flags != -1 && (flags & O_NONBLOCK) == 0;
+  }
+
+  // Waits until the socket can send, at most its send timeout : ETIMEDOUT is reported when the timeout expires.
+  static bool wait_writable(int32_t handle) {
+    auto timeout = timeval {};
+    auto timeout_length = static_cast<socklen_t>(sizeof(timeout));
+    auto milliseconds = -1;
+    if (::getsockopt(handle, SOL_SOCKET, SO_SNDTIMEO, &timeout, &timeout_length) == 0 && (timeout.tv_sec != 0 || timeout.tv_usec != 0))
+      milliseconds = static_cast<int32_t>(min<int64_t>(max<int64_t>(static_cast<int64_t>(timeout.tv_sec) * 1000 + timeout.tv_usec / 1000, 1), INT32_MAX));
+    auto descriptor = pollfd {handle, POLLOUT, 0};
+    auto result = 0;
+    while ((result = ::poll(&descriptor, 1, milliseconds)) == -1 && errno == EINTR);
+    if (result == 0) errno = ETIMEDOUT;
+    return result == 1;
+  }
+
+  static int64_t copy_file_to_socket(int32_t handle, int32_t file, int64_t offset, int64_t count) {
+    auto buffer = vector<uint8_t>(65536);
+    auto sent = int64_t {0};
+    while (count < 0 || sent < count) {
+      auto size = count < 0 ? buffer.size() : static_cast<size_t>(min<int64_t>(count - sent, buffer.size()));
+      auto read = ::pread(file, buffer.data(), size, static_cast<off_t>(offset + sent));
+      if (read == -1 && errno == EINTR) continue;
+      if (read == -1) return -1;
+      if (read == 0) break;
+      for (auto written = ssize_t {0}; written < read;) {
+        auto result = ::send(handle, buffer.data() + written, static_cast<size_t>(read - written), 0);
+        if (result == -1 && (errno == EINTR || (errno == EAGAIN && wait_writable(handle)))) continue;
+        if (result == -1) return -1;
+        written += result;
+      }
+      sent += read;
+    }
+    return sent;
+  }
 }
 
 int32_t socket::address_family_to_native(int32_t address_family) {
@@ -128,6 +199,11 @@ int32_t socket::get_raw_socket_option(intmax_t handle, int32_t socket_option_lev
   return ::getsockopt(static_cast<int32_t>(handle), socket_option_level, socket_option_name, reinterpret_cast<void*>(option), reinterpret_cast<socklen_t*>(&option_length));
 }
 
+int32_t socket::get_socket_name(intmax_t handle, vector<uint8_t>& socket_address) {
+  auto address_length = static_cast<socklen_t>(socket_address.size());
+  return ::getsockname(static_cast<int32_t>(handle), reinterpret_cast<sockaddr*>(socket_address.data()), &address_length);
+}
+
 int32_t socket::get_socket_option(intmax_t handle, int32_t socket_option_level, int32_t socket_option_name, intmax_t option, size_t& option_length) {
   if (socket_option_name_to_native(socket_option_name) == -1) {
     errno = ENOTSUP;
@@ -195,86 +271,249 @@ int32_t socket::listen(intmax_t handle, size_t backlog) {
 }
 
 int32_t socket::poll(intmax_t handle, int32_t microseconds, int32_t mode) {
-  if (handle == 0 || microseconds < 0) return -1;
-
-  auto poll_fd = pollfd {};
-  poll_fd.fd = static_cast<int32_t>(handle);
-  switch (mode) {
-    case SELECT_MODE_READ: poll_fd.events = POLLIN; break;
-    case SELECT_MODE_WRITE: poll_fd.events = POLLOUT; break;
-    case SELECT_MODE_ERROR: poll_fd.events = POLLERR; break;
-    default: return -1;
+  if (handle == 0 || mode < SELECT_MODE_READ || mode > SELECT_MODE_ERROR) return -1;
+
+  auto poll_fd = pollfd {static_cast<int32_t>(handle), poll_events[mode], 0};
+  auto result = ::poll(&poll_fd, 1, to_poll_timeout(microseconds));
+  if (result <= 0) return result;
+  if ((poll_fd.revents & POLLNVAL) == POLLNVAL) {
+    errno = EBADF;
+    return -1;
   }
-  return ::poll(&poll_fd, 1, microseconds);
+  return (poll_fd.revents & poll_ready_events[mode]) != 0 ? 1 : 0;
 }
 
 int32_t socket::receive(intmax_t handle, vector<uint8_t>& buffer, size_t offset, size_t size, int32_t flags) {
   auto result = static_cast<int32_t>(::recv(static_cast<int32_t>(handle), &buffer.data()[offset], size, flags));
   if (result == -1 && errno == EBADF) errno = EINTR;
-  if (result == -1 && errno == EAGAIN) errno = ETIMEDOUT;
+  if (result == -1 && errno == EAGAIN && is_blocking(handle)) errno = ETIMEDOUT;
   return result;
 }
 
+int32_t socket::receive(intmax_t handle, const vector<pair<uint8_t*, size_t>>& buffers, int32_t flags) {
+  // recvmsg takes at most max_io_vectors buffers : the next buffers are filled, without waiting, only while the previous ones are full.
+  thread_local auto vectors = vector<iovec> {};
+  auto received = size_t {0};
+  for (auto first = size_t {0}; first < buffers.size(); first += max_io_vectors) {
+    vectors.clear();
+    auto size = size_t {0};
+    for (auto index = first; index < buffers.size() && index < first + max_io_vectors; ++index) {
+      vectors.push_back({buffers[index].first, buffers[index].second});
+      size += buffers[index].second;
+    }
+    if (first != 0 && received + size > INT32_MAX) break;
+    auto message = msghdr {};
+    message.msg_iov = vectors.data();
+    message.msg_iovlen = static_cast<decltype(message.msg_iovlen)>(vectors.size());
+    auto result = ::recvmsg(static_cast<int32_t>(handle), &message, first == 0 ? flags : flags | MSG_DONTWAIT);
+    if (result == -1 && first != 0) break;
+    if (result == -1 && errno == EBADF) errno = EINTR;
+    if (result == -1 && errno == EAGAIN && is_blocking(handle)) errno = ETIMEDOUT;
+    if (result == -1) return -1;
+    received += static_cast<size_t>(result);
+    if (static_cast<size_t>(result) < size) break;
+  }
+  return static_cast<int32_t>(min<size_t>(received, INT32_MAX));
+}
+
 int32_t socket::receive_from(intmax_t handle, vector<uint8_t>& buffer, size_t offset, size_t size, int32_t flags, vector<uint8_t>& socket_address) {
   auto address_length = static_cast<socklen_t>(socket_address.size());
   auto result = static_cast<int32_t>(::recvfrom(static_cast<int32_t>(handle), &buffer.data()[offset], size, flags, reinterpret_cast<sockaddr*>(socket_address.data()), &address_length));
   //if (socket_address.size() != address_length) socket_address.resize(address_length);
 
   if (result == -1 && errno == EBADF) errno = EINTR;
-  if (result == -1 && errno == EAGAIN) errno = ETIMEDOUT;
+  if (result == -1 && errno == EAGAIN && is_blocking(handle)) errno = ETIMEDOUT;
   return result;
 }
 
-int32_t socket::select(vector<intmax_t>& check_read, vector<intmax_t>& check_write, vector<intmax_t>& check_error, int32_t microseconds) {
-  size_t nfds = 0;
-
-  auto read_fds = fd_set {};
-  FD_ZERO(&read_fds);
-  for (auto i = 0U; i < check_read.size() && i < FD_SETSIZE; i++)
-    FD_SET(static_cast<int32_t>(check_read[i]), &read_fds);
-  if (check_read.size() > nfds) nfds = check_read.size();
-
-  auto write_fds = fd_set {};
-  FD_ZERO(&write_fds);
-  for (auto i = 0U; i < check_write.size() && i < FD_SETSIZE; i++)
-    FD_SET(static_cast<int32_t>(check_write[i]), &write_fds);
-  if (check_write.size() > nfds) nfds = check_write.size();
-
-  auto error_fds = fd_set {};
-  FD_ZERO(&error_fds);
-  for (auto i = 0U; i < check_error.size() && i < FD_SETSIZE; i++)
-    FD_SET(static_cast<int32_t>(check_error[i]), &error_fds);
-  if (check_error.size() > nfds) nfds = check_error.size();
-
-  auto timeout = timeval {microseconds / 1000000, microseconds % 1000000};
-  auto result = ::select(static_cast<int32_t>(nfds + 1), &read_fds, &write_fds, &error_fds, microseconds == -1 ? nullptr : &timeout);
-
-  for (auto i = 0U; i < check_read.size(); i++) {
-    FD_CLR(static_cast<int32_t>(check_read[i]), &read_fds);
-    if (FD_ISSET(static_cast<int32_t>(check_read[i]), &read_fds) == 0) check_read[i] = 0;
-  }
-
-  for (auto i = 0U; i < check_write.size(); i++) {
-    FD_CLR(static_cast<int32_t>(check_write[i]), &write_fds);
-    if (FD_ISSET(static_cast<int32_t>(check_write[i]), &write_fds) == 0) check_write[i] = 0;
+int32_t socket::receive_from(intmax_t handle, const vector<pair<uint8_t*, size_t>>& buffers, const vector<pair<uint8_t*, size_t>>& socket_addresses, vector<pair<size_t, size_t>>& sizes, int32_t flags) {
+  static constexpr auto control_size = CMSG_SPACE(sizeof(int32_t));
+  thread_local auto vectors = vector<iovec> {};
+  thread_local auto messages = vector<mmsghdr> {};
+  thread_local auto controls = vector<uint8_t> {};
+  auto count = min(buffers.size(), max_messages);
+  vectors.resize(count);
+  messages.assign(count, mmsghdr {});
+  controls.assign(count * control_size, 0);
+  for (auto index = size_t {0}; index < count; ++index) {
+    vectors[index] = {buffers[index].first, buffers[index].second};
+    messages[index].msg_hdr.msg_iov = &vectors[index];
+    messages[index].msg_hdr.msg_iovlen = 1;
+    messages[index].msg_hdr.msg_name = socket_addresses[index].first;
+    messages[index].msg_hdr.msg_namelen = static_cast<socklen_t>(socket_addresses[index].second);
+    messages[index].msg_hdr.msg_control = controls.data() + index * control_size;
+    messages[index].msg_hdr.msg_controllen = control_size;
   }
 
-  for (auto i = 0U; i < check_error.size(); i++) {
-    FD_CLR(static_cast<int32_t>(check_error[i]), &error_fds);
-    if (FD_ISSET(static_cast<int32_t>(check_error[i]), &error_fds) == 0) check_error[i] = 0;
+  auto result = static_cast<int32_t>(::recvmmsg(static_cast<int32_t>(handle), messages.data(), static_cast<uint32_t>(count), flags | MSG_WAITFORONE, nullptr));
+  if (result == -1 && errno == EBADF) errno = EINTR;
+  if (result == -1 && errno == EAGAIN && is_blocking(handle)) errno = ETIMEDOUT;
+  if (result == -1) return result;
+
+  sizes.resize(static_cast<size_t>(result));
+  for (auto index = size_t {0}; index < sizes.size(); ++index) {
+    auto size = (messages[index].msg_hdr.msg_flags & MSG_TRUNC) ? buffers[index].second + 1 : static_cast<size_t>(messages[index].msg_len);
+    sizes[index] = {size, size};
+    for (auto control = CMSG_FIRSTHDR(&messages[index].msg_hdr); control; control = CMSG_NXTHDR(&messages[index].msg_hdr, control)) {
+      if (control->cmsg_level != SOL_UDP || control->cmsg_type != UDP_GRO) continue;
+      auto segment_size = int32_t {0};
+      memcpy(&segment_size, CMSG_DATA(control), sizeof(segment_size));
+      if (segment_size > 0) sizes[index].second = min(size, static_cast<size_t>(segment_size));
+    }
   }
-
   return result;
 }
 
+int32_t socket::select(vector<intmax_t>& check_read, vector<intmax_t>& check_write, vector<intmax_t>& check_error, int32_t microseconds) {
+  // poll has no FD_SETSIZE limit and its cost depends only on the number of sockets checked.
+  static thread_local auto poll_fds = vector<pollfd> {};
+  poll_fds.clear();
+  auto add_handles = [](const vector<intmax_t>& handles, int32_t mode) {
+    for (auto handle : handles)
+      poll_fds.push_back(pollfd {static_cast<int32_t>(handle), poll_events[mode], 0});
+  };
+  add_handles(check_read, SELECT_MODE_READ);
+  add_handles(check_write, SELECT_MODE_WRITE);
+  add_handles(check_error, SELECT_MODE_ERROR);
+
+  auto result = 0;
+  do {
+    result = ::poll(poll_fds.data(), static_cast<nfds_t>(poll_fds.size()), to_poll_timeout(microseconds));
+  } while (result == -1 && errno == EINTR);
+  if (result == -1) return -1;
+
+  auto count = 0;
+  auto index = size_t {0};
+  auto update_handles = [&](vector<intmax_t>& handles, int32_t mode) {
+    for (auto& handle : handles) {
+      auto revents = poll_fds[index++].revents;
+      if ((revents & POLLNVAL) == POLLNVAL) count = -1;
+      if (count != -1 && (revents & poll_ready_events[mode]) != 0) ++count;
+      else handle = 0;
+    }
+  };
+  update_handles(check_read, SELECT_MODE_READ);
+  update_handles(check_write, SELECT_MODE_WRITE);
+  update_handles(check_error, SELECT_MODE_ERROR);
+  if (count == -1) errno = EBADF;
+  return count;
+}
+
 int32_t socket::send(intmax_t handle, const vector<uint8_t>& buffer, size_t offset, size_t size, int32_t flags) {
   return static_cast<int32_t>(::send(static_cast<int32_t>(handle), &buffer.data()[offset], size, flags));
 }
 
+int32_t socket::send(intmax_t handle, const vector<pair<const uint8_t*, size_t>>& buffers, int32_t flags) {
+  // sendmsg takes at most max_io_vectors buffers : the next buffers are sent only while the previous ones are completely sent.
+  thread_local auto vectors = vector<iovec> {};
+  auto sent = size_t {0};
+  for (auto first = size_t {0}; first < buffers.size(); first += max_io_vectors) {
+    vectors.clear();
+    auto size = size_t {0};
+    for (auto index = first; index < buffers.size() && index < first + max_io_vectors; ++index) {
+      vectors.push_back({const_cast<uint8_t*>(buffers[index].first), buffers[index].second});
+      size += buffers[index].second;
+    }
+    if (first != 0 && sent + size > INT32_MAX) break;
+    auto message = msghdr {};
+    message.msg_iov = vectors.data();
+    message.msg_iovlen = static_cast<decltype(message.msg_iovlen)>(vectors.size());
+    auto result = ::sendmsg(static_cast<int32_t>(handle), &message, flags);
+    if (result == -1 && first != 0) break;
+    if (result == -1) return -1;
+    sent += static_cast<size_t>(result);
+    if (static_cast<size_t>(result) < size) break;
+  }
+  return static_cast<int32_t>(min<size_t>(sent, INT32_MAX));
+}
+
+int64_t socket::send_file(intmax_t handle, const string& path, int64_t offset, int64_t count) {
+  auto file = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (file == -1) return -1;
+  auto position = static_cast<off_t>(offset);
+  auto sent = int64_t {0};
+  auto result = int64_t {0};
+  while (count < 0 || sent < count) {
+    // sendfile copies from the page cache to the socket without going through the user space. It transfers at most 0x7ffff000 bytes per call.
+    auto size = count < 0 ? size_t {0x7ffff000} : static_cast<size_t>(min<int64_t>(count - sent, 0x7ffff000));
+    result = ::sendfile(static_cast<int32_t>(handle), file, &position, size);
+    if (result == -1 && (errno == EINTR || (errno == EAGAIN && wait_writable(static_cast<int32_t>(handle))))) continue;
+    if (result == -1 && sent == 0 && (errno == EINVAL || errno == ENOSYS)) {
+      // The file cannot be mapped (a pipe or a device, for example) : it is copied.
+      result = sent = copy_file_to_socket(static_cast<int32_t>(handle), file, offset, count);
+      break;
+    }
+    if (result <= 0) break;
+    sent += result;
+  }
+  auto error = errno;
+  ::close(file);
+  errno = error;
+  return result == -1 ? -1 : sent;
+}
+
 int32_t socket::send_to(intmax_t handle, const vector<uint8_t>& buffer, size_t offset, size_t size, int32_t flags, const vector<uint8_t>& socket_address) {
   return static_cast<int32_t>(::sendto(static_cast<int32_t>(handle), &buffer.data()[offset], size, flags, reinterpret_cast<const sockaddr*>(socket_address.data()), static_cast<socklen_t>(socket_address.size())));
 }
 
+int32_t socket::send_to(intmax_t handle, const vector<pair<const uint8_t*, size_t>>& buffers, const vector<pair<const uint8_t*, size_t>>& socket_addresses, int32_t flags) {
+  static constexpr auto control_size = CMSG_SPACE(sizeof(uint16_t));
+  thread_local auto vectors = vector<iovec> {};
+  thread_local auto messages = vector<mmsghdr> {};
+  thread_local auto controls = vector<uint8_t> {};
+  thread_local auto datagram_counts = vector<size_t> {};
+  auto same_destination = [&](size_t first, size_t second) {
+    return socket_addresses[first].second == socket_addresses[second].second && (socket_addresses[first].first == socket_addresses[second].first || memcmp(socket_addresses[first].first, socket_addresses[second].first, socket_addresses[first].second) == 0);
+  };
+
+  for (auto segmentation = segmentation_offload_supported.load();; segmentation = false) {
+    // With segmentation offload, consecutive datagrams of the same size sent to the same destination are gathered in one message : the kernel splits it in datagrams of segment size. Only the last datagram of a message can be shorter.
+    vectors.resize(min(buffers.size(), max_messages));
+    messages.clear();
+    controls.assign(min(buffers.size(), max_messages) * control_size, 0);
+    datagram_counts.clear();
+    for (auto index = size_t {0}; index < vectors.size();) {
+      auto first = index;
+      auto total_size = buffers[index].second;
+      vectors[index] = {const_cast<uint8_t*>(buffers[index].first), buffers[index].second};
+      ++index;
+      while (segmentation && buffers[first].second && index < vectors.size() && index - first < max_segments && buffers[index].second <= buffers[first].second && total_size + buffers[index].second <= max_segmented_size && same_destination(first, index) && buffers[index - 1].second == buffers[first].second) {
+        vectors[index] = {const_cast<uint8_t*>(buffers[index].first), buffers[index].second};
+        total_size += buffers[index++].second;
+      }
+
+      auto message = mmsghdr {};
+      message.msg_hdr.msg_iov = &vectors[first];
+      message.msg_hdr.msg_iovlen = index - first;
+      message.msg_hdr.msg_name = const_cast<uint8_t*>(socket_addresses[first].first);
+      message.msg_hdr.msg_namelen = socket_addresses[first].first ? static_cast<socklen_t>(socket_addresses[first].second) : 0;
+      if (index - first > 1) {
+        message.msg_hdr.msg_control = controls.data() + messages.size() * control_size;
+        message.msg_hdr.msg_controllen = control_size;
+        auto control = CMSG_FIRSTHDR(&message.msg_hdr);
+        control->cmsg_level = SOL_UDP;
+        control->cmsg_type = UDP_SEGMENT;
+        control->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+        auto segment_size = static_cast<uint16_t>(buffers[first].second);
+        memcpy(CMSG_DATA(control), &segment_size, sizeof(segment_size));
+      }
+      messages.push_back(message);
+      datagram_counts.push_back(index - first);
+    }
+
+    auto result = ::sendmmsg(static_cast<int32_t>(handle), messages.data(), static_cast<uint32_t>(messages.size()), flags);
+    // Only the errors reported for an unsupported segmentation offload retry without it : a full send buffer or an unreachable destination is reported as is.
+    if (result == -1 && segmentation && datagram_counts[0] > 1 && (errno == EIO || errno == EINVAL || errno == EOPNOTSUPP)) continue;
+    if (result == -1) return -1;
+    // Segmentation offload failed but sending the datagrams one by one succeeded : the kernel or the network device does not support it.
+    if (!segmentation && segmentation_offload_supported.load()) segmentation_offload_supported = false;
+    auto count = size_t {0};
+    for (auto index = 0; index < result; ++index)
+      count += datagram_counts[index];
+    return static_cast<int32_t>(count);
+  }
+}
+
 int32_t socket::set_blocking(intmax_t handle, bool blocking) {
   auto result = -1;
 
@@ -288,6 +527,11 @@ int32_t socket::set_blocking(intmax_t handle, bool blocking) {
   return result;
 }
 
+bool socket::set_receive_offload(intmax_t handle, bool enabled) {
+  auto value = enabled ? 1 : 0;
+  return ::setsockopt(static_cast<int32_t>(handle), SOL_UDP, UDP_GRO, &value, sizeof(value)) == 0;
+}
+
 int32_t socket::set_raw_socket_option(intmax_t handle, int32_t socket_option_level, int32_t socket_option_name, intmax_t option, size_t option_length) {
   return setsockopt(static_cast<int32_t>(handle), socket_option_level, socket_option_name, reinterpret_cast<const void*>(option), static_cast<socklen_t>(option_length));
 }
@@ -0,0 +1,104 @@
+#define __XTD_CORE_NATIVE_LIBRARY__
+#include <xtd/native/socket_poller>
+#include <xtd/native/socket_poller_constants>
+#undef __XTD_CORE_NATIVE_LIBRARY__
+#include <errno.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+
+using namespace std;
+using namespace xtd::native;
+
+namespace {
+  struct poller_data {
+    int32_t epoll_handle = -1;
+    int32_t interrupt_handle = -1;
+  };
+  
+  // The interrupt eventfd is registered with a data value that cannot be a socket handle.
+  constexpr uint64_t interrupt_key = static_cast<uint64_t>(-1);
+  
+  uint32_t to_native_events(int32_t events, int32_t mode) {
+    auto native_events = static_cast<uint32_t>(EPOLLRDHUP);
+    if ((events & SOCKET_POLLER_EVENT_READ) == SOCKET_POLLER_EVENT_READ) native_events |= EPOLLIN;
+    if ((events & SOCKET_POLLER_EVENT_WRITE) == SOCKET_POLLER_EVENT_WRITE) native_events |= EPOLLOUT;
+    if ((mode & SOCKET_POLLER_MODE_EDGE_TRIGGERED) == SOCKET_POLLER_MODE_EDGE_TRIGGERED) native_events |= EPOLLET;
+    if ((mode & SOCKET_POLLER_MODE_ONE_SHOT) == SOCKET_POLLER_MODE_ONE_SHOT) native_events |= EPOLLONESHOT;
+    return native_events;
+  }
+  
+  int32_t to_socket_poller_events(uint32_t native_events) {
+    auto events = 0;
+    if ((native_events & EPOLLIN) == EPOLLIN) events |= SOCKET_POLLER_EVENT_READ;
+    if ((native_events & EPOLLOUT) == EPOLLOUT) events |= SOCKET_POLLER_EVENT_WRITE;
+    if ((native_events & EPOLLERR) == EPOLLERR) events |= SOCKET_POLLER_EVENT_ERROR;
+    if ((native_events & (EPOLLHUP | EPOLLRDHUP)) != 0) events |= SOCKET_POLLER_EVENT_HANG_UP;
+    return events;
+  }
+  
+  bool control(intmax_t poller, int32_t operation, intmax_t handle, int32_t events, int32_t mode) {
+    auto event = epoll_event {};
+    event.events = to_native_events(events, mode);
+    event.data.u64 = static_cast<uint64_t>(handle);
+    return epoll_ctl(reinterpret_cast<poller_data*>(poller)->epoll_handle, operation, static_cast<int32_t>(handle), &event) == 0;
+  }
+}
+
+bool socket_poller::add(intmax_t poller, intmax_t handle, int32_t events, int32_t mode) {
+  return control(poller, EPOLL_CTL_ADD, handle, events, mode);
+}
+
+intmax_t socket_poller::create() {
+  auto data = new poller_data {epoll_create1(EPOLL_CLOEXEC), eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK)};
+  auto event = epoll_event {};
+  event.events = EPOLLIN;
+  event.data.u64 = interrupt_key;
+  if (data->epoll_handle == -1 || data->interrupt_handle == -1 || epoll_ctl(data->epoll_handle, EPOLL_CTL_ADD, data->interrupt_handle, &event) == -1) {
+    destroy(reinterpret_cast<intmax_t>(data));
+    return -1;
+  }
+  return reinterpret_cast<intmax_t>(data);
+}
+
+void socket_poller::destroy(intmax_t poller) {
+  auto data = reinterpret_cast<poller_data*>(poller);
+  if (data->interrupt_handle != -1) ::close(data->interrupt_handle);
+  if (data->epoll_handle != -1) ::close(data->epoll_handle);
+  delete data;
+}
+
+void socket_poller::interrupt(intmax_t poller) {
+  // The eventfd is never read : it stays readable and wakes up every waiting thread.
+  auto value = uint64_t {1};
+  [[maybe_unused]] auto result = ::write(reinterpret_cast<poller_data*>(poller)->interrupt_handle, &value, sizeof(value));
+}
+
+bool socket_poller::modify(intmax_t poller, intmax_t handle, int32_t events, int32_t mode) {
+  return control(poller, EPOLL_CTL_MOD, handle, events, mode);
+}
+
+bool socket_poller::remove(intmax_t poller, intmax_t handle) {
+  auto event = epoll_event {};
+  return epoll_ctl(reinterpret_cast<poller_data*>(poller)->epoll_handle, EPOLL_CTL_DEL, static_cast<int32_t>(handle), &event) == 0;
+}
+
+int32_t socket_poller::wait(intmax_t poller, vector<intmax_t>& handles, vector<int32_t>& events, int32_t milliseconds) {
+  if (handles.empty()) return -1;
+  static thread_local auto native_events = vector<epoll_event> {};
+  native_events.resize(handles.size());
+  auto count = 0;
+  do {
+    count = epoll_wait(reinterpret_cast<poller_data*>(poller)->epoll_handle, native_events.data(), static_cast<int32_t>(native_events.size()), milliseconds);
+  } while (count == -1 && errno == EINTR);
+  if (count == -1) return -1;
+  
+  events.resize(handles.size());
+  auto result = 0;
+  for (auto index = 0; index < count; ++index) {
+    if (native_events[index].data.u64 == interrupt_key) continue;
+    handles[result] = static_cast<intmax_t>(native_events[index].data.u64);
+    events[result++] = to_socket_poller_events(native_events[index].events);
+  }
+  return result;
+}
@@ -4,6 +4,7 @@
 #include <execinfo.h>
 #include <dlfcn.h>
 #include <cxxabi.h>
+#include <algorithm>
 
 using namespace std;
 using namespace xtd::native;
@@ -20,10 +21,35 @@ namespace {
 }
 
 #if __ANDROID__ | __CYGWIN__ | __MINGW32__
+size_t stack_trace::get_addresses(size_t skip_frames, void** addresses, size_t max_count) {
+  return 0;
+}
+
+stack_trace::frame stack_trace::get_frame(void* address) {
+  return {};
+}
+
 stack_trace::frames stack_trace::get_frames(size_t skip_frames, size_t max_frames) {
   return {};
 }
 #else
+size_t stack_trace::get_addresses(size_t skip_frames, void** addresses, size_t max_count) {
+  static constexpr size_t max_frames = 1024;
+  void* traces[max_frames];
+  auto nb_frames = static_cast<size_t>(backtrace(traces, static_cast<int>(min(max_frames, skip_frames + 1 + max_count))));
+
+  auto count = size_t {0};
+  for (auto index = skip_frames + 1; index < nb_frames && count < max_count; ++index)
+    addresses[count++] = traces[index];
+  return count;
+}
+
+stack_trace::frame stack_trace::get_frame(void* address) {
+  auto dl_info = Dl_info {};
+  if (!dladdr(address, &dl_info) || !dl_info.dli_sname) return {};
+  return std::make_tuple(dl_info.dli_fname, 0, 0, demangle_string(dl_info.dli_sname), reinterpret_cast<size_t>(dl_info.dli_saddr) - reinterpret_cast<size_t>(dl_info.dli_fbase));
+}
+
 stack_trace::frames stack_trace::get_frames(size_t skip_frames) {
   static constexpr size_t max_frames = 1024;
   auto frames = stack_trace::frames {};
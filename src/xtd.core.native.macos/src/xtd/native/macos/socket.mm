@@ -9,19 +9,32 @@
 #include <xtd/native/socket_shutdown_constants>
 #include <xtd/native/socket_type_constants>
 #undef __XTD_CORE_NATIVE_LIBRARY__
+#include <algorithm>
 #include <map>
 #include <errno.h>
 #include <fcntl.h>
+#include <limits.h>
 #include <poll.h>
 #include <unistd.h>
 #include <netinet/in.h>
 #include <sys/select.h>
 #include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/uio.h>
 #include <sys/ioctl.h>
 
 using namespace xtd::native;
 
 namespace {
+  // select_mode_constants values index these tables.
+  static constexpr int16_t poll_events[] = {POLLIN, POLLOUT, POLLPRI};
+  // Like select, a socket is readable or writable when an error or a hang up is pending, so that the next call reports it.
+  static constexpr int16_t poll_ready_events[] = {POLLIN | POLLHUP | POLLERR, POLLOUT | POLLHUP | POLLERR, POLLPRI | POLLERR};
+  
+  static int32_t to_poll_timeout(int32_t microseconds) {
+    return microseconds < 0 ? -1 : microseconds / 1000 + (microseconds % 1000 != 0 ? 1 : 0);
+  }
+  
   static int32_t native_to_socket_error(int32_t error) {
     static auto socket_errors = std::map<int32_t, int32_t> {{0, SOCKET_ERROR_SUCCESS}, {EINTR, SOCKET_ERROR_INTERRUPTED}, {EACCES, SOCKET_ERROR_ACCESS_DENIED}, {EFAULT, SOCKET_ERROR_FAULT}, {EINVAL, SOCKET_ERROR_INVALID_ARGUMENT}, {EMFILE, SOCKET_ERROR_TOO_MANY_OPEN_SOCKETS}, {EAGAIN, SOCKET_ERROR_WOULD_BLOCK}, {EINPROGRESS, SOCKET_ERROR_IN_PROGRESS}, {EALREADY, SOCKET_ERROR_ALREADY_IN_PROGRESS}, {ENOTSOCK, SOCKET_ERROR_NOT_SOCKET}, {EDESTADDRREQ, SOCKET_ERROR_DESTINATION_ADDRESS_REQUIRED}, {EMSGSIZE, SOCKET_ERROR_MESSAGE_SIZE}, {EPROTOTYPE, SOCKET_ERROR_PROTOCOL_TYPE}, {ENOPROTOOPT, SOCKET_ERROR_PROTOCOL_OPTION}, {EPROTONOSUPPORT, SOCKET_ERROR_PROTOCOL_NOT_SUPPORTED}, {ESOCKTNOSUPPORT, SOCKET_ERROR_SOCKET_NOT_SUPPORTED}, {ENOTSUP, SOCKET_ERROR_OPERATION_NOT_SUPPORTED}, {EPFNOSUPPORT, SOCKET_ERROR_PROTOCOL_FAMILY_NOT_SUPPORTED}, {EAFNOSUPPORT, SOCKET_ERROR_ADDRESS_FAMILY_NOT_SUPPORTED}, {EADDRINUSE, SOCKET_ERROR_ADDRESS_ALREADY_IN_USE}, {EADDRNOTAVAIL, SOCKET_ERROR_ADDRESS_NOT_AVAILABLE}, {ENETDOWN, SOCKET_ERROR_NETWORK_DOWN}, {ENETUNREACH, SOCKET_ERROR_NETWORK_UNREACHABLE}, {ENETRESET, SOCKET_ERROR_NETWORK_RESET}, {ECONNABORTED, SOCKET_ERROR_CONNECTION_ABORTED}, {ECONNRESET, SOCKET_ERROR_CONNECTION_RESET}, {ENOBUFS, SOCKET_ERROR_NO_BUFFER_SPACE_AVAILABLE}, {EISCONN, SOCKET_ERROR_IS_CONNECTED}, {ENOTCONN, SOCKET_ERROR_NOT_CONNECTED}, {ESHUTDOWN, SOCKET_ERROR_SHUTDOWN}, {ETIMEDOUT, SOCKET_ERROR_TIMED_OUT}, {ECONNREFUSED, SOCKET_ERROR_CONNECTION_REFUSED}, {EHOSTDOWN, SOCKET_ERROR_HOST_DOWN}, {EHOSTUNREACH, SOCKET_ERROR_HOST_UNREACHABLE}, {EPROCLIM, SOCKET_ERROR_PROCESS_LIMIT}, {ERPCMISMATCH, SOCKET_ERROR_VERSION_NOT_SUPPORTED}, {EOPNOTSUPP, SOCKET_ERROR_SOCKET_NOT_SUPPORTED}};
     auto it = socket_errors.find(error);
@@ -56,6 +69,54 @@ namespace {
     if (it == socket_types.end()) return SOCK_STREAM;
     return it->second;
   }
+  
+#if defined(IOV_MAX)
+  static constexpr size_t max_io_vectors = IOV_MAX;
+#else
+  static constexpr size_t max_io_vectors = 16;
+#endif
+  
+  // A blocking socket reports EAGAIN when its receive timeout expires, and a non-blocking socket when no data is available.
+  static bool is_blocking(intmax_t handle) {
+    auto error = errno;
+    auto flags = fcntl(static_cast<int32_t>(handle), F_GETFL, 0);
+    errno = error;
+    return flags != -1 && (flags & O_NONBLOCK) == 0;
+  }
+  
+  // Waits until the socket can send, at most its send timeout : ETIMEDOUT is reported when the timeout expires.
+  static bool wait_writable(int32_t handle) {
+    auto timeout = timeval {};
+    auto timeout_length = static_cast<socklen_t>(sizeof(timeout));
+    auto milliseconds = -1;
+    if (::getsockopt(handle, SOL_SOCKET, SO_SNDTIMEO, &timeout, &timeout_length) == 0 && (timeout.tv_sec != 0 || timeout.tv_usec != 0))
+      milliseconds = static_cast<int32_t>(std::min<int64_t>(std::max<int64_t>(static_cast<int64_t>(timeout.tv_sec) * 1000 + timeout.tv_usec / 1000, 1), INT32_MAX));
+    auto descriptor = pollfd {handle, POLLOUT, 0};
+    auto result = 0;
+    while ((result = ::poll(&descriptor, 1, milliseconds)) == -1 && errno == EINTR);
+    if (result == 0) errno = ETIMEDOUT;
+    return result == 1;
+  }
+  
+  static int64_t copy_file_to_socket(int32_t handle, int32_t file, int64_t offset, int64_t count) {
+    auto buffer = std::vector<uint8_t>(65536);
+    auto sent = int64_t {0};
+    while (count < 0 || sent < count) {
+      auto size = count < 0 ? buffer.size() : static_cast<size_t>(std::min<int64_t>(count - sent, buffer.size()));
+      auto read = ::pread(file, buffer.data(), size, static_cast<off_t>(offset + sent));
+      if (read == -1 && errno == EINTR) continue;
+      if (read == -1) return -1;
+      if (read == 0) break;
+      for (auto written = ssize_t {0}; written < read;) {
+        auto result = ::send(handle, buffer.data() + written, static_cast<size_t>(read - written), 0);
+        if (result == -1 && (errno == EINTR || (errno == EAGAIN && wait_writable(handle)))) continue;
+        if (result == -1) return -1;
+        written += result;
+      }
+      sent += read;
+    }
+    return sent;
+  }
 }
 
 int32_t socket::address_family_to_native(int32_t address_family) {
@@ -135,6 +196,11 @@ int32_t socket::get_raw_socket_option(intmax_t handle, int32_t socket_option_lev
   return ::getsockopt(static_cast<int32_t>(handle), socket_option_level, socket_option_name, reinterpret_cast<void*>(option), reinterpret_cast<socklen_t*>(&option_length));
 }
 
+int32_t socket::get_socket_name(intmax_t handle, vector<uint8_t>& socket_address) {
+  auto address_length = static_cast<socklen_t>(socket_address.size());
+  return ::getsockname(static_cast<int32_t>(handle), reinterpret_cast<sockaddr*>(socket_address.data()), &address_length);
+}
+
 int32_t socket::get_socket_option(intmax_t handle, int32_t socket_option_level, int32_t socket_option_name, intmax_t option, size_t& option_length) {
   if (socket_option_name_to_native(socket_option_name) == -1) {
     errno = ENOTSUP;
@@ -202,26 +268,51 @@ int32_t socket::listen(intmax_t handle, size_t backlog) {
 }
 
 int32_t socket::poll(intmax_t handle, int32_t microseconds, int32_t mode) {
-  if (handle == 0 || microseconds < 0) return -1;
+  if (handle == 0 || mode < SELECT_MODE_READ || mode > SELECT_MODE_ERROR) return -1;
   
-  auto poll_fd = pollfd {};
-  poll_fd.fd = static_cast<int32_t>(handle);
-  switch (mode) {
-    case SELECT_MODE_READ: poll_fd.events = POLLIN; break;
-    case SELECT_MODE_WRITE: poll_fd.events = POLLOUT; break;
-    case SELECT_MODE_ERROR: poll_fd.events = POLLERR; break;
-    default: return -1;
+  auto poll_fd = pollfd {static_cast<int32_t>(handle), poll_events[mode], 0};
+  auto result = ::poll(&poll_fd, 1, to_poll_timeout(microseconds));
+  if (result <= 0) return result;
+  if ((poll_fd.revents & POLLNVAL) == POLLNVAL) {
+    errno = EBADF;
+    return -1;
   }
-  return ::poll(&poll_fd, 1, microseconds);
+  return (poll_fd.revents & poll_ready_events[mode]) != 0 ? 1 : 0;
 }
 
 int32_t socket::receive(intmax_t handle, std::vector<uint8_t>& buffer, size_t offset, size_t size, int32_t flags) {
   auto result = static_cast<int32_t>(::recv(static_cast<int32_t>(handle), &buffer.data()[offset], size, flags));
   if (result == -1 && errno == EBADF) errno = EINTR;
-  if (result == -1 && errno == EAGAIN) errno = ETIMEDOUT;
+  if (result == -1 && errno == EAGAIN && is_blocking(handle)) errno = ETIMEDOUT;
   return result;
 }
 
+int32_t socket::receive(intmax_t handle, const std::vector<std::pair<uint8_t*, size_t>>& buffers, int32_t flags) {
+  // recvmsg takes at most max_io_vectors buffers : the next buffers are filled, without waiting, only while the previous ones are full.
+  thread_local auto vectors = std::vector<iovec> {};
+  auto received = size_t {0};
+  for (auto first = size_t {0}; first < buffers.size(); first += max_io_vectors) {
+    vectors.clear();
+    auto size = size_t {0};
+    for (auto index = first; index < buffers.size() && index < first + max_io_vectors; ++index) {
+      vectors.push_back({buffers[index].first, buffers[index].second});
+      size += buffers[index].second;
+    }
+    if (first != 0 && received + size > INT32_MAX) break;
+    auto message = msghdr {};
+    message.msg_iov = vectors.data();
+    message.msg_iovlen = static_cast<decltype(message.msg_iovlen)>(vectors.size());
+    auto result = ::recvmsg(static_cast<int32_t>(handle), &message, first == 0 ? flags : flags | MSG_DONTWAIT);
+    if (result == -1 && first != 0) break;
+    if (result == -1 && errno == EBADF) errno = EINTR;
+    if (result == -1 && errno == EAGAIN && is_blocking(handle)) errno = ETIMEDOUT;
+    if (result == -1) return -1;
+    received += static_cast<size_t>(result);
+    if (static_cast<size_t>(result) < size) break;
+  }
+  return static_cast<int32_t>(std::min<size_t>(received, INT32_MAX));
+}
+
 int32_t socket::receive_from(intmax_t handle, std::vector<uint8_t>& buffer, size_t offset, size_t size, int32_t flags, std::vector<uint8_t>& socket_address) {
   std::swap(socket_address[0], socket_address[1]);
   auto address_length = static_cast<socklen_t>(socket_address.size());
@@ -230,56 +321,120 @@ int32_t socket::receive_from(intmax_t handle, std::vector<uint8_t>& buffer, size
   std::swap(socket_address[0], socket_address[1]);
   
   if (result == -1 && errno == EBADF) errno = EINTR;
-  if (result == -1 && errno == EAGAIN) errno = ETIMEDOUT;
+  if (result == -1 && errno == EAGAIN && is_blocking(handle)) errno = ETIMEDOUT;
   return result;
 }
 
-int32_t socket::select(std::vector<intmax_t>& check_read, std::vector<intmax_t>& check_write, std::vector<intmax_t>& check_error, int32_t microseconds) {
-  auto nfds = size_t {0};
-  
-  auto read_fds = fd_set {};
-  FD_ZERO(&read_fds);
-  for (auto i = 0u; i < check_read.size() && i < FD_SETSIZE; i++)
-    FD_SET(static_cast<int32_t>(check_read[i]), &read_fds);
-  if (check_read.size() > nfds) nfds = check_read.size();
-  
-  auto write_fds = fd_set {};
-  FD_ZERO(&write_fds);
-  for (auto i = 0u; i < check_write.size() && i < FD_SETSIZE; i++)
-    FD_SET(static_cast<int32_t>(check_write[i]), &write_fds);
-  if (check_write.size() > nfds) nfds = check_write.size();
-  
-  auto error_fds = fd_set {};
-  FD_ZERO(&error_fds);
-  for (auto i = 0u; i < check_error.size() && i < FD_SETSIZE; i++)
-    FD_SET(static_cast<int32_t>(check_error[i]), &error_fds);
-  if (check_error.size() > nfds) nfds = check_error.size();
-  
-  auto timeout = timeval {microseconds / 1000000, microseconds % 1000000};
-  auto result = ::select(static_cast<int32_t>(nfds + 1), &read_fds, &write_fds, &error_fds, microseconds == -1 ? nullptr : &timeout);
-  
-  for (auto i = 0u; i < check_read.size(); i++) {
-    FD_CLR(static_cast<int32_t>(check_read[i]), &read_fds);
-    if (FD_ISSET(static_cast<int32_t>(check_read[i]), &read_fds) == 0) check_read[i] = 0;
-  }
-  
-  for (auto i = 0u; i < check_write.size(); i++) {
-    FD_CLR(static_cast<int32_t>(check_write[i]), &write_fds);
-    if (FD_ISSET(static_cast<int32_t>(check_write[i]), &write_fds) == 0) check_write[i] = 0;
+int32_t socket::receive_from(intmax_t handle, const std::vector<std::pair<uint8_t*, size_t>>& buffers, const std::vector<std::pair<uint8_t*, size_t>>& socket_addresses, std::vector<std::pair<size_t, size_t>>& sizes, int32_t flags) {
+  // There is no recvmmsg : receives the first datagram, then the datagrams already queued, one by one.
+  sizes.clear();
+  for (auto index = size_t {0}; index < buffers.size(); ++index) {
+    auto vector = iovec {buffers[index].first, buffers[index].second};
+    auto message = msghdr {};
+    message.msg_name = socket_addresses[index].first;
+    message.msg_namelen = static_cast<socklen_t>(socket_addresses[index].second);
+    message.msg_iov = &vector;
+    message.msg_iovlen = 1;
+    auto result = ::recvmsg(static_cast<int32_t>(handle), &message, index == 0 ? flags : flags | MSG_DONTWAIT);
+    if (result == -1 && index != 0) break;
+    if (result == -1 && errno == EBADF) errno = EINTR;
+    if (result == -1 && errno == EAGAIN && is_blocking(handle)) errno = ETIMEDOUT;
+    if (result == -1) return -1;
+    auto size = (message.msg_flags & MSG_TRUNC) ? buffers[index].second + 1 : static_cast<size_t>(result);
+    sizes.push_back({size, size});
   }
+  return static_cast<int32_t>(sizes.size());
+}
+
+int32_t socket::select(std::vector<intmax_t>& check_read, std::vector<intmax_t>& check_write, std::vector<intmax_t>& check_error, int32_t microseconds) {
+  // poll has no FD_SETSIZE limit and its cost depends only on the number of sockets checked.
+  static thread_local auto poll_fds = std::vector<pollfd> {};
+  poll_fds.clear();
+  auto add_handles = [](const std::vector<intmax_t>& handles, int32_t mode) {
+    for (auto handle : handles)
+      poll_fds.push_back(pollfd {static_cast<int32_t>(handle), poll_events[mode], 0});
+  };
+  add_handles(check_read, SELECT_MODE_READ);
+  add_handles(check_write, SELECT_MODE_WRITE);
+  add_handles(check_error, SELECT_MODE_ERROR);
   
-  for (auto i = 0u; i < check_error.size(); i++) {
-    FD_CLR(static_cast<int32_t>(check_error[i]), &error_fds);
-    if (FD_ISSET(static_cast<int32_t>(check_error[i]), &error_fds) == 0) check_error[i] = 0;
-  }
+  auto result = 0;
+  do {
+    result = ::poll(poll_fds.data(), static_cast<nfds_t>(poll_fds.size()), to_poll_timeout(microseconds));
+  } while (result == -1 && errno == EINTR);
+  if (result == -1) return -1;
   
-  return result;
+  auto count = 0;
+  auto index = size_t {0};
+  auto update_handles = [&](std::vector<intmax_t>& handles, int32_t mode) {
+    for (auto& handle : handles) {
+      auto revents = poll_fds[index++].revents;
+      if ((revents & POLLNVAL) == POLLNVAL) count = -1;
+      if (count != -1 && (revents & poll_ready_events[mode]) != 0) ++count;
+      else handle = 0;
+    }
+  };
+  update_handles(check_read, SELECT_MODE_READ);
+  update_handles(check_write, SELECT_MODE_WRITE);
+  update_handles(check_error, SELECT_MODE_ERROR);
+  if (count == -1) errno = EBADF;
+  return count;
 }
 
 int32_t socket::send(intmax_t handle, const std::vector<uint8_t>& buffer, size_t offset, size_t size, int32_t flags) {
   return static_cast<int32_t>(::send(static_cast<int32_t>(handle), &buffer.data()[offset], size, flags));
 }
 
+int32_t socket::send(intmax_t handle, const std::vector<std::pair<const uint8_t*, size_t>>& buffers, int32_t flags) {
+  // sendmsg takes at most max_io_vectors buffers : the next buffers are sent only while the previous ones are completely sent.
+  thread_local auto vectors = std::vector<iovec> {};
+  auto sent = size_t {0};
+  for (auto first = size_t {0}; first < buffers.size(); first += max_io_vectors) {
+    vectors.clear();
+    auto size = size_t {0};
+    for (auto index = first; index < buffers.size() && index < first + max_io_vectors; ++index) {
+      vectors.push_back({const_cast<uint8_t*>(buffers[index].first), buffers[index].second});
+      size += buffers[index].second;
+    }
+    if (first != 0 && sent + size > INT32_MAX) break;
+    auto message = msghdr {};
+    message.msg_iov = vectors.data();
+    message.msg_iovlen = static_cast<decltype(message.msg_iovlen)>(vectors.size());
+    auto result = ::sendmsg(static_cast<int32_t>(handle), &message, flags);
+    if (result == -1 && first != 0) break;
+    if (result == -1) return -1;
+    sent += static_cast<size_t>(result);
+    if (static_cast<size_t>(result) < size) break;
+  }
+  return static_cast<int32_t>(std::min<size_t>(sent, INT32_MAX));
+}
+
+int64_t socket::send_file(intmax_t handle, const std::string& path, int64_t offset, int64_t count) {
+  auto file = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (file == -1) return -1;
+  auto sent = int64_t {0};
+  auto result = 0;
+  while (count < 0 || sent < count) {
+    // sendfile copies from the page cache to the socket without going through the user space. A length of 0 sends the file up to its end.
+    auto length = static_cast<off_t>(count < 0 ? 0 : count - sent);
+    result = ::sendfile(file, static_cast<int32_t>(handle), static_cast<off_t>(offset + sent), &length, nullptr, 0);
+    sent += length;
+    if (result == -1 && (errno == EINTR || (errno == EAGAIN && wait_writable(static_cast<int32_t>(handle))))) continue;
+    if (result == -1 && sent == 0 && (errno == ENOTSUP || errno == EOPNOTSUPP || errno == ENOTSOCK)) {
+      // The file cannot be mapped (a pipe or a device, for example) : it is copied.
+      auto copied = copy_file_to_socket(static_cast<int32_t>(handle), file, offset, count);
+      result = copied == -1 ? -1 : 0;
+      sent = copied;
+      break;
+    }
+    if (result == -1 || length == 0 || count < 0) break;
+  }
+  auto error = errno;
+  ::close(file);
+  errno = error;
+  return result == -1 ? -1 : sent;
+}
+
 int32_t socket::send_to(intmax_t handle, const std::vector<uint8_t>& buffer, size_t offset, size_t size, int32_t flags, const std::vector<uint8_t>& socket_address) {
   std::swap(const_cast<std::vector<uint8_t>&>(socket_address)[0], const_cast<std::vector<uint8_t>&>(socket_address)[1]);
   auto result = static_cast<int32_t>(::sendto(static_cast<int32_t>(handle), &buffer.data()[offset], size, flags, reinterpret_cast<const sockaddr*>(socket_address.data()), static_cast<socklen_t>(socket_address.size())));
@@ -287,6 +442,17 @@ int32_t socket::send_to(intmax_t handle, const std::vector<uint8_t>& buffer, siz
   return result;
 }
 
+int32_t socket::send_to(intmax_t handle, const std::vector<std::pair<const uint8_t*, size_t>>& buffers, const std::vector<std::pair<const uint8_t*, size_t>>& socket_addresses, int32_t flags) {
+  // There is no sendmmsg : sends the datagrams one by one, and stops at the first error.
+  auto count = size_t {0};
+  for (; count < buffers.size(); ++count) {
+    auto result = ::sendto(static_cast<int32_t>(handle), buffers[count].first, buffers[count].second, flags, reinterpret_cast<const sockaddr*>(socket_addresses[count].first), socket_addresses[count].first ? static_cast<socklen_t>(socket_addresses[count].second) : 0);
+    if (result == -1 && count == 0) return -1;
+    if (result == -1) break;
+  }
+  return static_cast<int32_t>(count);
+}
+
 int32_t socket::set_blocking(intmax_t handle, bool blocking) {
   auto result = -1;
   
@@ -300,6 +466,10 @@ int32_t socket::set_blocking(intmax_t handle, bool blocking) {
   return result;
 }
 
+bool socket::set_receive_offload(intmax_t handle, bool enabled) {
+  return !enabled;
+}
+
 int32_t socket::set_raw_socket_option(intmax_t handle, int32_t socket_option_level, int32_t socket_option_name, intmax_t option, size_t option_length) {
   return setsockopt(static_cast<int32_t>(handle), socket_option_level, socket_option_name, reinterpret_cast<const void*>(option), static_cast<socklen_t>(option_length));
 }
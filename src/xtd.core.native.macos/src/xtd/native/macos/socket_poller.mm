@@ -0,0 +1,142 @@
+#define __XTD_CORE_NATIVE_LIBRARY__
+#include <xtd/native/socket_poller>
+#include <xtd/native/socket_poller_constants>
+#undef __XTD_CORE_NATIVE_LIBRARY__
+#include <mutex>
+#include <set>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/event.h>
+#include <sys/time.h>
+
+using namespace std;
+using namespace xtd::native;
+
+namespace {
+  // The registered handles are tracked so that add, modify and remove fail as epoll_ctl does. kqueue has one filter per direction : a one-shot filter is disabled after its event (EV_DISPATCH), and enabled again by modify.
+  struct poller_data {
+    int32_t kqueue_handle = -1;
+    mutex sync_root;
+    set<intmax_t> handles;
+  };
+  
+  // The interrupt user event is never cleared : it stays triggered and wakes up every waiting thread.
+  constexpr uintptr_t interrupt_key = 0;
+  
+  uint16_t to_native_flags(int32_t mode) {
+    auto flags = static_cast<uint16_t>(EV_ADD | EV_ENABLE | EV_RECEIPT);
+    if ((mode & SOCKET_POLLER_MODE_EDGE_TRIGGERED) == SOCKET_POLLER_MODE_EDGE_TRIGGERED) flags |= EV_CLEAR;
+    if ((mode & SOCKET_POLLER_MODE_ONE_SHOT) == SOCKET_POLLER_MODE_ONE_SHOT) flags |= EV_DISPATCH;
+    return flags;
+  }
+  
+  // Adds the read and write filters that events asks for, and deletes the other ones. A filter deleted that was not registered is not an error.
+  bool control(poller_data& data, intmax_t handle, int32_t events, int32_t mode) {
+    struct kevent changes[2];
+    struct kevent results[2];
+    EV_SET(&changes[0], static_cast<uintptr_t>(handle), EVFILT_READ, (events & SOCKET_POLLER_EVENT_READ) == SOCKET_POLLER_EVENT_READ ? to_native_flags(mode) : EV_DELETE | EV_RECEIPT, 0, 0, nullptr);
+    EV_SET(&changes[1], static_cast<uintptr_t>(handle), EVFILT_WRITE, (events & SOCKET_POLLER_EVENT_WRITE) == SOCKET_POLLER_EVENT_WRITE ? to_native_flags(mode) : EV_DELETE | EV_RECEIPT, 0, 0, nullptr);
+    auto count = kevent(data.kqueue_handle, changes, 2, results, 2, nullptr);
+    if (count == -1) return false;
+    for (auto index = 0; index < count; ++index) {
+      if ((results[index].flags & EV_ERROR) == 0 || results[index].data == 0 || results[index].data == ENOENT) continue;
+      errno = static_cast<int32_t>(results[index].data);
+      return false;
+    }
+    return true;
+  }
+  
+  int32_t to_socket_poller_events(const struct kevent& event) {
+    auto events = 0;
+    if (event.filter == EVFILT_READ) events |= SOCKET_POLLER_EVENT_READ;
+    if (event.filter == EVFILT_WRITE) events |= SOCKET_POLLER_EVENT_WRITE;
+    if ((event.flags & EV_ERROR) == EV_ERROR || ((event.flags & EV_EOF) == EV_EOF && event.fflags != 0)) events |= SOCKET_POLLER_EVENT_ERROR;
+    if ((event.flags & EV_EOF) == EV_EOF) events |= SOCKET_POLLER_EVENT_HANG_UP;
+    return events;
+  }
+}
+
+bool socket_poller::add(intmax_t poller, intmax_t handle, int32_t events, int32_t mode) {
+  auto& data = *reinterpret_cast<poller_data*>(poller);
+  auto lock = lock_guard<mutex> {data.sync_root};
+  if (data.handles.find(handle) != data.handles.end()) {
+    errno = EEXIST;
+    return false;
+  }
+  if (!control(data, handle, events, mode)) return false;
+  data.handles.insert(handle);
+  return true;
+}
+
+intmax_t socket_poller::create() {
+  auto data = new poller_data {};
+  data->kqueue_handle = kqueue();
+  struct kevent event {};
+  EV_SET(&event, interrupt_key, EVFILT_USER, EV_ADD, 0, 0, nullptr);
+  if (data->kqueue_handle == -1 || kevent(data->kqueue_handle, &event, 1, nullptr, 0, nullptr) == -1) {
+    destroy(reinterpret_cast<intmax_t>(data));
+    return -1;
+  }
+  return reinterpret_cast<intmax_t>(data);
+}
+
+void socket_poller::destroy(intmax_t poller) {
+  auto data = reinterpret_cast<poller_data*>(poller);
+  if (data->kqueue_handle != -1) ::close(data->kqueue_handle);
+  delete data;
+}
+
+void socket_poller::interrupt(intmax_t poller) {
+  struct kevent event {};
+  EV_SET(&event, interrupt_key, EVFILT_USER, 0, NOTE_TRIGGER, 0, nullptr);
+  kevent(reinterpret_cast<poller_data*>(poller)->kqueue_handle, &event, 1, nullptr, 0, nullptr);
+}
+
+bool socket_poller::modify(intmax_t poller, intmax_t handle, int32_t events, int32_t mode) {
+  auto& data = *reinterpret_cast<poller_data*>(poller);
+  auto lock = lock_guard<mutex> {data.sync_root};
+  if (data.handles.find(handle) == data.handles.end()) {
+    errno = ENOENT;
+    return false;
+  }
+  return control(data, handle, events, mode);
+}
+
+bool socket_poller::remove(intmax_t poller, intmax_t handle) {
+  auto& data = *reinterpret_cast<poller_data*>(poller);
+  auto lock = lock_guard<mutex> {data.sync_root};
+  if (data.handles.erase(handle) == 0) {
+    errno = ENOENT;
+    return false;
+  }
+  return control(data, handle, 0, 0);
+}
+
+int32_t socket_poller::wait(intmax_t poller, vector<intmax_t>& handles, vector<int32_t>& events, int32_t milliseconds) {
+  if (handles.empty()) return -1;
+  static thread_local auto native_events = vector<struct kevent> {};
+  native_events.resize(handles.size());
+  auto timeout = timespec {milliseconds / 1000, (milliseconds % 1000) * 1000000};
+  auto count = 0;
+  do {
+    count = kevent(reinterpret_cast<poller_data*>(poller)->kqueue_handle, nullptr, 0, native_events.data(), static_cast<int32_t>(native_events.size()), milliseconds < 0 ? nullptr : &timeout);
+  } while (count == -1 && errno == EINTR);
+  if (count == -1) return -1;
+  
+  events.resize(handles.size());
+  auto result = 0;
+  for (auto index = 0; index < count; ++index) {
+    if (native_events[index].filter == EVFILT_USER) continue;
+    // The read and write filters of one socket are reported as one event.
+    auto handle = static_cast<intmax_t>(native_events[index].ident);
+    auto position = 0;
+    while (position < result && handles[position] != handle)
+      ++position;
+    if (position == result) {
+      handles[result] = handle;
+      events[result++] = 0;
+    }
+    events[position] |= to_socket_poller_events(native_events[index]);
+  }
+  return result;
+}
@@ -0,0 +1,172 @@
+#define __XTD_CORE_NATIVE_LIBRARY__
+#include <xtd/native/socket_poller>
+#include <xtd/native/socket_poller_constants>
+#undef __XTD_CORE_NATIVE_LIBRARY__
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+
+using namespace std;
+using namespace xtd::native;
+
+namespace {
+  // Without epoll, the poller is emulated with poll : edge-triggered mode is handled as level-triggered mode, which reports a superset of the events.
+  struct registration {
+    int32_t events = 0;
+    int32_t mode = 0;
+    bool enabled = true;
+  };
+  
+  // Each waiting thread polls its own pipe with the sockets : a change wakes up every waiting thread, which then polls the new set of sockets.
+  struct wake_up_pipe {
+    wake_up_pipe() {
+      if (pipe(handles) == -1) return;
+      for (auto handle : handles) {
+        fcntl(handle, F_SETFL, fcntl(handle, F_GETFL, 0) | O_NONBLOCK);
+        fcntl(handle, F_SETFD, FD_CLOEXEC);
+      }
+    }
+    ~wake_up_pipe() {
+      for (auto handle : handles)
+        if (handle != -1) ::close(handle);
+    }
+    
+    int32_t handles[2] = {-1, -1};
+  };
+  
+  struct poller_data {
+    mutex sync_root;
+    map<intmax_t, registration> registrations;
+    vector<int32_t> waiters;
+    atomic<bool> interrupted = false;
+  };
+  
+  // Must be called with the sync_root locked.
+  void wake_up(poller_data& data) {
+    auto value = uint8_t {1};
+    for (auto waiter : data.waiters)
+      [[maybe_unused]] auto result = ::write(waiter, &value, sizeof(value));
+  }
+  
+  int16_t to_native_events(int32_t events) {
+    auto native_events = int16_t {0};
+    if ((events & SOCKET_POLLER_EVENT_READ) == SOCKET_POLLER_EVENT_READ) native_events |= POLLIN;
+    if ((events & SOCKET_POLLER_EVENT_WRITE) == SOCKET_POLLER_EVENT_WRITE) native_events |= POLLOUT;
+    return native_events;
+  }
+  
+  int32_t to_socket_poller_events(int16_t native_events) {
+    auto events = 0;
+    if ((native_events & POLLIN) == POLLIN) events |= SOCKET_POLLER_EVENT_READ;
+    if ((native_events & POLLOUT) == POLLOUT) events |= SOCKET_POLLER_EVENT_WRITE;
+    if ((native_events & (POLLERR | POLLNVAL)) != 0) events |= SOCKET_POLLER_EVENT_ERROR;
+    if ((native_events & POLLHUP) == POLLHUP) events |= SOCKET_POLLER_EVENT_HANG_UP;
+    return events;
+  }
+}
+
+bool socket_poller::add(intmax_t poller, intmax_t handle, int32_t events, int32_t mode) {
+  auto& data = *reinterpret_cast<poller_data*>(poller);
+  auto lock = lock_guard<mutex> {data.sync_root};
+  if (!data.registrations.emplace(handle, registration {events, mode, true}).second) {
+    errno = EEXIST;
+    return false;
+  }
+  wake_up(data);
+  return true;
+}
+
+intmax_t socket_poller::create() {
+  return reinterpret_cast<intmax_t>(new poller_data {});
+}
+
+void socket_poller::destroy(intmax_t poller) {
+  delete reinterpret_cast<poller_data*>(poller);
+}
+
+void socket_poller::interrupt(intmax_t poller) {
+  auto& data = *reinterpret_cast<poller_data*>(poller);
+  auto lock = lock_guard<mutex> {data.sync_root};
+  data.interrupted = true;
+  wake_up(data);
+}
+
+bool socket_poller::modify(intmax_t poller, intmax_t handle, int32_t events, int32_t mode) {
+  auto& data = *reinterpret_cast<poller_data*>(poller);
+  auto lock = lock_guard<mutex> {data.sync_root};
+  auto iterator = data.registrations.find(handle);
+  if (iterator == data.registrations.end()) {
+    errno = ENOENT;
+    return false;
+  }
+  iterator->second = registration {events, mode, true};
+  wake_up(data);
+  return true;
+}
+
+bool socket_poller::remove(intmax_t poller, intmax_t handle) {
+  auto& data = *reinterpret_cast<poller_data*>(poller);
+  auto lock = lock_guard<mutex> {data.sync_root};
+  if (data.registrations.erase(handle) == 0) {
+    errno = ENOENT;
+    return false;
+  }
+  // The waiting threads stop polling the socket before it is closed and its handle reused.
+  wake_up(data);
+  return true;
+}
+
+int32_t socket_poller::wait(intmax_t poller, vector<intmax_t>& handles, vector<int32_t>& events, int32_t milliseconds) {
+  if (handles.empty()) return -1;
+  static thread_local auto pipe = wake_up_pipe {};
+  if (pipe.handles[0] == -1) return -1;
+  auto& data = *reinterpret_cast<poller_data*>(poller);
+  events.resize(handles.size());
+  static thread_local auto poll_fds = vector<pollfd> {};
+  auto deadline = chrono::steady_clock::now() + chrono::milliseconds {max(milliseconds, 0)};
+  auto timeout = milliseconds;
+  while (!data.interrupted) {
+    poll_fds.assign(1, pollfd {pipe.handles[0], POLLIN, 0});
+    {
+      auto lock = lock_guard<mutex> {data.sync_root};
+      if (data.interrupted) break;
+      data.waiters.push_back(pipe.handles[1]);
+      for (const auto& [handle, registration] : data.registrations)
+        if (registration.enabled) poll_fds.push_back(pollfd {static_cast<int32_t>(handle), to_native_events(registration.events), 0});
+    }
+    
+    auto count = ::poll(poll_fds.data(), static_cast<nfds_t>(poll_fds.size()), timeout);
+    auto error = errno;
+    auto result = 0;
+    {
+      auto lock = lock_guard<mutex> {data.sync_root};
+      data.waiters.erase(find(data.waiters.begin(), data.waiters.end(), pipe.handles[1]));
+      for (auto index = size_t {1}; count > 0 && !data.interrupted && index < poll_fds.size() && static_cast<size_t>(result) < handles.size(); ++index) {
+        if (poll_fds[index].revents == 0) continue;
+        auto iterator = data.registrations.find(poll_fds[index].fd);
+        // Another thread may have reported a one-shot socket first, or the socket may have been removed meanwhile.
+        if (iterator == data.registrations.end() || !iterator->second.enabled) continue;
+        if ((iterator->second.mode & SOCKET_POLLER_MODE_ONE_SHOT) == SOCKET_POLLER_MODE_ONE_SHOT) iterator->second.enabled = false;
+        handles[result] = iterator->first;
+        events[result++] = to_socket_poller_events(poll_fds[index].revents);
+      }
+    }
+    if (count == -1 && error != EINTR) {
+      errno = error;
+      return -1;
+    }
+    if (count > 0 && poll_fds[0].revents != 0) {
+      auto value = uint8_t {0};
+      while (::read(pipe.handles[0], &value, sizeof(value)) > 0);
+    }
+    if (result != 0) return result;
+    if (milliseconds >= 0 && (timeout = static_cast<int32_t>(chrono::duration_cast<chrono::milliseconds>(deadline - chrono::steady_clock::now()).count())) <= 0) break;
+  }
+  return 0;
+}
@@ -0,0 +1,64 @@
+#define UNICODE
+#define __XTD_CORE_NATIVE_LIBRARY__
+#include <xtd/native/memory_mapped_file>
+#include "../../../../include/xtd/native/win32/strings.h"
+#undef __XTD_CORE_NATIVE_LIBRARY__
+#include <Windows.h>
+
+using namespace xtd::native;
+
+bool memory_mapped_file::advise(void* address, size_t size, int32_t advice) {
+  if (advice < 0 || advice > 4) return false;
+  #if defined(_WIN32_WINNT) && _WIN32_WINNT >= 0x0602
+  if (advice == 3) {
+    auto range = WIN32_MEMORY_RANGE_ENTRY {address, size};
+    return PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0) != FALSE;
+  }
+  #endif
+  // Windows has no equivalent for the other hints; the cache manager already detects sequential access.
+  return true;
+}
+
+size_t memory_mapped_file::allocation_granularity() {
+  auto system_info = SYSTEM_INFO {};
+  GetSystemInfo(&system_info);
+  return static_cast<size_t>(system_info.dwAllocationGranularity);
+}
+
+void memory_mapped_file::close(intmax_t handle) {
+  if (reinterpret_cast<HANDLE>(handle) != INVALID_HANDLE_VALUE) CloseHandle(reinterpret_cast<HANDLE>(handle));
+}
+
+bool memory_mapped_file::flush(void* address, size_t size) {
+  return FlushViewOfFile(address, size) != FALSE;
+}
+
+void* memory_mapped_file::map(intmax_t handle, size_t offset, size_t size, bool writable) {
+  // The view keeps a reference to the mapping object, so the mapping handle can be closed as soon as the view is mapped.
+  auto mapping = CreateFileMapping(reinterpret_cast<HANDLE>(handle), nullptr, writable ? PAGE_READWRITE : PAGE_READONLY, 0, 0, nullptr);
+  if (mapping == nullptr) return nullptr;
+  auto address = MapViewOfFile(mapping, writable ? FILE_MAP_WRITE : FILE_MAP_READ, static_cast<DWORD>(static_cast<uint64_t>(offset) >> 32), static_cast<DWORD>(offset & 0xFFFFFFFF), size);
+  CloseHandle(mapping);
+  return address;
+}
+
+intmax_t memory_mapped_file::open(const std::string& path, bool writable) {
+  auto handle = CreateFile(win32::strings::to_wstring(path).c_str(), writable ? GENERIC_READ | GENERIC_WRITE : GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  return reinterpret_cast<intmax_t>(handle);
+}
+
+bool memory_mapped_file::set_size(intmax_t handle, size_t size) {
+  auto distance = LARGE_INTEGER {};
+  distance.QuadPart = static_cast<LONGLONG>(size);
+  return SetFilePointerEx(reinterpret_cast<HANDLE>(handle), distance, nullptr, FILE_BEGIN) != FALSE && SetEndOfFile(reinterpret_cast<HANDLE>(handle)) != FALSE;
+}
+
+size_t memory_mapped_file::size(intmax_t handle) {
+  auto size = LARGE_INTEGER {};
+  if (GetFileSizeEx(reinterpret_cast<HANDLE>(handle), &size) == FALSE) return 0;
+  return static_cast<size_t>(size.QuadPart);
+}
+
+bool memory_mapped_file::unmap(void* address, size_t size) {
+  return UnmapViewOfFile(address) != FALSE;
+}
@@ -9,9 +9,12 @@
 #include <xtd/native/socket_shutdown_constants>
 #include <xtd/native/socket_type_constants>
 #undef __XTD_CORE_NATIVE_LIBRARY__
+#include "../../../../include/xtd/native/win32/strings.h"
+#include <algorithm>
 #include <map>
 #include <Winsock2.h>
 #include <Windows.h>
+#include <Mswsock.h>
 
 using namespace std;
 using namespace xtd::native;
@@ -115,6 +118,11 @@ int32_t socket::get_raw_socket_option(intmax_t handle, int32_t socket_option_lev
   return ::getsockopt(static_cast<SOCKET>(handle), socket_option_level, socket_option_name, reinterpret_cast<char*>(option), reinterpret_cast<int32_t*>(&option_length));
 }
 
+int32_t socket::get_socket_name(intmax_t handle, vector<uint8_t>& socket_address) {
+  auto address_length = static_cast<int32_t>(socket_address.size());
+  return ::getsockname(static_cast<SOCKET>(handle), reinterpret_cast<SOCKADDR*>(socket_address.data()), &address_length);
+}
+
 int32_t socket::get_socket_option(intmax_t handle, int32_t socket_option_level, int32_t socket_option_name, intmax_t option, size_t& option_length) {
   return ::getsockopt(static_cast<SOCKET>(handle), socket_option_level_to_native(socket_option_level), socket_option_name_to_native(socket_option_name), reinterpret_cast<char*>(option), reinterpret_cast<int32_t*>(&option_length));
 }
@@ -172,16 +180,16 @@ int32_t socket::listen(intmax_t handle, size_t backlog) {
 }
 
 int32_t socket::poll(intmax_t handle, int32_t microseconds, int32_t mode) {
-  if (handle == 0 || microseconds < 0) return -1;
+  if (handle == 0) return -1;
   
   auto timeout = timeval {microseconds / 1000000, microseconds % 1000000};
   auto fdset = fd_set {};
   FD_ZERO(&fdset);
   FD_SET(static_cast<SOCKET>(handle), &fdset);
   switch (mode) {
-    case SELECT_MODE_READ: return ::select(0, &fdset, nullptr, nullptr, microseconds == -1 ? nullptr : &timeout);
-    case SELECT_MODE_WRITE: return ::select(0, nullptr, &fdset, nullptr, microseconds == -1 ? nullptr : &timeout);
-    case SELECT_MODE_ERROR: return ::select(0, nullptr, nullptr, &fdset, microseconds == -1 ? nullptr : &timeout);
+    case SELECT_MODE_READ: return ::select(0, &fdset, nullptr, nullptr, microseconds < 0 ? nullptr : &timeout);
+    case SELECT_MODE_WRITE: return ::select(0, nullptr, &fdset, nullptr, microseconds < 0 ? nullptr : &timeout);
+    case SELECT_MODE_ERROR: return ::select(0, nullptr, nullptr, &fdset, microseconds < 0 ? nullptr : &timeout);
     default: return -1;
   }
 }
@@ -190,6 +198,17 @@ int32_t socket::receive(intmax_t handle, vector<uint8_t>& buffer, size_t offset,
   return static_cast<int32_t>(::recv(static_cast<SOCKET>(handle), reinterpret_cast<char*>(&buffer.data()[offset]), static_cast<int32_t>(size), flags));
 }
 
+int32_t socket::receive(intmax_t handle, const vector<pair<uint8_t*, size_t>>& buffers, int32_t flags) {
+  thread_local auto wsa_buffers = vector<WSABUF> {};
+  wsa_buffers.clear();
+  for (const auto& [data, size] : buffers)
+    wsa_buffers.push_back({static_cast<ULONG>(size), reinterpret_cast<CHAR*>(data)});
+  auto number_of_bytes_received = DWORD {0};
+  auto wsa_flags = static_cast<DWORD>(flags);
+  if (WSARecv(static_cast<SOCKET>(handle), wsa_buffers.data(), static_cast<DWORD>(wsa_buffers.size()), &number_of_bytes_received, &wsa_flags, nullptr, nullptr) == SOCKET_ERROR) return -1;
+  return static_cast<int32_t>(number_of_bytes_received);
+}
+
 int32_t socket::receive_from(intmax_t handle, vector<uint8_t>& buffer, size_t offset, size_t size, int32_t flags, vector<uint8_t>& socket_address) {
   auto address_length = static_cast<int32_t>(socket_address.size());
   auto result = static_cast<int32_t>(::recvfrom(static_cast<SOCKET>(handle), reinterpret_cast<char*>(&buffer.data()[offset]), static_cast<int32_t>(size), flags, reinterpret_cast<SOCKADDR*>(socket_address.data()), &address_length));
@@ -197,6 +216,22 @@ int32_t socket::receive_from(intmax_t handle, vector<uint8_t>& buffer, size_t of
   return result;
 }
 
+int32_t socket::receive_from(intmax_t handle, const vector<pair<uint8_t*, size_t>>& buffers, const vector<pair<uint8_t*, size_t>>& socket_addresses, vector<pair<size_t, size_t>>& sizes, int32_t flags) {
+  // There is no recvmmsg : receives the first datagram, then the datagrams already queued, one by one.
+  sizes.clear();
+  for (auto index = size_t {0}; index < buffers.size(); ++index) {
+    if (index != 0 && get_available(handle) == 0) break;
+    auto address_length = static_cast<int32_t>(socket_addresses[index].second);
+    auto result = ::recvfrom(static_cast<SOCKET>(handle), reinterpret_cast<char*>(buffers[index].first), static_cast<int32_t>(buffers[index].second), flags, reinterpret_cast<SOCKADDR*>(socket_addresses[index].first), &address_length);
+    auto truncated = result == SOCKET_ERROR && WSAGetLastError() == WSAEMSGSIZE;
+    if (result == SOCKET_ERROR && !truncated && index != 0) break;
+    if (result == SOCKET_ERROR && !truncated) return -1;
+    auto size = truncated ? buffers[index].second + 1 : static_cast<size_t>(result);
+    sizes.push_back({size, size});
+  }
+  return static_cast<int32_t>(sizes.size());
+}
+
 int32_t socket::select(vector<intmax_t>& check_read, vector<intmax_t>& check_write, vector<intmax_t>& check_error, int32_t microseconds) {
   auto nfds = size_t {};
   
@@ -247,15 +282,62 @@ int32_t socket::send(intmax_t handle, const vector<uint8_t>& buffer, size_t offs
   return static_cast<int32_t>(::send(static_cast<SOCKET>(handle), reinterpret_cast<const char*>(&buffer.data()[offset]), static_cast<int32_t>(size), flags));
 }
 
+int32_t socket::send(intmax_t handle, const vector<pair<const uint8_t*, size_t>>& buffers, int32_t flags) {
+  thread_local auto wsa_buffers = vector<WSABUF> {};
+  wsa_buffers.clear();
+  for (const auto& [data, size] : buffers)
+    wsa_buffers.push_back({static_cast<ULONG>(size), reinterpret_cast<CHAR*>(const_cast<uint8_t*>(data))});
+  auto number_of_bytes_sent = DWORD {0};
+  if (WSASend(static_cast<SOCKET>(handle), wsa_buffers.data(), static_cast<DWORD>(wsa_buffers.size()), &number_of_bytes_sent, static_cast<DWORD>(flags), nullptr, nullptr) == SOCKET_ERROR) return -1;
+  return static_cast<int32_t>(number_of_bytes_sent);
+}
+
+int64_t socket::send_file(intmax_t handle, const string& path, int64_t offset, int64_t count) {
+  auto file = CreateFile(win32::strings::to_wstring(path).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+  if (file == INVALID_HANDLE_VALUE) return -1;
+  auto file_size = LARGE_INTEGER {};
+  auto result = GetFileSizeEx(file, &file_size) != FALSE;
+  auto available = max<int64_t>(file_size.QuadPart - offset, 0);
+  auto size = count < 0 ? available : min<int64_t>(count, available);
+  auto sent = int64_t {0};
+  while (result && sent < size) {
+    // TransmitFile sends from the file system cache without going through the user space. It transfers at most 2,147,483,646 bytes per call.
+    auto position = LARGE_INTEGER {};
+    position.QuadPart = offset + sent;
+    auto length = static_cast<DWORD>(min<int64_t>(size - sent, 0x7ffffffe));
+    result = SetFilePointerEx(file, position, nullptr, FILE_BEGIN) != FALSE && TransmitFile(static_cast<SOCKET>(handle), file, length, 0, nullptr, nullptr, 0) != FALSE;
+    if (result) sent += length;
+  }
+  auto error = WSAGetLastError();
+  CloseHandle(file);
+  WSASetLastError(error);
+  return result ? sent : -1;
+}
+
 int32_t socket::send_to(intmax_t handle, const vector<uint8_t>& buffer, size_t offset, size_t size, int32_t flags, const vector<uint8_t>& socket_address) {
   return static_cast<int32_t>(::sendto(static_cast<SOCKET>(handle), reinterpret_cast<const char*>(&buffer.data()[offset]), static_cast<int32_t>(size), flags, reinterpret_cast<const SOCKADDR*>(socket_address.data()), static_cast<int32_t>(socket_address.size())));
 }
 
+int32_t socket::send_to(intmax_t handle, const vector<pair<const uint8_t*, size_t>>& buffers, const vector<pair<const uint8_t*, size_t>>& socket_addresses, int32_t flags) {
+  // There is no sendmmsg : sends the datagrams one by one, and stops at the first error.
+  auto count = size_t {0};
+  for (; count < buffers.size(); ++count) {
+    auto result = ::sendto(static_cast<SOCKET>(handle), reinterpret_cast<const char*>(buffers[count].first), static_cast<int32_t>(buffers[count].second), flags, reinterpret_cast<const SOCKADDR*>(socket_addresses[count].first), socket_addresses[count].first ? static_cast<int32_t>(socket_addresses[count].second) : 0);
+    if (result == SOCKET_ERROR && count == 0) return -1;
+    if (result == SOCKET_ERROR) break;
+  }
+  return static_cast<int32_t>(count);
+}
+
 int32_t socket::set_blocking(intmax_t handle, bool blocking) {
   auto mode = u_long {blocking ? 0ul : 1ul};
   return ioctlsocket(static_cast<SOCKET>(handle), FIONBIO, &mode);
 }
 
+bool socket::set_receive_offload(intmax_t handle, bool enabled) {
+  return !enabled;
+}
+
 int32_t socket::set_raw_socket_option(intmax_t handle, int32_t socket_option_level, int32_t socket_option_name, intmax_t option, size_t option_length) {
   return setsockopt(static_cast<SOCKET>(handle), socket_option_level, socket_option_name, reinterpret_cast<const char*>(option), static_cast<int32_t>(option_length));
 }
@@ -0,0 +1,126 @@
+#define UNICODE
+#define __XTD_CORE_NATIVE_LIBRARY__
+#include <xtd/native/socket_poller>
+#include <xtd/native/socket_poller_constants>
+#undef __XTD_CORE_NATIVE_LIBRARY__
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <Winsock2.h>
+#include <Windows.h>
+
+using namespace std;
+using namespace xtd::native;
+
+namespace {
+  // The poller is emulated with WSAPoll : edge-triggered mode is handled as level-triggered mode, which reports a superset of the events.
+  struct registration {
+    int32_t events = 0;
+    int32_t mode = 0;
+    bool enabled = true;
+  };
+  
+  struct poller_data {
+    mutex sync_root;
+    map<intmax_t, registration> registrations;
+    atomic<bool> interrupted = false;
+  };
+  
+  // WSAPoll cannot be woken up : waiting threads rebuild their set of sockets and check for interruption at this interval.
+  constexpr int32_t maximum_slice = 50;
+  
+  SHORT to_native_events(int32_t events) {
+    auto native_events = SHORT {0};
+    if ((events & SOCKET_POLLER_EVENT_READ) == SOCKET_POLLER_EVENT_READ) native_events |= POLLIN;
+    if ((events & SOCKET_POLLER_EVENT_WRITE) == SOCKET_POLLER_EVENT_WRITE) native_events |= POLLOUT;
+    return native_events;
+  }
+  
+  int32_t to_socket_poller_events(SHORT native_events) {
+    auto events = 0;
+    if ((native_events & POLLIN) != 0) events |= SOCKET_POLLER_EVENT_READ;
+    if ((native_events & POLLOUT) != 0) events |= SOCKET_POLLER_EVENT_WRITE;
+    if ((native_events & (POLLERR | POLLNVAL)) != 0) events |= SOCKET_POLLER_EVENT_ERROR;
+    if ((native_events & POLLHUP) == POLLHUP) events |= SOCKET_POLLER_EVENT_HANG_UP;
+    return events;
+  }
+}
+
+bool socket_poller::add(intmax_t poller, intmax_t handle, int32_t events, int32_t mode) {
+  auto& data = *reinterpret_cast<poller_data*>(poller);
+  auto lock = lock_guard<mutex> {data.sync_root};
+  if (data.registrations.emplace(handle, registration {events, mode, true}).second) return true;
+  WSASetLastError(WSAEINVAL);
+  return false;
+}
+
+intmax_t socket_poller::create() {
+  return reinterpret_cast<intmax_t>(new poller_data {});
+}
+
+void socket_poller::destroy(intmax_t poller) {
+  delete reinterpret_cast<poller_data*>(poller);
+}
+
+void socket_poller::interrupt(intmax_t poller) {
+  reinterpret_cast<poller_data*>(poller)->interrupted = true;
+}
+
+bool socket_poller::modify(intmax_t poller, intmax_t handle, int32_t events, int32_t mode) {
+  auto& data = *reinterpret_cast<poller_data*>(poller);
+  auto lock = lock_guard<mutex> {data.sync_root};
+  auto iterator = data.registrations.find(handle);
+  if (iterator == data.registrations.end()) {
+    WSASetLastError(WSAEINVAL);
+    return false;
+  }
+  iterator->second = registration {events, mode, true};
+  return true;
+}
+
+bool socket_poller::remove(intmax_t poller, intmax_t handle) {
+  auto& data = *reinterpret_cast<poller_data*>(poller);
+  auto lock = lock_guard<mutex> {data.sync_root};
+  if (data.registrations.erase(handle) != 0) return true;
+  WSASetLastError(WSAEINVAL);
+  return false;
+}
+
+int32_t socket_poller::wait(intmax_t poller, vector<intmax_t>& handles, vector<int32_t>& events, int32_t milliseconds) {
+  if (handles.empty()) return -1;
+  auto& data = *reinterpret_cast<poller_data*>(poller);
+  events.resize(handles.size());
+  static thread_local auto poll_fds = vector<WSAPOLLFD> {};
+  auto remaining = milliseconds;
+  while (!data.interrupted) {
+    poll_fds.clear();
+    {
+      auto lock = lock_guard<mutex> {data.sync_root};
+      for (const auto& [handle, registration] : data.registrations)
+        if (registration.enabled) poll_fds.push_back(WSAPOLLFD {static_cast<SOCKET>(handle), to_native_events(registration.events), 0});
+    }
+    
+    auto slice = remaining < 0 || remaining > maximum_slice ? maximum_slice : remaining;
+    // WSAPoll fails with an empty set of sockets.
+    auto count = poll_fds.empty() ? (Sleep(static_cast<DWORD>(slice)), 0) : WSAPoll(poll_fds.data(), static_cast<ULONG>(poll_fds.size()), slice);
+    if (count == SOCKET_ERROR) return -1;
+    if (data.interrupted) break;
+    
+    auto result = 0;
+    {
+      auto lock = lock_guard<mutex> {data.sync_root};
+      for (auto index = size_t {0}; count > 0 && index < poll_fds.size() && static_cast<size_t>(result) < handles.size(); ++index) {
+        if (poll_fds[index].revents == 0) continue;
+        auto iterator = data.registrations.find(static_cast<intmax_t>(poll_fds[index].fd));
+        // Another thread may have reported a one-shot socket first, or the socket may have been removed meanwhile.
+        if (iterator == data.registrations.end() || !iterator->second.enabled) continue;
+        if ((iterator->second.mode & SOCKET_POLLER_MODE_ONE_SHOT) == SOCKET_POLLER_MODE_ONE_SHOT) iterator->second.enabled = false;
+        handles[result] = iterator->first;
+        events[result++] = to_socket_poller_events(poll_fds[index].revents);
+      }
+    }
+    if (result != 0) return result;
+    if (remaining >= 0 && (remaining -= slice) <= 0) break;
+  }
+  return 0;
+}
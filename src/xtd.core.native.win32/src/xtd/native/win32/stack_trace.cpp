@@ -2,8 +2,11 @@
 #include <xtd/native/stack_trace>
 #undef __XTD_CORE_NATIVE_LIBRARY__
 #include <StackWalker.h>
+#include <Windows.h>
+#include <DbgHelp.h>
 #include <cstddef>
 #include <cstdint>
+#include <mutex>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -30,6 +33,31 @@ private:
   frames frames_;
 };
 
+size_t stack_trace::get_addresses(size_t skip_frames, void** addresses, size_t max_count) {
+  return static_cast<size_t>(CaptureStackBackTrace(static_cast<DWORD>(skip_frames + 1), static_cast<DWORD>(max_count > 0xFFFF ? 0xFFFF : max_count), addresses, nullptr));
+}
+
+stack_trace::frame stack_trace::get_frame(void* address) {
+  // DbgHelp functions are single threaded.
+  static auto sync_root = std::mutex {};
+  auto lock = std::lock_guard<std::mutex> {sync_root};
+  static auto initialized = SymInitialize(GetCurrentProcess(), nullptr, TRUE);
+  if (!initialized) return {};
+  
+  auto symbol_buffer = std::vector<char>(sizeof(SYMBOL_INFO) + MAX_SYM_NAME);
+  auto symbol = reinterpret_cast<SYMBOL_INFO*>(symbol_buffer.data());
+  symbol->SizeOfStruct = sizeof(SYMBOL_INFO);
+  symbol->MaxNameLen = MAX_SYM_NAME;
+  auto displacement = DWORD64 {0};
+  if (!SymFromAddr(GetCurrentProcess(), reinterpret_cast<DWORD64>(address), &displacement, symbol)) return {};
+  
+  auto line = IMAGEHLP_LINE64 {};
+  line.SizeOfStruct = sizeof(IMAGEHLP_LINE64);
+  auto line_displacement = DWORD {0};
+  if (!SymGetLineFromAddr64(GetCurrentProcess(), reinterpret_cast<DWORD64>(address), &line_displacement, &line)) return make_tuple(std::string {}, 0, 0, std::string {symbol->Name}, static_cast<size_t>(displacement));
+  return make_tuple(std::string {line.FileName}, static_cast<size_t>(line.LineNumber), static_cast<size_t>(line_displacement), std::string {symbol->Name}, static_cast<size_t>(displacement));
+}
+
 stack_trace::frames stack_trace::get_frames(size_t skip_frames) {
   auto sw = stack_walker {};
   if (!sw.ShowCallstack()) return {};
@@ -0,0 +1,113 @@
+/// @file
+/// @brief Contains memory_mapped_file API.
+/// @copyright Copyright (c) 2024 Gammasoft. All rights reserved.
+#pragma once
+/// @cond
+#if !defined(__XTD_CORE_NATIVE_LIBRARY__)
+#error "Do not include this file: Internal use only"
+#endif
+/// @endcond
+
+#include <xtd/core_native_export>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
+namespace xtd {
+  /// @cond
+  namespace io {
+    class memory_mapped_file;
+    class memory_mapped_view_accessor;
+  }
+  /// @endcond
+  
+  /// @brief The xtd::native namespace contains internal native API definitions to access underlying operating system components used by xtd.core library.
+  /// @warning Internal use only
+  namespace native {
+    /// @brief Contains memory_mapped_file native API.
+    /// @par Namespace
+    /// xtd::native
+    /// @par Library
+    /// xtd.core.native
+    /// @ingroup xtd_core_native native
+    /// @warning Internal use only
+    class core_native_export_ memory_mapped_file final {
+      memory_mapped_file() = delete;
+      friend xtd::io::memory_mapped_file;
+      friend xtd::io::memory_mapped_view_accessor;
+    protected:
+      /// @name Protected Static Methods
+      
+      /// @{
+      /// @brief Gives an access pattern hint for the specified mapped view.
+      /// @param address The address of the mapped view.
+      /// @param size The size of the mapped view.
+      /// @param advice The advice :
+      ///  * 0 : normal
+      ///  * 1 : sequential
+      ///  * 2 : random
+      ///  * 3 : will need
+      ///  * 4 : don't need
+      /// @return true if succeed; otherwise false.
+      /// @remarks Hints not supported by the operating system are ignored.
+      /// @warning Internal use only
+      static bool advise(void* address, size_t size, int32_t advice);
+      
+      /// @brief Gets the granularity for the offset of a mapped view.
+      /// @return The allocation granularity in bytes.
+      /// @warning Internal use only
+      static size_t allocation_granularity();
+      
+      /// @brief Closes the specified file handle.
+      /// @param handle The file handle to close.
+      /// @remarks The views already mapped remain valid after the file handle is closed.
+      /// @warning Internal use only
+      static void close(intmax_t handle);
+      
+      /// @brief Writes the modified pages of the specified mapped view to the file.
+      /// @param address The address of the mapped view.
+      /// @param size The size of the mapped view.
+      /// @return true if succeed; otherwise false.
+      /// @warning Internal use only
+      static bool flush(void* address, size_t size);
+      
+      /// @brief Maps a view of the specified file handle into memory.
+      /// @param handle The file handle to map.
+      /// @param offset The offset in the file where the view starts. Must be a multiple of xtd::native::memory_mapped_file::allocation_granularity.
+      /// @param size The size of the view.
+      /// @param writable true if the view can be written; otherwise false.
+      /// @return The address of the mapped view if succeed; otherwise nullptr.
+      /// @warning Internal use only
+      static void* map(intmax_t handle, size_t offset, size_t size, bool writable);
+      
+      /// @brief Opens the specified file for mapping.
+      /// @param path The path of the file to open.
+      /// @param writable true if the file is opened for reading and writing; otherwise false.
+      /// @return The file handle if succeed; otherwise -1.
+      /// @warning Internal use only
+      static intmax_t open(const std::string& path, bool writable);
+      
+      /// @brief Sets the size of the specified file handle.
+      /// @param handle The file handle.
+      /// @param size The new size of the file.
+      /// @return true if succeed; otherwise false.
+      /// @warning Internal use only
+      static bool set_size(intmax_t handle, size_t size);
+      
+      /// @brief Gets the size of the specified file handle.
+      /// @param handle The file handle.
+      /// @return The size of the file.
+      /// @warning Internal use only
+      static size_t size(intmax_t handle);
+      
+      /// @brief Unmaps the specified mapped view.
+      /// @param address The address of the mapped view.
+      /// @param size The size of the mapped view.
+      /// @return true if succeed; otherwise false.
+      /// @warning Internal use only
+      static bool unmap(void* address, size_t size);
+      /// @}
+    };
+  }
+}
@@ -10,6 +10,7 @@
 
 #include <xtd/core_native_export>
 #include <string>
+#include <utility>
 #include <vector>
 #include <cstdint>
 
@@ -24,6 +25,9 @@ namespace xtd {
     class socket_address;
     namespace sockets {
       class socket;
+      class socket_io_engine;
+      class socket_poller;
+      class udp_client;
     }
   }
   /// @endcond
@@ -43,6 +47,9 @@ namespace xtd {
       friend __using_socket__;
       friend xtd::net::socket_address;
       friend xtd::net::sockets::socket;
+      friend xtd::net::sockets::socket_io_engine;
+      friend xtd::net::sockets::socket_poller;
+      friend xtd::net::sockets::udp_client;
     protected:
       /// @name Protected Methods
       
@@ -115,6 +122,12 @@ namespace xtd {
       /// @return Zero (0) if succeed; otherwise on error.
       /// @warning Internal use only
       static int32_t get_raw_socket_option(intmax_t handle, int32_t socket_option_level, int32_t socket_option_name, intmax_t option, size_t& option_length);
+      /// @brief Gets the address to which a socket is bound.
+      /// @param handle The socket handle.
+      /// @param socket_address A byte array that receives the socket address.
+      /// @return Zero (0) if succeed; otherwise on error.
+      /// @warning Internal use only
+      static int32_t get_socket_name(intmax_t handle, std::vector<uint8_t>& socket_address);
       /// @brief Gets options on socket.
       /// @param handle The socket handle.
       /// @param socket_option_level One of socket option level values (see socket_option_level_constants.h).
@@ -163,9 +176,9 @@ namespace xtd {
       static int32_t listen(intmax_t handle, size_t backlog);
       /// @brief Synchronous I/O multiplexing
       /// @param handle The socket handle.
-      /// @param microseconds Timeout in microseconds.
+      /// @param microseconds Timeout in microseconds. A negative value indicates an infinite time-out.
       /// @param mode One of select mode value (see select_mode_constants.h).
-      /// @return Zero (0) if succeed; otherwise on error.
+      /// @return 1 if the socket is ready for the specified mode, 0 if the timeout expired; -1 on error.
       /// @warning Internal use only
       static int32_t poll(intmax_t handle, int32_t microseconds, int32_t mode);
       /// @brief Receives a message from a socket.
@@ -177,6 +190,14 @@ namespace xtd {
       /// @return Zero (0) if succeed; otherwise on error.
       /// @warning Internal use only
       static int32_t receive(intmax_t handle, std::vector<uint8_t>& buffer, size_t offset, size_t size, int32_t flags);
+      /// @brief Receives data from a connected socket into several buffers with a single call.
+      /// @param handle The socket handle.
+      /// @param buffers The storage locations for the received data, as pairs of address and size. They are filled in order.
+      /// @param flags A bitwise combination of the socket flags values. (see socket_flags_constants.h)
+      /// @return The number of bytes received if succeed; otherwise -1.
+      /// @remarks Only the first buffers are used if there are more buffers than the operating system supports for one call.
+      /// @warning Internal use only
+      static int32_t receive(intmax_t handle, const std::vector<std::pair<uint8_t*, size_t>>& buffers, int32_t flags);
       /// @brief Receives a message from a socket.
       /// @param handle The socket handle.
       /// @param buffer An array of type byte that is the storage location for the received data.
@@ -187,12 +208,22 @@ namespace xtd {
       /// @return Zero (0) if succeed; otherwise on error.
       /// @warning Internal use only
       static int32_t receive_from(intmax_t handle, std::vector<uint8_t>& buffer, size_t offset, size_t size, int32_t flags, std::vector<uint8_t>& socket_address);
+      /// @brief Receives several datagrams from a socket with as few calls as possible.
+      /// @param handle The socket handle.
+      /// @param buffers The storage locations for the received datagrams, as pairs of address and size. One datagram is received in each buffer.
+      /// @param socket_addresses The storage locations for the socket addresses of the senders, as pairs of address and size. There is one socket address for each buffer.
+      /// @param sizes Receives, for each datagram received, its size and the size of its segments. The size is greater than the size of its buffer when the datagram was truncated. The segment size is smaller than the size when the operating system coalesced several datagrams (see xtd::native::socket::set_receive_offload).
+      /// @param flags A bitwise combination of the socket flags values. (see socket_flags_constants.h)
+      /// @return The number of datagrams received if succeed; otherwise -1.
+      /// @remarks The method waits for the first datagram, then only receives the datagrams already queued.
+      /// @warning Internal use only
+      static int32_t receive_from(intmax_t handle, const std::vector<std::pair<uint8_t*, size_t>>& buffers, const std::vector<std::pair<uint8_t*, size_t>>& socket_addresses, std::vector<std::pair<size_t, size_t>>& sizes, int32_t flags);
       /// @brief Determines the status of one or more sockets.
       /// @param check_read An IList of Socket instances to check for readability.
       /// @param check_write An IList of Socket instances to check for writability.
       /// @param check_error An IList of Socket instances to check for errors.
       /// @param microseconds The time-out value, in microseconds. A -1 value indicates an infinite time-out.
-      /// @return Zero (0) if succeed; otherwise on error.
+      /// @return The number of ready sockets, 0 if the timeout expired; -1 on error. The handles of the sockets that are not ready are set to 0.
       /// @warning Internal use only
       static int32_t select(std::vector<intmax_t>& check_read, std::vector<intmax_t>& check_write, std::vector<intmax_t>& check_error, int32_t microseconds);
       /// @brief send a message from a socket.
@@ -203,6 +234,23 @@ namespace xtd {
       /// @return Zero (0) if succeed; otherwise on error.
       /// @warning Internal use only
       static int32_t send(intmax_t handle, const std::vector<uint8_t>& buffer, size_t offset, size_t size, int32_t flags);
+      /// @brief Sends several buffers to a connected socket with a single call.
+      /// @param handle The socket handle.
+      /// @param buffers The data to send, as pairs of address and size. They are sent in order.
+      /// @param flags A bitwise combination of the socket flags values. (see socket_flags_constants.h)
+      /// @return The number of bytes sent if succeed; otherwise -1.
+      /// @remarks Only the first buffers are used if there are more buffers than the operating system supports for one call.
+      /// @warning Internal use only
+      static int32_t send(intmax_t handle, const std::vector<std::pair<const uint8_t*, size_t>>& buffers, int32_t flags);
+      /// @brief Sends a part of a file to a connected socket, without copying it through the user space when the operating system allows it.
+      /// @param handle The socket handle.
+      /// @param path The path of the file to send.
+      /// @param offset The position in the file at which to begin sending data.
+      /// @param count The number of bytes to send, or -1 to send the file up to its end.
+      /// @return The number of bytes sent if succeed; otherwise -1.
+      /// @remarks The method returns when all the bytes are sent, the end of file is reached, or an error occurs. It waits for the socket to become writable if the socket is in non-blocking mode.
+      /// @warning Internal use only
+      static int64_t send_file(intmax_t handle, const std::string& path, int64_t offset, int64_t count);
       /// @brief send a message from a socket.
       /// @param handle The socket handle.
       /// @param buffer An array of type Byte that contains the data to be sent.
@@ -213,12 +261,27 @@ namespace xtd {
       /// @return Zero (0) if succeed; otherwise on error.
       /// @warning Internal use only
       static int32_t send_to(intmax_t handle, const std::vector<uint8_t>& buffer, size_t offset, size_t size, int32_t flags, const std::vector<uint8_t>& socket_address);
+      /// @brief Sends several datagrams from a socket with as few calls as possible.
+      /// @param handle The socket handle.
+      /// @param buffers The datagrams to send, as pairs of address and size.
+      /// @param socket_addresses The socket addresses to send each datagram to, as pairs of address and size. A nullptr address sends the datagram to the connected remote host.
+      /// @param flags A bitwise combination of the socket flags values. (see socket_flags_constants.h)
+      /// @return The number of datagrams sent if succeed; otherwise -1. The number can be less than the number of datagrams.
+      /// @remarks When the operating system supports segmentation offload, consecutive datagrams of the same size sent to the same remote host are sent as one message.
+      /// @warning Internal use only
+      static int32_t send_to(intmax_t handle, const std::vector<std::pair<const uint8_t*, size_t>>& buffers, const std::vector<std::pair<const uint8_t*, size_t>>& socket_addresses, int32_t flags);
       /// @brief Sets a value that indicates whether the socket is in blocking mode.
       /// @param handle The socket handle.
       /// @param blocking bool true if the Socket will block; otherwise, false. The default is true
       /// @return Zero (0) if succeed; otherwise on error.
       /// @warning Internal use only
       static int32_t set_blocking(intmax_t handle, bool blocking);
+      /// @brief Sets a value that indicates whether the operating system can coalesce the datagrams received from the same remote host.
+      /// @param handle The socket handle.
+      /// @param enabled true to enable generic receive offload; otherwise false.
+      /// @return true if succeed; otherwise false. Enabling fails when the operating system does not support generic receive offload.
+      /// @warning Internal use only
+      static bool set_receive_offload(intmax_t handle, bool enabled);
       /// @brief Sets options on socket.
       /// @param handle The socket handle.
       /// @param socket_option_level The platform-defined option name.
@@ -0,0 +1,99 @@
+/// @file
+/// @brief Contains socket_poller API.
+/// @copyright Copyright (c) 2024 Gammasoft. All rights reserved.
+#pragma once
+/// @cond
+#if !defined(__XTD_CORE_NATIVE_LIBRARY__)
+#error "Do not include this file: Internal use only"
+#endif
+/// @endcond
+
+#include <xtd/core_native_export>
+#include <cstdint>
+#include <vector>
+
+/// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
+namespace xtd {
+  /// @cond
+  namespace net {
+    namespace sockets {
+      class socket_io_engine;
+      class socket_poller;
+    }
+  }
+  /// @endcond
+  
+  /// @brief The xtd::native namespace contains internal native API definitions to access underlying operating system components used by xtd.core library.
+  /// @warning Internal use only
+  namespace native {
+    /// @brief Contains socket_poller native API.
+    /// @par Namespace
+    /// xtd::native
+    /// @par Library
+    /// xtd.core.native
+    /// @ingroup xtd_core_native native
+    /// @warning Internal use only
+    /// @remarks A socket poller waits for readiness events on a set of sockets. It is safe to call xtd::native::socket_poller::wait from several threads at the same time on the same poller.
+    class core_native_export_ socket_poller final {
+      socket_poller() = delete;
+      friend xtd::net::sockets::socket_io_engine;
+      friend xtd::net::sockets::socket_poller;
+    protected:
+      /// @name Protected Static Methods
+      
+      /// @{
+      /// @brief Adds a socket to the specified poller.
+      /// @param poller The poller handle.
+      /// @param handle The socket handle.
+      /// @param events The events to wait for (see socket_poller_constants.h).
+      /// @param mode The trigger mode (see socket_poller_constants.h).
+      /// @return true if succeed; otherwise false.
+      /// @remarks Error and hang up events are always reported, even if they are not specified in events.
+      /// @warning Internal use only
+      static bool add(intmax_t poller, intmax_t handle, int32_t events, int32_t mode);
+      
+      /// @brief Creates a new poller.
+      /// @return The poller handle if succeed; otherwise -1.
+      /// @warning Internal use only
+      static intmax_t create();
+      
+      /// @brief Destroys the specified poller.
+      /// @param poller The poller handle.
+      /// @warning Internal use only
+      static void destroy(intmax_t poller);
+      
+      /// @brief Wakes up the threads waiting on the specified poller.
+      /// @param poller The poller handle.
+      /// @remarks After this call, all the current and subsequent calls to xtd::native::socket_poller::wait return immediately. Use it before destroying the poller.
+      /// @warning Internal use only
+      static void interrupt(intmax_t poller);
+      
+      /// @brief Changes the events of a socket already added to the specified poller.
+      /// @param poller The poller handle.
+      /// @param handle The socket handle.
+      /// @param events The events to wait for (see socket_poller_constants.h).
+      /// @param mode The trigger mode (see socket_poller_constants.h).
+      /// @return true if succeed; otherwise false.
+      /// @remarks A socket disabled by SOCKET_POLLER_MODE_ONE_SHOT is enabled again.
+      /// @warning Internal use only
+      static bool modify(intmax_t poller, intmax_t handle, int32_t events, int32_t mode);
+      
+      /// @brief Removes a socket from the specified poller.
+      /// @param poller The poller handle.
+      /// @param handle The socket handle.
+      /// @return true if succeed; otherwise false.
+      /// @warning Internal use only
+      static bool remove(intmax_t poller, intmax_t handle);
+      
+      /// @brief Waits for readiness events on the specified poller.
+      /// @param poller The poller handle.
+      /// @param handles The sockets that are ready. The size of handles on entry is the maximum number of events to return.
+      /// @param events The events of each ready socket (see socket_poller_constants.h). Resized to the size of handles.
+      /// @param milliseconds Timeout in milliseconds, or -1 to wait indefinitely.
+      /// @return The number of ready sockets, 0 if the timeout expired or the poller is interrupted; -1 on error.
+      /// @warning Internal use only
+      static int32_t wait(intmax_t poller, std::vector<intmax_t>& handles, std::vector<int32_t>& events, int32_t milliseconds);
+      /// @}
+    };
+  }
+}
@@ -0,0 +1,67 @@
+/// @file
+/// @brief Contains socket poller constants.
+/// @copyright Copyright (c) 2024 Gammasoft. All rights reserved.
+#pragma once
+/// @cond
+#if !defined(__XTD_CORE_NATIVE_LIBRARY__)
+#error "Do not include this file: Internal use only"
+#endif
+/// @endcond
+
+#include <cstdint>
+
+/// @brief The socket is readable, or a connection is pending on a listening socket.
+/// @par Library
+/// xtd.core.native
+/// @ingroup xtd_core_native socket_poller
+/// @remarks Added specifically for xtd.
+/// @warning Internal use only
+constexpr int32_t SOCKET_POLLER_EVENT_READ = 0b1;
+
+/// @brief The socket is writable, or a pending connection is established.
+/// @par Library
+/// xtd.core.native
+/// @ingroup xtd_core_native socket_poller
+/// @remarks Added specifically for xtd.
+/// @warning Internal use only
+constexpr int32_t SOCKET_POLLER_EVENT_WRITE = 0b10;
+
+/// @brief An error is pending on the socket.
+/// @par Library
+/// xtd.core.native
+/// @ingroup xtd_core_native socket_poller
+/// @remarks Added specifically for xtd.
+/// @warning Internal use only
+constexpr int32_t SOCKET_POLLER_EVENT_ERROR = 0b100;
+
+/// @brief The peer closed the connection.
+/// @par Library
+/// xtd.core.native
+/// @ingroup xtd_core_native socket_poller
+/// @remarks Added specifically for xtd.
+/// @warning Internal use only
+constexpr int32_t SOCKET_POLLER_EVENT_HANG_UP = 0b1000;
+
+/// @brief The events are reported as long as the socket is ready.
+/// @par Library
+/// xtd.core.native
+/// @ingroup xtd_core_native socket_poller
+/// @remarks Added specifically for xtd.
+/// @warning Internal use only
+constexpr int32_t SOCKET_POLLER_MODE_LEVEL_TRIGGERED = 0b0;
+
+/// @brief The events are reported only when the socket becomes ready.
+/// @par Library
+/// xtd.core.native
+/// @ingroup xtd_core_native socket_poller
+/// @remarks Added specifically for xtd.
+/// @warning Internal use only
+constexpr int32_t SOCKET_POLLER_MODE_EDGE_TRIGGERED = 0b1;
+
+/// @brief The socket is disabled after its first event, until it is modified.
+/// @par Library
+/// xtd.core.native
+/// @ingroup xtd_core_native socket_poller
+/// @remarks Added specifically for xtd.
+/// @warning Internal use only
+constexpr int32_t SOCKET_POLLER_MODE_ONE_SHOT = 0b10;
@@ -20,6 +20,7 @@ namespace xtd {
   /// @cond
   namespace diagnostics {
     class stack_frame;
+    class stack_trace;
   }
   /// @endcond
   
@@ -36,6 +37,7 @@ namespace xtd {
     class core_native_export_ stack_trace final {
       stack_trace() = delete;
       friend xtd::diagnostics::stack_frame;
+      friend xtd::diagnostics::stack_trace;
     protected:
       /// @name Protected Aliases
       
@@ -49,6 +51,21 @@ namespace xtd {
       /// @name Protected Static Methods
       
       /// @{
+      /// @brief Gets the return addresses of the current call stack, without resolving them.
+      /// @param skip_frames The number of frames up the stack from which to start the capture.
+      /// @param addresses The array that receives the return addresses.
+      /// @param max_count The number of elements of addresses.
+      /// @return The number of return addresses stored in addresses.
+      /// @remarks No memory is allocated.
+      /// @warning Internal use only
+      static size_t get_addresses(size_t skip_frames, void** addresses, size_t max_count);
+      
+      /// @brief Resolves a return address.
+      /// @param address The return address to resolve.
+      /// @return The frame that contains address. The method name of the frame is empty if address cannot be resolved.
+      /// @warning Internal use only
+      static frame get_frame(void* address);
+      
       /// @brief Play system sound.
       /// @param sound The sound to play (see souund.h).
       /// @warning Internal use only
@@ -4,14 +4,19 @@
 #pragma once
 /// @cond
 #define __XTD_CORE_INTERNAL__
+#include "internal/__case_mapping.h"
+#include "internal/__char_set.h"
 #include "internal/__format_information.h"
+#include "internal/__format_literal.h"
 #include "internal/__sprintf.h"
 #include "internal/__string_definitions.h"
+#include "internal/__unicode_transcoding.h"
 #undef __XTD_CORE_INTERNAL__
 #define __XTD_STD_INTERNAL__
 #include "internal/__xtd_std_version.h"
 #undef __XTD_STD_INTERNAL__
 /// @endcond
+#include "collections/generic/helpers/wrap_pointer_iterator.h"
 #include "collections/generic/ienumerable.h"
 #include "hash_code.h"
 #include "icomparable.h"
@@ -25,18 +30,23 @@
 #include "to_string.h"
 #include "types.h"
 #include "unused.h"
+#include <algorithm>
 #include <cctype>
 #if defined(__xtd__cpp_lib_format)
 #include <format>
 #endif
 #include <iomanip>
+#include <memory>
 #include <ostream>
+#include <span>
 #include <sstream>
 #include <string>
+#include <string_view>
 
 /// @cond
-template<typename ...args_t>
-void __basic_string_extract_format_arg(xtd::basic_string<char>& fmt, std::vector<__format_information<char>>& formats, args_t&&... args);
+template<typename string_t, typename ...args_t>
+void __basic_string_format(std::basic_string<char>& result, const __format_pattern<char>& pattern, args_t&&... args);
+std::shared_ptr<const __format_pattern<char>> __basic_string_parse_format(const std::basic_string<char>& fmt);
 template<typename target_t, typename source_t>
 std::basic_string<target_t> __xtd_convert_to_string(std::basic_string<source_t>&& str) noexcept;
 template<typename target_t, typename source_t>
@@ -98,11 +108,9 @@ namespace xtd {
     /// @brief Represents the basic string const pointer type.
     using const_pointer = typename base_type::const_pointer;
     /// @brief Represents the basic string iterator type.
-    /// @todo replace xtd::ienumerable::iterator
-    using iterator = typename xtd::collections::generic::ienumerable<char_t>::iterator;
+    using iterator = xtd::collections::generic::helpers::wrap_pointer_iterator<pointer>;
     /// @brief Represents the basic string const iterator type.
-    /// @todo replace xtd::ienumerable::const_iterator
-    using const_iterator = typename xtd::collections::generic::ienumerable<char_t>::const_iterator;
+    using const_iterator = xtd::collections::generic::helpers::wrap_pointer_iterator<const_pointer>;
     /// @brief Represents the basic string reverse iterator type.
     using reverse_iterator = typename base_type::reverse_iterator;
     /// @brief Represents the basic string const reverse iterator type.
@@ -741,7 +749,7 @@ namespace xtd {
     
     /// @brief Returns an iterator to the first character of the string.
     /// @return Iterator to the first character.
-    const_iterator begin() const override {return xtd::collections::generic::ienumerable<value_type>::begin();}
+    const_iterator begin() const {return const_iterator {chars_.data()};}
     
     /// @brief Returns a pointer to a null-terminated character array with data equivalent to those stored in the string.
     /// @return Pointer to the underlying character storage.
@@ -759,7 +767,7 @@ namespace xtd {
     
     /// @brief Returns an iterator to the first character of the string.
     /// @return Iterator to the first character.
-    const_iterator cbegin() const override {return xtd::collections::generic::ienumerable<value_type>::cbegin();}
+    const_iterator cbegin() const {return begin();}
     
     /// @brief Returns a reverse iterator to the first character of the string.
     /// @return Reverse iterator to the first character.
@@ -771,7 +779,7 @@ namespace xtd {
 
     /// @brief Returns an iterator to the character following the last character of the string. This character acts as a placeholder, attempting to access it results in undefined behavior.
     /// @return Iterator to the character following the last character.
-    const_iterator cend() const override {return xtd::collections::generic::ienumerable<value_type>::cend();}
+    const_iterator cend() const {return end();}
 
     /// @brief Returns a reverse  iterator to the character following the last character of the string. This character acts as a placeholder, attempting to access it results in undefined behavior.
     /// @return Return iterator to the character following the last character.
@@ -792,7 +800,7 @@ namespace xtd {
     
     /// @brief Returns an iterator to the character following the last character of the string. This character acts as a placeholder, attempting to access it results in undefined behavior.
     /// @return Iterator to the character following the last character.
-    const_iterator end() const override {return xtd::collections::generic::ienumerable<value_type>::end();}
+    const_iterator end() const {return const_iterator {chars_.data() + chars_.size()};}
     
     /// @brief Returns reference to the first character in the string. The behavior is undefined if empty() is true.
     /// @return Reference to the first character, equivalent to `operator[](0)`.
@@ -1031,7 +1039,7 @@ namespace xtd {
     /// @return `true` if the `value` of the value parameter is the same as the value of this instance; otherwise, `false`.
     /// @remarks This method performs an ordinal comparison.
     bool equals(const basic_string& value, bool ignore_case) const noexcept {
-      if (ignore_case) return to_upper().chars_ == value.to_upper().chars_;
+      if (ignore_case) return __xtd_compare_ignore_case(chars_.data(), chars_.size(), value.chars_.data(), value.chars_.size()) == 0;
       return chars_ == value.chars_;
     }
 
@@ -1044,8 +1052,9 @@ namespace xtd {
     /// @param ignore_case true to ignore case during the comparison; otherwise, false.
     /// @return true if value matches the end of this instance; otherwise, false.
     bool ends_with(value_type value, bool ignore_case) const noexcept {
-      if (ignore_case) return to_lower().rfind(static_cast<value_type>(tolower(value))) == size() - 1;
-      return rfind(value) == size() - 1;
+      if (chars_.empty()) return false;
+      if (ignore_case) return __xtd_fold_code_unit(chars_.back()) == __xtd_fold_code_unit(value);
+      return chars_.back() == value;
     }
     /// @brief Determines whether the end of this basic_string matches the specified basic_string.
     /// @param value The basic_string to compare to the substring at the end of this instance.
@@ -1061,8 +1070,8 @@ namespace xtd {
     /// @param comparison_type One of the enumeration values that determines how this basic_string and value are compared.
     /// @return bool true if value matches the end of the specified basic_string; otherwise, false.
     bool ends_with(const basic_string& value, xtd::string_comparison comparison_type) const noexcept {
-      if (comparison_type == xtd::string_comparison::ordinal_ignore_case) return to_lower().rfind(value.to_lower()) + value.to_lower().size() == size();
-      return rfind(value) + value.size() == size();
+      if (comparison_type == xtd::string_comparison::ordinal_ignore_case) return __xtd_ends_with_ignore_case(chars_.data(), chars_.size(), value.chars_.data(), value.chars_.size());
+      return chars_.size() >= value.chars_.size() && chars_.compare(chars_.size() - value.chars_.size(), value.chars_.size(), value.chars_) == 0;
     }
 
     /// @brief Finds the first substring equal to the given character sequence. Search begins at `0`, i.e. the found substring must not begin in a position preceding `0`.
@@ -1293,77 +1302,29 @@ namespace xtd {
     template<typename ...args_t>
     static basic_string format(const basic_string<char>& fmt, args_t&& ... args) {
       auto result = basic_string<char> {};
-      auto index = xtd::size {0};
-      auto formats = std::vector<__format_information<char>> {};
-      auto begin_format_iterator = fmt.end();
-      auto end_format_iterator = fmt.end();
-      for (auto iterator = fmt.begin(); iterator != fmt.end(); ++iterator) {
-        if (*iterator == '{') {
-          if (++iterator == fmt.end())
-            __throw_basic_string_format_exception_open_bracket(__FILE__, __LINE__, __func__);
-          if (*iterator == '{')
-            result += *iterator;
-          else {
-            begin_format_iterator = iterator;
-            while (iterator != fmt.end() && *iterator != '}') ++iterator;
-            if (iterator == fmt.end())
-              __throw_basic_string_format_exception_open_bracket(__FILE__, __LINE__, __func__);
-            end_format_iterator = iterator;
-            __format_information<char> fi;
-            fi.location = result.size();
-            auto format_str = std::basic_string<char> {begin_format_iterator, end_format_iterator};
-            if (format_str.size() == 0)
-              fi.index = index++;
-            else {
-              xtd::size index_alignment_separator = basic_string(format_str).index_of(',');
-              xtd::size index_format_separator = basic_string(format_str).index_of(u':');
-              
-              if (index_alignment_separator != std::basic_string<char>::npos && index_format_separator != std::basic_string<char>::npos && index_alignment_separator > index_format_separator)
-                index_alignment_separator = std::basic_string<char>::npos;
-              
-              if (index_alignment_separator != basic_string<char_t>::npos)
-                fi.alignment = format_str.substr(index_alignment_separator + 1, index_format_separator != std::basic_string<char>::npos ? index_format_separator - index_alignment_separator - 1 : std::basic_string<char>::npos);
-              
-              if (index_format_separator != basic_string<char>::npos)
-                fi.format = format_str.substr(index_format_separator + 1);
-              
-              if (index_alignment_separator == 0 || index_format_separator == 0)
-                fi.index = index++;
-              else {
-                auto index_str = std::basic_string<char> {};
-                if (index_alignment_separator != basic_string<char>::npos)
-                  index_str = format_str.substr(0, index_alignment_separator);
-                else if (index_format_separator != basic_string<char>::npos)
-                  index_str = format_str.substr(0, index_format_separator);
-                else
-                  index_str = std::move(format_str);
-                try {
-                  for (auto c : index_str)
-                    if (!std::isdigit(c)) __throw_basic_string_format_exception_start_colon(__FILE__, __LINE__, __func__);
-                  fi.index = std::stoi(index_str);
-                } catch (...) {
-                  __throw_basic_string_format_exception_start_colon(__FILE__, __LINE__, __func__);
-                }
-              }
-            }
-            formats.push_back(fi);
-          }
-        } else if (*iterator == '}') {
-          if (++iterator == fmt.end()) {
-            __throw_basic_string_format_exception_close_bracket(__FILE__, __LINE__, __func__);
-            break;
-          }
-          if (*iterator != '}') {
-            __throw_basic_string_format_exception_close_bracket(__FILE__, __LINE__, __func__);
-            break;
-          }
-          result += *iterator;
-        } else
-          result += *iterator;
-      }
-      
-      __basic_string_extract_format_arg(result, formats, std::forward<args_t>(args)...);
-      return result.c_str();
+      __basic_string_format<basic_string<char>>(const_cast<std::basic_string<char>&>(result.chars()), *__basic_string_parse_format(fmt.chars()), std::forward<args_t>(args)...);
+      if constexpr (std::is_same_v<char_t, char>) return result;
+      else return result.c_str();
+    }
+
+    /// @brief Writes the text representation of the specified arguments list, to string using the specified format information.
+    /// @tparam fmt A composite format string literal.
+    /// @param args arguments list to write using format.
+    /// @return string formatted.
+    /// @ingroup format_parse
+    /// @remarks The format is parsed and checked while compiling : a malformed format, or an index that does not refer to one of the arguments, does not compile.
+    /// @remarks for more information about format see @ref FormatPage "Format".
+    /// @par Examples
+    /// @code
+    /// auto str = xtd::basic_string<char>::format<"{0} items from {1}">(42, "source");
+    /// @endcode
+    template<__format_literal fmt, typename ...args_t>
+    requires (__format_literal_is_valid<fmt>(sizeof...(args_t)))
+    static basic_string format(args_t&& ... args) {
+      auto result = basic_string<char> {};
+      __basic_string_format<basic_string<char>>(const_cast<std::basic_string<char>&>(result.chars()), __format_literal_pattern<fmt>(), std::forward<args_t>(args)...);
+      if constexpr (std::is_same_v<char_t, char>) return result;
+      else return result.c_str();
     }
 
     /// @brief Returns the allocator associated with the string.
@@ -1387,6 +1348,16 @@ namespace xtd {
         
         bool move_next() override {return ++index_ < chars_.size();}
         
+        std::span<const value_type> move_next_batch() override {
+          auto first = index_ == basic_string::npos ? 0 : index_ + 1;
+          if (first >= chars_.size()) {
+            index_ = chars_.size();
+            return {};
+          }
+          index_ = chars_.size() - 1;
+          return std::span<const value_type> {chars_.data() + first, chars_.size() - first};
+        }
+        
         void reset() override {index_ = basic_string::npos;}
         
       protected:
@@ -1413,8 +1384,8 @@ namespace xtd {
     /// @exception xtd::index_out_of_range_exception start_index + count are greater than the length of this instance.
     xtd::size index_of(const basic_string& value, xtd::size start_index, xtd::size count) const {
       if (start_index > size() || start_index + count > size()) __throw_basic_string_index_out_of_range_exception(__FILE__, __LINE__, __func__);
-      auto result = find(value, start_index);
-      return result > start_index + count ? npos : result;
+      auto result = std::basic_string_view<char_t, traits_t> {chars_.data() + start_index, std::min(size() - start_index, count + value.size())}.find(value.chars_);
+      return result == npos ? npos : start_index + result;
     }
     /// @brief Reports the index of the first occurrence of the specified character in this basic_string.
     /// @param value An unicode character to seek
@@ -1433,8 +1404,8 @@ namespace xtd {
     /// @exception xtd::index_out_of_range_exception start_index + count are greater than the length of this instance.
     xtd::size index_of(value_type value, xtd::size start_index, xtd::size count) const {
       if (start_index > size() || start_index + count > size()) __throw_basic_string_index_out_of_range_exception(__FILE__, __LINE__, __func__);
-      auto result = find(value, start_index);
-      return result > start_index + count ? npos : result;
+      auto result = traits_t::find(chars_.data() + start_index, std::min(size() - start_index, count + 1), value);
+      return result ? static_cast<xtd::size>(result - chars_.data()) : npos;
     }
     
     /// @brief Reports the index of the first occurrence in this instance of any character in a specified array of characters.
@@ -1455,18 +1426,15 @@ namespace xtd {
     /// @exception xtd::index_out_of_range_exception start_index + count are greater than the length of this instance.
     xtd::size index_of_any(const std::vector<value_type>& values, xtd::size start_index, xtd::size count) const {
       if (start_index > size() || start_index + count > size()) __throw_basic_string_index_out_of_range_exception(__FILE__, __LINE__, __func__);
-      auto index = xtd::size {0};
-      for (const auto& item : *this) {
-        if (index++ < start_index) continue;
-        if (index - 1 > start_index + count) break;
-        if (std::find(values.begin(), values.end(), item) != values.end()) return index - 1;
-      }
-      return npos;
+      return index_of_any_unchecked(values.data(), values.size(), start_index, count);
     }
     /// @cond
-    xtd::size index_of_any(const std::initializer_list<value_type>& values) const noexcept {return index_of_any(std::vector<value_type>(values));}
-    xtd::size index_of_any(const std::initializer_list<value_type>& values, xtd::size start_index) const {return index_of_any(std::vector<value_type>(values), start_index);}
-    xtd::size index_of_any(const std::initializer_list<value_type>& values, xtd::size start_index, xtd::size count) const {return index_of_any(std::vector<value_type>(values), start_index, count);}
+    xtd::size index_of_any(const std::initializer_list<value_type>& values) const noexcept {return index_of_any_unchecked(values.begin(), values.size(), 0, size());}
+    xtd::size index_of_any(const std::initializer_list<value_type>& values, xtd::size start_index) const {return index_of_any(values, start_index, size() - start_index);}
+    xtd::size index_of_any(const std::initializer_list<value_type>& values, xtd::size start_index, xtd::size count) const {
+      if (start_index > size() || start_index + count > size()) __throw_basic_string_index_out_of_range_exception(__FILE__, __LINE__, __func__);
+      return index_of_any_unchecked(values.begin(), values.size(), start_index, count);
+    }
     /// @endcond
     
     /// @brief Inserts a specified instance of basic_string at a specified index position in this instance.
@@ -1548,18 +1516,15 @@ namespace xtd {
     /// @return The index position of the first occurrence in this instance where any character in values was found; otherwise, std::basic_string<char_t>::npos if no character in values was found.
     xtd::size last_index_of_any(const std::vector<value_type>& values, xtd::size start_index, xtd::size count) const {
       if (start_index > size() || start_index + count > size()) __throw_basic_string_index_out_of_range_exception(__FILE__, __LINE__, __func__);
-      auto index = size() - 1;
-      for (auto iterator = crbegin(); iterator != crend(); ++iterator) {
-        if (index-- > start_index + count) continue;
-        if (index + 1 < start_index) break;
-        if (std::find(values.begin(), values.end(), *iterator) != values.end()) return index + 1;
-      }
-      return npos;
+      return last_index_of_any_unchecked(values.data(), values.size(), start_index, count);
     }
     /// @cond
-    xtd::size last_index_of_any(const std::initializer_list<value_type>& values) const noexcept {return last_index_of_any(std::vector<value_type>(values));}
-    xtd::size last_index_of_any(const std::initializer_list<value_type>& values, xtd::size start_index) const {return last_index_of_any(std::vector<value_type>(values), start_index);}
-    xtd::size last_index_of_any(const std::initializer_list<value_type>& values, xtd::size start_index, xtd::size count) const {return last_index_of_any(std::vector<value_type>(values), start_index, count);}
+    xtd::size last_index_of_any(const std::initializer_list<value_type>& values) const noexcept {return last_index_of_any_unchecked(values.begin(), values.size(), 0, size());}
+    xtd::size last_index_of_any(const std::initializer_list<value_type>& values, xtd::size start_index) const {return last_index_of_any(values, start_index, size() - start_index);}
+    xtd::size last_index_of_any(const std::initializer_list<value_type>& values, xtd::size start_index, xtd::size count) const {
+      if (start_index > size() || start_index + count > size()) __throw_basic_string_index_out_of_range_exception(__FILE__, __LINE__, __func__);
+      return last_index_of_any_unchecked(values.begin(), values.size(), start_index, count);
+    }
     /// @endcond
 
     /// @brief Right-aligns the characters in this basic_string, padding with spaces on the left for a specified total length.
@@ -1630,27 +1595,30 @@ namespace xtd {
     /// @param old_char A char_t to be replaced.
     /// @param new_char A char_t to replace all occurrences of old_char.
     /// @return A new basic_string equivalent to the specified basic_string but with all instances of old_char replaced with new_char.
-    basic_string replace(value_type old_char, value_type new_char) const noexcept {return replace(string(1, old_char), string(1, new_char));}
+    basic_string replace(value_type old_char, value_type new_char) const noexcept {
+      auto result = *this;
+      for (auto index = result.chars_.find(old_char); index != npos; index = result.chars_.find(old_char, index + 1))
+        result.chars_[index] = new_char;
+      return result;
+    }
     /// @brief Replaces all occurrences of a specified basic_string in this basic_string with another specified basic_string.
     /// @param old_string A basic_string to be replaced.
     /// @param new_string A basic_string to replace all occurrences of old_string.
     /// @return A new basic_string equivalent to the specified basic_string but with all instances of old_string replaced with new_string.
     /// @remarks If new_string is empty, all occurrences of old_string are removed
     basic_string replace(const basic_string& old_string, const basic_string& new_string) const noexcept {
-      auto result = *this;
-      auto old_size = old_string.size();
-      auto new_size = new_string.size();
-      auto index = xtd::size {0};
-      while (true) {
-        index = result.find(old_string, index);
-        if (index == npos) break;
-        if (old_size == new_size) result.chars_.replace(index, old_size, new_string);
-        else {
-          result.chars_.erase(index, old_string.size());
-          result.chars_.insert(index, new_string);
-        }
-        index += new_string.size();
-      }
+      if (old_string.empty()) return *this;
+      auto index = find(old_string);
+      if (index == npos) return *this;
+      
+      auto result = basic_string {};
+      auto start_index = xtd::size {0};
+      do {
+        result.chars_.append(chars_, start_index, index - start_index).append(new_string.chars_);
+        start_index = index + old_string.size();
+        index = find(old_string, start_index);
+      } while (index != npos);
+      result.chars_.append(chars_, start_index);
       return result;
     }
 
@@ -1790,26 +1758,45 @@ namespace xtd {
     /// @remarks If there are more than count substrings in the specified basic_string, the first count minus 1 substrings are returned in the first count minus 1 elements of the return value, and the remaining characters in the specified basic_string are returned in the last element of the return value.
     /// @remarks If count is greater than the number of substrings, the available substrings are returned.
     std::vector<basic_string> split(const std::vector<value_type>& separators, xtd::size count, xtd::string_split_options options) const noexcept {
-      if (count == 0) return {};
       if (count == 1) return {*this};
-      
-      auto list = std::vector<basic_string> {};
-      auto sub_string = basic_string::empty_string;
-      auto split_char_separators = separators.size() == 0 ? default_split_separators : separators;
-      for (auto it = begin(); it != end(); ++it) {
-        auto is_separator = std::find(split_char_separators.begin(), split_char_separators.end(), *it) != split_char_separators.end();
-        if (!is_separator) sub_string.chars_.append(basic_string(1, *it));
-        if ((static_cast<xtd::size>(it - begin()) == length() - 1 || is_separator) && (sub_string.length() > 0 || (sub_string.length() == 0 && options != xtd::string_split_options::remove_empty_entries))) {
-          if (list.size() == count - 1) {
-            list.push_back(sub_string + basic_string(c_str(), it - begin() + (is_separator ? 0 : 1), length() - (it - begin()) + (is_separator ? 0 : 1)));
-            return list;
-          }
-          list.push_back(sub_string);
-          sub_string.chars_.clear();
-        }
+      return split_slices<basic_string>(separators, count, options);
       }
       
-      return list;
+    /// @brief Splits this basic_string into views on the substrings that are based on the default white-space characters.
+    /// @return An array whose elements are views on the substrings in this basic_string that are delimited by one or more characters in white-space separators.
+    /// @remarks This method splits the same way as xtd::basic_string::split, but the substrings are not copied : the returned views refer to the characters of this basic_string and are only valid as long as this basic_string is alive.
+    std::vector<std::basic_string_view<char_t, traits_t>> split_view() const noexcept {return split_view(default_split_separators, std::numeric_limits<xtd::size>::max(), xtd::string_split_options::none);}
+    /// @brief Splits this basic_string into views on the substrings that are based on a character.
+    /// @param separator A character that delimits the substrings in this basic_string.
+    /// @return An array whose elements are views on the substrings in this basic_string that are delimited by separator.
+    /// @remarks This method splits the same way as xtd::basic_string::split, but the substrings are not copied : the returned views refer to the characters of this basic_string and are only valid as long as this basic_string is alive.
+    std::vector<std::basic_string_view<char_t, traits_t>> split_view(value_type separator) const noexcept {return split_view(std::vector<value_type> {separator}, std::numeric_limits<xtd::size>::max(), xtd::string_split_options::none);}
+    /// @brief Splits this basic_string into views on the substrings that are based on a character. You can specify whether the substrings include empty array elements.
+    /// @param separator A character that delimits the substrings in this basic_string.
+    /// @param options xtd::string_split_options::remove_empty_entries to omit empty array elements from the array returned; or None to include empty array elements in the array returned.
+    /// @return An array whose elements are views on the substrings in this basic_string that are delimited by separator.
+    /// @remarks This method splits the same way as xtd::basic_string::split, but the substrings are not copied : the returned views refer to the characters of this basic_string and are only valid as long as this basic_string is alive.
+    std::vector<std::basic_string_view<char_t, traits_t>> split_view(value_type separator, xtd::string_split_options options) const noexcept {return split_view(std::vector<value_type> {separator}, std::numeric_limits<xtd::size>::max(), options);}
+    /// @brief Splits this basic_string into views on the substrings that are based on the characters in an array.
+    /// @param separators A character array that delimits the substrings in this basic_string, an empty array that contains no delimiters.
+    /// @return An array whose elements are views on the substrings in this basic_string that are delimited by one or more characters in separators.
+    /// @remarks This method splits the same way as xtd::basic_string::split, but the substrings are not copied : the returned views refer to the characters of this basic_string and are only valid as long as this basic_string is alive.
+    std::vector<std::basic_string_view<char_t, traits_t>> split_view(const std::vector<value_type>& separators) const noexcept {return split_view(separators, std::numeric_limits<xtd::size>::max(), xtd::string_split_options::none);}
+    /// @brief Splits this basic_string into views on the substrings that are based on the characters in an array. You can specify whether the substrings include empty array elements.
+    /// @param separators A character array that delimits the substrings in this basic_string, an empty array that contains no delimiters.
+    /// @param options xtd::string_split_options::remove_empty_entries to omit empty array elements from the array returned; or None to include empty array elements in the array returned.
+    /// @return An array whose elements are views on the substrings in this basic_string that are delimited by one or more characters in separators.
+    /// @remarks This method splits the same way as xtd::basic_string::split, but the substrings are not copied : the returned views refer to the characters of this basic_string and are only valid as long as this basic_string is alive.
+    std::vector<std::basic_string_view<char_t, traits_t>> split_view(const std::vector<value_type>& separators, xtd::string_split_options options) const noexcept {return split_view(separators, std::numeric_limits<xtd::size>::max(), options);}
+    /// @brief Splits this basic_string into a maximum number of views on the substrings that are based on the characters in an array.
+    /// @param separators A character array that delimits the substrings in this basic_string, an empty array that contains no delimiters.
+    /// @param count The maximum number of substrings to return.
+    /// @param options xtd::string_split_options::remove_empty_entries to omit empty array elements from the array returned; or None to include empty array elements in the array returned.
+    /// @return An array whose elements are views on the substrings in this basic_string that are delimited by one or more characters in separators.
+    /// @remarks This method splits the same way as xtd::basic_string::split, but the substrings are not copied : the returned views refer to the characters of this basic_string and are only valid as long as this basic_string is alive.
+    std::vector<std::basic_string_view<char_t, traits_t>> split_view(const std::vector<value_type>& separators, xtd::size count, xtd::string_split_options options) const noexcept {
+      if (count == 1) return {std::basic_string_view<char_t, traits_t> {chars_}};
+      return split_slices<std::basic_string_view<char_t, traits_t>>(separators, count, options);
     }
     
     /// @brief Determines whether the beginning of this instance of xtd::basic_string matches a specified xtd::basic_string.
@@ -1823,8 +1810,9 @@ namespace xtd {
     /// @return bool true if value matches the beginning of the specified basic_string; otherwise, false.
     /// @remarks This method compares value to the substring at the beginning of the specified basic_string that is the same length as value, and returns an indication whether they are equal. To be equal, value must be a reference to this same instance, or match the beginning of the specified basic_string.
     bool starts_with(value_type value, bool ignore_case) const noexcept {
-      if (ignore_case) return to_lower().find(static_cast<value_type>(tolower(value))) == 0;
-      return find(value) == 0;
+      if (chars_.empty()) return false;
+      if (ignore_case) return __xtd_fold_code_unit(chars_.front()) == __xtd_fold_code_unit(value);
+      return chars_.front() == value;
     }
     /// @brief Determines whether the beginning of this instance of xtd::basic_string matches a specified xtd::basic_string.
     /// @param value A xtd::basic_string to compare to.
@@ -1842,8 +1830,8 @@ namespace xtd {
     /// @param comparison_type One of the enumeration values that determines how this basic_string and value are compared.
     /// @return bool true if value matches the end of the specified basic_string; otherwise, false.
     bool starts_with(const basic_string& value, xtd::string_comparison comparison_type) const noexcept {
-      if (comparison_type == xtd::string_comparison::ordinal_ignore_case) return to_lower().find(value.to_lower()) == 0;
-      return find(value) == 0;
+      if (comparison_type == xtd::string_comparison::ordinal_ignore_case) return __xtd_starts_with_ignore_case(chars_.data(), chars_.size(), value.chars_.data(), value.chars_.size());
+      return chars_.compare(0, value.chars_.size(), value.chars_) == 0;
     }
 
     /// @brief Returns a substring [`pos`, `pos + count`). If the requested substring extends past the end of the string, i.e. the `count` is greater than size() - pos (e.g. if `count` == xtd::basic_string::npos), the returned substring is [`pos`, size()).
@@ -1884,11 +1872,8 @@ namespace xtd {
 
     /// @brief Returns a copy of the current xtd::basic_string converted to lowercase.
     /// @return A string in lowercase.
-    basic_string to_lower() const noexcept {
-      auto result = basic_string::empty_string;
-      std::for_each(begin(), end(), [&](auto c) {result += static_cast<value_type>(std::tolower(c));});
-      return result;
-    }
+    /// @remarks The characters are converted with the Unicode simple case mapping; the code units that do not form a valid code point are copied unchanged.
+    basic_string to_lower() const noexcept {return to_lower(std::basic_string_view<char_t, traits_t> {chars_});}
 
     /// @brief Converts the value of this instance to a xtd::basic_string <char>.
     /// @return The current string.
@@ -1921,20 +1906,62 @@ namespace xtd {
     
     /// @brief Returns a copy of the current xtd::basic_string converted to uppercase.
     /// @return A string in uppercase.
-    basic_string to_upper() const noexcept {
-      auto result = basic_string::empty_string;
-      std::for_each(begin(), end(), [&](auto c) {result += static_cast<value_type>(std::toupper(c));});
-      return result;
-    }
+    /// @remarks The characters are converted with the Unicode simple case mapping; the code units that do not form a valid code point are copied unchanged.
+    basic_string to_upper() const noexcept {return to_upper(std::basic_string_view<char_t, traits_t> {chars_});}
 
     /// @brief Converts the value of this instance to a xtd::basic_string <xtd::wchar>.
     /// @return The current string.
     basic_string<xtd::wchar> to_wstring() const noexcept {return __xtd_convert_to_string<xtd::wchar>(chars_);}
+    
+    /// @brief Gets the characters of the string as a span.
+    /// @param result When this method returns, contains the characters of the string.
+    /// @return Always true : the characters of a string are stored contiguously.
+    bool try_get_span(std::span<const value_type>& result) const noexcept override {
+      result = std::span<const value_type> {chars_.data(), chars_.size()};
+      return true;
+    }
     /// @}
     
     /// @name Public Static Methods
     
     /// @{
+    /// @brief Compares two specified basic_string objects and returns an integer that indicates their relative position in the sort order.
+    /// @param str_a The first basic_string to compare.
+    /// @param str_b The second basic_string to compare.
+    /// @return A 32-bit signed integer that indicates the lexical relationship between the two compares.
+    /// | Value             | Condition                                                     |
+    /// | ----------------- | ------------------------------------------------------------- |
+    /// | Less than zero    | str_a precedes str_b in the sort order.                       |
+    /// | Zero              | str_a occurs in the same position as str_b in the sort order. |
+    /// | Greater than zero | str_a follows str_b in the sort order.                        |
+    static int32 compare(const basic_string& str_a, const basic_string& str_b) noexcept {return compare(str_a, str_b, false);}
+    /// @brief Compares two specified basic_string objects, ignoring or honoring their case, and returns an integer that indicates their relative position in the sort order.
+    /// @param str_a The first basic_string to compare.
+    /// @param str_b The second basic_string to compare.
+    /// @param ignore_case true to ignore case during the comparison; otherwise, false.
+    /// @return A 32-bit signed integer that indicates the lexical relationship between the two compares.
+    /// | Value             | Condition                                                     |
+    /// | ----------------- | ------------------------------------------------------------- |
+    /// | Less than zero    | str_a precedes str_b in the sort order.                       |
+    /// | Zero              | str_a occurs in the same position as str_b in the sort order. |
+    /// | Greater than zero | str_a follows str_b in the sort order.                        |
+    static int32 compare(const basic_string& str_a, const basic_string& str_b, bool ignore_case) noexcept {return compare(str_a, str_b, ignore_case ? xtd::string_comparison::ordinal_ignore_case : xtd::string_comparison::ordinal);}
+    /// @brief Compares two specified basic_string objects using the specified rules, and returns an integer that indicates their relative position in the sort order.
+    /// @param str_a The first basic_string to compare.
+    /// @param str_b The second basic_string to compare.
+    /// @param comparison_type One of the enumeration values that specifies the rules to use in the comparison.
+    /// @return A 32-bit signed integer that indicates the lexical relationship between the two compares.
+    /// | Value             | Condition                                                     |
+    /// | ----------------- | ------------------------------------------------------------- |
+    /// | Less than zero    | str_a precedes str_b in the sort order.                       |
+    /// | Zero              | str_a occurs in the same position as str_b in the sort order. |
+    /// | Greater than zero | str_a follows str_b in the sort order.                        |
+    /// @remarks The xtd::string_comparison::ordinal_ignore_case comparison compares the Unicode simple case foldings of the characters without creating temporary strings.
+    static int32 compare(const basic_string& str_a, const basic_string& str_b, xtd::string_comparison comparison_type) noexcept {
+      if (comparison_type == xtd::string_comparison::ordinal_ignore_case) return __xtd_compare_ignore_case(str_a.chars_.data(), str_a.chars_.size(), str_b.chars_.data(), str_b.chars_.size());
+      return str_a.chars_.compare(str_b.chars_);
+    }
+    
     /// @brief Indicates whether the specifeid basic_string is an empty basic_string ("").
     /// @param string The xtd::basic_string to check if empty.
     /// @return true if the value parameter is null or an empty basic_string (""); otherwise, false.
@@ -1986,6 +2013,26 @@ namespace xtd {
     template<typename value_t>
     static basic_string join(const basic_string& separator, const std::initializer_list<value_t>& values, xtd::size index, xtd::size count) noexcept {return join(separator, std::vector<value_t>(values), index, count);}
     /// @endcond
+    
+    /// @brief Returns a copy of the specified characters converted to lowercase.
+    /// @param value The characters to convert.
+    /// @return A string in lowercase.
+    /// @remarks The characters are converted with the Unicode simple case mapping; the code units that do not form a valid code point are copied unchanged.
+    static basic_string to_lower(std::basic_string_view<char_t, traits_t> value) noexcept {
+      auto result = basic_string {};
+      __xtd_append_case_mapped(result.chars_, value.data(), value.size(), __xtd_case::lower);
+      return result;
+    }
+    
+    /// @brief Returns a copy of the specified characters converted to uppercase.
+    /// @param value The characters to convert.
+    /// @return A string in uppercase.
+    /// @remarks The characters are converted with the Unicode simple case mapping; the code units that do not form a valid code point are copied unchanged.
+    static basic_string to_upper(std::basic_string_view<char_t, traits_t> value) noexcept {
+      auto result = basic_string {};
+      __xtd_append_case_mapped(result.chars_, value.data(), value.size(), __xtd_case::upper);
+      return result;
+    }
     /// @}
     
     /// @name Public Operators
@@ -3067,18 +3114,47 @@ namespace xtd {
     static const std::vector<char_t> default_split_separators;
     static const std::vector<char_t> default_trim_chars;
 
-    typename base_type::iterator to_base_type_iterator(iterator value) const noexcept {
-      if (value == begin()) return chars_.begin();
-      if (value == end()) return chars_.end();
-      return chars_.begin() + (value - begin());
+    typename base_type::const_iterator to_base_type_iterator(const_iterator value) const noexcept {return chars_.begin() + (value - begin());}
+    
+    const_iterator to_iterator(typename base_type::const_iterator value) const noexcept {return begin() + (value - chars_.begin());}
+
+    xtd::size index_of_any_unchecked(const value_type* values, xtd::size values_count, xtd::size start_index, xtd::size count) const noexcept {
+      // The character at start_index + count is examined too, as long as it is in the basic_string.
+      return __char_set__<char_t, traits_t> {values, values + values_count}.find_first(chars_.data(), start_index, std::min(size(), start_index + count + 1));
     }
     
-    iterator to_iterator(typename base_type::iterator value) const noexcept {
-      if (value == chars_.begin()) return begin();
-      if (value == chars_.end()) return end();
-      return begin() + (value - chars_.begin());
+    xtd::size last_index_of_any_unchecked(const value_type* values, xtd::size values_count, xtd::size start_index, xtd::size count) const noexcept {
+      return __char_set__<char_t, traits_t> {values, values + values_count}.find_last(chars_.data(), start_index, std::min(size(), start_index + count + 1));
     }
-
+    
+    template<typename slice_t>
+    std::vector<slice_t> split_slices(const std::vector<value_type>& separators, xtd::size count, xtd::string_split_options options) const noexcept {
+      if (count == 0 || empty()) return {};
+      
+      const auto& split_char_separators = separators.size() == 0 ? default_split_separators : separators;
+      auto separator_set = __char_set__<char_t, traits_t> {split_char_separators.data(), split_char_separators.data() + split_char_separators.size()};
+      auto data = chars_.data();
+      auto list = std::vector<slice_t> {};
+      auto start_index = xtd::size {0};
+      while (start_index < size()) {
+        auto separator_index = separator_set.find_first(data, start_index, size());
+        if (separator_index == npos) {
+          list.push_back(slice_t(data + start_index, size() - start_index));
+          break;
+        }
+        if (separator_index != start_index || options != xtd::string_split_options::remove_empty_entries) {
+          // The last substring contains the rest of the basic_string, separators included.
+          if (list.size() == count - 1) {
+            list.push_back(slice_t(data + start_index, size() - start_index));
+            break;
+          }
+          list.push_back(slice_t(data + start_index, separator_index - start_index));
+        }
+        start_index = separator_index + 1;
+      }
+      return list;
+    }
+    
     base_type chars_;
   };
 
@@ -3096,220 +3172,43 @@ namespace xtd {
 }
 
 /// @cond
-template<typename arg_t>
-void __basic_string_extract_format_arg(std::basic_string<char>& fmt, xtd::size& index, std::vector<__format_information<char>>& formats, arg_t&& arg) {
-  auto offset = xtd::size {0};
-  for (auto& format : formats) {
-    format.location += offset;
-    if (format.index == index) {
-      xtd::basic_string<char> arg_str = xtd::to_string(arg, format.format);
-      
-      if (!format.alignment.empty()) {
-        xtd::int32 alignment = 0;
-        try {
-          alignment = std::stoi(format.alignment);
-        } catch (...) {
-          __throw_basic_string_format_exception(__FILE__, __LINE__, __func__);
-        }
-        if (alignment > 0) arg_str = arg_str.pad_left(alignment);
-        else if (alignment < 0) arg_str = arg_str.pad_right(-alignment);
-      }
-      fmt.insert(format.location, arg_str);
-      offset += arg_str.size();
-    }
+template<typename string_t, typename arg_t>
+bool __basic_string_format_arg(std::basic_string<char>& result, const __format_information<char>& format, xtd::size& index, arg_t&& arg) {
+  if (format.index != index++) return false;
+  if (format.alignment.empty()) {
+    result.append(xtd::to_string(arg, format.format));
+    return true;
   }
-  ++index;
+  
+  if (!format.is_alignment_valid) __throw_basic_string_format_exception(__FILE__, __LINE__, __func__);
+  auto arg_str = string_t {xtd::to_string(arg, format.format)};
+  if (format.alignment_width > 0) arg_str = arg_str.pad_left(format.alignment_width);
+  else if (format.alignment_width < 0) arg_str = arg_str.pad_right(-format.alignment_width);
+  result.append(arg_str.data(), arg_str.size());
+  return true;
 }
 
-template<typename ...args_t>
-void __basic_string_extract_format_arg(xtd::basic_string<char>& fmt, std::vector<__format_information<char>>& formats, args_t&&... args) {
-  auto index = xtd::size {0};
-  (__basic_string_extract_format_arg(const_cast<std::basic_string<char>&>(fmt.chars()), index, formats, args), ...);
-  unused_(index); // workaround to mute gcc warning: unused-but-set-variable
+template<typename string_t, typename ...args_t>
+void __basic_string_format(std::basic_string<char>& result, const __format_pattern<char>& pattern, args_t&&... args) {
+  // The pattern is already parsed, so the literal text and the formatted arguments are appended in one pass.
+  result.reserve(pattern.text.size() + 16 * pattern.formats.size());
+  auto position = xtd::size {0};
+  for (const auto& format : pattern.formats) {
+    result.append(pattern.text, position, format.location - position);
+    position = format.location;
+    auto index = xtd::size {0};
+    static_cast<void>((__basic_string_format_arg<string_t>(result, format, index, args) || ...));
+    unused_(index); // workaround to mute gcc warning: unused-but-set-variable
+  }
+  result.append(pattern.text, position);
 }
 
 template<typename target_t, typename source_t>
 inline std::basic_string<target_t> __xtd_convert_to_string(std::basic_string<source_t>&& str) noexcept {
-  auto out = std::basic_string<target_t> {};
-  auto codepoint = 0u;
-  for (const auto& character : str) {
-    if (character >= 0xd800 && character <= 0xdbff)
-      codepoint = ((character - 0xd800) << 10) + 0x10000;
-    else  {
-      if (character >= 0xdc00 && character <= 0xdfff) codepoint |= character - 0xdc00;
-      else codepoint = character;
-      
-      if (codepoint <= 0x7f)
-        out.append(1, static_cast<target_t>(codepoint));
-      else if (codepoint <= 0x7ff) {
-        out.append(1, static_cast<target_t>(0xc0 | ((codepoint >> 6) & 0x1f)));
-        out.append(1, static_cast<target_t>(0x80 | (codepoint & 0x3f)));
-      } else if (codepoint <= 0xffff) {
-        out.append(1, static_cast<target_t>(0xe0 | ((codepoint >> 12) & 0x0f)));
-        out.append(1, static_cast<target_t>(0x80 | ((codepoint >> 6) & 0x3f)));
-        out.append(1, static_cast<target_t>(0x80 | (codepoint & 0x3f)));
-      } else {
-        out.append(1, static_cast<target_t>(0xf0 | ((codepoint >> 18) & 0x07)));
-        out.append(1, static_cast<target_t>(0x80 | ((codepoint >> 12) & 0x3f)));
-        out.append(1, static_cast<target_t>(0x80 | ((codepoint >> 6) & 0x3f)));
-        out.append(1, static_cast<target_t>(0x80 | (codepoint & 0x3f)));
-      }
-      codepoint = 0;
-    }
-  }
-  str.clear();
-  return out;
-}
-
-template<>
-inline std::basic_string<xtd::char16> __xtd_convert_to_string<xtd::char16, char>(std::basic_string<char>&& str) noexcept {
-  auto out = std::basic_string<xtd::char16> {};
-  auto codepoint = 0u;
-  auto str_ptr = str.data();
-  while (*str_ptr != 0) {
-    auto ch = static_cast<unsigned char>(*str_ptr);
-    if (ch <= 0x7f) codepoint = ch;
-    else if (ch <= 0xbf) codepoint = (codepoint << 6) | (ch & 0x3f);
-    else if (ch <= 0xdf) codepoint = ch & 0x1f;
-    else if (ch <= 0xef) codepoint = ch & 0x0f;
-    else codepoint = ch & 0x07;
-    ++str_ptr;
-    if (((*str_ptr & 0xc0) != 0x80) && (codepoint <= 0x10ffff)) {
-      if (codepoint > 0xffff) {
-        out.append(1, static_cast<xtd::char16>(0xd800 + (static_cast<xtd::char16>(codepoint) >> 10)));
-        out.append(1, static_cast<xtd::char16>(0xdc00 + (static_cast<xtd::char16>(codepoint) & 0x03ff)));
-      } else if (codepoint < 0xd800 || codepoint >= 0xe000)
-        out.append(1, static_cast<xtd::char16>(codepoint));
-    }
-  }
+  auto result = __xtd_convert_to_string<target_t>(static_cast<const std::basic_string<source_t>&>(str));
   str.clear();
-  return out;
-}
-
-#if defined(__xtd__cpp_lib_char8_t)
-template<>
-inline std::basic_string<xtd::char16> __xtd_convert_to_string<xtd::char16, xtd::char8>(std::basic_string<xtd::char8>&& str) noexcept {
-  auto out = std::basic_string<xtd::char16> {};
-  auto codepoint = 0u;
-  auto str_ptr = str.data();
-  while (*str_ptr != 0) {
-    auto ch = static_cast<unsigned char>(*str_ptr);
-    if (ch <= 0x7f) codepoint = ch;
-    else if (ch <= 0xbf) codepoint = (codepoint << 6) | (ch & 0x3f);
-    else if (ch <= 0xdf) codepoint = ch & 0x1f;
-    else if (ch <= 0xef) codepoint = ch & 0x0f;
-    else codepoint = ch & 0x07;
-    ++str_ptr;
-    if (((*str_ptr & 0xc0) != 0x80) && (codepoint <= 0x10ffff)) {
-      if (codepoint > 0xffff) {
-        out.append(1, static_cast<xtd::char16>(0xd800 + (static_cast<xtd::char16>(codepoint) >> 10)));
-        out.append(1, static_cast<xtd::char16>(0xdc00 + (static_cast<xtd::char16>(codepoint) & 0x03ff)));
-      } else if (codepoint < 0xd800 || codepoint >= 0xe000)
-        out.append(1, static_cast<xtd::char16>(codepoint));
-    }
-  }
-  str.clear();
-  return out;
-}
-#endif
-
-template<>
-inline std::basic_string<xtd::wchar> __xtd_convert_to_string<xtd::wchar, char>(std::basic_string<char>&& str) noexcept {
-  auto out = std::basic_string<xtd::wchar> {};
-  auto codepoint = 0u;
-  auto str_ptr = str.data();
-  while (*str_ptr != 0) {
-    auto ch = static_cast<unsigned char>(*str_ptr);
-    if (ch <= 0x7f) codepoint = ch;
-    else if (ch <= 0xbf) codepoint = (codepoint << 6) | (ch & 0x3f);
-    else if (ch <= 0xdf) codepoint = ch & 0x1f;
-    else if (ch <= 0xef) codepoint = ch & 0x0f;
-    else codepoint = ch & 0x07;
-    ++str_ptr;
-    if (((*str_ptr & 0xc0) != 0x80) && (codepoint <= 0x10ffff)) {
-      if (sizeof(xtd::wchar) > 2)
-        out.append(1, static_cast<xtd::wchar>(codepoint));
-      else if (codepoint > 0xffff) {
-        out.append(1, static_cast<xtd::wchar>(0xd800 + (static_cast<xtd::wchar>(codepoint) >> 10)));
-        out.append(1, static_cast<xtd::wchar>(0xdc00 + (static_cast<xtd::wchar>(codepoint) & 0x03ff)));
-      } else if (codepoint < 0xd800 || codepoint >= 0xe000)
-        out.append(1, static_cast<xtd::wchar>(codepoint));
-    }
-  }
-  str.clear();
-  return out;
-}
-
-#if defined(__xtd__cpp_lib_char8_t)
-template<>
-inline std::basic_string<xtd::wchar> __xtd_convert_to_string<xtd::wchar, xtd::char8>(std::basic_string<xtd::char8>&& str) noexcept {
-  auto out = std::basic_string<xtd::wchar> {};
-  auto codepoint = 0u;
-  auto str_ptr = str.data();
-  while (*str_ptr != 0) {
-    auto ch = static_cast<unsigned char>(*str_ptr);
-    if (ch <= 0x7f) codepoint = ch;
-    else if (ch <= 0xbf) codepoint = (codepoint << 6) | (ch & 0x3f);
-    else if (ch <= 0xdf) codepoint = ch & 0x1f;
-    else if (ch <= 0xef) codepoint = ch & 0x0f;
-    else codepoint = ch & 0x07;
-    ++str_ptr;
-    if (((*str_ptr & 0xc0) != 0x80) && (codepoint <= 0x10ffff)) {
-      if (sizeof(xtd::wchar) > 2)
-        out.append(1, static_cast<xtd::wchar>(codepoint));
-      else if (codepoint > 0xffff) {
-        out.append(1, static_cast<xtd::wchar>(0xd800 + (static_cast<xtd::wchar>(codepoint) >> 10)));
-        out.append(1, static_cast<xtd::wchar>(0xdc00 + (static_cast<xtd::wchar>(codepoint) & 0x03ff)));
-      } else if (codepoint < 0xd800 || codepoint >= 0xe000)
-        out.append(1, static_cast<xtd::wchar>(codepoint));
-    }
-  }
-  str.clear();
-  return out;
-}
-#endif
-
-template<>
-inline std::basic_string<xtd::char32> __xtd_convert_to_string<xtd::char32, char>(std::basic_string<char>&& str) noexcept {
-  auto out = std::basic_string<xtd::char32> {};
-  auto codepoint = 0u;
-  auto str_ptr = str.data();
-  while (*str_ptr != 0) {
-    auto ch = static_cast<unsigned char>(*str_ptr);
-    if (ch <= 0x7f) codepoint = ch;
-    else if (ch <= 0xbf) codepoint = (codepoint << 6) | (ch & 0x3f);
-    else if (ch <= 0xdf) codepoint = ch & 0x1f;
-    else if (ch <= 0xef) codepoint = ch & 0x0f;
-    else codepoint = ch & 0x07;
-    ++str_ptr;
-    if (((*str_ptr & 0xc0) != 0x80) && (codepoint <= 0x10ffff))
-      out.append(1, static_cast<xtd::char32>(codepoint));
-  }
-  str.clear();
-  return out;
-}
-
-#if defined(__xtd__cpp_lib_char8_t)
-template<>
-inline std::basic_string<xtd::char32> __xtd_convert_to_string<xtd::char32, xtd::char8>(std::basic_string<xtd::char8>&& str) noexcept {
-  auto out = std::basic_string<xtd::char32> {};
-  auto codepoint = 0u;
-  auto str_ptr = str.data();
-  while (*str_ptr != 0) {
-    auto ch = static_cast<unsigned char>(*str_ptr);
-    if (ch <= 0x7f) codepoint = ch;
-    else if (ch <= 0xbf) codepoint = (codepoint << 6) | (ch & 0x3f);
-    else if (ch <= 0xdf) codepoint = ch & 0x1f;
-    else if (ch <= 0xef) codepoint = ch & 0x0f;
-    else codepoint = ch & 0x07;
-    ++str_ptr;
-    if (((*str_ptr & 0xc0) != 0x80) && (codepoint <= 0x10ffff))
-      out.append(1, static_cast<xtd::char32>(codepoint));
-  }
-  str.clear();
-  return out;
+  return result;
 }
-#endif
 
 template<>
 inline std::basic_string<char> __xtd_convert_to_string<char, char>(std::basic_string<char>&& str) noexcept {return std::move(str);}
@@ -3323,209 +3222,14 @@ inline std::basic_string<xtd::char8> __xtd_convert_to_string<xtd::char8, xtd::ch
 #endif
 template<>
 inline std::basic_string<xtd::wchar> __xtd_convert_to_string<xtd::wchar, xtd::wchar>(std::basic_string<xtd::wchar>&& str) noexcept {return std::move(str);}
-#if defined(__xtd__cpp_lib_char8_t)
-template<>
-inline std::basic_string<xtd::char8> __xtd_convert_to_string<xtd::char8, char>(std::basic_string<char>&& str) noexcept {
-  auto result = std::basic_string<xtd::char8> {reinterpret_cast<const xtd::char8*>(str.c_str())};
-  str.clear();
-  return result;
-}
-template<>
-inline std::basic_string<char> __xtd_convert_to_string<char, xtd::char8>(std::basic_string<xtd::char8>&& str) noexcept {
-  auto result = std::basic_string<char> {reinterpret_cast<const char*>(str.c_str())};
-  str.clear();
-  return result;
-}
-#endif
-template<>
-inline std::basic_string<xtd::char16> __xtd_convert_to_string<xtd::char16, xtd::char32>(std::basic_string<xtd::char32>&& str) noexcept {return __xtd_convert_to_string<xtd::char16>(__xtd_convert_to_string<char>(std::move(str)));}
-template<>
-inline std::basic_string<xtd::char16> __xtd_convert_to_string<xtd::char16, xtd::wchar>(std::basic_string<xtd::wchar>&& str) noexcept {return __xtd_convert_to_string<xtd::char16>(__xtd_convert_to_string<char>(std::move(str)));}
-template<>
-inline std::basic_string<xtd::char32> __xtd_convert_to_string<xtd::char32, xtd::char16>(std::basic_string<xtd::char16>&& str) noexcept {return __xtd_convert_to_string<xtd::char32>(__xtd_convert_to_string<char>(std::move(str)));}
-template<>
-inline std::basic_string<xtd::char32> __xtd_convert_to_string<xtd::char32, xtd::wchar>(std::basic_string<xtd::wchar>&& str) noexcept {return __xtd_convert_to_string<xtd::char32>(__xtd_convert_to_string<char>(std::move(str)));}
-template<>
-inline std::basic_string<xtd::wchar> __xtd_convert_to_string<xtd::wchar, xtd::char16>(std::basic_string<xtd::char16>&& str) noexcept {return __xtd_convert_to_string<xtd::wchar>(__xtd_convert_to_string<char>(std::move(str)));}
-template<>
-inline std::basic_string<xtd::wchar> __xtd_convert_to_string<xtd::wchar, xtd::char32>(std::basic_string<xtd::char32>&& str) noexcept {return __xtd_convert_to_string<xtd::wchar>(__xtd_convert_to_string<char>(std::move(str)));}
 
 template<typename target_t, typename source_t>
 inline std::basic_string<target_t> __xtd_convert_to_string(const std::basic_string<source_t>& str) noexcept {
-  auto out = std::basic_string<target_t> {};
-  auto codepoint = 0u;
-  for (const auto& character : str) {
-    if (character >= 0xd800 && character <= 0xdbff)
-      codepoint = ((character - 0xd800) << 10) + 0x10000;
-    else  {
-      if (character >= 0xdc00 && character <= 0xdfff) codepoint |= character - 0xdc00;
-      else codepoint = character;
-      
-      if (codepoint <= 0x7f)
-        out.append(1, static_cast<target_t>(codepoint));
-      else if (codepoint <= 0x7ff) {
-        out.append(1, static_cast<target_t>(0xc0 | ((codepoint >> 6) & 0x1f)));
-        out.append(1, static_cast<target_t>(0x80 | (codepoint & 0x3f)));
-      } else if (codepoint <= 0xffff) {
-        out.append(1, static_cast<target_t>(0xe0 | ((codepoint >> 12) & 0x0f)));
-        out.append(1, static_cast<target_t>(0x80 | ((codepoint >> 6) & 0x3f)));
-        out.append(1, static_cast<target_t>(0x80 | (codepoint & 0x3f)));
-      } else {
-        out.append(1, static_cast<target_t>(0xf0 | ((codepoint >> 18) & 0x07)));
-        out.append(1, static_cast<target_t>(0x80 | ((codepoint >> 12) & 0x3f)));
-        out.append(1, static_cast<target_t>(0x80 | ((codepoint >> 6) & 0x3f)));
-        out.append(1, static_cast<target_t>(0x80 | (codepoint & 0x3f)));
-      }
-      codepoint = 0;
-    }
-  }
-  return out;
-}
-
-template<>
-inline std::basic_string<xtd::char16> __xtd_convert_to_string<xtd::char16, char>(const std::basic_string<char>& str) noexcept {
-  auto out = std::basic_string<xtd::char16> {};
-  auto codepoint = 0u;
-  auto str_ptr = str.data();
-  while (*str_ptr != 0) {
-    auto ch = static_cast<unsigned char>(*str_ptr);
-    if (ch <= 0x7f) codepoint = ch;
-    else if (ch <= 0xbf) codepoint = (codepoint << 6) | (ch & 0x3f);
-    else if (ch <= 0xdf) codepoint = ch & 0x1f;
-    else if (ch <= 0xef) codepoint = ch & 0x0f;
-    else codepoint = ch & 0x07;
-    ++str_ptr;
-    if (((*str_ptr & 0xc0) != 0x80) && (codepoint <= 0x10ffff)) {
-      if (codepoint > 0xffff) {
-        out.append(1, static_cast<xtd::char16>(0xd800 + (static_cast<xtd::char16>(codepoint) >> 10)));
-        out.append(1, static_cast<xtd::char16>(0xdc00 + (static_cast<xtd::char16>(codepoint) & 0x03ff)));
-      } else if (codepoint < 0xd800 || codepoint >= 0xe000)
-        out.append(1, static_cast<xtd::char16>(codepoint));
-    }
-  }
-  return out;
-}
-
-#if defined(__xtd__cpp_lib_char8_t)
-template<>
-inline std::basic_string<xtd::char16> __xtd_convert_to_string<xtd::char16, xtd::char8>(const std::basic_string<xtd::char8>& str) noexcept {
-  auto out = std::basic_string<xtd::char16> {};
-  auto codepoint = 0u;
-  auto str_ptr = str.data();
-  while (*str_ptr != 0) {
-    auto ch = static_cast<unsigned char>(*str_ptr);
-    if (ch <= 0x7f) codepoint = ch;
-    else if (ch <= 0xbf) codepoint = (codepoint << 6) | (ch & 0x3f);
-    else if (ch <= 0xdf) codepoint = ch & 0x1f;
-    else if (ch <= 0xef) codepoint = ch & 0x0f;
-    else codepoint = ch & 0x07;
-    ++str_ptr;
-    if (((*str_ptr & 0xc0) != 0x80) && (codepoint <= 0x10ffff)) {
-      if (codepoint > 0xffff) {
-        out.append(1, static_cast<xtd::char16>(0xd800 + (static_cast<xtd::char16>(codepoint) >> 10)));
-        out.append(1, static_cast<xtd::char16>(0xdc00 + (static_cast<xtd::char16>(codepoint) & 0x03ff)));
-      } else if (codepoint < 0xd800 || codepoint >= 0xe000)
-        out.append(1, static_cast<xtd::char16>(codepoint));
-    }
-  }
-  return out;
-}
-#endif
-
-template<>
-inline std::basic_string<xtd::wchar> __xtd_convert_to_string<xtd::wchar, char>(const std::basic_string<char>& str) noexcept {
-  auto out = std::basic_string<xtd::wchar> {};
-  auto codepoint = 0u;
-  auto str_ptr = str.data();
-  while (*str_ptr != 0) {
-    auto ch = static_cast<unsigned char>(*str_ptr);
-    if (ch <= 0x7f) codepoint = ch;
-    else if (ch <= 0xbf) codepoint = (codepoint << 6) | (ch & 0x3f);
-    else if (ch <= 0xdf) codepoint = ch & 0x1f;
-    else if (ch <= 0xef) codepoint = ch & 0x0f;
-    else codepoint = ch & 0x07;
-    ++str_ptr;
-    if (((*str_ptr & 0xc0) != 0x80) && (codepoint <= 0x10ffff)) {
-      if (sizeof(xtd::wchar) > 2)
-        out.append(1, static_cast<xtd::wchar>(codepoint));
-      else if (codepoint > 0xffff) {
-        out.append(1, static_cast<xtd::wchar>(0xd800 + (static_cast<xtd::wchar>(codepoint) >> 10)));
-        out.append(1, static_cast<xtd::wchar>(0xdc00 + (static_cast<xtd::wchar>(codepoint) & 0x03ff)));
-      } else if (codepoint < 0xd800 || codepoint >= 0xe000)
-        out.append(1, static_cast<xtd::wchar>(codepoint));
-    }
-  }
-  return out;
+  // char and xtd::char8 strings are both UTF-8 : their code units are copied as is.
+  if constexpr (sizeof(target_t) == 1 && sizeof(source_t) == 1) return std::basic_string<target_t>(reinterpret_cast<const target_t*>(str.data()), str.size());
+  else return __xtd_transcode_to_string<target_t>(str.data(), str.size());
 }
 
-#if defined(__xtd__cpp_lib_char8_t)
-template<>
-inline std::basic_string<xtd::wchar> __xtd_convert_to_string<xtd::wchar, xtd::char8>(const std::basic_string<xtd::char8>& str) noexcept {
-  auto out = std::basic_string<xtd::wchar> {};
-  auto codepoint = 0u;
-  auto str_ptr = str.data();
-  while (*str_ptr != 0) {
-    auto ch = static_cast<unsigned char>(*str_ptr);
-    if (ch <= 0x7f) codepoint = ch;
-    else if (ch <= 0xbf) codepoint = (codepoint << 6) | (ch & 0x3f);
-    else if (ch <= 0xdf) codepoint = ch & 0x1f;
-    else if (ch <= 0xef) codepoint = ch & 0x0f;
-    else codepoint = ch & 0x07;
-    ++str_ptr;
-    if (((*str_ptr & 0xc0) != 0x80) && (codepoint <= 0x10ffff)) {
-      if (sizeof(xtd::wchar) > 2)
-        out.append(1, static_cast<xtd::wchar>(codepoint));
-      else if (codepoint > 0xffff) {
-        out.append(1, static_cast<xtd::wchar>(0xd800 + (static_cast<xtd::wchar>(codepoint) >> 10)));
-        out.append(1, static_cast<xtd::wchar>(0xdc00 + (static_cast<xtd::wchar>(codepoint) & 0x03ff)));
-      } else if (codepoint < 0xd800 || codepoint >= 0xe000)
-        out.append(1, static_cast<xtd::wchar>(codepoint));
-    }
-  }
-  return out;
-}
-#endif
-
-template<>
-inline std::basic_string<xtd::char32> __xtd_convert_to_string<xtd::char32, char>(const std::basic_string<char>& str) noexcept {
-  auto out = std::basic_string<xtd::char32> {};
-  auto codepoint = 0u;
-  auto str_ptr = str.data();
-  while (*str_ptr != 0) {
-    auto ch = static_cast<unsigned char>(*str_ptr);
-    if (ch <= 0x7f) codepoint = ch;
-    else if (ch <= 0xbf) codepoint = (codepoint << 6) | (ch & 0x3f);
-    else if (ch <= 0xdf) codepoint = ch & 0x1f;
-    else if (ch <= 0xef) codepoint = ch & 0x0f;
-    else codepoint = ch & 0x07;
-    ++str_ptr;
-    if (((*str_ptr & 0xc0) != 0x80) && (codepoint <= 0x10ffff))
-      out.append(1, static_cast<xtd::char32>(codepoint));
-  }
-  return out;
-}
-
-#if defined(__xtd__cpp_lib_char8_t)
-template<>
-inline std::basic_string<xtd::char32> __xtd_convert_to_string<xtd::char32, xtd::char8>(const std::basic_string<xtd::char8>& str) noexcept {
-  auto out = std::basic_string<xtd::char32> {};
-  auto codepoint = 0u;
-  auto str_ptr = str.data();
-  while (*str_ptr != 0) {
-    auto ch = static_cast<unsigned char>(*str_ptr);
-    if (ch <= 0x7f) codepoint = ch;
-    else if (ch <= 0xbf) codepoint = (codepoint << 6) | (ch & 0x3f);
-    else if (ch <= 0xdf) codepoint = ch & 0x1f;
-    else if (ch <= 0xef) codepoint = ch & 0x0f;
-    else codepoint = ch & 0x07;
-    ++str_ptr;
-    if (((*str_ptr & 0xc0) != 0x80) && (codepoint <= 0x10ffff))
-      out.append(1, static_cast<xtd::char32>(codepoint));
-  }
-  return out;
-}
-#endif
-
 template<>
 inline std::basic_string<char> __xtd_convert_to_string<char, char>(const std::basic_string<char>& str) noexcept {return str;}
 template<>
@@ -3538,22 +3242,4 @@ inline std::basic_string<xtd::char8> __xtd_convert_to_string<xtd::char8, xtd::ch
 #endif
 template<>
 inline std::basic_string<xtd::wchar> __xtd_convert_to_string<xtd::wchar, xtd::wchar>(const std::basic_string<xtd::wchar>& str) noexcept {return str;}
-#if defined(__xtd__cpp_lib_char8_t)
-template<>
-inline std::basic_string<xtd::char8> __xtd_convert_to_string<xtd::char8, char>(const std::basic_string<char>& str) noexcept {return reinterpret_cast<const xtd::char8*>(str.c_str());}
-template<>
-inline std::basic_string<char> __xtd_convert_to_string<char, xtd::char8>(const std::basic_string<xtd::char8>& str) noexcept {return reinterpret_cast<const char*>(str.c_str());}
-#endif
-template<>
-inline std::basic_string<xtd::char16> __xtd_convert_to_string<xtd::char16, xtd::char32>(const std::basic_string<xtd::char32>& str) noexcept {return __xtd_convert_to_string<xtd::char16>(__xtd_convert_to_string<char>(str));}
-template<>
-inline std::basic_string<xtd::char16> __xtd_convert_to_string<xtd::char16, xtd::wchar>(const std::basic_string<xtd::wchar>& str) noexcept {return __xtd_convert_to_string<xtd::char16>(__xtd_convert_to_string<char>(str));}
-template<>
-inline std::basic_string<xtd::char32> __xtd_convert_to_string<xtd::char32, xtd::char16>(const std::basic_string<xtd::char16>& str) noexcept {return __xtd_convert_to_string<xtd::char32>(__xtd_convert_to_string<char>(str));}
-template<>
-inline std::basic_string<xtd::char32> __xtd_convert_to_string<xtd::char32, xtd::wchar>(const std::basic_string<xtd::wchar>& str) noexcept {return __xtd_convert_to_string<xtd::char32>(__xtd_convert_to_string<char>(str));}
-template<>
-inline std::basic_string<xtd::wchar> __xtd_convert_to_string<xtd::wchar, xtd::char16>(const std::basic_string<xtd::char16>& str) noexcept {return __xtd_convert_to_string<xtd::wchar>(__xtd_convert_to_string<char>(str));}
-template<>
-inline std::basic_string<xtd::wchar> __xtd_convert_to_string<xtd::wchar, xtd::char32>(const std::basic_string<xtd::char32>& str) noexcept {return __xtd_convert_to_string<xtd::wchar>(__xtd_convert_to_string<char>(str));}
 /// @endcond
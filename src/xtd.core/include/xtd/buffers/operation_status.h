@@ -0,0 +1,41 @@
+/// @file
+/// @brief Contains xtd::buffers::operation_status enum class.
+/// @copyright Copyright (c) 2024 Gammasoft. All rights reserved.
+#pragma once
+#include "../enum.h"
+
+/// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
+namespace xtd {
+  /// @brief Contains types used in creating and managing memory buffers.
+  namespace buffers {
+    /// @brief Defines the values that can be returned from span-based operations that support processing of input contained in multiple discontiguous buffers.
+    /// ```cpp
+    /// enum class operation_status
+    /// ```
+    /// @par Header
+    /// ```cpp
+    /// #include <xtd/buffers/operation_status>
+    /// ```
+    /// @par Namespace
+    /// xtd::buffers
+    /// @par Library
+    /// xtd.core
+    /// @ingroup xtd_core
+    enum class operation_status {
+      /// @brief The entire input buffer has been processed and the operation is complete.
+      done = 0,
+      /// @brief The input is partially processed, up to what could fit into the destination buffer. The caller can enlarge the destination buffer, slice the buffers appropriately, and retry.
+      destination_too_small = 1,
+      /// @brief The input is partially processed, up to the last valid chunk of the input that could be consumed. The caller can stitch the remaining unprocessed input with more data, slice the buffers appropriately, and retry.
+      need_more_data = 2,
+      /// @brief The input contained invalid bytes which could not be processed. If the input is partially processed, the destination contains the partial result. This guarantees that no additional data appended to the input will make the invalid sequence valid.
+      invalid_data = 3,
+    };
+  }
+}
+
+/// @cond
+template<> struct xtd::enum_register<xtd::buffers::operation_status> {
+  explicit operator auto() const noexcept {return xtd::enum_collection<xtd::buffers::operation_status> {{xtd::buffers::operation_status::done, "done"}, {xtd::buffers::operation_status::destination_too_small, "destination_too_small"}, {xtd::buffers::operation_status::need_more_data, "need_more_data"}, {xtd::buffers::operation_status::invalid_data, "invalid_data"}};}
+};
+/// @endcond
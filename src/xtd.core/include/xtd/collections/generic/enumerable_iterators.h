@@ -39,6 +39,7 @@ namespace xtd {
       /// for (auto part : parts)
       ///   console::write_line(part);
       /// ```
+      /// @remarks The `begin` and `end` methods are not virtual : a collection that stores its elements contiguously, such as xtd::collections::generic::list <type_t>, hides them with its own contiguous iterators. The iterators of xtd::collections::generic::enumerable_iterators <type_t, enumerable_t> are used only when the collection is iterated through the xtd::collections::generic::ienumerable <type_t> interface.
       /// @warning Internal use only for xtd::collections::generic::ienumerable interfece.
       template<typename type_t, typename enumerable_t>
       class enumerable_iterators {
@@ -195,25 +196,25 @@ namespace xtd {
         /// @{
         /// @brief Returns an iterator to the first element of the enumarable.
         /// @return Iterator to the first element.
-        virtual const_iterator begin() const {return iterator::begin(enumerable_);}
+        const_iterator begin() const {return iterator::begin(enumerable_);}
         /// @brief Returns an iterator to the first element of the enumarable.
         /// @return Iterator to the first element.
-        virtual iterator begin() {return iterator::begin(enumerable_);}
+        iterator begin() {return iterator::begin(enumerable_);}
 
         /// @brief Returns an iterator to the first element of the enumarable.
         /// @return Iterator to the first element.
-        virtual const_iterator cbegin() const {return iterator::begin(enumerable_);}
+        const_iterator cbegin() const {return iterator::begin(enumerable_);}
 
         /// @brief Returns an iterator to the element following the last element of the enumarable.
         /// @return Iterator to the element following the last element.
-        virtual const_iterator cend() const {return iterator::end(enumerable_);}
+        const_iterator cend() const {return iterator::end(enumerable_);}
 
         /// @brief Returns an iterator to the element following the last element of the enumarable.
         /// @return Iterator to the element following the last element.
-        virtual const_iterator end() const {return iterator::end(enumerable_);}
+        const_iterator end() const {return iterator::end(enumerable_);}
         /// @brief Returns an iterator to the element following the last element of the enumarable.
         /// @return Iterator to the element following the last element.
-        virtual iterator end() {return iterator::end(enumerable_);}
+        iterator end() {return iterator::end(enumerable_);}
         /// @}
         
       private:
@@ -63,6 +63,11 @@ namespace xtd {
         /// @exception xtd::invalid_operation_exception The collection was modified after the enumerator was created.
         bool move_next() override {return enumerator_->move_next();}
         
+        /// @brief Advances the enumerator past the next batch of elements of the collection.
+        /// @return The elements of the batch, or an empty span if the enumerator has passed the end of the collection.
+        /// @exception xtd::invalid_operation_exception The collection was modified after the enumerator was created.
+        std::span<const type_t> move_next_batch() override {return enumerator_->move_next_batch();}
+        
         /// @brief Sets the enumerator to its initial position, which is before the first element in the collection.
         /// @exception xtd::invalid_operation_exception The collection was modified after the enumerator was created.
         /// @exception xtd::not_supported_exception The enumerator does not support being reset.
@@ -0,0 +1,150 @@
+/// @file
+/// @brief Contains xtd::collections::generic::helpers::wrap_pointer_iterator class.
+/// @copyright Copyright (c) 2024 Gammasoft. All rights reserved.
+#pragma once
+#include "../../../ptrdiff.h"
+#include <compare>
+#include <iterator>
+#include <type_traits>
+
+/// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
+namespace xtd {
+  /// @brief The xtd::collections namespace contains interfaces and classes that define various collections of objects, such as lists, queues, bit arrays, hash tables and dictionaries.
+  namespace collections {
+    /// @brief The xtd::collections::generic namespace contains interfaces and classes that define generic collections, which allow users to create strongly typed collections that provide better type safety and performance than non-generic strongly typed collections.
+    namespace generic {
+      /// @brief The xtd::collections::generic::helpers namespace contains helpers for generic collections, sush as comparer, equator an hasher structs.
+      namespace helpers {
+        /// @brief Represents a contiguous iterator that wraps a pointer on the elements of a collection.
+        /// @par Definition
+        /// ```cpp
+        /// template<typename pointer_t>
+        /// class wrap_pointer_iterator
+        /// ```
+        /// @par Header
+        /// ```cpp
+        /// #include <xtd/collections/generic/helpers/wrap_pointer_iterator>
+        /// ```
+        /// @par Namespace
+        /// xtd::collections::generic::helpers
+        /// @par Library
+        /// xtd.core
+        /// @ingroup xtd_core helpers_generic_collections
+        /// @remarks The xtd::collections::generic::helpers::wrap_pointer_iterator is the iterator of the collections that store their elements contiguously, such as xtd::basic_string and xtd::collections::generic::list <type_t>. It satisfies [std::contiguous_iterator](https://en.cppreference.com/w/cpp/iterator/contiguous_iterator) : iterating costs the same as iterating with a pointer and the standard algorithms can vectorize the loops.
+        /// @remarks Iterating a collection through the xtd::collections::generic::ienumerable <type_t> interface still uses the xtd::collections::generic::enumerator <type_t> returned by xtd::collections::generic::ienumerable::get_enumerator.
+        template<typename pointer_t>
+        class wrap_pointer_iterator {
+        public:
+          /// @name Public Aliases
+          
+          /// @{
+          /// @brief Represents the iterator concept type.
+          using iterator_concept = std::contiguous_iterator_tag;
+          /// @brief Represents the iterator category type.
+          using iterator_category = std::random_access_iterator_tag;
+          /// @brief Represents the element type.
+          using element_type = std::remove_pointer_t<pointer_t>;
+          /// @brief Represents the value type.
+          using value_type = std::remove_cv_t<element_type>;
+          /// @brief Represents the difference type.
+          using difference_type = xtd::ptrdiff;
+          /// @brief Represents the pointer of the value type.
+          using pointer = pointer_t;
+          /// @brief Represents the reference of the value type.
+          using reference = element_type&;
+          /// @}
+          
+          /// @name Public Constructors
+          
+          /// @{
+          /// @brief Initializes a new instance of the xtd::collections::generic::helpers::wrap_pointer_iterator class.
+          wrap_pointer_iterator() noexcept = default;
+          /// @brief Initializes a new instance of the xtd::collections::generic::helpers::wrap_pointer_iterator class with specified pointer.
+          /// @param data The pointer to the element.
+          explicit wrap_pointer_iterator(pointer data) noexcept : data_(data) {}
+          /// @brief Initializes a new instance of the xtd::collections::generic::helpers::wrap_pointer_iterator class with specified iterator.
+          /// @param value The iterator to convert, for example an iterator to a const iterator.
+          template<typename other_pointer_t>
+          requires std::is_convertible_v<other_pointer_t, pointer_t>
+          wrap_pointer_iterator(const wrap_pointer_iterator<other_pointer_t>& value) noexcept : data_(value.data()) {}
+          /// @}
+          
+          /// @name Public Properties
+          
+          /// @{
+          /// @brief Gets the underlying pointer.
+          /// @return The pointer to the element.
+          pointer data() const noexcept {return data_;}
+          /// @}
+          
+          /// @name Public Operators
+          
+          /// @{
+          /// @brief Returns reference to the current element.
+          /// @return The reference to the current element.
+          reference operator *() const noexcept {return *data_;}
+          /// @brief Returns pointer to the current element.
+          /// @return The pointer to the current element.
+          pointer operator ->() const noexcept {return data_;}
+          /// @brief Returns reference to the element at specified offset from the current element.
+          /// @param index The offset from the current element.
+          /// @return The reference to the element.
+          reference operator [](difference_type index) const noexcept {return data_[index];}
+          
+          /// @brief Pre increments the iterator.
+          /// @return The current iterator.
+          wrap_pointer_iterator& operator ++() noexcept {++data_; return *this;}
+          /// @brief Post increments the iterator.
+          /// @return The iterator before the increment.
+          wrap_pointer_iterator operator ++(int) noexcept {return wrap_pointer_iterator {data_++};}
+          /// @brief Pre decrements the iterator.
+          /// @return The current iterator.
+          wrap_pointer_iterator& operator --() noexcept {--data_; return *this;}
+          /// @brief Post decrements the iterator.
+          /// @return The iterator before the decrement.
+          wrap_pointer_iterator operator --(int) noexcept {return wrap_pointer_iterator {data_--};}
+          
+          /// @brief Advances the iterator by specified offset.
+          /// @param value The offset to add.
+          /// @return The current iterator.
+          wrap_pointer_iterator& operator +=(difference_type value) noexcept {data_ += value; return *this;}
+          /// @brief Moves back the iterator by specified offset.
+          /// @param value The offset to subtract.
+          /// @return The current iterator.
+          wrap_pointer_iterator& operator -=(difference_type value) noexcept {data_ -= value; return *this;}
+          /// @brief Add operator with specified value.
+          /// @param value The offset to add.
+          /// @return The iterator advanced by value.
+          wrap_pointer_iterator operator +(difference_type value) const noexcept {return wrap_pointer_iterator {data_ + value};}
+          /// @brief Add operator with specified value.
+          /// @param value The offset to add.
+          /// @param iterator The iterator.
+          /// @return The iterator advanced by value.
+          friend wrap_pointer_iterator operator +(difference_type value, const wrap_pointer_iterator& iterator) noexcept {return iterator + value;}
+          /// @brief Subtract operator with specified value.
+          /// @param value The offset to subtract.
+          /// @return The iterator moved back by value.
+          wrap_pointer_iterator operator -(difference_type value) const noexcept {return wrap_pointer_iterator {data_ - value};}
+          /// @brief Subtract The specified iterator from the current iterator.
+          /// @param value The iterator to subtract from the current iterator.
+          /// @return The difference between current iterator and the specified iterator.
+          template<typename other_pointer_t>
+          difference_type operator -(const wrap_pointer_iterator<other_pointer_t>& value) const noexcept {return data_ - value.data();}
+          
+          /// @brief The equality operator of specified iterators.
+          /// @return true if the iterators point to the same element; otherwise false.
+          template<typename other_pointer_t>
+          bool operator ==(const wrap_pointer_iterator<other_pointer_t>& value) const noexcept {return data_ == value.data();}
+          /// @brief The three-way comparison operator of specified iterators.
+          /// @return The ordering of the elements pointed by the iterators.
+          template<typename other_pointer_t>
+          std::strong_ordering operator <=>(const wrap_pointer_iterator<other_pointer_t>& value) const noexcept {return data_ <=> value.data();}
+          /// @}
+        
+        private:
+          pointer data_ = nullptr;
+        };
+      }
+    }
+  }
+}
@@ -3,6 +3,7 @@
 /// @copyright Copyright (c) 2024 Gammasoft. All rights reserved.
 #pragma once
 #include "enumerable_iterators.h"
+#include <span>
 
 /// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
 namespace xtd {
@@ -42,15 +43,36 @@ namespace xtd {
         /// @brief Represents the const iterator of xtd::collections::generic::ienumerable value type.
         using const_iterator = typename enumerable_iterators<type_t, ienumerable<type_t>>::const_iterator;
         /// @}
-
+        
         /// @name Public Methods
         
         /// @{
         /// @brief Returns an enumerator that iterates through a collection.
         /// @return An xtd::collections::generic::enumerator object that can be used to iterate through the collection.
         virtual enumerator<type_t> get_enumerator() const = 0;
+        
+        /// @brief Gets the elements of the collection as a span when they are stored contiguously.
+        /// @param result When this method returns, contains the elements of the collection if they are stored contiguously; otherwise an empty span.
+        /// @return true if the elements of the collection are stored contiguously; otherwise false.
+        /// @remarks The default implementation returns false. A collection that stores its elements contiguously, such as xtd::collections::generic::list <type_t> or xtd::basic_string, overrides this method.
+        /// @remarks A generic algorithm written against xtd::collections::generic::ienumerable <type_t> can iterate over the span instead of the enumerator : it avoids the allocation of the enumerator and the virtual calls for each element. The span is valid until the collection is modified.
+        /// @par Examples
+        /// The following code shows how to sum the elements of any collection.
+        /// @code
+        /// int sum(const ienumerable<int>& items) {
+        ///   auto result = 0;
+        ///   auto span = std::span<const int> {};
+        ///   if (items.try_get_span(span)) result = std::accumulate(span.begin(), span.end(), 0);
+        ///   else for (auto item : items) result += item;
+        ///   return result;
+        /// }
+        /// @endcode
+        virtual bool try_get_span(std::span<const type_t>& result) const noexcept {
+          result = {};
+          return false;
+        }
         /// @}
-
+        
         /// @cond
         ienumerable() : enumerable_iterators<type_t, ienumerable<type_t>>(this) {}
         /// @endcond
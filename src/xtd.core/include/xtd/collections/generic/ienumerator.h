@@ -4,6 +4,7 @@
 #pragma once
 #include "../../interface.h"
 #include <iterator>
+#include <span>
 
 /// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
 namespace xtd {
@@ -145,6 +146,25 @@ namespace xtd {
         /// @remarks If changes are made to the collection, such as adding, modifying, or deleting elements, the behavior of xtd::collections::generic::ienumerator::move_next is undefined.
         virtual bool move_next() = 0;
         
+        /// @brief Advances the enumerator past the next batch of elements of the collection.
+        /// @return The elements of the batch, or an empty span if the enumerator has passed the end of the collection.
+        /// @exception xtd::invalid_operation_exception The collection was modified after the enumerator was created.
+        /// @remarks The default implementation returns a batch of one element obtained with xtd::collections::generic::ienumerator::move_next and xtd::collections::generic::ienumerator::current. An enumerator over a collection that stores its elements contiguously returns all the remaining elements in one batch.
+        /// @remarks After the call, xtd::collections::generic::ienumerator::current is the last element of the batch. The span is valid until the collection is modified.
+        /// @par Examples
+        /// The following code shows how to sum the elements of a collection by batches.
+        /// @code
+        /// auto sum = 0;
+        /// auto enumerator = items.get_enumerator();
+        /// for (auto batch = enumerator.move_next_batch(); !batch.empty(); batch = enumerator.move_next_batch())
+        ///   for (auto item : batch)
+        ///     sum += item;
+        /// @endcode
+        virtual std::span<const type_t> move_next_batch() {
+          if (!move_next()) return {};
+          return std::span<const type_t> {&current(), 1};
+        }
+        
         /// @brief Sets the enumerator to its initial position, which is before the first element in the collection.
         /// @exception xtd::invalid_operation_exception The collection was modified after the enumerator was created.
         /// @exception xtd::not_supported_exception The enumerator does not support being reset.
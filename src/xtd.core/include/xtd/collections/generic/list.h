@@ -3,6 +3,7 @@
 /// @copyright Copyright (c) 2024 Gammasoft. All rights reserved.
 #pragma once
 #include "helpers/allocator.h"
+#include "helpers/wrap_pointer_iterator.h"
 #include "ilist.h"
 #include "../object_model/read_only_collection.h"
 #include "../../argument_exception.h"
@@ -16,6 +17,7 @@
 #include "../../new_ptr.h"
 #include "../../ptr.h"
 #include "../../string.h"
+#include <span>
 #include <utility>
 #include <vector>
 
@@ -41,6 +43,7 @@ namespace xtd {
       /// @ingroup xtd_core generic_collections
       /// @remarks The xtd::collections::generic::list <type_t> class instanciate as xtd::collections::generic::list::base_type a [std::vector](https://en.cppreference.com/w/cpp/container/vector) with xtd::collections::generic::helpers::allocator instead [std::allocator](https://en.cppreference.com/w/cpp/memory/allocator). Use xtd::collections::generic::list::get_base_type() to access the underlying [std::vector](https://en.cppreference.com/w/cpp/container/vector).
       /// @remarks The xtd::collections::generic::list <type_t> class can also be used to manage a dynamic array of `bool` exactly as other types unlike [std::vector](https://en.cppreference.com/w/cpp/container/vector) with xtd::collections::generic::helpers::allocator instead [std::allocator](https://en.cppreference.com/w/cpp/memory/allocator). When the `type_t`is `bool` The underlying [std::vector](https://en.cppreference.com/w/cpp/container/vector) uses xtd::byte.
+      /// @remarks As the elements of a xtd::collections::generic::list <bool> are stored as xtd::byte, its xtd::collections::generic::list::iterator, xtd::collections::generic::list::const_iterator, xtd::collections::generic::list::pointer and xtd::collections::generic::list::const_pointer refer to xtd::byte and not to `bool`.
       /// @remarks The xtd::collections::generic::list <type_t> class is the generic equivalent of the xtd::collections::array_list class. It implements the xtd::collections::generic::ilist <type_t> generic interface by using an array whose size is dynamically increased as required.
       /// @remarks You can add items to a xtd::collections::generic::list <type_t> by using the xtd::collections::generic::list::add or xtd::collections::generic::list::add_range methods.
       /// @remarks The xtd::collections::generic::list <type_t> class uses both an equality comparer and an ordering comparer.
@@ -87,13 +90,14 @@ namespace xtd {
         /// @brief Represents the const reference of list value type.
         using const_reference = const value_type&;
         /// @brief Represents the pointer of list value type.
-        using pointer = value_type*;
+        /// @remarks The elements of a xtd::collections::generic::list <bool> are stored as xtd::byte : its pointer and its iterators refer to xtd::byte.
+        using pointer = typename base_type::value_type*;
         /// @brief Represents the const pointer of list value type.
-        using const_pointer = const value_type*;
+        using const_pointer = const typename base_type::value_type*;
         /// @brief Represents the iterator of list value type.
-        using iterator = ilist<type_t>::iterator;
+        using iterator = helpers::wrap_pointer_iterator<pointer>;
         /// @brief Represents the const iterator of list value type.
-        using const_iterator = ilist<type_t>::const_iterator;
+        using const_iterator = helpers::wrap_pointer_iterator<const_pointer>;
         /// @brief Represents the reverse iterator of list value type.
         using reverse_iterator = typename base_type::reverse_iterator;
         /// @brief Represents the const reverse iterator of list value type.
@@ -200,10 +204,10 @@ namespace xtd {
         
         /// @brief Returns an iterator to the first element of the enumarable.
         /// @return Iterator to the first element.
-        const_iterator begin() const noexcept override {return ienumerable<value_type>::begin();}
+        const_iterator begin() const noexcept {return const_iterator {data_->items.data()};}
         /// @brief Returns an iterator to the first element of the enumarable.
         /// @return Iterator to the first element.
-        iterator begin() noexcept override {return ienumerable<value_type>::begin();}
+        iterator begin() noexcept {return iterator {data_->items.data()};}
         
         /// @brief Gets the total number of elements the internal data structure can hold without resizing.
         /// @return Capacity of the currently allocated storage.
@@ -257,11 +261,11 @@ namespace xtd {
         
         /// @brief Returns an iterator to the first element of the enumarable.
         /// @return Iterator to the first element.
-        const_iterator cbegin() const noexcept override {return ienumerable<value_type>::cbegin();}
+        const_iterator cbegin() const noexcept {return begin();}
         
         /// @brief Returns an iterator to the element following the last element of the enumarable.
         /// @return Iterator to the element following the last element.
-        const_iterator cend() const noexcept override {return ienumerable<value_type>::cend();}
+        const_iterator cend() const noexcept {return end();}
         
         /// @brief Gets the number of elements contained in the xtd::collections::generic::list <type_t>.
         /// @return The number of elements contained in the xtd::collections::generic::list <type_t>.
@@ -299,11 +303,11 @@ namespace xtd {
         /// @brief Returns pointer to the underlying array serving as element storage.
         /// @return Pointer to the underlying element storage. For non-empty containers, the returned pointer compares equal to the address of the first element.
         /// @remarks The pointer is such that range [xtd::collections::generic::list::data(), xtd::collections::generic::list::data() + xtd::collections::generic::list::size()) is always a valid range, even if the container is empty (xtd::collections::generic::list::data() is not dereferenceable in that case).
-        virtual pointer data() noexcept {return (pointer)data_->items.data();}
+        virtual pointer data() noexcept {return data_->items.data();}
         /// @brief Returns pointer to the underlying array serving as element storage.
         /// @return Pointer to the underlying element storage. For non-empty containers, the returned pointer compares equal to the address of the first element.
         /// @remarks The pointer is such that range [xtd::collections::generic::list::data(), xtd::collections::generic::list::data() + xtd::collections::generic::list::size()) is always a valid range, even if the container is empty (xtd::collections::generic::list::data() is not dereferenceable in that case).
-        virtual const_pointer data() const noexcept {return (pointer)data_->items.data();}
+        virtual const_pointer data() const noexcept {return data_->items.data();}
 
         /// @brief Checks if the container has no elements, i.e. whether xtd::collections::generic::list::begin() == xtd::collections::generic::list::end().
         /// @return true if the container is empty, false otherwise.
@@ -311,10 +315,10 @@ namespace xtd {
         
         /// @brief Returns an iterator to the element following the last element of the enumarable.
         /// @return Iterator to the element following the last element.
-        const_iterator end() const noexcept override {return ienumerable<value_type>::end();}
+        const_iterator end() const noexcept {return begin() + static_cast<difference_type>(data_->items.size());}
         /// @brief Returns an iterator to the element following the last element of the enumarable.
         /// @return Iterator to the element following the last element.
-        iterator end() noexcept override {return ienumerable<value_type>::end();}
+        iterator end() noexcept {return begin() + static_cast<difference_type>(data_->items.size());}
         
         /// @brief Returns a reference to the first element in the container.
         /// @return Reference to the first element.
@@ -467,7 +471,7 @@ namespace xtd {
         }
         
         bool contains(const type_t& value) const noexcept override {
-          for (const type_t& item : data_->items)
+          for (const auto& item : data_->items)
             if (item == value) return true;
           return false;
         }
@@ -502,15 +506,8 @@ namespace xtd {
         /// @include ListCopyTo.cpp
         virtual void copy_to(xtd::size index, xtd::array<type_t>& array, xtd::size array_index, xtd::size count) const {
           if (index + count > this->count() || array_index + count > array.size()) throw xtd::argument_exception {csf_};
-          auto i = 0_z, c = 0_z;
-          for (const type_t& item : *this) {
-            if (i >= index + count) return;
-            if (i >= index) {
-              array[array_index + c] = item;
-              c += 1;
-            }
-            i += 1;
-          }
+          for (auto i = 0_z; i < count; ++i)
+            array[array_index + i] = data_->items[index + i];
         }
         
         /// @brief Inserts a new element into the container directly before `pos`.
@@ -589,6 +586,21 @@ namespace xtd {
               return ++index_ < items_.count();
             }
             
+            std::span<const value_type> move_next_batch() override {
+              // The elements of a list <bool> are stored as xtd::byte : they are enumerated one by one.
+              if constexpr (std::is_same_v<value_type, bool>) return ienumerator<value_type>::move_next_batch();
+              else {
+                if (version_ != items_.data_->version) throw xtd::invalid_operation_exception {"Collection was modified; enumeration operation may not execute.", csf_};
+                auto first = index_ == xtd::box_integer<xtd::size>::max_value ? 0 : index_ + 1;
+                if (first >= items_.count()) {
+                  index_ = items_.count();
+                  return {};
+                }
+                index_ = items_.count() - 1;
+                return std::span<const value_type> {items_.data() + first, items_.count() - first};
+              }
+            }
+            
             void reset() override {
               version_ = items_.data_->version;
               index_ = xtd::box_integer<xtd::size>::max_value;
@@ -733,7 +745,9 @@ namespace xtd {
             return;
           }
           
-          insert(begin() + index, enumerable.begin(), enumerable.end());
+          auto span = std::span<const type_t> {};
+          if (enumerable.try_get_span(span)) insert(begin() + index, span.begin(), span.end());
+          else insert(begin() + index, enumerable.begin(), enumerable.end());
         }
         
         /// @brief Inserts copy of elements from a collection into the xtd::collections::generic::list <type_t> at the specified index.
@@ -894,6 +908,19 @@ namespace xtd {
         /// @remarks To reset a xtd::collections::generic::list <type_t> to its initial state, call the xtd::collections::generic::list::clear method before calling the xtd::collections::generic::list::trim_excess method. Trimming an empty xtd::collections::generic::list <type_t> sets the capacity of the xtd::collections::generic::list <type_t> to the default capacity.
         /// @remarks The capacity can also be set using the xtd::collections::generic::list::capacity property.
         virtual void trim_excess() {shrink_to_fit();}
+        
+        /// @brief Gets the elements of the xtd::collections::generic::list <type_t> as a span.
+        /// @param result When this method returns, contains the elements of the xtd::collections::generic::list <type_t>.
+        /// @return true if the elements are stored contiguously; otherwise false.
+        /// @remarks The span is valid until the xtd::collections::generic::list <type_t> is modified.
+        /// @remarks The elements of a xtd::collections::generic::list <bool> are stored as xtd::byte : they cannot be viewed as a span of bool, and this method returns false.
+        bool try_get_span(std::span<const type_t>& result) const noexcept override {
+          if constexpr (std::is_same_v<type_t, bool>) return ienumerable<type_t>::try_get_span(result);
+          else {
+            result = std::span<const type_t> {data_->items.data(), data_->items.size()};
+            return true;
+          }
+        }
         /// @}
         
         /// @name Public Operators
@@ -940,17 +967,9 @@ namespace xtd {
         /// @}
         
       private:
-        typename base_type::iterator to_base_type_iterator(iterator value) noexcept {
-          if (value == begin()) return data_->items.begin();
-          if (value == end()) return data_->items.end();
-          return data_->items.begin() + (value - begin());
-        }
+        typename base_type::iterator to_base_type_iterator(const_iterator value) noexcept {return data_->items.begin() + (value - cbegin());}
         
-        iterator to_iterator(typename base_type::iterator value) noexcept {
-          if (value == data_->items.begin()) return begin();
-          if (value == data_->items.end()) return end();
-          return begin() + (value - data_->items.begin());
-        }
+        iterator to_iterator(typename base_type::iterator value) noexcept {return begin() + (value - data_->items.begin());}
 
         struct data {
           data() = default;
@@ -959,7 +978,11 @@ namespace xtd {
           explicit data(size_type count, const allocator_type& alloc = allocator_type()) : items(count, alloc) {}
           template<typename input_iterator_t>
           data(input_iterator_t first, input_iterator_t last, const allocator_type& alloc = allocator_type()) : items(first, last, alloc) {}
-          data(const xtd::collections::generic::ienumerable<type_t>& collection, const allocator_type& alloc = allocator_type()) : items(collection.begin(), collection.end(), alloc) {}
+          data(const xtd::collections::generic::ienumerable<type_t>& collection, const allocator_type& alloc = allocator_type()) : items(alloc) {
+            auto span = std::span<const type_t> {};
+            if (collection.try_get_span(span)) items.assign(span.begin(), span.end());
+            else items.assign(collection.begin(), collection.end());
+          }
           data(const list& list) : items(list.data_->items), version(list.data_->version) {}
           data(const base_type& list) : items(list) {}
           data(const list& list, const allocator_type& alloc) : items(list.data_->items, alloc), version(list.data_->version) {}
@@ -212,6 +212,11 @@ namespace xtd {
         /// @remarks This method determines equality using the default comparer xtd::collections::generic::equality_comparer::default_comparer.
         /// @remarks This method performs a linear search; therefore, this method is an O(n) operation, where n is xtd::collections::object_model::read_only_collection::count.
         xtd::size index_of(const type_t& item) const noexcept override {return items_->index_of(item);}
+        
+        /// @brief Gets the elements of the xtd::collections::object_model::read_only_collection <type_t> as a span when the elements of the wrapped list are stored contiguously.
+        /// @param result When this method returns, contains the elements of the wrapped list if they are stored contiguously; otherwise an empty span.
+        /// @return true if the elements of the wrapped list are stored contiguously; otherwise false.
+        bool try_get_span(std::span<const type_t>& result) const noexcept override {return items_->try_get_span(result);}
         /// @}
 
         /// @name Public Operators
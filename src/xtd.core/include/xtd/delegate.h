@@ -2,14 +2,22 @@
 /// @brief Contains xtd::delegate delegate.
 /// @copyright Copyright (c) 2024 Gammasoft. All rights reserved.
 #pragma once
+#define __XTD_CORE_INTERNAL__
+#include "internal/__invocation_list.h"
+#undef __XTD_CORE_INTERNAL__
 #include "any.h"
 #include "argument_null_exception.h"
 #include "async_result.h"
 #include "iequatable.h"
 #include "object.h"
 #include "object_ref.h"
+#include <algorithm>
 #include <functional>
+#include <memory>
 #include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 /// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
@@ -21,7 +29,7 @@ namespace xtd {
   template<typename result_t, typename... arguments_t>
   class delegate<result_t(arguments_t...)>;
   /// @endcond
-
+  
   /// @brief References a method to be called when a corresponding asynchronous operation completes.
   /// @param ar The result of the asynchronous operation.
   /// @par Header
@@ -34,7 +42,7 @@ namespace xtd {
   /// xtd.core
   /// @ingroup xtd_core
   using async_callback = delegate<void(async_result ar)>;
-
+  
   /// @brief Represents a delegate, which is a data structure that refers to a static method or to a class instance && an instance method of that class.
   /// @par Header
   /// ```cpp
@@ -51,9 +59,7 @@ namespace xtd {
   /// @include delegate.cpp
   template<typename result_t>
   class delegate<result_t()> : public xtd::object, public xtd::iequatable<delegate<result_t()>> {
-    struct data {
-      std::vector<std::function <result_t()>> functions;
-    };
+    using invocation_list = __xtd_invocation_list<result_t>;
     
     class async_result_invoke : public xtd::iasync_result {
       struct data;
@@ -66,7 +72,7 @@ namespace xtd {
       
       xtd::sptr<data> data_;
     };
-
+  
   public:
     /// @name Public Aliases
     
@@ -75,34 +81,57 @@ namespace xtd {
     using function_t = std::function <result_t()>;
     /// @}
     
+    /// @name Public Classes
+    
+    /// @{
+    /// @brief Identifies the functions added to a delegate by one call to xtd::delegate::operator +=.
+    /// @remarks Pass it to xtd::delegate::operator -= to remove these functions without comparing them with the other functions of the delegate.
+    /// @remarks A subscription converts to the delegate it was returned by, so `+=` can still be used where a reference to the delegate is expected.
+    class subscription {
+    public:
+      /// @brief Initializes a subscription that identifies no function.
+      subscription() noexcept = default;
+      
+      /// @brief Gets the delegate the functions were added to.
+      operator delegate&() const noexcept {return *delegate_;}
+    
+    private:
+      friend class delegate;
+      subscription(delegate& delegate, typename invocation_list::token_range tokens) noexcept : delegate_(&delegate), tokens_(tokens) {}
+      
+      delegate* delegate_ = nullptr;
+      typename invocation_list::token_range tokens_;
+    };
+    /// @}
+    
     /// @name Public Constructors
     
     /// @{
     /// @brief Initializes an empty delegate.
     delegate() = default;
     /// @cond
-    delegate(delegate&&) = default;
+    delegate(delegate&& delegate) noexcept : data_(delegate.data_) {delegate.data_.clear();}
     delegate(const delegate&) = default;
     delegate& operator =(const delegate& delegate) = default;
     /// @endcond
-
+    
     /// @brief Initializes a delegate that invokes the specified instance method.
     /// @param function the method instance.
-    delegate(const function_t& function) noexcept {data_->functions.push_back(function);} // Can't be explicit by design.
+    delegate(const function_t& function) noexcept {data_.add_function(function);} // Can't be explicit by design.
     
     /// @brief Initializes a delegate that invokes the specified instance method on the specified class instance.
     /// @param object the class instance.
     /// @param function the method instance.
     template<typename object1_t, typename object2_t>
     delegate(const object1_t& object, result_t(object2_t::*method)() const) noexcept {
-      data_->functions.push_back(function_t(std::bind(method, const_cast<object1_t*>(&object))));
+      data_.add_function([object = const_cast<object1_t*>(&object), method]() -> result_t {return (object->*method)();});
     }
     /// @brief Initializes a delegate that invokes the specified instance method on the specified class instance.
     /// @param object the class instance.
     /// @param function the method instance.
     template<typename object1_t, typename object2_t>
     delegate(const object1_t& object, result_t(object2_t::*method)()) noexcept {
-      data_->functions.push_back(function_t(std::bind(method, const_cast<object1_t*>(&object))));
+      data_.add_function([object = const_cast<object1_t*>(&object), method]() -> result_t {return (object->*method)();});
     }
     /// @}
     
@@ -111,23 +140,24 @@ namespace xtd {
     /// @{
     /// @brief Gets the delegates array
     /// @return The delegates array.
-    const std::vector<function_t>& functions() const {return data_->functions;}
+    /// @remarks The returned reference stays valid until the delegate is changed.
+    const std::vector<function_t>& functions() const {return data_.functions();}
     
     /// @brief Return if the delegate is empty.
     /// @return bool Return true if delegate is empty; otherwise false.
-    bool is_empty() const noexcept {return data_->functions.size() == 0;}
+    bool is_empty() const noexcept {return data_.is_empty();}
     
     /// @brief Return the size of invocation list.
     /// @return Return the size of invocation list.
-    size_t size() const noexcept {return data_->functions.size();}
+    size_t size() const noexcept {return data_.size();}
     /// @}
     
     /// @name Public Methods
     
     /// @{
     /// @brief Clear delegates array.
-    void clear() {data_->functions.clear();}
-
+    void clear() noexcept {data_.clear();}
+    
     /// @brief Executes the method represented by the current delegate asynchronously on the thread that the control's underlying handle was created on.
     /// @return An async_result_invoke that represents the result of the begin_invoke operation.
     /// @par Examples
@@ -149,14 +179,14 @@ namespace xtd {
     /// The following examples shows hot tu use xtd::delegate::begin_invoke, xtd::delegate::end_invoke, xtd::delegate::invoke methods.
     /// @include delegate_begin_invoke.cpp
     async_result begin_invoke(xtd::async_callback async_callback, std::any async_state);
-
+    
     /// @brief Retrieves the return value of the asynchronous operation represented by the async_result_invoke passed.
     /// @param async The async_result_invoke that represents a specific invoke asynchronous operation, returned when calling begin_invoke.
     /// @par Examples
     /// The following examples shows hot tu use xtd::delegate::begin_invoke, xtd::delegate::end_invoke, xtd::delegate::invoke methods.
     /// @include delegate_begin_invoke.cpp
     result_t end_invoke(async_result async);
-
+    
     /// @brief invokes the method represented by the current delegate.
     /// @param arguments The parameter list.
     /// @return result_t The return value.
@@ -169,18 +199,9 @@ namespace xtd {
     /// @brief Determines whether this instance and another specified delegateType object have the same value.
     /// @param value The delegateType to compare.
     /// @return bool true if the value of this instance is the same as the value of value; otherwise, false.
-    bool equals(const delegate& delegate) const noexcept override {
-      if (data_->functions.size() != delegate.data_->functions.size())
-        return false;
-      
-      for (size_t i = 0; i < data_->functions.size(); i++)
-        if (!are_equals(data_->functions[i], delegate.data_->functions[i]))
-          return false;
-      
-      return true;
-    }
+    bool equals(const delegate& delegate) const noexcept override {return data_.equals(delegate.data_);}
     /// @}
-
+    
     /// @name Public Static Methods
     
     /// @{
@@ -191,10 +212,8 @@ namespace xtd {
     /// @remarks The invocation list can contain duplicate entries; that is, entries that refer to the same method on the same object.
     static delegate combine(const std::vector<delegate>& delegates) noexcept {
       delegate result;
-      for (const delegate& delegate : delegates) {
-        for (const function_t& function : delegate.data_->functions)
-          result.data_->functions.push_back(function);
-      }
+      for (const delegate& delegate : delegates)
+        result.data_.add(delegate.data_);
       return result;
     }
     
@@ -205,8 +224,7 @@ namespace xtd {
     /// @remarks The invocation list can contain duplicate entries; that is, entries that refer to the same method on the same object.
     static delegate combine(const delegate& a, const delegate& b) noexcept {
       delegate result = a;
-      for (const function_t& function : b.data_->functions)
-        result.data_->functions.push_back(function);
+      result.data_.add(b.data_);
       return result;
     }
     
@@ -217,10 +235,7 @@ namespace xtd {
     /// @remarks If the invocation list of value matches a contiguous set of elements in the invocation list of source, then the invocation list of value is said to occur within the invocation list of source. If the invocation list of value occurs more than once in the invocation list of source, the last occurrence is removed.
     static delegate remove(const delegate& source, const delegate& value) noexcept {
       delegate result = source;
-      std::for_each(value.data_->functions.begin(), value.data_->functions.end(), [&](auto function) {
-        auto iterator = std::find_if(result.data_->functions.rbegin(), result.data_->functions.rend(), [&](auto item) {return are_equals(item, function);});
-        if (iterator != result.data_->functions.rend()) result.data_->functions.erase((iterator + 1).base());
-      });
+      result.data_.remove(value.data_);
       return result;
     }
     
@@ -231,14 +246,7 @@ namespace xtd {
     /// @remarks If the invocation list of value matches a contiguous set of elements in the invocation list of source, then the invocation list of value is said to occur within the invocation list of source. If the invocation list of value occurs more than once in the invocation list of source, all occurrences are removed.
     static delegate remove_all(const delegate& source, const delegate& value) noexcept {
       delegate result = source;
-      for (const function_t& function : value.data_->functions) {
-        if (find(result.data_->functions.begin(), result.data_->functions.end(), function) != result.data_->functions.end()) {
-          for (typename std::vector<function_t>::reverse_iterator iterator = result.data_->functions.rbegin(); iterator != result.data_->functions.rend(); ++iterator) {
-            if (are_equals(*iterator, function))
-              result.data_->functions.erase((iterator + 1).base());
-          }
-        }
-      }
+      result.data_.remove_all(value.data_);
       return result;
     }
     /// @}
@@ -249,20 +257,11 @@ namespace xtd {
     /// @brief invokes the method represented by the current delegate.
     /// @param arguments The parameter list.
     /// @return result_t The return value.
-    result_t operator()() const {
-      if (data_->functions.size() == 0) return result_t();
-      
-      for (size_t i = 0; i < data_->functions.size() - 1; i++) {
-        if (data_->functions[i] == nullptr) throw xtd::argument_null_exception {csf_};
-        data_->functions[i]();
-      }
-      if (data_->functions.back() == nullptr) throw xtd::argument_null_exception {csf_};
-      return data_->functions.back()();
-    }
+    /// @remarks The delegate can be invoked while other threads add or remove functions; each invocation calls the functions the delegate held when it started.
+    result_t operator()() const {return data_.invoke();}
     
     delegate& operator =(const function_t& function) noexcept {
-      data_->functions.clear();
-      data_->functions.push_back(function);
+      *this = delegate {function};
       return *this;
     }
     /// @}
@@ -286,23 +285,26 @@ namespace xtd {
       result += function;
       return result;
     }
-
-    delegate& operator +=(const delegate& delegate) noexcept {
-      *this = delegate::combine(*this, delegate);
-      return *this;
-    }
+    /// @endcond
     
-    delegate& operator +=(const function_t& function) noexcept {
-      *this = delegate::combine(*this, delegate(function));
-      return *this;
-    }
+    /// @brief Adds the functions of the specified delegate to the invocation list.
+    /// @param delegate The delegate whose functions are added.
+    /// @return A subscription that xtd::delegate::operator -= takes to remove these functions.
+    subscription operator +=(const delegate& delegate) noexcept {return subscription {*this, data_.add(delegate.data_)};}
+    
+    /// @brief Adds the specified function to the invocation list.
+    /// @param function The function to add.
+    /// @return A subscription that xtd::delegate::operator -= takes to remove this function.
+    subscription operator +=(const function_t& function) noexcept {return subscription {*this, data_.add_function(function)};}
     
+    /// @brief Adds the specified function to the invocation list.
+    /// @param function The function to add.
+    /// @return A subscription that xtd::delegate::operator -= takes to remove this function.
+    /// @remarks A function pointer, or a callable object that is trivially copyable and no larger than three pointers, is stored in the delegate itself while it is the only function : adding, removing and invoking it do not allocate.
     template<typename fn_t>
-    delegate& operator +=(fn_t function) noexcept {
-      *this = delegate::combine(*this, delegate(function));
-      return *this;
-    }
-
+    subscription operator +=(fn_t function) noexcept {return subscription {*this, data_.add_function(function)};}
+    
+    /// @cond
     delegate operator -(const delegate& other) noexcept {
       delegate result = *this;
       result -= other;
@@ -321,35 +323,35 @@ namespace xtd {
       result -= function;
       return result;
     }
-
+    
     delegate& operator -=(const delegate& delegate) noexcept {
-      *this = delegate::remove(*this, delegate);
+      data_.remove(delegate.data_);
       return *this;
     }
     
     delegate& operator -=(const function_t& function) noexcept {
-      *this = delegate::remove(*this, delegate(function));
+      data_.remove_function(function);
       return *this;
     }
     
     template<typename fn_t>
     delegate& operator -=(fn_t function) noexcept {
-      *this = delegate::remove(*this, delegate(function));
+      data_.remove_function(function_t {function});
       return *this;
     }
     /// @endcond
     
-  private:
-    static bool are_equals(const std::function<result_t()>& fct1, const std::function<result_t()>& fct2) noexcept {
-      return fct1.target_type() == fct2.target_type() && (fct1.template target<result_t(*)()>() == fct2.template target<result_t(*)()>() || *fct1.template target<result_t(*)()>() == *fct2.template target<result_t(*)()>());
-    }
-    
-    static typename std::vector<function_t>::const_iterator find(typename std::vector<function_t>::const_iterator begin, typename std::vector<function_t>::const_iterator end, const function_t& function) noexcept {
-      auto iterator = std::find_if(begin, end, [&](auto item) {return are_equals(item, function);});
-      if (iterator != end) return iterator;
-      return end;
+    /// @brief Removes the functions added by the call to xtd::delegate::operator += that returned the specified subscription.
+    /// @param subscription The subscription returned by xtd::delegate::operator +=.
+    /// @return The current delegate.
+    /// @remarks The functions are found by their subscription token instead of by comparing them with the functions of the delegate; removing the only function of a delegate does not allocate.
+    delegate& operator -=(const subscription& subscription) noexcept {
+      data_.remove(subscription.tokens_);
+      return *this;
     }
-    xtd::sptr<data> data_ = xtd::new_sptr<data>();
+  
+  private:
+    invocation_list data_;
   };
   
   /// @brief Represents a delegate, which is a data structure that refers to a static method or to a class instance && an instance method of that class.
@@ -368,10 +370,7 @@ namespace xtd {
   /// @include delegate.cpp
   template<typename result_t, typename... arguments_t>
   class delegate<result_t(arguments_t...)> : public object, public xtd::iequatable<delegate<result_t(arguments_t...)>> {
-    struct data {
-      std::vector<std::function <result_t()>> no_arguments_functions;
-      std::vector<std::function <result_t(arguments_t...)>> functions;
-    };
+    using invocation_list = __xtd_invocation_list<result_t, arguments_t...>;
     
     class async_result_invoke : public xtd::iasync_result {
       struct data;
@@ -384,7 +383,7 @@ namespace xtd {
       
       xtd::sptr<data> data_;
     };
-
+  
   public:
     /// @name Public Aliases
     
@@ -395,163 +394,91 @@ namespace xtd {
     using function_t = std::function <result_t(arguments_t...)>;
     /// @}
     
+    /// @name Public Classes
+    
+    /// @{
+    /// @brief Identifies the functions added to a delegate by one call to xtd::delegate::operator +=.
+    /// @remarks Pass it to xtd::delegate::operator -= to remove these functions without comparing them with the other functions of the delegate.
+    /// @remarks A subscription converts to the delegate it was returned by, so `+=` can still be used where a reference to the delegate is expected.
+    class subscription {
+    public:
+      /// @brief Initializes a subscription that identifies no function.
+      subscription() noexcept = default;
+      
+      /// @brief Gets the delegate the functions were added to.
+      operator delegate&() const noexcept {return *delegate_;}
+    
+    private:
+      friend class delegate;
+      subscription(delegate& delegate, typename invocation_list::token_range tokens) noexcept : delegate_(&delegate), tokens_(tokens) {}
+      
+      delegate* delegate_ = nullptr;
+      typename invocation_list::token_range tokens_;
+    };
+    /// @}
+    
     /// @name Public Constructors
     
     /// @{
     /// @brief Initializes an empty delegate.
     delegate() = default;
     /// @cond
-    delegate(delegate&&) = default;
+    delegate(delegate&& delegate) noexcept : data_(delegate.data_) {delegate.data_.clear();}
     delegate(const delegate&) = default;
     delegate& operator =(const delegate& delegate) = default;
-    delegate(const delegate<result_t()>& delegate) noexcept {data_->no_arguments_functions = delegate.functions();}
+    delegate(const delegate<result_t()>& delegate) noexcept {
+      for (const no_arguments_function_t& function : delegate.functions())
+        data_.add_no_arguments_function(function);
+    }
     /// @endcond
     
     /// @brief Initializes a delegate that invokes the specified instance method.
     /// @param function the method instance.
-    delegate(const function_t& function) noexcept {data_->functions.push_back(function);} // Can't be explicit by design.
+    delegate(const function_t& function) noexcept {data_.add_function(function);} // Can't be explicit by design.
     
     /// @cond
-    delegate(const no_arguments_function_t& function) noexcept {data_->no_arguments_functions.push_back(function);} // Can't be explicit by design.
+    delegate(const no_arguments_function_t& function) noexcept {data_.add_no_arguments_function(function);} // Can't be explicit by design.
     /// @endcond
     
     /// @brief Initializes a delegate that invokes the specified instance method on the specified class instance.
     /// @param object the class instance.
     /// @param function the method instance.
-    template<typename object1_t, typename object2_t>
-    delegate(const object1_t& object, result_t(object2_t::*method)() const) noexcept {
-      data_->functions.push_back(function_t(std::bind(method, const_cast<object1_t*>(&object))));
+    /// @remarks The method can take fewer parameters than the delegate; it receives the first arguments of the invocation.
+    template<typename object1_t, typename object2_t, typename... method_arguments_t>
+    delegate(const object1_t& object, result_t(object2_t::*method)(method_arguments_t...) const) noexcept {
+      data_.add_function(bind_member(const_cast<object1_t*>(&object), method, std::make_index_sequence<sizeof...(method_arguments_t)> {}));
     }
     
     /// @brief Initializes a delegate that invokes the specified instance method on the specified class instance.
     /// @param object the class instance.
     /// @param function the method instance.
-    template<typename object1_t, typename object2_t>
-    delegate(const object1_t& object, result_t(object2_t::*method)()) noexcept {
-      data_->functions.push_back(function_t(std::bind(method, const_cast<object1_t*>(&object))));
+    /// @remarks The method can take fewer parameters than the delegate; it receives the first arguments of the invocation.
+    template<typename object1_t, typename object2_t, typename... method_arguments_t>
+    delegate(const object1_t& object, result_t(object2_t::*method)(method_arguments_t...)) noexcept {
+      data_.add_function(bind_member(const_cast<object1_t*>(&object), method, std::make_index_sequence<sizeof...(method_arguments_t)> {}));
     }
     /// @}
     
-    /// @cond
-    template<typename object1_t, typename object2_t, typename a1_t>
-    delegate(const object1_t& object, result_t(object2_t::*method)(a1_t) const) noexcept {
-      data_->functions.push_back(function_t(std::bind(method, const_cast<object1_t*>(&object), std::placeholders::_1)));
-    }
-    
-    template<typename object1_t, typename object2_t, typename a1_t>
-    delegate(const object1_t& object, result_t(object2_t::*method)(a1_t)) noexcept {
-      data_->functions.push_back(function_t(std::bind(method, const_cast<object1_t*>(&object), std::placeholders::_1)));
-    }
-    
-    template<typename object1_t, typename object2_t, typename a1_t, typename a2_t>
-    delegate(const object1_t& object, result_t(object2_t::*method)(a1_t, a2_t) const) noexcept {
-      data_->functions.push_back(function_t(std::bind(method, const_cast<object1_t*>(&object), std::placeholders::_1, std::placeholders::_2)));
-    }
-    
-    template<typename object1_t, typename object2_t, typename a1_t, typename a2_t>
-    delegate(const object1_t& object, result_t(object2_t::*method)(a1_t, a2_t)) noexcept {
-      data_->functions.push_back(function_t(std::bind(method, const_cast<object1_t*>(&object), std::placeholders::_1, std::placeholders::_2)));
-    }
-    
-    template<typename object1_t, typename object2_t, typename a1_t, typename a2_t, typename a3_t>
-    delegate(const object1_t& object, result_t(object2_t::*method)(a1_t, a2_t, a3_t) const) noexcept {
-      data_->functions.push_back(function_t(std::bind(method, const_cast<object1_t*>(&object), std::placeholders::_1, std::placeholders::_2, std::placeholders::_3)));
-    }
-    
-    template<typename object1_t, typename object2_t, typename a1_t, typename a2_t, typename a3_t>
-    delegate(const object1_t& object, result_t(object2_t::*method)(a1_t, a2_t, a3_t)) noexcept {
-      data_->functions.push_back(function_t(std::bind(method, const_cast<object1_t*>(&object), std::placeholders::_1, std::placeholders::_2, std::placeholders::_3)));
-    }
-    
-    template<typename object1_t, typename object2_t, typename a1_t, typename a2_t, typename a3_t, typename a4_t>
-    delegate(const object1_t& object, result_t(object2_t::*method)(a1_t, a2_t, a3_t, a4_t) const) {
-      data_->functions.push_back(function_t(std::bind(method, const_cast<object1_t*>(&object), std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4)));
-    }
-    
-    template<typename object1_t, typename object2_t, typename a1_t, typename a2_t, typename a3_t, typename a4_t>
-    delegate(const object1_t& object, result_t(object2_t::*method)(a1_t, a2_t, a3_t, a4_t)) noexcept {
-      data_->functions.push_back(function_t(std::bind(method, const_cast<object1_t*>(&object), std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4)));
-    }
-    
-    template<typename object1_t, typename object2_t, typename a1_t, typename a2_t, typename a3_t, typename a4_t, typename A5>
-    delegate(const object1_t& object, result_t(object2_t::*method)(a1_t, a2_t, a3_t, a4_t, A5) const) noexcept {
-      data_->functions.push_back(function_t(std::bind(method, const_cast<object1_t*>(&object), std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4, std::placeholders::_5)));
-    }
-    
-    template<typename object1_t, typename object2_t, typename a1_t, typename a2_t, typename a3_t, typename a4_t, typename A5>
-    delegate(const object1_t& object, result_t(object2_t::*method)(a1_t, a2_t, a3_t, a4_t, A5)) {
-      data_->functions.push_back(function_t(std::bind(method, const_cast<object1_t*>(&object), std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4, std::placeholders::_5)));
-    }
-    
-    template<typename object1_t, typename object2_t, typename a1_t, typename a2_t, typename a3_t, typename a4_t, typename A5, typename a6_t>
-    delegate(const object1_t& object, result_t(object2_t::*method)(a1_t, a2_t, a3_t, a4_t, A5, a6_t) const) noexcept {
-      data_->functions.push_back(function_t(std::bind(method, const_cast<object1_t*>(&object), std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4, std::placeholders::_5, std::placeholders::_6)));
-    }
-    
-    template<typename object1_t, typename object2_t, typename a1_t, typename a2_t, typename a3_t, typename a4_t, typename A5, typename a6_t>
-    delegate(const object1_t& object, result_t(object2_t::*method)(a1_t, a2_t, a3_t, a4_t, A5, a6_t)) noexcept {
-      data_->functions.push_back(function_t(std::bind(method, const_cast<object1_t*>(&object), std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4, std::placeholders::_5, std::placeholders::_6)));
-    }
-    
-    template<typename object1_t, typename object2_t, typename a1_t, typename a2_t, typename a3_t, typename a4_t, typename A5, typename a6_t, typename a7_t>
-    delegate(const object1_t& object, result_t(object2_t::*method)(a1_t, a2_t, a3_t, a4_t, A5, a6_t, a7_t) const) noexcept {
-      data_->functions.push_back(function_t(std::bind(method, const_cast<object1_t*>(&object), std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4, std::placeholders::_5, std::placeholders::_6, std::placeholders::_7)));
-    }
-    
-    template<typename object1_t, typename object2_t, typename a1_t, typename a2_t, typename a3_t, typename a4_t, typename A5, typename a6_t, typename a7_t>
-    delegate(const object1_t& object, result_t(object2_t::*method)(a1_t, a2_t, a3_t, a4_t, A5, a6_t, a7_t)) noexcept {
-      data_->functions.push_back(function_t(std::bind(method, const_cast<object1_t*>(&object), std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4, std::placeholders::_5, std::placeholders::_6, std::placeholders::_7)));
-    }
-    
-    template<typename object1_t, typename object2_t, typename a1_t, typename a2_t, typename a3_t, typename a4_t, typename A5, typename a6_t, typename a7_t, typename a8_t>
-    delegate(const object1_t& object, result_t(object2_t::*method)(a1_t, a2_t, a3_t, a4_t, A5, a6_t, a7_t, a8_t) const) noexcept {
-      data_->functions.push_back(function_t(std::bind(method, const_cast<object1_t*>(&object), std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4, std::placeholders::_5, std::placeholders::_6, std::placeholders::_7, std::placeholders::_8)));
-    }
-    
-    template<typename object1_t, typename object2_t, typename a1_t, typename a2_t, typename a3_t, typename a4_t, typename A5, typename a6_t, typename a7_t, typename a8_t>
-    delegate(const object1_t& object, result_t(object2_t::*method)(a1_t, a2_t, a3_t, a4_t, A5, a6_t, a7_t, a8_t)) noexcept {
-      data_->functions.push_back(function_t(std::bind(method, const_cast<object1_t*>(&object), std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4, std::placeholders::_5, std::placeholders::_6, std::placeholders::_7, std::placeholders::_8)));
-    }
-    
-    template<typename object1_t, typename object2_t, typename a1_t, typename a2_t, typename a3_t, typename a4_t, typename A5, typename a6_t, typename a7_t, typename a8_t, typename a9_t>
-    delegate(const object1_t& object, result_t(object2_t::*method)(a1_t, a2_t, a3_t, a4_t, A5, a6_t, a7_t, a8_t, a9_t) const) noexcept {
-      data_->functions.push_back(function_t(std::bind(method, const_cast<object1_t*>(&object), std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4, std::placeholders::_5, std::placeholders::_6, std::placeholders::_7, std::placeholders::_8, std::placeholders::_9)));
-    }
-    
-    template<typename object1_t, typename object2_t, typename a1_t, typename a2_t, typename a3_t, typename a4_t, typename A5, typename a6_t, typename a7_t, typename a8_t, typename a9_t>
-    delegate(const object1_t& object, result_t(object2_t::*method)(a1_t, a2_t, a3_t, a4_t, A5, a6_t, a7_t, a8_t, a9_t)) noexcept {
-      data_->functions.push_back(function_t(std::bind(method, const_cast<object1_t*>(&object), std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4, std::placeholders::_5, std::placeholders::_6, std::placeholders::_7, std::placeholders::_8, std::placeholders::_9)));
-    }
-    
-    template<typename object1_t, typename object2_t, typename a1_t, typename a2_t, typename a3_t, typename a4_t, typename A5, typename a6_t, typename a7_t, typename a8_t, typename a9_t, typename a10_t>
-    delegate(const object1_t& object, result_t(object2_t::*method)(a1_t, a2_t, a3_t, a4_t, A5, a6_t, a7_t, a8_t, a9_t, a10_t) const) noexcept {
-      data_->functions.push_back(function_t(std::bind(method, const_cast<object1_t*>(&object), std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4, std::placeholders::_5, std::placeholders::_6, std::placeholders::_7, std::placeholders::_8, std::placeholders::_9, std::placeholders::_10)));
-    }
-    
-    template<typename object1_t, typename object2_t, typename a1_t, typename a2_t, typename a3_t, typename a4_t, typename A5, typename a6_t, typename a7_t, typename a8_t, typename a9_t, typename a10_t>
-    delegate(const object1_t& object, result_t(object2_t::*method)(a1_t, a2_t, a3_t, a4_t, A5, a6_t, a7_t, a8_t, a9_t, a10_t)) noexcept {
-      data_->functions.push_back(function_t(std::bind(method, const_cast<object1_t*>(&object), std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4, std::placeholders::_5, std::placeholders::_6, std::placeholders::_7, std::placeholders::_8, std::placeholders::_9, std::placeholders::_10)));
-    }
-    /// @endcond
-    
     /// @name Public Properties
     
     /// @{
     /// @brief Gets the no arguments delegates array
-    /// @return The delegates array.
-    const std::vector<no_arguments_function_t>& no_arguments_functions() const {return data_->no_arguments_functions;}
+    /// @return The no arguments delegates array.
+    /// @remarks The returned reference stays valid until the delegate is changed.
+    const std::vector<no_arguments_function_t>& no_arguments_functions() const {return data_.no_arguments_functions();}
     
     /// @brief Gets the delegates array
     /// @return The delegates array.
-    const std::vector<function_t>& functions() const {return data_->functions;}
+    /// @remarks The returned reference stays valid until the delegate is changed.
+    const std::vector<function_t>& functions() const {return data_.functions();}
     
     /// @brief Return if the delegate is empty.
     /// @return bool Return true if delegate is empty; otherwise false.
-    bool is_empty() const noexcept {return data_->functions.size() == 0 && data_->no_arguments_functions.size() == 0;}
+    bool is_empty() const noexcept {return data_.is_empty();}
     
     /// @brief Return the size of invocation list.
     /// @return Return the size of invocation list.
-    size_t size() const noexcept {return data_->functions.size() + data_->no_arguments_functions.size();}
+    size_t size() const noexcept {return data_.size();}
     /// @}
     
     /// @name Public Methods
@@ -581,14 +508,14 @@ namespace xtd {
     /// The following examples shows hot tu use xtd::delegate::begin_invoke, xtd::delegate::end_invoke, xtd::delegate::invoke methods.
     /// @include delegate_begin_invoke.cpp
     async_result begin_invoke(xtd::async_callback async_callback, std::any async_state, arguments_t... arguments);
-        
+    
     /// @brief Retrieves the return value of the asynchronous operation represented by the async_result_invoke passed.
     /// @param async The async_result_invoke that represents a specific invoke asynchronous operation, returned when calling begin_invoke.
     /// @par Examples
     /// The following examples shows hot tu use xtd::delegate::begin_invoke, xtd::delegate::end_invoke, xtd::delegate::invoke methods.
     /// @include delegate_begin_invoke.cpp
     result_t end_invoke(async_result async);
-
+    
     /// @brief invokes the method represented by the current delegate.
     /// @param arguments The parameter list.
     /// @return result_t The return value.
@@ -601,20 +528,7 @@ namespace xtd {
     /// @brief Determines whether this instance and another specified delegateType object have the same value.
     /// @param value The delegateType to compare.
     /// @return bool true if the value of this instance is the same as the value of value; otherwise, false.
-    bool equals(const delegate& delegate) const noexcept override {
-      if (data_->functions.size() != delegate.data_->functions.size() || data_->no_arguments_functions.size() != delegate.data_->no_arguments_functions.size())
-        return false;
-      
-      for (size_t i = 0; i < data_->no_arguments_functions.size(); i++)
-        if (!are_equals(data_->no_arguments_functions[i], delegate.data_->no_arguments_functions[i]))
-          return false;
-      
-      for (size_t i = 0; i < data_->functions.size(); i++)
-        if (!are_equals(data_->functions[i], delegate.data_->functions[i]))
-          return false;
-      
-      return true;
-    }
+    bool equals(const delegate& delegate) const noexcept override {return data_.equals(delegate.data_);}
     /// @}
     
     /// @name Public Static Methods
@@ -627,12 +541,8 @@ namespace xtd {
     /// @remarks The invocation list can contain duplicate entries; that is, entries that refer to the same method on the same object.
     static delegate combine(const std::vector<delegate>& delegates) noexcept {
       delegate result;
-      for (const delegate& delegate : delegates) {
-        for (const no_arguments_function_t& function : delegate.data_->no_arguments_functions)
-          result.data_->no_arguments_functions.push_back(function);
-        for (const function_t& function : delegate.data_->functions)
-          result.data_->functions.push_back(function);
-      }
+      for (const delegate& delegate : delegates)
+        result.data_.add(delegate.data_);
       return result;
     }
     
@@ -643,10 +553,7 @@ namespace xtd {
     /// @remarks The invocation list can contain duplicate entries; that is, entries that refer to the same method on the same object.
     static delegate combine(const delegate& a, const delegate& b) noexcept {
       delegate result = a;
-      for (const no_arguments_function_t& function : b.data_->no_arguments_functions)
-        result.data_->no_arguments_functions.push_back(function);
-      for (const function_t& function : b.data_->functions)
-        result.data_->functions.push_back(function);
+      result.data_.add(b.data_);
       return result;
     }
     
@@ -657,15 +564,7 @@ namespace xtd {
     /// @remarks If the invocation list of value matches a contiguous set of elements in the invocation list of source, then the invocation list of value is said to occur within the invocation list of source. If the invocation list of value occurs more than once in the invocation list of source, the last occurrence is removed.
     static delegate remove(const delegate& source, const delegate& value) noexcept {
       delegate result = source;
-      std::for_each(value.data_->no_arguments_functions.begin(), value.data_->no_arguments_functions.end(), [&](auto no_arguments_function) {
-        auto iterator = std::find_if(result.data_->no_arguments_functions.rbegin(), result.data_->no_arguments_functions.rend(), [&](auto item) {return are_equals(item, no_arguments_function);});
-        if (iterator != result.data_->no_arguments_functions.rend()) result.data_->no_arguments_functions.erase((iterator + 1).base());
-      });
-      
-      std::for_each(value.data_->functions.begin(), value.data_->functions.end(), [&](auto function) {
-        auto iterator = std::find_if(result.data_->functions.rbegin(), result.data_->functions.rend(), [&](auto item) {return are_equals(item, function);});
-        if (iterator != result.data_->functions.rend()) result.data_->functions.erase((iterator + 1).base());
-      });
+      result.data_.remove(value.data_);
       return result;
     }
     
@@ -676,23 +575,7 @@ namespace xtd {
     /// @remarks If the invocation list of value matches a contiguous set of elements in the invocation list of source, then the invocation list of value is said to occur within the invocation list of source. If the invocation list of value occurs more than once in the invocation list of source, all occurrences are removed.
     static delegate remove_all(const delegate& source, const delegate& value) noexcept {
       delegate result = source;
-      for (const no_arguments_function_t& function : value.data_->no_arguments_functions) {
-        if (find(result.data_->no_arguments_functions.begin(), result.data_->no_arguments_functions.end(), function) != result.data_->no_arguments_functions.end()) {
-          for (typename std::vector<function_t>::reverse_iterator iterator = result.data_->no_arguments_functions.rbegin(); iterator != result.data_->no_arguments_functions.rend(); ++iterator) {
-            if (are_equals(*iterator, function))
-              result.data_->no_arguments_functions.erase((iterator + 1).base());
-          }
-        }
-      }
-      
-      for (const function_t& function : value.data_->functions) {
-        if (find(result.data_->functions.begin(), result.data_->functions.end(), function) != result.data_->functions.end()) {
-          for (typename std::vector<function_t>::reverse_iterator iterator = result.data_->functions.rbegin(); iterator != result.data_->functions.rend(); ++iterator) {
-            if (are_equals(*iterator, function))
-              result.data_->functions.erase((iterator + 1).base());
-          }
-        }
-      }
+      result.data_.remove_all(value.data_);
       return result;
     }
     /// @}
@@ -703,50 +586,24 @@ namespace xtd {
     /// @brief invokes the method represented by the current delegate.
     /// @param arguments The parameter list.
     /// @return result_t The return value.
-    result_t operator()(arguments_t... arguments) const {
-      if (data_->no_arguments_functions.size() == 0 && data_->functions.size() == 0) return result_t();
-      
-      if (data_->no_arguments_functions.size()) {
-        for (size_t i = 0; i < data_->no_arguments_functions.size() - (data_->functions.size() == 0 ? 1 : 0); i++) {
-          if (data_->no_arguments_functions[i] == nullptr) throw xtd::argument_null_exception {csf_};
-          data_->no_arguments_functions[i]();
-        }
-        
-        if (data_->functions.size() == 0) {
-          if (data_->no_arguments_functions.back() == nullptr) throw xtd::argument_null_exception {csf_};
-          return data_->no_arguments_functions.back()();
-        }
-      }
-      
-      for (size_t i = 0; i < data_->functions.size() - 1; i++) {
-        if (data_->functions[i] == nullptr) throw xtd::argument_null_exception {csf_};
-        data_->functions[i](arguments...);
-      }
-      if (data_->functions.back() == nullptr) throw xtd::argument_null_exception {csf_};
-      return data_->functions.back()(arguments...);
-    }
+    /// @remarks The delegate can be invoked while other threads add or remove functions; each invocation calls the functions the delegate held when it started.
+    result_t operator()(arguments_t... arguments) const {return data_.invoke(arguments...);}
     /// @}
     
     /// @cond
     template<typename type_t>
     delegate& operator =(const type_t& function) noexcept {
-      data_->no_arguments_functions.clear();
-      data_->functions.clear();
-      data_->functions.push_back(function_t(function));
+      *this = delegate {function_t(function)};
       return *this;
     }
     
     delegate& operator =(const function_t& function) noexcept {
-      data_->no_arguments_functions.clear();
-      data_->functions.clear();
-      data_->functions.push_back(function);
+      *this = delegate {function};
       return *this;
     }
     
     delegate& operator =(const no_arguments_function_t& function) noexcept {
-      data_->no_arguments_functions.clear();
-      data_->functions.clear();
-      data_->no_arguments_functions.push_back(function);
+      *this = delegate {function};
       return *this;
     }
     
@@ -774,28 +631,35 @@ namespace xtd {
       result += function;
       return result;
     }
+    /// @endcond
     
-    delegate& operator +=(const delegate& delegate) noexcept {
-      *this = delegate::combine(*this, delegate);
-      return *this;
-    }
-    
-    delegate& operator +=(const no_arguments_function_t& function) noexcept {
-      *this = delegate::combine(*this, delegate(function));
-      return *this;
-    }
-    
-    delegate& operator +=(const function_t& function) noexcept {
-      *this = delegate::combine(*this, delegate(function));
-      return *this;
-    }
-    
+    /// @brief Adds the functions of the specified delegate to the invocation list.
+    /// @param delegate The delegate whose functions are added.
+    /// @return A subscription that xtd::delegate::operator -= takes to remove these functions.
+    subscription operator +=(const delegate& delegate) noexcept {return subscription {*this, data_.add(delegate.data_)};}
+    
+    /// @brief Adds the specified function without arguments to the invocation list.
+    /// @param function The function to add.
+    /// @return A subscription that xtd::delegate::operator -= takes to remove this function.
+    subscription operator +=(const no_arguments_function_t& function) noexcept {return subscription {*this, data_.add_no_arguments_function(function)};}
+    
+    /// @brief Adds the specified function to the invocation list.
+    /// @param function The function to add.
+    /// @return A subscription that xtd::delegate::operator -= takes to remove this function.
+    subscription operator +=(const function_t& function) noexcept {return subscription {*this, data_.add_function(function)};}
+    
+    /// @brief Adds the specified function to the invocation list.
+    /// @param function The function to add.
+    /// @return A subscription that xtd::delegate::operator -= takes to remove this function.
+    /// @remarks A function pointer, or a callable object that is trivially copyable and no larger than three pointers, is stored in the delegate itself while it is the only function : adding, removing and invoking it do not allocate.
     template<typename fn_t>
-    delegate& operator +=(fn_t function) noexcept {
-      *this = delegate::combine(*this, delegate(function));
-      return *this;
+    subscription operator +=(fn_t function) noexcept {
+      if constexpr (std::is_same_v<fn_t, delegate<result_t()>>) return *this += delegate {function};
+      else if constexpr (std::is_invocable_v<const fn_t&, arguments_t...>) return subscription {*this, data_.add_function(function)};
+      else return subscription {*this, data_.add_no_arguments_function(function)};
     }
     
+    /// @cond
     delegate operator -(const delegate& other) noexcept {
       delegate result = *this;
       result -= other;
@@ -822,49 +686,46 @@ namespace xtd {
     }
     
     delegate& operator -=(const delegate& delegate) noexcept {
-      *this = delegate::remove(*this, delegate);
+      data_.remove(delegate.data_);
       return *this;
     }
     
     delegate& operator -=(const no_arguments_function_t& function) noexcept {
-      *this = delegate::remove(*this, delegate(function));
+      data_.remove_no_arguments_function(function);
       return *this;
     }
     
     delegate& operator -=(const function_t& function) noexcept {
-      *this = delegate::remove(*this, delegate(function));
+      data_.remove_function(function);
       return *this;
     }
     
     template<typename fn_t>
     delegate& operator -=(fn_t function) noexcept {
-      *this = delegate::remove(*this, delegate(function));
+      if constexpr (std::is_same_v<fn_t, delegate<result_t()>>) data_.remove(delegate {function}.data_);
+      else if constexpr (std::is_invocable_v<const fn_t&, arguments_t...>) data_.remove_function(function_t {function});
+      else data_.remove_no_arguments_function(no_arguments_function_t {function});
       return *this;
     }
     /// @endcond
     
-  private:
-    static bool are_equals(const std::function<result_t(arguments_t...)>& fct1, const std::function<result_t(arguments_t...)>& fct2) noexcept {
-      return fct1.target_type() == fct2.target_type() && (fct1.template target<result_t(*)(arguments_t...)>() == fct2.template target<result_t(*)(arguments_t...)>() || *fct1.template target<result_t(*)(arguments_t...)>() == *fct2.template target<result_t(*)(arguments_t...)>());
-    }
-    
-    static bool are_equals(const std::function<result_t()>& fct1, const std::function<result_t()>& fct2) noexcept {
-      return fct1.target_type() == fct2.target_type() && (fct1.template target<result_t(*)()>() == fct2.template target<result_t(*)()>() || *fct1.template target<result_t(*)()>() == *fct2.template target<result_t(*)()>());
-    }
-    
-    static typename std::vector<no_arguments_function_t>::const_iterator find(typename std::vector<no_arguments_function_t>::const_iterator begin, typename std::vector<no_arguments_function_t>::const_iterator end, const no_arguments_function_t& function) noexcept {
-      auto iterator = std::find_if(begin, end, [&](auto item) {return are_equals(item, function);});
-      if (iterator != end) return iterator;
-      return end;
+    /// @brief Removes the functions added by the call to xtd::delegate::operator += that returned the specified subscription.
+    /// @param subscription The subscription returned by xtd::delegate::operator +=.
+    /// @return The current delegate.
+    /// @remarks The functions are found by their subscription token instead of by comparing them with the functions of the delegate; removing the only function of a delegate does not allocate.
+    delegate& operator -=(const subscription& subscription) noexcept {
+      data_.remove(subscription.tokens_);
+      return *this;
     }
-    
-    static typename std::vector<function_t>::const_iterator find(typename std::vector<function_t>::const_iterator begin, typename std::vector<function_t>::const_iterator end, const function_t& function) noexcept {
-      auto iterator = std::find_if(begin, end, [&](auto item) {return are_equals(item, function);});
-      if (iterator != end) return iterator;
-      return end;
+  
+  private:
+    // A lambda capturing the object and the method is trivially copyable and fits in the inline slot, where std::bind does not.
+    template<typename object_t, typename method_t, size_t... indexes>
+    static auto bind_member(object_t* object, method_t method, std::index_sequence<indexes...>) noexcept {
+      return [object, method](arguments_t... arguments) -> result_t {return (object->*method)(std::get<indexes>(std::forward_as_tuple(std::forward<arguments_t>(arguments)...))...);};
     }
     
-    xtd::sptr<data> data_ = xtd::new_sptr<data>();
+    invocation_list data_;
   };
 }
 
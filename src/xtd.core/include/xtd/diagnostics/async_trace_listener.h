@@ -0,0 +1,145 @@
+/// @file
+/// @brief Contains xtd::diagnostics::async_trace_listener listener.
+/// @copyright Copyright (c) 2024 Gammasoft. All rights reserved.
+#pragma once
+#include "trace_listener.h"
+#include "trace_overflow_policy.h"
+#include "../sptr.h"
+#include "../time_span.h"
+
+/// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
+namespace xtd {
+  /// @brief The xtd::diagnostics namespace provides classes that allow you to interact with system processes, event logs, and performance counters.
+  namespace diagnostics {
+    /// @brief Queues tracing or debugging output and writes it to another xtd::diagnostics::trace_listener from a background thread.
+    /// ```cpp
+    /// class core_export_ async_trace_listener : public xtd::diagnostics::trace_listener
+    /// ```
+    /// @par Inheritance
+    /// xtd::object → xtd::abstract_object → xtd::diagnostics::trace_listener → xtd::diagnostics::async_trace_listener
+    /// @par Header
+    /// ```cpp
+    /// #include <xtd/diagnostics/async_trace_listener>
+    /// ```
+    /// @par Namespace
+    /// xtd::diagnostics
+    /// @par Library
+    /// xtd.core
+    /// @ingroup xtd_core diagnostics debug
+    /// @remarks The writing threads only push the messages into a bounded lock-free queue : they neither take the global debug lock nor wait for the output stream. A background thread writes the queued messages to the wrapped listener by batches and flushes the wrapped listener once per batch.
+    /// @remarks The indent level and indent size in effect when a message is written are kept with the message and applied to the wrapped listener.
+    /// @remarks When the queue is full, the message is handled according to xtd::diagnostics::async_trace_listener::overflow_policy.
+    /// @remarks xtd::diagnostics::async_trace_listener::flush waits for the background thread. Leave xtd::diagnostics::trace::auto_flush and xtd::diagnostics::debug::auto_flush set to false, otherwise each message waits to be written.
+    /// @par Examples
+    /// The following example shows how to trace to the console from a background thread.
+    /// ```cpp
+    /// trace::listeners().clear();
+    /// trace::listeners().push_back(new_sptr<async_trace_listener>(new_sptr<console_trace_listener>()));
+    /// trace::write_line("Hello, World!");
+    /// trace::flush();
+    /// ```
+    class core_export_ async_trace_listener : public xtd::diagnostics::trace_listener {
+      struct data;
+    
+    public:
+      /// @name Public Fields
+      
+      /// @{
+      /// @brief Represents the default number of messages the queue can hold.
+      static constexpr size_t default_capacity = 8192;
+      /// @}
+      
+      /// @name Public Constructors
+      
+      /// @{
+      /// @brief Initializes a new instance of the xtd::diagnostics::async_trace_listener class with the specified listener.
+      /// @param listener The xtd::diagnostics::trace_listener the queued messages are written to.
+      /// @exception xtd::argument_null_exception listener is null.
+      explicit async_trace_listener(const xtd::sptr<xtd::diagnostics::trace_listener>& listener);
+      /// @brief Initializes a new instance of the xtd::diagnostics::async_trace_listener class with the specified listener and queue capacity.
+      /// @param listener The xtd::diagnostics::trace_listener the queued messages are written to.
+      /// @param capacity The number of messages the queue can hold. It is rounded up to the next power of two.
+      /// @exception xtd::argument_null_exception listener is null.
+      /// @exception xtd::argument_out_of_range_exception capacity is less than 2.
+      async_trace_listener(const xtd::sptr<xtd::diagnostics::trace_listener>& listener, size_t capacity);
+      /// @brief Initializes a new instance of the xtd::diagnostics::async_trace_listener class with the specified listener, queue capacity and overflow policy.
+      /// @param listener The xtd::diagnostics::trace_listener the queued messages are written to.
+      /// @param capacity The number of messages the queue can hold. It is rounded up to the next power of two.
+      /// @param overflow_policy One of xtd::diagnostics::trace_overflow_policy values.
+      /// @exception xtd::argument_null_exception listener is null.
+      /// @exception xtd::argument_out_of_range_exception capacity is less than 2.
+      async_trace_listener(const xtd::sptr<xtd::diagnostics::trace_listener>& listener, size_t capacity, xtd::diagnostics::trace_overflow_policy overflow_policy);
+      /// @cond
+      ~async_trace_listener();
+      /// @endcond
+      /// @}
+      
+      /// @name Public Properties
+      
+      /// @{
+      /// @brief Gets the average time between the queuing of a message and its writing to the wrapped listener.
+      /// @return The average latency of the written messages.
+      xtd::time_span average_latency() const noexcept;
+      
+      /// @brief Gets the number of messages the queue can hold.
+      /// @return The capacity of the queue.
+      size_t capacity() const noexcept;
+      
+      /// @brief Gets the number of messages discarded because the queue was full or the listener was closed.
+      /// @return The number of dropped messages.
+      size_t dropped_count() const noexcept;
+      
+      /// @brief Gets the listener the queued messages are written to.
+      /// @return The wrapped xtd::diagnostics::trace_listener.
+      const xtd::sptr<xtd::diagnostics::trace_listener>& listener() const noexcept;
+      
+      /// @brief Gets the longest time between the queuing of a message and its writing to the wrapped listener.
+      /// @return The maximum latency of the written messages.
+      xtd::time_span max_latency() const noexcept;
+      
+      /// @brief Gets what is done with a message when the queue is full.
+      /// @return One of xtd::diagnostics::trace_overflow_policy values.
+      xtd::diagnostics::trace_overflow_policy overflow_policy() const noexcept;
+      
+      /// @brief Gets the number of messages written to the wrapped listener.
+      /// @return The number of written messages.
+      size_t written_count() const noexcept;
+      /// @}
+      
+      /// @name Public Methods
+      
+      /// @{
+      /// @brief Writes the queued messages, stops the background thread and closes the wrapped listener.
+      /// @remarks The messages written after the listener is closed are dropped.
+      void close() override;
+      
+      /// @brief Waits until the messages queued before the call are written, and the wrapped listener is flushed.
+      void flush() override {
+        #if !defined(NDEBUG) || defined(DEBUG) || defined(TRACE)
+        flush_();
+        #endif
+      }
+      
+      using xtd::diagnostics::trace_listener::write;
+      void write(const xtd::string& message) override {
+        #if !defined(NDEBUG) || defined(DEBUG) || defined(TRACE)
+        write_(message, false);
+        #endif
+      }
+      
+      using xtd::diagnostics::trace_listener::write_line;
+      void write_line(const xtd::string& message) override {
+        #if !defined(NDEBUG) || defined(DEBUG) || defined(TRACE)
+        write_(message, true);
+        #endif
+      }
+      /// @}
+    
+    private:
+      void flush_();
+      void write_(const xtd::string& message, bool new_line);
+      
+      xtd::sptr<data> data_;
+    };
+  }
+}
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <cstdint>
+#include <span>
 #include <vector>
 #include "../iequatable.h"
 #include "../object.h"
@@ -202,6 +203,7 @@ namespace xtd {
       // Do not use xtd::collections::generic::list because xtd::diagnostics::stack_frame is use by xtd::system_exception and
       // xtd::collections::generic::list use xtd::argument_exception.
       static std::vector<stack_frame> get_stack_frames(const xtd::string& str, size_t skip_frames, bool need_file_info) noexcept;
+      static std::vector<stack_frame> get_stack_frames(std::span<void* const> addresses, const xtd::string& str, size_t skip_frames, bool need_file_info) noexcept;
       
       xtd::string file_name_;
       uint32 file_line_number_ = 0;
@@ -4,6 +4,7 @@
 #pragma once
 #include <exception>
 #include <memory>
+#include <span>
 #include "../core_export.h"
 #include "../object.h"
 #include "../string.h"
@@ -17,6 +18,10 @@ namespace xtd {
   
   /// @brief The xtd::diagnostics namespace provides classes that allow you to interact with system processes, event logs, and performance counters.
   namespace diagnostics {
+    /// @cond
+    class trace_event_cache;
+    /// @endcond
+    
     /// @brief Represents a stack trace, which is an ordered collection of one or more stack frames.
     /// ```cpp
     /// class core_export_ stack_trace : public xtd::object
@@ -329,7 +334,10 @@ namespace xtd {
       
     private:
       friend class xtd::system_exception;
+      friend class xtd::diagnostics::trace_event_cache;
       stack_trace(const xtd::string& str, size_t skip_frames, bool need_file_info);
+      stack_trace(std::span<void* const> addresses, const xtd::string& str, size_t skip_frames, bool need_file_info);
+      static size_t get_addresses(size_t skip_frames, std::span<void*> addresses) noexcept;
       xtd::string to_string(size_t skip_frames, const xtd::diagnostics::stack_frame& stack_frame = xtd::diagnostics::stack_frame::empty()) const noexcept;
       
       stack_frame_collection frames_;
@@ -2,6 +2,7 @@
 /// @brief Contains xtd::diagnostics::trace_event_cache class.
 /// @copyright Copyright (c) 2024 Gammasoft. All rights reserved.
 #pragma once
+#include <chrono>
 #include <string>
 #include <vector>
 #include "../date_time.h"
@@ -27,17 +28,18 @@ namespace xtd {
     /// @par Library
     /// xtd.core
     /// @ingroup xtd_core
+    /// @remarks The timestamp and the thread identifier are captured when the trace_event_cache is created. The call stack is captured the first time xtd::diagnostics::trace_event_cache::call_stack is called. The fields are only formatted when a listener renders them, and each field is formatted once, whatever the number of listeners.
     class core_export_ trace_event_cache : public xtd::object {
     public:
       /// @name Public Constructors
       
       /// @{
       /// @brief Initializes a new instance of the trace_event_cache class.
-      trace_event_cache() = default;
+      trace_event_cache();
       /// @}
       
       /// @cond
-      trace_event_cache(const trace_event_cache& tec);
+      trace_event_cache(const trace_event_cache& tec) = default;
       trace_event_cache& operator =(const trace_event_cache& tec) = default;
       /// @endcond
       
@@ -47,6 +49,7 @@ namespace xtd {
       /// @brief Gets the call stack for the current thread.
       /// @return string A string containing stack trace information. This value can be an empty string ("").
       /// @remarks The Callstack property gets the call stack from the StackTrace property of the Environment class. The property value lists method calls in reverse chronological order. That is, the most recent method call is described first. One line of stack trace information is listed for each method call on the stack. For more information, see StackTrace.
+      /// @remarks The return addresses are captured the first time the call stack is requested. They are resolved through a per-process symbol cache, so repeated call stacks of the same code paths are cheap to resolve. The resulting string is kept and returned by the following calls.
       xtd::string call_stack() const noexcept;
       
       /// @brief Gets the date and time at which the event trace occurred.
@@ -59,6 +62,10 @@ namespace xtd {
       /// @remarks The correlation data is stored as an object in the call context with the name "System.Diagnostics.Trace.CorrelationManagerSlot". The CorrelationManager class provides methods used to store a logical operation identity in a thread-bound context and automatically tag each trace event generated by the thread with the stored identity. The CorrelationManager is accessed through the Trace.CorrelationManager property. Each call to the StartLogicalOperation method pushes a new logical operation identity onto the stack. Each call to the StopLogicalOperation method pops a logical operation identity from the stack
       std::vector<xtd::string> logical_operation_stack() const noexcept;
       
+      /// @brief Gets the managed thread identifier of the thread that created the trace_event_cache.
+      /// @return int32 The xtd::threading::thread::managed_thread_id of the thread.
+      int32 managed_thread_id() const noexcept;
+      
       /// @brief Gets the unique identifier of the current process.
       /// @return int32 The system-generated unique identifier of the current process.
       /// @remarks Until the process terminates, the process identifier uniquely identifies the process throughout the system.
@@ -66,31 +73,35 @@ namespace xtd {
       
       /// @brief Gets a unique identifier for the current managed thread.
       /// @return string A string that represents a unique integer identifier for this managed thread.
-      /// @remarks The thread identifier is the value of the Thread.ManagedThreadId property formatted as a string.
+      /// @remarks The thread identifier is the value of the xtd::diagnostics::trace_event_cache::managed_thread_id property formatted as a string.
       xtd::string thread_id() const noexcept;
       
       /// @brief Gets the current number of ticks in the timer mechanism.
       /// @return std::chrono::nanoseconds The nanoseconds counter value of the underlying timer mechanism.
-      /// @remarks The get accessor calls the Stopwatch.GetTimestamp method to get the timestamp. If the Stopwatch class uses a high-resolution performance counter, GetTimestamp returns the current value of that counter. If the Stopwatch class uses the system timer, GetTimestamp returns the Ticks property of DateTime.Now.
+      /// @remarks The timestamp is the value returned by xtd::diagnostics::stopwatch::get_timestamp when the trace_event_cache was created.
       std::chrono::nanoseconds timestamp() const noexcept;
       
       /// @brief Gets the current number of ticks in the timer mechanism, in milliseconds.
       /// @return int64 The millisecond counter value of the underlying timer mechanism.
-      /// @remarks The get accessor calls the Stopwatch.GetTimestamp method to get the timestamp. If the Stopwatch class uses a high-resolution performance counter, GetTimestamp returns the current value of that counter. If the Stopwatch class uses the system timer, GetTimestamp returns the Ticks property of DateTime.Now.
+      /// @remarks The timestamp is the value returned by xtd::diagnostics::stopwatch::get_timestamp when the trace_event_cache was created.
       int64 timestamp_milliseconds() const noexcept;
       
       /// @brief Gets the current number of ticks in the timer mechanism, in nanoseconds.
       /// @return int64 The nanosecond counter value of the underlying timer mechanism.
-      /// @remarks The get accessor calls the Stopwatch.GetTimestamp method to get the timestamp. If the Stopwatch class uses a high-resolution performance counter, GetTimestamp returns the current value of that counter. If the Stopwatch class uses the system timer, GetTimestamp returns the Ticks property of DateTime.Now.
+      /// @remarks The timestamp is the value returned by xtd::diagnostics::stopwatch::get_timestamp when the trace_event_cache was created.
       int64 timestamp_nanoseconds() const noexcept;
       
       /// @brief Gets the current number of ticks in the timer mechanism, in nanoseconds.
       /// @return int64 The tick counter value of the underlying timer mechanism.
-      /// @remarks The get accessor calls the Stopwatch.GetTimestamp method to get the timestamp. If the Stopwatch class uses a high-resolution performance counter, GetTimestamp returns the current value of that counter. If the Stopwatch class uses the system timer, GetTimestamp returns the Ticks property of DateTime.Now.
+      /// @remarks The timestamp is the value returned by xtd::diagnostics::stopwatch::get_timestamp when the trace_event_cache was created.
       int64 timestamp_ticks() const noexcept;
       /// @}
       
     private:
+      std::chrono::nanoseconds timestamp_ {0};
+      int32 managed_thread_id_ = 0;
+      mutable xtd::string call_stack_;
+      mutable bool call_stack_captured_ = false;
       mutable xtd::date_time date_time_ = xtd::date_time::min_value;
     };
   }
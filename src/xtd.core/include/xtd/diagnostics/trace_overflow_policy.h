@@ -0,0 +1,37 @@
+/// @file
+/// @brief Contains xtd::diagnostics::trace_overflow_policy enum class.
+/// @copyright Copyright (c) 2024 Gammasoft. All rights reserved.
+#pragma once
+#include "../enum.h"
+
+/// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
+namespace xtd {
+  /// @brief The xtd::diagnostics namespace provides classes that allow you to interact with system processes, event logs, and performance counters.
+  namespace diagnostics {
+    /// @brief Specifies what an xtd::diagnostics::async_trace_listener does with a message when its queue is full.
+    /// ```cpp
+    /// enum class trace_overflow_policy
+    /// ```
+    /// @par Header
+    /// ```cpp
+    /// #include <xtd/diagnostics/trace_overflow_policy>
+    /// ```
+    /// @par Namespace
+    /// xtd::diagnostics
+    /// @par Library
+    /// xtd.core
+    /// @ingroup xtd_core diagnostics
+    enum class trace_overflow_policy {
+      /// @brief The writing thread waits until the queue has room for the message. No message is lost. This is the default.
+      block = 0,
+      /// @brief The message is discarded and counted in xtd::diagnostics::async_trace_listener::dropped_count. The writing thread never waits.
+      drop = 1,
+    };
+  }
+}
+
+/// @cond
+template<> struct xtd::enum_register<xtd::diagnostics::trace_overflow_policy> {
+  explicit operator auto() const noexcept {return xtd::enum_collection<xtd::diagnostics::trace_overflow_policy> {{xtd::diagnostics::trace_overflow_policy::block, "block"}, {xtd::diagnostics::trace_overflow_policy::drop, "drop"}};}
+};
+/// @endcond
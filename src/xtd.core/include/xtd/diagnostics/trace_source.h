@@ -101,9 +101,11 @@ namespace xtd {
       template<typename object_t>
       void trace_data(const xtd::diagnostics::trace_event_type& event_type, int32 id, const object_t& data) {
         #if defined(TRACE)
-        if (source_switch_.should_trace(event_type))
+        if (source_switch_.should_trace(event_type)) {
+          auto event_cache = trace_event_cache {};
           for (auto listener : listeners_)
-            listener->trace_data(trace_event_cache(), name_, event_type, id, data);
+            listener->trace_data(event_cache, name_, event_type, id, data);
+        }
         #endif
       }
       
@@ -116,9 +118,11 @@ namespace xtd {
       template<typename object_t>
       void trace_data(const xtd::diagnostics::trace_event_type& event_type, int32 id, const std::vector<object_t>& data) {
         #if defined(TRACE)
-        if (source_switch_.should_trace(event_type))
+        if (source_switch_.should_trace(event_type)) {
+          auto event_cache = trace_event_cache {};
           for (auto listener : listeners_)
-            listener->trace_data(trace_event_cache(), name_, event_type, id, data);
+            listener->trace_data(event_cache, name_, event_type, id, data);
+        }
         #endif
       }
       
@@ -128,9 +132,11 @@ namespace xtd {
       /// @remarks The trace_event method is intended to trace events that can be processed automatically by tools. For example, a monitoring tool can notify an administrator if a specific event is traced by a specific source.
       void trace_event(const xtd::diagnostics::trace_event_type& event_type, int32 id) {
         #if defined(TRACE)
-        if (source_switch_.should_trace(event_type))
+        if (source_switch_.should_trace(event_type)) {
+          auto event_cache = trace_event_cache {};
           for (auto listener : listeners_)
-            listener->trace_event(trace_event_cache(), name_, event_type, id);
+            listener->trace_event(event_cache, name_, event_type, id);
+        }
         #endif
       }
       
@@ -140,9 +146,11 @@ namespace xtd {
       /// @param message The trace message to write.
       void trace_event(const xtd::diagnostics::trace_event_type& event_type, int32 id, const xtd::string& message) {
         #if defined(TRACE)
-        if (source_switch_.should_trace(event_type))
+        if (source_switch_.should_trace(event_type)) {
+          auto event_cache = trace_event_cache {};
           for (auto listener : listeners_)
-            listener->trace_event(trace_event_cache(), name_, event_type, id, message);
+            listener->trace_event(event_cache, name_, event_type, id, message);
+        }
         #endif
       }
       
@@ -154,9 +162,11 @@ namespace xtd {
       template<typename ...objects>
       void trace_event(const xtd::diagnostics::trace_event_type& event_type, int32 id, const xtd::string& format, const objects& ... args) {
         #if defined(TRACE)
-        if (source_switch_.should_trace(event_type))
+        if (source_switch_.should_trace(event_type)) {
+          auto event_cache = trace_event_cache {};
           for (auto listener : listeners_)
-            listener->trace_event(trace_event_cache(), name_, event_type, id, xtd::string::format(format, args...));
+            listener->trace_event(event_cache, name_, event_type, id, xtd::string::format(format, args...));
+        }
         #endif
       }
       
@@ -183,8 +193,9 @@ namespace xtd {
       template<typename guid_t>
       void trace_transfer(int32 id, const xtd::string& message, const  guid_t& related_activity_id) {
         #if defined(TRACE)
+        auto event_cache = trace_event_cache {};
         for (auto listener : listeners_)
-          listener->trace_transfer(trace_event_cache(), name_, id, message, related_activity_id);
+          listener->trace_transfer(event_cache, name_, id, message, related_activity_id);
         #endif
       }
       /// @}
@@ -36,23 +36,23 @@ namespace xtd {
     /// @{
     /// @brief Adds an handler to the event.
     /// @param handler Handler to add.
-    /// @return The current event instance.
-    handler_t& operator +=(const handler_t& handler) noexcept {
+    /// @return A subscription that xtd::event::operator -= takes to remove the handler.
+    typename handler_t::subscription operator +=(const handler_t& handler) noexcept {
       return handler_t::operator +=(handler);
     }
     
     /// @brief Adds a function to the event.
     /// @param handler Function to add.
-    /// @return The current event instance.
-    handler_t& operator +=(const typename handler_t::function_t& function) noexcept {
+    /// @return A subscription that xtd::event::operator -= takes to remove the function.
+    typename handler_t::subscription operator +=(const typename handler_t::function_t& function) noexcept {
       return handler_t::operator +=(function);
     }
     
     /// @brief Adds a function to the event.
     /// @param function Function to add.
-    /// @return The current event instance.
+    /// @return A subscription that xtd::event::operator -= takes to remove the function.
     template<typename fn_t>
-    handler_t& operator +=(fn_t function) noexcept {
+    typename handler_t::subscription operator +=(fn_t function) noexcept {
       return handler_t::operator +=(function);
     }
     
@@ -78,6 +78,13 @@ namespace xtd {
       return handler_t::operator -=(function);
     }
     
+    /// @brief Removes the handler or the function added by the call to xtd::event::operator += that returned the specified subscription.
+    /// @param subscription The subscription returned by xtd::event::operator +=.
+    /// @return The current event instance.
+    handler_t& operator -=(const typename handler_t::subscription& subscription) noexcept {
+      return handler_t::operator -=(subscription);
+    }
+    
     /// @brief Clear event.
     void clear() noexcept {
       *this = event {};
@@ -0,0 +1,69 @@
+/// @file
+/// @brief Contains __xtd_atomic_sptr class.
+/// @copyright Copyright (c) 2024 Gammasoft. All rights reserved.
+#pragma once
+/// @cond
+#if !defined(__XTD_CORE_INTERNAL__)
+#error "Do not include this file: Internal use only"
+#endif
+/// @endcond
+
+#include "../sptr.h"
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+/// @cond
+// Holds a shared pointer that can be loaded, stored and compare-exchanged from several threads. A copy holds the pointer loaded from the original.
+// std::atomic<std::shared_ptr> is used when the standard library provides it; otherwise the pointer is guarded by a mutex that is only held to copy or replace it.
+template<typename type_t>
+class __xtd_atomic_sptr {
+public:
+  __xtd_atomic_sptr() noexcept = default;
+  __xtd_atomic_sptr(const xtd::sptr<type_t>& value) noexcept : value_(value) {}
+  __xtd_atomic_sptr(const __xtd_atomic_sptr& other) noexcept : value_(other.load()) {}
+  __xtd_atomic_sptr& operator =(const __xtd_atomic_sptr& other) noexcept {
+    store(other.load());
+    return *this;
+  }
+  
+#if defined(__cpp_lib_atomic_shared_ptr)
+  xtd::sptr<type_t> load() const noexcept {return value_.load();}
+  void store(const xtd::sptr<type_t>& value) noexcept {value_.store(value);}
+  bool compare_exchange_weak(xtd::sptr<type_t>& expected, const xtd::sptr<type_t>& desired) noexcept {return value_.compare_exchange_weak(expected, desired);}
+  
+private:
+  std::atomic<xtd::sptr<type_t>> value_;
+#else
+  xtd::sptr<type_t> load() const noexcept {
+    auto lock = std::lock_guard<std::mutex> {mutex_};
+    return value_;
+  }
+  
+  void store(const xtd::sptr<type_t>& value) noexcept {
+    auto previous = value;
+    {
+      auto lock = std::lock_guard<std::mutex> {mutex_};
+      value_.swap(previous);
+    }
+  }
+  
+  bool compare_exchange_weak(xtd::sptr<type_t>& expected, const xtd::sptr<type_t>& desired) noexcept {
+    auto previous = desired;
+    {
+      auto lock = std::lock_guard<std::mutex> {mutex_};
+      if (value_ != expected) {
+        expected = value_;
+        return false;
+      }
+      value_.swap(previous);
+    }
+    return true;
+  }
+  
+private:
+  mutable std::mutex mutex_;
+  xtd::sptr<type_t> value_;
+#endif
+};
+/// @endcond
@@ -7,14 +7,17 @@
 #endif
 /// @endcond
 
-#include <bitset>
+#include "__to_chars_formatter.h"
+#include <cstdlib>
 
 /// @cond
 template<typename char_t, typename value_t>
 inline std::basic_string<char_t> __binary_formatter(value_t value, int precision) {
-  std::basic_string<char_t> result = std::bitset<sizeof(value) * 8>(value).to_string(char_t('0'), char_t('1'));
-  while (result[0] != 0 && result[0] == char_t('0'))
-    result.erase(0, 1);
+  auto bits = static_cast<unsigned long long>(value);
+  if constexpr (sizeof(value) < sizeof(bits)) bits &= (1ull << (sizeof(value) * 8)) - 1;
+  char digits[__to_chars_buffer_size];
+  auto count = bits == 0 ? 0 : static_cast<size_t>(std::to_chars(digits, digits + sizeof(digits), bits, 2).ptr - digits);
+  auto result = std::basic_string<char_t>(digits, digits + count);
   if (precision < 0 && result.size() > size_t(std::abs(precision)))
     result.append(result.size() - std::abs(precision), char_t(' '));
   else {
@@ -0,0 +1,232 @@
+/// @file
+/// @brief Contains case mapping and case insensitive comparison functions.
+/// @copyright Copyright (c) 2024 Gammasoft. All rights reserved.
+
+#pragma once
+/// @cond
+#if !defined(__XTD_CORE_INTERNAL__)
+#error "Do not include this file: Internal use only"
+#endif
+/// @endcond
+
+#include "__unicode_transcoding.h"
+#include "../char32.h"
+#include "../size.h"
+#include "../types.h"
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+/// @cond
+// Case mapping of xtd::basic_string and xtd::string.
+// The code units are decoded according to their size : UTF-8 for one-byte characters, UTF-16 for two-byte characters and UTF-32 otherwise. The code units that do not form a valid code point are left as is.
+// ASCII characters are mapped inline, eight at a time in a 64-bit word (SWAR) for one-byte characters. The other code points are mapped with the Unicode simple case mapping tables of __case_mapping.cpp.
+// The ordinal_ignore_case comparisons compare the simple case foldings of the code points, without building temporary strings.
+enum class __xtd_case {
+  lower,
+  upper,
+  fold,
+};
+
+xtd::char32 __xtd_simple_to_lower(xtd::char32 code_point) noexcept;
+xtd::char32 __xtd_simple_to_upper(xtd::char32 code_point) noexcept;
+xtd::char32 __xtd_simple_case_fold(xtd::char32 code_point) noexcept;
+
+constexpr xtd::char32 __xtd_invalid_code_unit = 0x200000;
+
+inline xtd::char32 __xtd_map_case(xtd::char32 code_point, __xtd_case kind) noexcept {
+  if (code_point < 0x80) {
+    if (kind == __xtd_case::upper) return code_point - U'a' < 26u ? code_point - 0x20 : code_point;
+    return code_point - U'A' < 26u ? code_point + 0x20 : code_point;
+  }
+  if (code_point >= __xtd_invalid_code_unit) return code_point;
+  if (kind == __xtd_case::lower) return __xtd_simple_to_lower(code_point);
+  if (kind == __xtd_case::upper) return __xtd_simple_to_upper(code_point);
+  return __xtd_simple_case_fold(code_point);
+}
+
+// Maps the eight ASCII characters of word; each byte of word must be lower than 0x80.
+inline xtd::uint64 __xtd_map_ascii_word(xtd::uint64 word, __xtd_case kind) noexcept {
+  auto first = static_cast<xtd::uint64>(kind == __xtd_case::upper ? 'a' : 'A');
+  auto above_first = word + (0x80 - first) * __xtd_ascii_low_bits;
+  auto above_last = word + (0x7f - (first + 25)) * __xtd_ascii_low_bits;
+  auto is_letter = above_first & ~above_last & __xtd_ascii_high_bits;
+  return word ^ (is_letter >> 2);
+}
+
+// Decodes the code point that starts at data[index] and moves index after it. A code unit that does not start a valid code point is returned as __xtd_invalid_code_unit + code unit.
+template<typename char_t>
+inline xtd::char32 __xtd_decode_code_point(const char_t* data, xtd::size count, xtd::size& index) noexcept {
+  if constexpr (sizeof(char_t) == 1) {
+    auto unit = static_cast<xtd::char32>(static_cast<unsigned char>(data[index]));
+    if (unit < 0x80) {
+      ++index;
+      return unit;
+    }
+    auto length = unit >= 0xf0 ? xtd::size {4} : unit >= 0xe0 ? xtd::size {3} : unit >= 0xc0 ? xtd::size {2} : xtd::size {0};
+    auto code_point = length == 4 ? unit & 0x07 : length == 3 ? unit & 0x0f : unit & 0x1f;
+    auto is_valid = length != 0 && index + length <= count && unit <= 0xf4;
+    for (auto position = xtd::size {1}; is_valid && position < length; ++position) {
+      auto continuation = static_cast<xtd::char32>(static_cast<unsigned char>(data[index + position]));
+      is_valid = (continuation & 0xc0) == 0x80;
+      code_point = (code_point << 6) | (continuation & 0x3f);
+    }
+    if (is_valid) is_valid = code_point >= (length == 2 ? 0x80u : length == 3 ? 0x800u : 0x10000u) && code_point <= 0x10ffff && (code_point < 0xd800 || code_point > 0xdfff);
+    if (!is_valid) {
+      ++index;
+      return __xtd_invalid_code_unit + unit;
+    }
+    index += length;
+    return code_point;
+  } else if constexpr (sizeof(char_t) == 2) {
+    auto unit = static_cast<xtd::char32>(static_cast<xtd::uint16>(data[index++]));
+    if (unit < 0xd800 || unit > 0xdfff) return unit;
+    if (unit <= 0xdbff && index < count) {
+      auto low = static_cast<xtd::char32>(static_cast<xtd::uint16>(data[index]));
+      if (low >= 0xdc00 && low <= 0xdfff) {
+        ++index;
+        return 0x10000 + ((unit - 0xd800) << 10) + (low - 0xdc00);
+      }
+    }
+    return __xtd_invalid_code_unit + unit;
+  } else {
+    auto unit = static_cast<xtd::char32>(data[index++]);
+    return unit <= 0x10ffff && (unit < 0xd800 || unit > 0xdfff) ? unit : __xtd_invalid_code_unit + (unit & 0xffff);
+  }
+}
+
+// Decodes the code point that ends at data[index - 1] and moves index before it.
+template<typename char_t>
+inline xtd::char32 __xtd_decode_previous_code_point(const char_t* data, xtd::size& index) noexcept {
+  auto start_index = index - 1;
+  if constexpr (sizeof(char_t) == 1) {
+    while (start_index > 0 && index - start_index < 4 && (static_cast<unsigned char>(data[start_index]) & 0xc0) == 0x80) --start_index;
+  } else if constexpr (sizeof(char_t) == 2) {
+    if (start_index > 0 && (static_cast<xtd::uint16>(data[start_index]) & 0xfc00) == 0xdc00) --start_index;
+  }
+  auto end_index = start_index;
+  auto code_point = __xtd_decode_code_point(data, index, end_index);
+  if (end_index == index) {
+    index = start_index;
+    return code_point;
+  }
+  // The last code unit does not end a valid code point.
+  end_index = --index;
+  return __xtd_decode_code_point(data, index + 1, end_index);
+}
+
+// Appends the count code units of data mapped to lowercase or uppercase to result, code point by code point.
+template<typename string_t, typename char_t>
+inline void __xtd_append_case_mapped_code_points(string_t& result, const char_t* data, xtd::size count, __xtd_case kind) {
+  result.reserve(result.size() + count);
+  auto index = xtd::size {0};
+  while (index < count) {
+    auto start_index = index;
+    auto code_point = __xtd_decode_code_point(data, count, index);
+    if (code_point >= __xtd_invalid_code_unit) result.push_back(data[start_index]);
+    else {
+      char_t units[4];
+      result.append(units, __xtd_encode_code_point(units, __xtd_map_case(code_point, kind)));
+    }
+  }
+}
+
+// Maps the code units of value that follow start_index to lowercase or uppercase in place.
+// The mapping of a code point has almost always the same length as the code point; when it does not, the rest of value is mapped into a new buffer.
+template<typename string_t>
+inline void __xtd_map_case_in_place(string_t& value, __xtd_case kind, xtd::size start_index = 0) {
+  using char_t = typename string_t::value_type;
+  auto data = value.data();
+  auto count = value.size();
+  auto index = start_index;
+  while (index < count) {
+    if constexpr (sizeof(char_t) == 1) {
+      if (count - index >= sizeof(xtd::uint64)) {
+        auto word = __xtd_load_word(data + index);
+        if (__xtd_is_ascii_word(word)) {
+          word = __xtd_map_ascii_word(word, kind);
+          std::memcpy(data + index, &word, sizeof(word));
+          index += sizeof(word);
+          continue;
+        }
+      }
+    }
+    auto code_point_index = index;
+    auto code_point = __xtd_decode_code_point(data, count, index);
+    if (code_point >= __xtd_invalid_code_unit) continue;
+    auto mapped_code_point = __xtd_map_case(code_point, kind);
+    if (mapped_code_point == code_point) continue;
+    char_t units[4];
+    auto length = __xtd_encode_code_point(units, mapped_code_point);
+    if (length == index - code_point_index) {
+      std::copy(units, units + length, data + code_point_index);
+      continue;
+    }
+    auto result = string_t(data, code_point_index);
+    result.append(units, length);
+    __xtd_append_case_mapped_code_points(result, data + index, count - index, kind);
+    value = std::move(result);
+    return;
+  }
+}
+
+// Appends the count code units of data mapped to lowercase or uppercase to result.
+template<typename string_t, typename char_t>
+inline void __xtd_append_case_mapped(string_t& result, const char_t* data, xtd::size count, __xtd_case kind) {
+  auto start_index = result.size();
+  result.append(data, count);
+  __xtd_map_case_in_place(result, kind, start_index);
+}
+
+// Compares a and b after simple case folding, code point by code point, until one of them is exhausted. On return, a_index and b_index are the positions of the first code points that are not compared.
+template<typename char_t>
+inline xtd::int32 __xtd_compare_ignore_case(const char_t* a, xtd::size a_count, const char_t* b, xtd::size b_count, xtd::size& a_index, xtd::size& b_index) noexcept {
+  a_index = 0;
+  b_index = 0;
+  while (a_index < a_count && b_index < b_count) {
+    if constexpr (sizeof(char_t) == 1) {
+      if (a_count - a_index >= sizeof(xtd::uint64) && b_count - b_index >= sizeof(xtd::uint64)) {
+        auto a_word = __xtd_load_word(a + a_index);
+        auto b_word = __xtd_load_word(b + b_index);
+        if (__xtd_is_ascii_word(a_word | b_word) && __xtd_map_ascii_word(a_word, __xtd_case::fold) == __xtd_map_ascii_word(b_word, __xtd_case::fold)) {
+          a_index += sizeof(xtd::uint64);
+          b_index += sizeof(xtd::uint64);
+          continue;
+        }
+      }
+    }
+    auto a_code_point = __xtd_map_case(__xtd_decode_code_point(a, a_count, a_index), __xtd_case::fold);
+    auto b_code_point = __xtd_map_case(__xtd_decode_code_point(b, b_count, b_index), __xtd_case::fold);
+    if (a_code_point != b_code_point) return a_code_point < b_code_point ? -1 : 1;
+  }
+  return 0;
+}
+
+template<typename char_t>
+inline xtd::int32 __xtd_compare_ignore_case(const char_t* a, xtd::size a_count, const char_t* b, xtd::size b_count) noexcept {
+  auto a_index = xtd::size {0}, b_index = xtd::size {0};
+  auto result = __xtd_compare_ignore_case(a, a_count, b, b_count, a_index, b_index);
+  if (result != 0) return result;
+  return a_index < a_count ? 1 : b_index < b_count ? -1 : 0;
+}
+
+template<typename char_t>
+inline bool __xtd_starts_with_ignore_case(const char_t* data, xtd::size count, const char_t* value, xtd::size value_count) noexcept {
+  auto index = xtd::size {0}, value_index = xtd::size {0};
+  return __xtd_compare_ignore_case(data, count, value, value_count, index, value_index) == 0 && value_index == value_count;
+}
+
+template<typename char_t>
+inline bool __xtd_ends_with_ignore_case(const char_t* data, xtd::size count, const char_t* value, xtd::size value_count) noexcept {
+  while (count > 0 && value_count > 0)
+    if (__xtd_map_case(__xtd_decode_previous_code_point(data, count), __xtd_case::fold) != __xtd_map_case(__xtd_decode_previous_code_point(value, value_count), __xtd_case::fold)) return false;
+  return value_count == 0;
+}
+
+// Folds a single code unit : only the code units that are code points by themselves are folded.
+template<typename char_t>
+inline xtd::char32 __xtd_fold_code_unit(char_t value) noexcept {
+  auto index = xtd::size {0};
+  return __xtd_map_case(__xtd_decode_code_point(&value, 1, index), __xtd_case::fold);
+}
+/// @endcond
@@ -0,0 +1,114 @@
+/// @file
+/// @brief Contains __char_set__ class.
+/// @copyright Copyright (c) 2024 Gammasoft. All rights reserved.
+
+#pragma once
+/// @cond
+#if !defined(__XTD_CORE_INTERNAL__)
+#error "Do not include this file: Internal use only"
+#endif
+/// @endcond
+
+#include "../size.h"
+#include "../types.h"
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+/// @cond
+// Set of characters used by the index_of_any, last_index_of_any, split and trim methods.
+// The characters lower than 256 are tested with a 256-bit lookup table, the others with a linear search in the (usually very small) candidate array.
+// When the set contains only one character, the search is delegated to traits_t::find, that is memchr for char.
+// When the set contains a few one-byte characters, the search tests eight characters at once in a 64-bit word (SWAR) and only examines one by one the characters of the words that contain a candidate.
+// The set does not copy the candidates : they must outlive it.
+template<typename char_t, typename traits_t = std::char_traits<char_t>>
+class __char_set__ {
+public:
+  static constexpr xtd::size npos = static_cast<xtd::size>(-1);
+  
+  __char_set__(const char_t* first, const char_t* last) noexcept : values_(first), count_(static_cast<xtd::size>(last - first)) {
+    for (auto iterator = first; iterator != last; ++iterator) {
+      auto value = to_unsigned(*iterator);
+      if (value < 256) table_[value >> 6] |= xtd::uint64 {1} << (value & 63);
+      else has_wide_values_ = true;
+    }
+  }
+  
+  bool contains(char_t value) const noexcept {
+    auto unsigned_value = to_unsigned(value);
+    if (unsigned_value < 256) return (table_[unsigned_value >> 6] >> (unsigned_value & 63)) & 1;
+    return has_wide_values_ && std::find(values_, values_ + count_, value) != values_ + count_;
+  }
+  
+  xtd::size count() const noexcept {return count_;}
+  
+  // Returns the index of the first character of data in [start_index, end_index) contained in the set; otherwise npos.
+  xtd::size find_first(const char_t* data, xtd::size start_index, xtd::size end_index) const noexcept {
+    if (start_index >= end_index || count_ == 0) return npos;
+    if (count_ == 1) {
+      auto result = traits_t::find(data + start_index, end_index - start_index, *values_);
+      return result ? static_cast<xtd::size>(result - data) : npos;
+    }
+    if constexpr (sizeof(char_t) == 1) {
+      if (count_ <= max_word_values) {
+        while (end_index - start_index >= sizeof(xtd::uint64) && !word_contains_value(data + start_index))
+          start_index += sizeof(xtd::uint64);
+      }
+    }
+    for (auto index = start_index; index < end_index; ++index)
+      if (contains(data[index])) return index;
+    return npos;
+  }
+  
+  // Returns the index of the last character of data in [start_index, end_index) contained in the set; otherwise npos.
+  xtd::size find_last(const char_t* data, xtd::size start_index, xtd::size end_index) const noexcept {
+    if (start_index >= end_index || count_ == 0) return npos;
+    if constexpr (sizeof(char_t) == 1) {
+      if (count_ <= max_word_values) {
+        while (end_index - start_index >= sizeof(xtd::uint64) && !word_contains_value(data + end_index - sizeof(xtd::uint64)))
+          end_index -= sizeof(xtd::uint64);
+      }
+    }
+    for (auto index = end_index; index > start_index; --index)
+      if (contains(data[index - 1])) return index - 1;
+    return npos;
+  }
+  
+  // Returns the index of the first character of data in [start_index, end_index) not contained in the set; otherwise end_index.
+  xtd::size skip_first(const char_t* data, xtd::size start_index, xtd::size end_index) const noexcept {
+    while (start_index < end_index && contains(data[start_index])) ++start_index;
+    return start_index;
+  }
+  
+  // Returns the index following the last character of data in [start_index, end_index) not contained in the set; otherwise start_index.
+  xtd::size skip_last(const char_t* data, xtd::size start_index, xtd::size end_index) const noexcept {
+    while (end_index > start_index && contains(data[end_index - 1])) --end_index;
+    return end_index;
+  }
+
+private:
+  static constexpr xtd::size max_word_values = 4;
+  static constexpr xtd::uint64 low_bits = 0x0101010101010101ull;
+  static constexpr xtd::uint64 high_bits = 0x8080808080808080ull;
+  
+  // Returns true if at least one of the eight characters starting at data is a candidate.
+  bool word_contains_value(const char_t* data) const noexcept {
+    auto word = xtd::uint64 {0};
+    std::memcpy(&word, data, sizeof(word));
+    auto result = xtd::uint64 {0};
+    for (auto index = xtd::size {0}; index < count_; ++index) {
+      auto difference = word ^ (low_bits * to_unsigned(values_[index]));
+      result |= (difference - low_bits) & ~difference & high_bits;
+    }
+    return result != 0;
+  }
+  
+  static auto to_unsigned(char_t value) noexcept {return static_cast<std::make_unsigned_t<char_t>>(value);}
+  
+  xtd::uint64 table_[4] {};
+  const char_t* values_ = nullptr;
+  xtd::size count_ = 0;
+  bool has_wide_values_ = false;
+};
+/// @endcond
@@ -91,8 +91,9 @@ inline xtd::async_result xtd::delegate<result_t()>::begin_invoke(xtd::async_call
 template<typename result_t>
 xtd::async_result xtd::delegate<result_t()>::begin_invoke(xtd::async_callback async_callback, std::any async_state) {
   auto async = xtd::new_sptr<async_result_invoke>(async_callback, async_state);
-  threading::thread_pool::queue_user_work_item([&, async = async] {
-    async->data_->result = __xtd_delegate_invoker(function_t {std::bind(&xtd::delegate<result_t()>::invoke, this)});
+  // The delegate is copied : begin_invoke is often called on a temporary delegate.
+  threading::thread_pool::queue_user_work_item([async = async, delegate = *this] {
+    async->data_->result = __xtd_delegate_invoker(function_t {std::bind(&xtd::delegate<result_t()>::invoke, &delegate)});
     async->data_->is_completed = true;
     async->data_->async_event.set();
     async->data_->async_callback(async);
@@ -155,8 +156,9 @@ xtd::async_result xtd::delegate<result_t(arguments_t...)>::begin_invoke(xtd::asy
 template<typename result_t, typename... arguments_t>
 xtd::async_result xtd::delegate<result_t(arguments_t...)>::begin_invoke(xtd::async_callback async_callback, std::any async_state, arguments_t... arguments) {
   auto async = xtd::new_sptr<async_result_invoke>(async_callback, async_state);
-  threading::thread_pool::queue_user_work_item([&, async = async, ...arguments = arguments] {
-    async->data_->result = __xtd_delegate_invoker(function_t {std::bind(&xtd::delegate<result_t(arguments_t...)>::invoke, this, arguments...)}, arguments...);
+  // The delegate is copied : begin_invoke is often called on a temporary delegate.
+  threading::thread_pool::queue_user_work_item([async = async, delegate = *this, ...arguments = arguments] {
+    async->data_->result = __xtd_delegate_invoker(function_t {std::bind(&xtd::delegate<result_t(arguments_t...)>::invoke, &delegate, arguments...)}, arguments...);
     async->data_->is_completed = true;
     async->data_->async_event.set();
     async->data_->async_callback(async);
@@ -0,0 +1,38 @@
+/// @file
+/// @brief Contains __xtd_epoch_guard class and __xtd_epoch_retire method.
+/// @copyright Copyright (c) 2024 Gammasoft. All rights reserved.
+#pragma once
+/// @cond
+#if !defined(__XTD_CORE_INTERNAL__)
+#error "Do not include this file: Internal use only"
+#endif
+/// @endcond
+
+#include <atomic>
+#include <cstdint>
+
+/// @cond
+// Epoch-based reclamation of the nodes that lock-free readers may still be using.
+// A reader holds an __xtd_epoch_guard while it uses a node it loaded from a shared pointer; a writer that unpublished a node hands it to __xtd_epoch_retire, which destroys it once every guard that could have seen it is gone.
+// Readers never wait and never write shared memory other than their own thread record.
+struct __xtd_epoch_node {
+  virtual ~__xtd_epoch_node() = default;
+  
+  __xtd_epoch_node* next_retired = nullptr;
+  std::uintptr_t retired_epoch = 0;
+};
+
+class __xtd_epoch_guard {
+public:
+  __xtd_epoch_guard() noexcept;
+  __xtd_epoch_guard(const __xtd_epoch_guard&) = delete;
+  __xtd_epoch_guard& operator =(const __xtd_epoch_guard&) = delete;
+  ~__xtd_epoch_guard();
+
+private:
+  void* record_ = nullptr;
+};
+
+// Destroys node once no guard entered before the call is still alive; node must already be unreachable for new readers.
+void __xtd_epoch_retire(__xtd_epoch_node* node) noexcept;
+/// @endcond
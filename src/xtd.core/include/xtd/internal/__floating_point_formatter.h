@@ -14,9 +14,8 @@
 #include "__hexfloat_formatter.h"
 #include "__natural_formatter.h"
 #include "__sprintf.h"
-#include <algorithm>
+#include "__to_chars_formatter.h"
 #include <cstring>
-#include <vector>
 
 /// @cond
 template<typename char_t, typename value_t>
@@ -24,16 +23,13 @@ inline std::basic_string<char_t> __floating_point_formatter(const std::basic_str
   auto fmt = format;
   if (fmt.empty()) fmt = {'G'};
   
-  std::vector<char_t> possible_formats {'b', 'B', 'c', 'C', 'e', 'E', 'f', 'F', 'g', 'G', 'n', 'N', 'p', 'P', 'x', 'X'};
-  if (fmt.size() > 3 || std::find(possible_formats.begin(), possible_formats.end(), fmt[0]) == possible_formats.end() || (fmt.size() >= 2 && !std::isdigit(fmt[1])) || (fmt.size() == 3 && !std::isdigit(fmt[2])))
+  if (fmt.size() > 3 || !__to_chars_is_one_of(fmt[0], "bBcCeEfFgGnNpPxX") || (fmt.size() >= 2 && !std::isdigit(fmt[1])) || (fmt.size() == 3 && !std::isdigit(fmt[2])))
     __format_exception("Custom format not yet implemented");
     
+  // The characters after the specifier are already known to be digits.
   int precision = 0;
-  try {
-    if (fmt.size() > 1) precision = std::stoi(fmt.substr(1));
-  } catch (...) {
-    __format_exception("Invalid format expression");
-  }
+  for (auto index = size_t {1}; index < fmt.size(); ++index)
+    precision = precision * 10 + static_cast<int>(fmt[index] - '0');
   if ((fmt[0] == 'f' || fmt[0] == 'F' || fmt[0] == 'n' || fmt[0] == 'N' || fmt[0] == 'p' || fmt[0] == 'P' || fmt[0] == 'r' || fmt[0] == 'R') && fmt.size() == 1) precision = 2;
   if ((fmt[0] == 'e' || fmt[0] == 'E') && fmt.size() == 1) precision = 6;
   if ((fmt[0] == 'g' || fmt[0] == 'G') && fmt.size() == 1) precision = sizeof(value) <= 4 ? 7 : 15;
@@ -49,11 +45,22 @@ inline std::basic_string<char_t> __floating_point_formatter(const std::basic_str
     case 'f':
     case 'F':
     case 'g':
-    case 'G': return __sprintf((fmt_str + fmt[0]).c_str(), precision, static_cast<long double>(value));
+    case 'G': {
+      auto result = std::basic_string<char_t> {};
+      auto chars_format = fmt[0] == 'e' || fmt[0] == 'E' ? std::chars_format::scientific : (fmt[0] == 'f' || fmt[0] == 'F' ? std::chars_format::fixed : std::chars_format::general);
+      if (__to_chars_floating_point(result, static_cast<long double>(value), chars_format, precision, fmt[0] == 'E' || fmt[0] == 'G')) return result;
+      return __sprintf((fmt_str + fmt[0]).c_str(), precision, static_cast<long double>(value));
+    }
     case 'n':
     case 'N': return __natural_formatter<char_t>(static_cast<long double>(value), precision, loc);
-    case 'p': return __sprintf((fmt_str + char_t('f')).c_str(), precision, static_cast<long double>(value * 100)) + std::basic_string<char_t>({char_t(' '), char_t('%')});
-    case 'P': return __sprintf((fmt_str + char_t('F')).c_str(), precision, static_cast<long double>(value * 100)) + std::basic_string<char_t>({char_t(' '), char_t('%')});
+    case 'p':
+    case 'P': {
+      auto result = std::basic_string<char_t> {};
+      if (!__to_chars_floating_point(result, static_cast<long double>(value * 100), std::chars_format::fixed, precision, false)) result = __sprintf((fmt_str + char_t(fmt[0] == 'p' ? 'f' : 'F')).c_str(), precision, static_cast<long double>(value * 100));
+      result += char_t(' ');
+      result += char_t('%');
+      return result;
+    }
     case 'x':
     case 'X': return __hexfloat_formatter<char_t>(static_cast<long double>(value), precision, loc);
     default: __format_exception("Invalid format expression"); return {};
@@ -9,6 +9,7 @@
 
 #include <string>
 #include <limits>
+#include <vector>
 
 /// @cond
 template<typename char_t>
@@ -17,5 +18,13 @@ struct __format_information {
   size_t location = 0;
   std::basic_string<char_t> alignment;
   std::basic_string<char_t> format;
+  int alignment_width = 0;
+  bool is_alignment_valid = true;
+};
+
+template<typename char_t>
+struct __format_pattern {
+  std::basic_string<char_t> text;
+  std::vector<__format_information<char_t>> formats;
 };
 /// @endcond
@@ -0,0 +1,164 @@
+/// @file
+/// @brief Contains __format_literal struct.
+#pragma once
+/// @cond
+#if !defined(__XTD_CORE_INTERNAL__)
+#error "Do not include this file: Internal use only"
+#endif
+/// @endcond
+
+#include "__format_information.h"
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <string_view>
+
+/// @cond
+// A format string given as a template argument; it is parsed and checked while compiling, with the same rules as the runtime parser.
+template<std::size_t length>
+struct __format_literal {
+  consteval __format_literal(const char (&fmt)[length]) {
+    for (auto index = std::size_t {0}; index < length; ++index)
+      chars[index] = fmt[index];
+  }
+  
+  constexpr std::string_view view() const noexcept {return {chars, length - 1};}
+  
+  char chars[length] {};
+};
+
+struct __format_literal_item {
+  std::size_t index = std::numeric_limits<std::size_t>::max();
+  std::size_t location = 0;
+  std::size_t alignment_first = 0;
+  std::size_t alignment_size = 0;
+  std::size_t format_first = 0;
+  std::size_t format_size = 0;
+  int alignment_width = 0;
+  bool is_alignment_valid = true;
+};
+
+template<std::size_t length>
+struct __format_literal_parse_result {
+  bool is_valid = true;
+  std::array<char, length> text {};
+  std::size_t text_size = 0;
+  std::array<__format_literal_item, length / 2 + 1> items {};
+  std::size_t item_count = 0;
+};
+
+// Same conversion as std::stoi : leading white spaces, an optional sign and at least one digit; the characters after the digits are ignored.
+constexpr bool __format_literal_parse_alignment(std::string_view alignment, int& width) noexcept {
+  auto position = std::size_t {0};
+  while (position < alignment.size() && (alignment[position] == ' ' || (alignment[position] >= '\t' && alignment[position] <= '\r'))) ++position;
+  auto negative = position < alignment.size() && alignment[position] == '-';
+  if (position < alignment.size() && (alignment[position] == '-' || alignment[position] == '+')) ++position;
+  auto value = 0ll;
+  auto first_digit = position;
+  for (; position < alignment.size() && alignment[position] >= '0' && alignment[position] <= '9'; ++position) {
+    value = value * 10 + (alignment[position] - '0');
+    if (value > static_cast<long long>(std::numeric_limits<int>::max()) + 1) return false;
+  }
+  if (position == first_digit || (!negative && value > std::numeric_limits<int>::max())) return false;
+  width = static_cast<int>(negative ? -value : value);
+  return true;
+}
+
+constexpr bool __format_literal_parse_item(std::string_view item, std::size_t item_first, std::size_t& index, __format_literal_item& information) noexcept {
+  if (item.empty()) {
+    information.index = index++;
+    return true;
+  }
+  
+  auto alignment_separator = item.find(',');
+  auto format_separator = item.find(':');
+  if (alignment_separator != std::string_view::npos && format_separator != std::string_view::npos && alignment_separator > format_separator)
+    alignment_separator = std::string_view::npos;
+  
+  if (alignment_separator != std::string_view::npos) {
+    information.alignment_first = item_first + alignment_separator + 1;
+    information.alignment_size = (format_separator != std::string_view::npos ? format_separator : item.size()) - alignment_separator - 1;
+    information.is_alignment_valid = __format_literal_parse_alignment(item.substr(alignment_separator + 1, information.alignment_size), information.alignment_width);
+  }
+  
+  if (format_separator != std::string_view::npos) {
+    information.format_first = item_first + format_separator + 1;
+    information.format_size = item.size() - format_separator - 1;
+  }
+  
+  if (alignment_separator == 0 || format_separator == 0) {
+    information.index = index++;
+    return true;
+  }
+  
+  auto index_str = item.substr(0, alignment_separator != std::string_view::npos ? alignment_separator : format_separator);
+  auto value = std::size_t {0};
+  for (auto c : index_str) {
+    if (c < '0' || c > '9') return false;
+    value = value * 10 + static_cast<std::size_t>(c - '0');
+    if (value > static_cast<std::size_t>(std::numeric_limits<int>::max())) return false;
+  }
+  information.index = value;
+  return true;
+}
+
+template<std::size_t length>
+constexpr __format_literal_parse_result<length> __format_literal_parse(const __format_literal<length>& literal) noexcept {
+  auto result = __format_literal_parse_result<length> {};
+  auto fmt = literal.view();
+  auto index = std::size_t {0};
+  for (auto position = std::size_t {0}; position < fmt.size(); ++position) {
+    if (fmt[position] == '{') {
+      if (++position == fmt.size()) return {false};
+      if (fmt[position] == '{') result.text[result.text_size++] = '{';
+      else {
+        auto end_position = fmt.find('}', position);
+        if (end_position == std::string_view::npos) return {false};
+        auto& information = result.items[result.item_count++];
+        information.location = result.text_size;
+        if (!__format_literal_parse_item(fmt.substr(position, end_position - position), position, index, information)) return {false};
+        position = end_position;
+      }
+    } else if (fmt[position] == '}') {
+      if (++position == fmt.size() || fmt[position] != '}') return {false};
+      result.text[result.text_size++] = '}';
+    } else result.text[result.text_size++] = fmt[position];
+  }
+  return result;
+}
+
+// A literal is accepted only if it parses, each alignment is a number and each index refers to one of the argument_count arguments.
+template<__format_literal literal>
+consteval bool __format_literal_is_valid(std::size_t argument_count) noexcept {
+  constexpr auto result = __format_literal_parse(literal);
+  if (!result.is_valid) return false;
+  for (auto index = std::size_t {0}; index < result.item_count; ++index)
+    if (result.items[index].index >= argument_count || (result.items[index].alignment_size && !result.items[index].is_alignment_valid)) return false;
+  return true;
+}
+
+// The pattern of a literal is built once from the compile-time parse; it does not go through the cache of the runtime patterns.
+template<__format_literal literal>
+const __format_pattern<char>& __format_literal_pattern() {
+  static const auto pattern = [] {
+    constexpr auto result = __format_literal_parse(literal);
+    auto fmt = literal.view();
+    auto pattern = __format_pattern<char> {};
+    pattern.text.assign(result.text.data(), result.text_size);
+    pattern.formats.reserve(result.item_count);
+    for (auto index = std::size_t {0}; index < result.item_count; ++index) {
+      const auto& item = result.items[index];
+      auto information = __format_information<char> {};
+      information.index = item.index;
+      information.location = item.location;
+      information.alignment = std::string {fmt.substr(item.alignment_first, item.alignment_size)};
+      information.format = std::string {fmt.substr(item.format_first, item.format_size)};
+      information.alignment_width = item.alignment_width;
+      information.is_alignment_valid = item.is_alignment_valid;
+      pattern.formats.push_back(std::move(information));
+    }
+    return pattern;
+  }();
+  return pattern;
+}
+/// @endcond
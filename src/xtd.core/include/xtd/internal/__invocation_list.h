@@ -0,0 +1,572 @@
+/// @file
+/// @brief Contains __xtd_invocation_list class.
+/// @copyright Copyright (c) 2024 Gammasoft. All rights reserved.
+#pragma once
+/// @cond
+#if !defined(__XTD_CORE_INTERNAL__)
+#error "Do not include this file: Internal use only"
+#endif
+/// @endcond
+
+#include "__epoch_reclaimer.h"
+#include "../argument_null_exception.h"
+#include "../size.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+/// @cond
+// Returns the first of count consecutive subscription tokens; tokens only grow, so the entries of a list stay sorted by token.
+xtd::size __xtd_invocation_list_reserve_tokens(xtd::size count) noexcept;
+
+// Holds the functions of a delegate; the functions without arguments are invoked before the functions with arguments.
+// The state is a single word : empty, the inline slot, or an immutable list shared by the copies of the delegate. Writers publish a new state with compare_exchange and never wait for each other or for readers.
+// A single function whose callable is trivially copyable and at most three words long is kept in the inline slot; invoke copies it out under a sequence check, so it neither allocates nor touches a reference count.
+// Longer lists are read under an __xtd_epoch_guard and destroyed by __xtd_epoch_retire once the last delegate holding them let them go.
+template<typename result_t, typename... arguments_t>
+class __xtd_invocation_list {
+  struct content;
+
+public:
+  using no_arguments_function_t = std::function<result_t()>;
+  using function_t = std::function<result_t(arguments_t...)>;
+  
+  struct token_range {
+    xtd::size first = 0;
+    xtd::size count = 0;
+    
+    bool contains(xtd::size token) const noexcept {return token >= first && token - first < count;}
+  };
+  
+  __xtd_invocation_list() noexcept = default;
+  __xtd_invocation_list(const __xtd_invocation_list& other) noexcept {
+    for (;;) {
+      auto state = other.state_.load(std::memory_order_acquire);
+      if ((state & ~reserved_state) == 0) return;
+      if (state & inline_state) {
+        auto single = entry {};
+        if (!other.read_slot(state, single)) continue;
+        write_slot(single);
+        state_.store(inline_state, std::memory_order_relaxed);
+        return;
+      }
+      
+      auto guard = __xtd_epoch_guard {};
+      state = other.state_.load(std::memory_order_seq_cst);
+      if (state & inline_state) continue;
+      auto node = pointer(state);
+      if (!node) return;
+      auto references = node->references.load(std::memory_order_relaxed);
+      while (references && !node->references.compare_exchange_weak(references, references + 1, std::memory_order_relaxed));
+      if (!references) continue;
+      state_.store(reinterpret_cast<std::uintptr_t>(node), std::memory_order_relaxed);
+      return;
+    }
+  }
+  
+  __xtd_invocation_list& operator =(const __xtd_invocation_list& other) noexcept {
+    if (this == &other) return *this;
+    auto copy = __xtd_invocation_list {other};
+    for (;;) {
+      auto state = state_.load(std::memory_order_seq_cst);
+      if (auto node = pointer(copy.state_.load(std::memory_order_relaxed)); node) {
+        node->references.fetch_add(1, std::memory_order_relaxed);
+        if (exchange(state, reinterpret_cast<std::uintptr_t>(node) | (state & reserved_state))) return *this;
+        node->references.fetch_sub(1, std::memory_order_relaxed);
+        continue;
+      }
+      auto value = content {};
+      copy.read_content(copy.state_.load(std::memory_order_relaxed), value);
+      if (publish(state, std::move(value))) return *this;
+    }
+  }
+  
+  ~__xtd_invocation_list() {release(state_.load(std::memory_order_acquire));}
+  
+  // The returned references stay valid until the list is changed.
+  const std::vector<no_arguments_function_t>& no_arguments_functions() const noexcept {return snapshot().no_arguments_functions;}
+  const std::vector<function_t>& functions() const noexcept {return snapshot().functions;}
+  
+  bool is_empty() const noexcept {return (state_.load(std::memory_order_acquire) & ~reserved_state) == 0;}
+  
+  xtd::size size() const noexcept {
+    auto guard = __xtd_epoch_guard {};
+    auto state = state_.load(std::memory_order_seq_cst);
+    if (state & inline_state) return 1;
+    auto node = pointer(state);
+    return node ? node->value.size() : 0;
+  }
+  
+  template<typename callable_t>
+  token_range add_function(const callable_t& callable) noexcept {return add<false>(callable);}
+  
+  template<typename callable_t>
+  token_range add_no_arguments_function(const callable_t& callable) noexcept {return add<true>(callable);}
+  
+  token_range add(const __xtd_invocation_list& other) noexcept {
+    auto value = content {};
+    {
+      auto guard = __xtd_epoch_guard {};
+      other.read_content(value);
+    }
+    auto tokens = token_range {__xtd_invocation_list_reserve_tokens(value.size()), value.size()};
+    auto token = tokens.first;
+    for (auto& entry : value.no_arguments_entries)
+      entry.token = token++;
+    for (auto& entry : value.entries)
+      entry.token = token++;
+    
+    update([&](content& current) {
+      current.no_arguments_functions.insert(current.no_arguments_functions.end(), value.no_arguments_functions.begin(), value.no_arguments_functions.end());
+      current.no_arguments_entries.insert(current.no_arguments_entries.end(), value.no_arguments_entries.begin(), value.no_arguments_entries.end());
+      current.functions.insert(current.functions.end(), value.functions.begin(), value.functions.end());
+      current.entries.insert(current.entries.end(), value.entries.begin(), value.entries.end());
+      return value.size() != 0;
+    });
+    return tokens;
+  }
+  
+  // Removes the last function equal to function, as xtd::delegate::remove does.
+  void remove_function(const function_t& function) noexcept {
+    auto matches = matcher<function_t> {function};
+    if (remove_inline([&](const entry& single) {return !single.no_arguments && matches(single);})) return;
+    update([&](content& current) {return remove_last(current.functions, current.entries, matches);});
+  }
+  
+  void remove_no_arguments_function(const no_arguments_function_t& function) noexcept {
+    auto matches = matcher<no_arguments_function_t> {function};
+    if (remove_inline([&](const entry& single) {return single.no_arguments && matches(single);})) return;
+    update([&](content& current) {return remove_last(current.no_arguments_functions, current.no_arguments_entries, matches);});
+  }
+  
+  void remove(const __xtd_invocation_list& value) noexcept {
+    auto removed = content {};
+    {
+      auto guard = __xtd_epoch_guard {};
+      value.read_content(removed);
+    }
+    update([&](content& current) {
+      auto changed = false;
+      for (const auto& function : removed.no_arguments_functions)
+        changed = remove_last(current.no_arguments_functions, current.no_arguments_entries, matcher<no_arguments_function_t> {function}) || changed;
+      for (const auto& function : removed.functions)
+        changed = remove_last(current.functions, current.entries, matcher<function_t> {function}) || changed;
+      return changed;
+    });
+  }
+  
+  void remove_all(const __xtd_invocation_list& value) noexcept {
+    auto removed = content {};
+    {
+      auto guard = __xtd_epoch_guard {};
+      value.read_content(removed);
+    }
+    update([&](content& current) {
+      auto changed = false;
+      for (const auto& function : removed.no_arguments_functions)
+        for (auto matches = matcher<no_arguments_function_t> {function}; remove_last(current.no_arguments_functions, current.no_arguments_entries, matches);) changed = true;
+      for (const auto& function : removed.functions)
+        for (auto matches = matcher<function_t> {function}; remove_last(current.functions, current.entries, matches);) changed = true;
+      return changed;
+    });
+  }
+  
+  // Removes the functions added with tokens without comparing functions; a single inline function is removed without allocating.
+  void remove(token_range tokens) noexcept {
+    if (tokens.count == 0 || remove_inline([&](const entry& single) {return tokens.contains(single.token);})) return;
+    update([&](content& current) {
+      auto changed = remove_tokens(current.no_arguments_functions, current.no_arguments_entries, tokens);
+      return remove_tokens(current.functions, current.entries, tokens) || changed;
+    });
+  }
+  
+  void clear() noexcept {
+    auto state = state_.load(std::memory_order_seq_cst);
+    while (!exchange(state, state & reserved_state))
+      state = state_.load(std::memory_order_seq_cst);
+  }
+  
+  bool equals(const __xtd_invocation_list& other) const noexcept {
+    auto value = content {};
+    auto other_value = content {};
+    {
+      auto guard = __xtd_epoch_guard {};
+      read_content(value);
+      other.read_content(other_value);
+    }
+    if (value.functions.size() != other_value.functions.size() || value.no_arguments_functions.size() != other_value.no_arguments_functions.size()) return false;
+    for (auto index = xtd::size {0}; index < value.no_arguments_functions.size(); ++index)
+      if (!are_equals(value.no_arguments_functions[index], other_value.no_arguments_functions[index])) return false;
+    for (auto index = xtd::size {0}; index < value.functions.size(); ++index)
+      if (!are_equals(value.functions[index], other_value.functions[index])) return false;
+    return true;
+  }
+  
+  result_t invoke(arguments_t... arguments) const {
+    // Only the thunk and the callable are read; they are the first words of the entry.
+    auto state = state_.load(std::memory_order_acquire);
+    if (state & inline_state) {
+      auto words = callable_words {};
+      if (read_words(state, words)) return call_callable(std::bit_cast<invoke_t>(words[0]), words.data() + 1, arguments...);
+    } else if ((state & ~reserved_state) == 0) return result_t();
+    return invoke_list(arguments...);
+  }
+  
+  static bool are_equals(const function_t& function1, const function_t& function2) noexcept {
+    return function1.target_type() == function2.target_type() && (function1.template target<result_t(*)(arguments_t...)>() == function2.template target<result_t(*)(arguments_t...)>() || *function1.template target<result_t(*)(arguments_t...)>() == *function2.template target<result_t(*)(arguments_t...)>());
+  }
+  
+  static bool are_equals(const no_arguments_function_t& function1, const no_arguments_function_t& function2) noexcept requires (sizeof...(arguments_t) != 0) {
+    return function1.target_type() == function2.target_type() && (function1.template target<result_t(*)()>() == function2.template target<result_t(*)()>() || *function1.template target<result_t(*)()>() == *function2.template target<result_t(*)()>());
+  }
+
+private:
+  static constexpr xtd::size inline_storage_size = 3;
+  
+  using function_pointer_t = result_t (*)(arguments_t...);
+  using invoke_t = result_t (*)(const std::uintptr_t* storage, arguments_t... arguments);
+  
+  // One function of the list : its token and, when the callable fits, a copy of it with the thunks that call it and rebuild its std::function.
+  // A function pointer that takes the arguments of the list has no invoke thunk : it is called directly.
+  struct entry {
+    invoke_t invoke = nullptr;
+    std::uintptr_t storage[inline_storage_size] {};
+    const std::type_info& (*manage)(const std::uintptr_t* storage, content* target) = nullptr;
+    xtd::size token = 0;
+    std::uintptr_t no_arguments = 0;
+  };
+  
+  static constexpr xtd::size entry_size = sizeof(entry) / sizeof(std::uintptr_t);
+  using callable_words = std::array<std::uintptr_t, 1 + inline_storage_size>;
+  static_assert(sizeof(entry) == entry_size * sizeof(std::uintptr_t) && std::is_trivially_copyable_v<entry> && offsetof(entry, storage) == sizeof(invoke_t));
+  
+  struct content {
+    std::vector<no_arguments_function_t> no_arguments_functions;
+    std::vector<function_t> functions;
+    std::vector<entry> no_arguments_entries;
+    std::vector<entry> entries;
+    
+    xtd::size size() const noexcept {return no_arguments_functions.size() + functions.size();}
+  };
+  
+  struct data : public __xtd_epoch_node {
+    explicit data(content&& value) noexcept : value(std::move(value)) {}
+    
+    std::atomic<xtd::size> references {1};
+    content value;
+  };
+  
+  static constexpr std::uintptr_t inline_state = 1;
+  static constexpr std::uintptr_t reserved_state = 2;
+  
+  template<bool no_arguments, typename callable_t>
+  static constexpr bool is_inline_callable = std::is_trivially_copyable_v<callable_t> && sizeof(callable_t) <= sizeof(entry::storage) && alignof(callable_t) <= alignof(std::uintptr_t) && (no_arguments ? std::is_invocable_r_v<result_t, const callable_t&> : std::is_invocable_r_v<result_t, const callable_t&, arguments_t...>);
+  
+  template<typename callable_t>
+  static const callable_t& callable_from(const std::uintptr_t* storage, unsigned char* buffer) noexcept {
+    std::memcpy(buffer, storage, sizeof(callable_t));
+    return *std::launder(reinterpret_cast<const callable_t*>(buffer));
+  }
+  
+  template<bool no_arguments, typename callable_t>
+  static result_t invoke_callable(const std::uintptr_t* storage, arguments_t... arguments) {
+    alignas(callable_t) unsigned char buffer[sizeof(callable_t)];
+    const auto& callable = callable_from<callable_t>(storage, buffer);
+    if constexpr (std::is_void_v<result_t> && no_arguments) callable();
+    else if constexpr (std::is_void_v<result_t>) callable(arguments...);
+    else if constexpr (no_arguments) return callable();
+    else return callable(arguments...);
+  }
+  
+  template<bool no_arguments, typename callable_t>
+  static const std::type_info& manage_callable(const std::uintptr_t* storage, content* target) {
+    if (target) {
+      alignas(callable_t) unsigned char buffer[sizeof(callable_t)];
+      const auto& callable = callable_from<callable_t>(storage, buffer);
+      if constexpr (no_arguments) target->no_arguments_functions.push_back(no_arguments_function_t {callable});
+      else target->functions.push_back(function_t {callable});
+    }
+    return typeid(callable_t);
+  }
+  
+  template<bool no_arguments, typename callable_t>
+  static bool make_entry(const callable_t& callable, entry& result) noexcept {
+    if constexpr (std::is_same_v<callable_t, function_t> || std::is_same_v<callable_t, no_arguments_function_t>) {
+      // A std::function holding a function pointer is stored as that pointer.
+      using pointer_t = std::conditional_t<no_arguments, result_t(*)(), result_t(*)(arguments_t...)>;
+      auto target = callable.template target<pointer_t>();
+      return target && make_entry<no_arguments>(*target, result);
+    } else if constexpr (is_inline_callable<no_arguments, callable_t>) {
+      if constexpr (std::is_pointer_v<callable_t>) if (!callable) return false;
+      if constexpr (no_arguments || !std::is_same_v<callable_t, function_pointer_t>) result.invoke = &invoke_callable<no_arguments, callable_t>;
+      std::memcpy(result.storage, &callable, sizeof(callable_t));
+      result.manage = &manage_callable<no_arguments, callable_t>;
+      return true;
+    } else return false;
+  }
+  
+  // Compares functions as are_equals does, with the type and the target of the searched function read once; a callable held by an entry is compared without its std::function.
+  template<typename function_type_t>
+  struct matcher {
+    using pointer_t = std::conditional_t<std::is_same_v<function_type_t, function_t>, result_t(*)(arguments_t...), result_t(*)()>;
+    
+    explicit matcher(const function_type_t& function) noexcept : type(function.target_type()), target(function.template target<pointer_t>()) {}
+    
+    bool operator()(const entry& single) const noexcept {
+      return single.manage && single.manage(single.storage, nullptr) == type && (!target || std::memcmp(single.storage, target, sizeof(pointer_t)) == 0);
+    }
+    
+    bool operator()(const entry& single, const function_type_t& function) const noexcept {
+      if (single.manage) return (*this)(single);
+      return function.target_type() == type && (!target || *function.template target<pointer_t>() == *target);
+    }
+    
+    const std::type_info& type;
+    const pointer_t* target;
+  };
+  
+  
+  static data* pointer(std::uintptr_t state) noexcept {return (state & inline_state) ? nullptr : reinterpret_cast<data*>(state & ~reserved_state);}
+  
+  static const content& empty_content() noexcept {
+    static auto empty = content {};
+    return empty;
+  }
+  
+  template<bool no_arguments, typename callable_t>
+  token_range add(const callable_t& callable) noexcept {
+    auto tokens = token_range {__xtd_invocation_list_reserve_tokens(1), 1};
+    auto single = entry {};
+    auto is_inline = make_entry<no_arguments>(callable, single);
+    single.token = tokens.first;
+    single.no_arguments = no_arguments;
+    // An empty list takes the callable in its inline slot without building a list.
+    for (auto state = state_.load(std::memory_order_seq_cst); is_inline && state == 0; state = state_.load(std::memory_order_seq_cst))
+      if (publish_inline(state, single)) return tokens;
+    
+    update([&](content& current) {
+      if constexpr (no_arguments) current.no_arguments_functions.push_back(no_arguments_function_t {callable});
+      else current.functions.push_back(function_t {callable});
+      (no_arguments ? current.no_arguments_entries : current.entries).push_back(single);
+      return true;
+    });
+    return tokens;
+  }
+  
+  // Removes the inline function if it matches; returns false when the list is not inline so the caller takes the general path.
+  template<typename predicate_t>
+  bool remove_inline(predicate_t predicate) noexcept {
+    for (;;) {
+      auto state = state_.load(std::memory_order_seq_cst);
+      if (!(state & inline_state)) return false;
+      auto single = entry {};
+      if (!read_slot(state, single)) continue;
+      if (!predicate(single) || exchange(state, 0)) return true;
+    }
+  }
+  
+  template<typename function_type_t>
+  static bool remove_last(std::vector<function_type_t>& functions, std::vector<entry>& entries, const matcher<function_type_t>& matches) noexcept {
+    for (auto index = functions.size(); index-- != 0;) {
+      if (!matches(entries[index], functions[index])) continue;
+      functions.erase(functions.begin() + index);
+      entries.erase(entries.begin() + index);
+      return true;
+    }
+    return false;
+  }
+  
+  
+  template<typename function_type_t>
+  static bool remove_tokens(std::vector<function_type_t>& functions, std::vector<entry>& entries, token_range tokens) noexcept {
+    // Concurrent adds can publish their tokens out of order, but the functions of one add stay contiguous.
+    auto first = std::find_if(entries.begin(), entries.end(), [&](const entry& item) {return tokens.contains(item.token);});
+    auto last = std::find_if(first, entries.end(), [&](const entry& item) {return !tokens.contains(item.token);});
+    if (first == last) return false;
+    functions.erase(functions.begin() + (first - entries.begin()), functions.begin() + (last - entries.begin()));
+    entries.erase(first, last);
+    return true;
+  }
+  
+  static result_t call_callable(invoke_t invoke, const std::uintptr_t* storage, arguments_t... arguments) {
+    if (!invoke) return std::bit_cast<function_pointer_t>(storage[0])(arguments...);
+    return invoke(storage, arguments...);
+  }
+  
+  // A list calls the callables it holds a copy of without going through their std::function.
+  template<typename function_type_t>
+  static result_t call_entry(const entry& single, const function_type_t& function, arguments_t... arguments) {
+    if (single.manage) return call_callable(single.invoke, single.storage, arguments...);
+    if (function == nullptr) throw xtd::argument_null_exception {csf_};
+    if constexpr (std::is_same_v<function_type_t, function_t>) return function(arguments...);
+    else return function();
+  }
+  
+  // The slow path of invoke : the list, or an inline function that was changed while it was read.
+  result_t invoke_list(arguments_t... arguments) const {
+    for (;;) {
+      auto state = state_.load(std::memory_order_acquire);
+      if ((state & ~reserved_state) == 0) return result_t();
+      if (state & inline_state) {
+        auto words = callable_words {};
+        if (read_words(state, words)) return call_callable(std::bit_cast<invoke_t>(words[0]), words.data() + 1, arguments...);
+        continue;
+      }
+      
+      auto guard = __xtd_epoch_guard {};
+      state = state_.load(std::memory_order_seq_cst);
+      if (state & inline_state) continue;
+      auto node = pointer(state);
+      if (!node) return result_t();
+      return invoke_all(node->value, arguments...);
+    }
+  }
+  
+  static result_t invoke_all(const content& value, arguments_t... arguments) {
+    auto count = value.size();
+    for (auto index = xtd::size {0}; index < value.no_arguments_functions.size(); ++index, --count)
+      if (count == 1) return call_entry(value.no_arguments_entries[index], value.no_arguments_functions[index], arguments...);
+      else call_entry(value.no_arguments_entries[index], value.no_arguments_functions[index], arguments...);
+    for (auto index = xtd::size {0}; index < value.functions.size(); ++index, --count)
+      if (count == 1) return call_entry(value.entries[index], value.functions[index], arguments...);
+      else call_entry(value.entries[index], value.functions[index], arguments...);
+    return result_t();
+  }
+  
+  
+  // The slot is only written while it is reserved and not published; a reader that raced with a writer sees another sequence or another state and retries.
+  template<xtd::size count>
+  bool read_words(std::uintptr_t state, std::array<std::uintptr_t, count>& words) const noexcept {
+    auto sequence = sequence_.load(std::memory_order_acquire);
+    if (sequence & 1) return false;
+    for (auto index = xtd::size {0}; index < count; ++index)
+      words[index] = words_[index].load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return sequence_.load(std::memory_order_relaxed) == sequence && state_.load(std::memory_order_relaxed) == state;
+  }
+  
+  bool read_slot(std::uintptr_t state, entry& value) const noexcept {
+    auto words = std::array<std::uintptr_t, entry_size> {};
+    if (!read_words(state, words)) return false;
+    value = std::bit_cast<entry>(words);
+    return true;
+  }
+  
+  void write_slot(const entry& value) noexcept {
+    auto sequence = sequence_.load(std::memory_order_relaxed);
+    sequence_.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    auto words = std::bit_cast<std::array<std::uintptr_t, entry_size>>(value);
+    for (auto index = xtd::size {0}; index < entry_size; ++index)
+      words_[index].store(words[index], std::memory_order_relaxed);
+    sequence_.store(sequence + 2, std::memory_order_release);
+  }
+  
+  // Copies the functions of the current state; the caller holds a guard when the state may be a list.
+  bool read_content(std::uintptr_t state, content& value) const noexcept {
+    if (state & inline_state) {
+      auto single = entry {};
+      if (!read_slot(state, single)) return false;
+      single.manage(single.storage, &value);
+      (single.no_arguments ? value.no_arguments_entries : value.entries).push_back(single);
+      return true;
+    }
+    if (auto node = pointer(state); node) {
+      // The copy keeps room for one more function, which is what add needs.
+      copy(node->value.no_arguments_functions, value.no_arguments_functions);
+      copy(node->value.functions, value.functions);
+      copy(node->value.no_arguments_entries, value.no_arguments_entries);
+      copy(node->value.entries, value.entries);
+    }
+    return true;
+  }
+  
+  template<typename item_t>
+  static void copy(const std::vector<item_t>& source, std::vector<item_t>& destination) noexcept {
+    if (source.empty()) return;
+    destination.reserve(source.size() + 1);
+    destination.assign(source.begin(), source.end());
+  }
+  
+  void read_content(content& value) const noexcept {
+    while (!read_content(state_.load(std::memory_order_seq_cst), value));
+  }
+  
+  // Lists and promotes the inline function to a list so that the vectors of functions can be referenced.
+  const content& snapshot() const noexcept {
+    for (;;) {
+      auto state = state_.load(std::memory_order_seq_cst);
+      if (!(state & inline_state)) {
+        auto node = pointer(state);
+        return node ? node->value : empty_content();
+      }
+      auto value = content {};
+      if (!read_content(state, value)) continue;
+      auto node = new data {std::move(value)};
+      if (exchange(state, reinterpret_cast<std::uintptr_t>(node))) return node->value;
+      delete node;
+    }
+  }
+  
+  // Calls updater on a copy of the current functions and publishes the result; returns without change when updater returns false.
+  template<typename updater_t>
+  void update(updater_t updater) noexcept {
+    for (;;) {
+      auto guard = __xtd_epoch_guard {};
+      auto state = state_.load(std::memory_order_seq_cst);
+      auto value = content {};
+      if (!read_content(state, value)) continue;
+      if (!updater(value) || publish(state, std::move(value))) return;
+    }
+  }
+  
+  bool publish(std::uintptr_t expected, content&& value) noexcept {
+    if (value.size() == 0) return exchange(expected, expected & reserved_state);
+    const auto& single = value.no_arguments_entries.size() ? value.no_arguments_entries.front() : value.entries.front();
+    if (value.size() == 1 && single.manage && !(expected & (inline_state | reserved_state))) return publish_inline(expected, single);
+    auto node = new data {std::move(value)};
+    if (exchange(expected, reinterpret_cast<std::uintptr_t>(node) | (expected & reserved_state))) return true;
+    delete node;
+    return false;
+  }
+  
+  // Reserves the slot, writes it and publishes it; other writers keep the reservation while they change the state, which makes the publication fail.
+  bool publish_inline(std::uintptr_t expected, const entry& value) noexcept {
+    if (!state_.compare_exchange_strong(expected, expected | reserved_state, std::memory_order_seq_cst)) return false;
+    write_slot(value);
+    auto reserved = expected | reserved_state;
+    if (state_.compare_exchange_strong(reserved, inline_state, std::memory_order_seq_cst)) {
+      release(expected);
+      return true;
+    }
+    auto state = state_.load(std::memory_order_relaxed);
+    while (!state_.compare_exchange_weak(state, state & ~reserved_state, std::memory_order_seq_cst));
+    return false;
+  }
+  
+  bool exchange(std::uintptr_t expected, std::uintptr_t desired) const noexcept {
+    if (!state_.compare_exchange_strong(expected, desired, std::memory_order_seq_cst)) return false;
+    release(expected);
+    return true;
+  }
+  
+  static void release(std::uintptr_t state) noexcept {
+    auto node = pointer(state);
+    if (node && node->references.fetch_sub(1, std::memory_order_acq_rel) == 1) __xtd_epoch_retire(node);
+  }
+  
+  mutable std::atomic<std::uintptr_t> state_ {0};
+  std::atomic<std::uint32_t> sequence_ {0};
+  std::array<std::atomic<std::uintptr_t>, entry_size> words_ {};
+};
+/// @endcond
@@ -9,10 +9,13 @@
 
 #include "../number_styles.h"
 #include "../types.h"
+#include <charconv>
 #include <locale>
 #include <limits>
 #include <string>
+#include <string_view>
 #include <sstream>
+#include <type_traits>
 
 /// @cond
 void __throw_parse_format_exception(const std::string& message, const char* file, xtd::uint32 line, const char* func);
@@ -53,13 +56,13 @@ inline int __parse_remove_signs(std::basic_string<char_t>& str, xtd::number_styl
     sign -= 1;
   }
   
-  while ((styles & xtd::number_styles::allow_trailing_sign) == xtd::number_styles::allow_trailing_sign && str.rfind('+') + 1 == str.size()) {
+  while ((styles & xtd::number_styles::allow_trailing_sign) == xtd::number_styles::allow_trailing_sign && !str.empty() && str.rfind('+') + 1 == str.size()) {
     if (sign != 0) __throw_parse_format_exception("String contains more than one sign", __FILE__, __LINE__, __func__);
     str.pop_back();
     sign += 1;
   }
   
-  while ((styles & xtd::number_styles::allow_trailing_sign) == xtd::number_styles::allow_trailing_sign && str.rfind('-') + 1 == str.size()) {
+  while ((styles & xtd::number_styles::allow_trailing_sign) == xtd::number_styles::allow_trailing_sign && !str.empty() && str.rfind('-') + 1 == str.size()) {
     if (sign != 0) __throw_parse_format_exception("String contains more than one sign", __FILE__, __LINE__, __func__);
     str.pop_back();
     sign -= 1;
@@ -106,14 +109,14 @@ inline void __parse_check_valid_characters(const std::basic_string<char_t>& str,
   if ((styles & xtd::number_styles::allow_exponent) == xtd::number_styles::allow_exponent) {
     size_t index = str.find('+');
     if (index == std::basic_string<char_t>::npos) index = str.find('-');
-    if (index != std::basic_string<char_t>::npos && str[index - 1] != 'e' && str[index - 1] != 'E')
+    if (index != std::basic_string<char_t>::npos && (index == 0 || (str[index - 1] != 'e' && str[index - 1] != 'E')))
       __throw_parse_format_exception("invalid character found", __FILE__, __LINE__, __func__);
   }
 }
 
 template <typename value_t, typename char_t>
 inline value_t __parse_floating_point(const std::basic_string<char_t>& str, int sign, xtd::number_styles styles) {
-  long double result;
+  long double result = 0;
   if ((styles & xtd::number_styles::allow_thousands) != xtd::number_styles::allow_thousands)
     result = std::stold(str, nullptr);
   else {
@@ -129,7 +132,7 @@ inline value_t __parse_floating_point(const std::basic_string<char_t>& str, int
 
 template <typename value_t, typename char_t>
 inline value_t __parse_signed(const std::basic_string<char_t>& str, int base, int sign, xtd::number_styles styles) {
-  long long result;
+  long long result = 0;
   if ((styles & xtd::number_styles::allow_thousands) != xtd::number_styles::allow_thousands)
     result = std::stoll(str, nullptr, base);
   else {
@@ -158,6 +161,121 @@ inline value_t __parse_unsigned(const std::basic_string<char_t>& str, int base,
   return static_cast<value_t>(result);
 }
 
+enum class __parse_status {success, failure, not_handled};
+
+inline bool __parse_is_white(char c) noexcept {return c == 9 || c == 10 || c == 11 || c == 12 || c == 13 || c == 32;}
+inline bool __parse_is_sign(char c) noexcept {return c == '+' || c == '-';}
+
+inline bool __parse_is_digit(char c, int base) noexcept {
+  if (base == 2) return c == '0' || c == '1';
+  if (base == 16) return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+  return c >= '0' && c <= '9';
+}
+
+template<typename value_t>
+inline constexpr bool __parse_has_fast_path = std::is_floating_point_v<value_t> || std::is_same_v<value_t, char> || std::is_same_v<value_t, signed char> || std::is_same_v<value_t, unsigned char> || std::is_same_v<value_t, short> || std::is_same_v<value_t, unsigned short> || std::is_same_v<value_t, int> || std::is_same_v<value_t, unsigned int> || std::is_same_v<value_t, long> || std::is_same_v<value_t, unsigned long> || std::is_same_v<value_t, long long> || std::is_same_v<value_t, unsigned long long>;
+
+// Single pass parser over a view of the input for the styles that do not depend on the locale (white spaces, one leading or trailing sign, decimal point, exponent, hex_number and binary_number).
+// It accepts and rejects exactly the strings the general parser accepts and rejects; anything it is not sure about (locale decimal point, thousands, currency, parentheses, octal, repeated signs) is reported as not_handled.
+// It does not allocate and does not throw : on failure the caller either reports it (try_parse) or runs the general parser to throw the detailed exception (parse).
+template <typename value_t, bool unsigned_number>
+inline __parse_status __parse_fast_number(std::string_view str, xtd::number_styles styles, value_t& value) noexcept {
+  auto has_style = [styles](xtd::number_styles style) {return (styles & style) == style;};
+  
+  auto base = 10;
+  if (styles == xtd::number_styles::hex_number) base = 16;
+  else if (styles == xtd::number_styles::binary_number) base = 2;
+  else if ((styles & (xtd::number_styles::allow_parentheses | xtd::number_styles::allow_thousands | xtd::number_styles::allow_currency_symbol | xtd::number_styles::allow_hex_specifier | xtd::number_styles::allow_binary_specifier | xtd::number_styles::allow_octal_specifier)) != xtd::number_styles::none) return __parse_status::not_handled;
+  
+  if (has_style(xtd::number_styles::allow_leading_white))
+    while (!str.empty() && __parse_is_white(str.front())) str.remove_prefix(1);
+  if (has_style(xtd::number_styles::allow_trailing_white))
+    while (!str.empty() && __parse_is_white(str.back())) str.remove_suffix(1);
+  if (base == 16 && (str.starts_with("0x") || str.starts_with("0X"))) str.remove_prefix(2);
+  if (base == 2 && (str.starts_with("0b") || str.starts_with("0B"))) str.remove_prefix(2);
+  
+  auto sign = 0;
+  if (has_style(xtd::number_styles::allow_leading_sign) && !str.empty() && __parse_is_sign(str.front())) {
+    sign = str.front() == '+' ? 1 : -1;
+    str.remove_prefix(1);
+    if (!str.empty() && __parse_is_sign(str.front())) return __parse_status::not_handled;
+  }
+  if (has_style(xtd::number_styles::allow_trailing_sign)) {
+    if (str.empty()) return __parse_status::failure;
+    if (__parse_is_sign(str.back())) {
+      if (sign != 0) return __parse_status::failure;
+      sign = str.back() == '+' ? 1 : -1;
+      str.remove_suffix(1);
+      if (str.empty() || str.back() == '-' || (sign > 0 && str.back() == '+')) return __parse_status::failure;
+      if (str.back() == '+') return __parse_status::not_handled;
+    }
+  }
+  if (unsigned_number && sign < 0) return __parse_status::failure;
+  
+  if (!std::is_floating_point_v<value_t> && !has_style(xtd::number_styles::allow_exponent)) {
+    for (auto c : str)
+      if (!__parse_is_digit(c, base)) return has_style(xtd::number_styles::allow_decimal_point) ? __parse_status::not_handled : __parse_status::failure;
+    
+    if constexpr (unsigned_number) {
+      auto result = 0ull;
+      if (std::from_chars(str.data(), str.data() + str.size(), result, base).ec != std::errc {}) return __parse_status::failure;
+      if (result > static_cast<unsigned long long>(std::numeric_limits<value_t>::max())) return __parse_status::failure;
+      value = static_cast<value_t>(result);
+    } else {
+      auto result = 0ll;
+      if (std::from_chars(str.data(), str.data() + str.size(), result, base).ec != std::errc {}) return __parse_status::failure;
+      result = sign < 0 ? -result : result;
+      if (result < static_cast<long long>(std::numeric_limits<value_t>::lowest()) || result > static_cast<long long>(std::numeric_limits<value_t>::max())) return __parse_status::failure;
+      value = static_cast<value_t>(result);
+    }
+    return __parse_status::success;
+  }
+  
+  if (base != 10) return __parse_status::not_handled;
+  auto decimal_point_found = false;
+  for (auto c : str) {
+    if (c >= '0' && c <= '9') continue;
+    if (c == '.' && has_style(xtd::number_styles::allow_decimal_point)) {
+      if (decimal_point_found) return __parse_status::not_handled;
+      decimal_point_found = true;
+    } else if ((c == 'e' || c == 'E' || __parse_is_sign(c)) && has_style(xtd::number_styles::allow_exponent)) continue;
+    else return has_style(xtd::number_styles::allow_decimal_point) ? __parse_status::not_handled : __parse_status::failure;
+  }
+  if (has_style(xtd::number_styles::allow_exponent)) {
+    auto index = str.find('+');
+    if (index == std::string_view::npos) index = str.find('-');
+    if (index != std::string_view::npos && (index == 0 || (str[index - 1] != 'e' && str[index - 1] != 'E'))) return __parse_status::failure;
+  }
+  
+  // Like std::stold, the longest valid prefix is converted. float and double are read as double, which std::from_chars converts much faster than long double.
+  using result_t = std::conditional_t<std::is_same_v<value_t, float> || std::is_same_v<value_t, double>, double, long double>;
+  auto result = result_t {};
+  auto [ptr, error] = std::from_chars(str.data(), str.data() + str.size(), result);
+  if (error == std::errc::invalid_argument) return __parse_status::failure;
+  if (error != std::errc {}) return __parse_status::not_handled;
+  result = sign < 0 ? -result : result;
+  if (result < std::numeric_limits<value_t>::lowest() || result > std::numeric_limits<value_t>::max()) return __parse_status::failure;
+  value = static_cast<value_t>(result);
+  return __parse_status::success;
+}
+
+template <typename value_t>
+inline __parse_status __parse_try_fast_number(std::string_view str, xtd::number_styles styles, value_t& value) noexcept {
+  if constexpr (std::is_floating_point_v<value_t>) {
+    if ((styles & xtd::number_styles::binary_number) == xtd::number_styles::binary_number || (styles & xtd::number_styles::octal_number) == xtd::number_styles::octal_number || (styles & xtd::number_styles::hex_number) == xtd::number_styles::hex_number) return __parse_status::failure;
+    if (str == "inf") value = std::numeric_limits<value_t>::infinity();
+    else if (str == "-inf") value = -std::numeric_limits<value_t>::infinity();
+    else if (str == "nan") value = std::numeric_limits<value_t>::quiet_NaN();
+    else return __parse_fast_number<value_t, false>(str, styles, value);
+    return __parse_status::success;
+  } else if constexpr (__parse_has_fast_path<value_t>) {
+    if ((styles & xtd::number_styles::allow_binary_specifier) == xtd::number_styles::allow_binary_specifier && (styles - xtd::number_styles::binary_number) != xtd::number_styles::none) return __parse_status::failure;
+    if ((styles & xtd::number_styles::allow_octal_specifier) == xtd::number_styles::allow_octal_specifier && (styles - xtd::number_styles::octal_number) != xtd::number_styles::none) return __parse_status::failure;
+    if ((styles & xtd::number_styles::allow_hex_specifier) == xtd::number_styles::allow_hex_specifier && (styles - xtd::number_styles::hex_number) != xtd::number_styles::none) return __parse_status::failure;
+    return __parse_fast_number<value_t, std::is_unsigned_v<value_t> && !std::is_same_v<value_t, char>>(str, styles, value);
+  } else return __parse_status::not_handled;
+}
+
 template <typename value_t, typename char_t>
 inline value_t __parse_floating_point_number(const std::basic_string<char_t>& s, xtd::number_styles styles, const std::locale& locale) {
   if ((styles & xtd::number_styles::binary_number) == xtd::number_styles::binary_number) __throw_parse_format_exception("xtd::number_styles::binary_number not supported by floating point", __FILE__, __LINE__, __func__);
@@ -171,12 +289,17 @@ inline value_t __parse_floating_point_number(const std::basic_string<char_t>& s,
   if (s == "-inf") return -std::numeric_limits<value_t>::infinity();
   if (s == "nan") return std::numeric_limits<value_t>::quiet_NaN();
   
+  if constexpr (std::is_same_v<char_t, char>) {
+    auto value = value_t {};
+    if (__parse_fast_number<value_t, false>(s, styles, value) == __parse_status::success) return value;
+  }
+  
   std::basic_string<char_t> str = __parse_remove_decorations(s, styles);
   int sign = __parse_remove_signs(str, styles);
   
   __parse_check_valid_characters(str, styles);
   
-  long double result;
+  long double result = 0;
   if ((styles & xtd::number_styles::allow_thousands) != xtd::number_styles::allow_thousands)
     result = std::stold(str, nullptr);
   else {
@@ -201,6 +324,11 @@ inline value_t __parse_number(const std::basic_string<char_t>& s, xtd::number_st
   if ((styles & xtd::number_styles::octal_number) == xtd::number_styles::octal_number) base = 8;
   if ((styles & xtd::number_styles::hex_number) == xtd::number_styles::hex_number) base = 16;
   
+  if constexpr (std::is_same_v<char_t, char>) {
+    auto value = value_t {};
+    if (__parse_fast_number<value_t, false>(s, styles, value) == __parse_status::success) return value;
+  }
+  
   std::basic_string<char_t> str = __parse_remove_decorations(s, styles);
   int sign = __parse_remove_signs(str, styles);
   
@@ -221,6 +349,11 @@ inline value_t __parse_unsigned_number(const std::basic_string<char_t>& s, xtd::
   if ((styles & xtd::number_styles::octal_number) == xtd::number_styles::octal_number) base = 8;
   if ((styles & xtd::number_styles::hex_number) == xtd::number_styles::hex_number) base = 16;
   
+  if constexpr (std::is_same_v<char_t, char>) {
+    auto value = value_t {};
+    if (__parse_fast_number<value_t, true>(s, styles, value) == __parse_status::success) return value;
+  }
+  
   std::basic_string<char_t> str = __parse_remove_decorations(s, styles);
   if (__parse_remove_signs(str, styles) < 0) __throw_parse_format_exception("unsigned type can't have minus sign", __FILE__, __LINE__, __func__);
   
@@ -0,0 +1,79 @@
+/// @file
+/// @brief Contains __to_chars_formatter methods.
+#pragma once
+/// @cond
+#if !defined(__XTD_CORE_INTERNAL__)
+#error "Do not include this file: Internal use only"
+#endif
+/// @endcond
+
+#include <charconv>
+#include <clocale>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+/// @cond
+// Digits are written by std::to_chars into a stack buffer and copied once into the result; nothing here goes through printf.
+constexpr size_t __to_chars_buffer_size = 128;
+
+template<typename char_t>
+inline bool __to_chars_is_one_of(char_t c, const char* chars) noexcept {
+  for (; *chars; ++chars)
+    if (c == static_cast<char_t>(*chars)) return true;
+  return false;
+}
+
+template<typename char_t>
+inline char_t __to_chars_to_upper(char c, bool upper) noexcept {
+  return static_cast<char_t>(upper && c >= 'a' && c <= 'z' ? c - 'a' + 'A' : c);
+}
+
+// Same output as printf "%0*ll[dou]" / "%0*llx" / "%0*llX" : a positive width pads with zeros after the sign, a negative width pads with spaces on the right.
+template<typename char_t>
+inline std::basic_string<char_t> __to_chars_integer(unsigned long long magnitude, bool negative, int base, bool upper, int width) {
+  char digits[__to_chars_buffer_size];
+  auto count = static_cast<size_t>(std::to_chars(digits, digits + sizeof(digits), magnitude, base).ptr - digits);
+  auto length = count + (negative ? 1 : 0);
+  auto absolute_width = static_cast<size_t>(std::abs(width));
+  auto padding = absolute_width > length ? absolute_width - length : 0;
+  auto result = std::basic_string<char_t>(length + padding, static_cast<char_t>(width < 0 ? ' ' : '0'));
+  auto position = size_t {0};
+  if (negative) result[position++] = static_cast<char_t>('-');
+  if (width > 0) position += padding;
+  for (auto index = size_t {0}; index < count; ++index)
+    result[position++] = __to_chars_to_upper<char_t>(digits[index], upper);
+  return result;
+}
+
+template<typename char_t>
+inline std::basic_string<char_t> __to_chars_signed_integer(long long value, int base, bool upper, int width) {
+  auto negative = value < 0;
+  auto magnitude = negative ? 0ull - static_cast<unsigned long long>(value) : static_cast<unsigned long long>(value);
+  return __to_chars_integer<char_t>(magnitude, negative, base, upper, width);
+}
+
+// Same output as printf "%.*L[eEfFgG]" for finite values. Returns false when the caller has to fall back to printf (infinity, nan or output larger than the stack buffer).
+template<typename char_t>
+inline bool __to_chars_floating_point(std::basic_string<char_t>& result, long double value, std::chars_format format, int precision, bool upper) {
+  if (!std::isfinite(value) || precision < 0) return false;
+  char chars[__to_chars_buffer_size];
+  auto [end, error] = std::to_chars(chars, chars + sizeof(chars), value, format, precision);
+  if (error != std::errc {}) return false;
+
+  // printf uses the decimal point of the current C locale.
+  const char* decimal_point = std::localeconv()->decimal_point;
+  auto decimal_point_length = decimal_point && *decimal_point ? std::strlen(decimal_point) : 0;
+  auto is_default_decimal_point = decimal_point_length == 0 || (decimal_point_length == 1 && *decimal_point == '.');
+
+  result.reserve(result.size() + static_cast<size_t>(end - chars) + (is_default_decimal_point ? 0 : decimal_point_length));
+  for (auto iterator = chars; iterator != end; ++iterator) {
+    if (*iterator == '.' && !is_default_decimal_point) {
+      for (auto index = size_t {0}; index < decimal_point_length; ++index)
+        result += static_cast<char_t>(static_cast<unsigned char>(decimal_point[index]));
+    } else result += __to_chars_to_upper<char_t>(*iterator, upper);
+  }
+  return true;
+}
+/// @endcond
@@ -0,0 +1,300 @@
+/// @file
+/// @brief Contains unicode transcoding functions.
+/// @copyright Copyright (c) 2024 Gammasoft. All rights reserved.
+
+#pragma once
+/// @cond
+#if !defined(__XTD_CORE_INTERNAL__)
+#error "Do not include this file: Internal use only"
+#endif
+/// @endcond
+
+#include "../char32.h"
+#include "../size.h"
+#include "../types.h"
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+/// @cond
+// Transcoding between the UTF-8, UTF-16 and UTF-32 encodings of xtd::basic_string.
+// The code units are decoded according to their size : UTF-8 for one-byte characters, UTF-16 for two-byte characters and UTF-32 otherwise.
+// The sources are validated : an ill-formed sequence is either reported or replaced by U+FFFD, one replacement character per maximal subpart as recommended by the Unicode Standard.
+// Blocks of eight ASCII code units are detected in 64-bit words (SWAR) and copied without being decoded. The other code points are decoded and encoded one by one.
+enum class __xtd_transcoding_status {
+  done,
+  destination_too_small,
+  need_more_data,
+  invalid_data,
+};
+
+constexpr xtd::uint64 __xtd_ascii_low_bits = 0x0101010101010101ull;
+constexpr xtd::uint64 __xtd_ascii_high_bits = 0x8080808080808080ull;
+constexpr xtd::size __xtd_ascii_block_size = 8;
+constexpr xtd::char32 __xtd_replacement_character = 0xfffd;
+constexpr xtd::char32 __xtd_invalid_sequence = 0xffffffff;
+constexpr xtd::char32 __xtd_incomplete_sequence = 0xfffffffe;
+
+inline bool __xtd_is_ascii_word(xtd::uint64 word) noexcept {return (word & __xtd_ascii_high_bits) == 0;}
+
+// Returns the number of bytes of bits whose high bit is set; the other bits of bits must be zero.
+inline xtd::size __xtd_count_high_bits(xtd::uint64 bits) noexcept {return static_cast<xtd::size>(((bits >> 7) * __xtd_ascii_low_bits) >> 56);}
+
+template<typename char_t>
+inline xtd::uint64 __xtd_load_word(const char_t* data) noexcept {
+  auto word = xtd::uint64 {0};
+  std::memcpy(&word, data, sizeof(word));
+  return word;
+}
+
+template<typename char_t>
+inline bool __xtd_is_ascii_unit(char_t value) noexcept {return static_cast<std::make_unsigned_t<char_t>>(value) < 0x80;}
+
+// Returns true if the __xtd_ascii_block_size code units starting at data are ASCII characters.
+template<typename char_t>
+inline bool __xtd_is_ascii_block(const char_t* data) noexcept {
+  constexpr auto non_ascii_bits = sizeof(char_t) == 1 ? __xtd_ascii_high_bits : sizeof(char_t) == 2 ? 0xff80ff80ff80ff80ull : 0xffffff80ffffff80ull;
+  auto word = xtd::uint64 {0};
+  for (auto index = xtd::size {0}; index < sizeof(char_t); ++index)
+    word |= __xtd_load_word(data + index * sizeof(xtd::uint64) / sizeof(char_t));
+  return (word & non_ascii_bits) == 0;
+}
+
+// Returns the index of the first code unit of data in [index, count) that is not an ASCII character; otherwise count.
+template<typename char_t>
+inline xtd::size __xtd_skip_ascii(const char_t* data, xtd::size count, xtd::size index) noexcept {
+  while (count - index >= __xtd_ascii_block_size && __xtd_is_ascii_block(data + index))
+    index += __xtd_ascii_block_size;
+  while (index < count && __xtd_is_ascii_unit(data[index]))
+    ++index;
+  return index;
+}
+
+// Decodes the code point whose sequence starts at data[index] and sets length to the number of code units of the sequence.
+// An ill-formed sequence returns __xtd_invalid_sequence and a sequence cut by the end of data returns __xtd_incomplete_sequence; length is then the length of its maximal subpart.
+template<typename char_t>
+inline xtd::char32 __xtd_decode_sequence(const char_t* data, xtd::size count, xtd::size index, xtd::size& length) noexcept {
+  length = 1;
+  if constexpr (sizeof(char_t) == 1) {
+    auto unit = static_cast<xtd::char32>(static_cast<unsigned char>(data[index]));
+    if (unit < 0x80) return unit;
+    if (unit < 0xc2 || unit > 0xf4) return __xtd_invalid_sequence;
+    if (index + 1 >= count) return __xtd_incomplete_sequence;
+    auto second = static_cast<xtd::char32>(static_cast<unsigned char>(data[index + 1]));
+    if (unit < 0xe0) {
+      if ((second & 0xc0) != 0x80) return __xtd_invalid_sequence;
+      length = 2;
+      return ((unit & 0x1f) << 6) | (second & 0x3f);
+    }
+    // The range of the second code unit excludes the overlong forms, the surrogates and the code points greater than U+10FFFF.
+    auto lower = unit == 0xe0 ? 0xa0u : unit == 0xf0 ? 0x90u : 0x80u;
+    auto upper = unit == 0xed ? 0x9fu : unit == 0xf4 ? 0x8fu : 0xbfu;
+    if (second < lower || second > upper) return __xtd_invalid_sequence;
+    length = 2;
+    if (index + 2 >= count) return __xtd_incomplete_sequence;
+    auto third = static_cast<xtd::char32>(static_cast<unsigned char>(data[index + 2]));
+    if ((third & 0xc0) != 0x80) return __xtd_invalid_sequence;
+    length = 3;
+    if (unit < 0xf0) return ((unit & 0x0f) << 12) | ((second & 0x3f) << 6) | (third & 0x3f);
+    if (index + 3 >= count) return __xtd_incomplete_sequence;
+    auto fourth = static_cast<xtd::char32>(static_cast<unsigned char>(data[index + 3]));
+    if ((fourth & 0xc0) != 0x80) return __xtd_invalid_sequence;
+    length = 4;
+    return ((unit & 0x07) << 18) | ((second & 0x3f) << 12) | ((third & 0x3f) << 6) | (fourth & 0x3f);
+  } else if constexpr (sizeof(char_t) == 2) {
+    auto unit = static_cast<xtd::char32>(static_cast<xtd::uint16>(data[index]));
+    if (unit < 0xd800 || unit > 0xdfff) return unit;
+    if (unit > 0xdbff) return __xtd_invalid_sequence;
+    if (index + 1 >= count) return __xtd_incomplete_sequence;
+    auto low = static_cast<xtd::char32>(static_cast<xtd::uint16>(data[index + 1]));
+    if (low < 0xdc00 || low > 0xdfff) return __xtd_invalid_sequence;
+    length = 2;
+    return 0x10000 + ((unit - 0xd800) << 10) + (low - 0xdc00);
+  } else {
+    auto unit = static_cast<xtd::char32>(data[index]);
+    return unit <= 0x10ffff && (unit < 0xd800 || unit > 0xdfff) ? unit : __xtd_invalid_sequence;
+  }
+}
+
+// Returns the number of code units of the encoding of code_point.
+template<typename char_t>
+inline xtd::size __xtd_encoded_length(xtd::char32 code_point) noexcept {
+  if constexpr (sizeof(char_t) == 1) return code_point < 0x80 ? 1 : code_point < 0x800 ? 2 : code_point < 0x10000 ? 3 : 4;
+  else if constexpr (sizeof(char_t) == 2) return code_point < 0x10000 ? 1 : 2;
+  else return 1;
+}
+
+// Encodes code_point into units and returns the number of code units written (at most four).
+template<typename char_t>
+inline xtd::size __xtd_encode_code_point(char_t* units, xtd::char32 code_point) noexcept {
+  if constexpr (sizeof(char_t) == 1) {
+    if (code_point < 0x80) {
+      units[0] = static_cast<char_t>(code_point);
+      return 1;
+    }
+    if (code_point < 0x800) {
+      units[0] = static_cast<char_t>(0xc0 | (code_point >> 6));
+      units[1] = static_cast<char_t>(0x80 | (code_point & 0x3f));
+      return 2;
+    }
+    if (code_point < 0x10000) {
+      units[0] = static_cast<char_t>(0xe0 | (code_point >> 12));
+      units[1] = static_cast<char_t>(0x80 | ((code_point >> 6) & 0x3f));
+      units[2] = static_cast<char_t>(0x80 | (code_point & 0x3f));
+      return 3;
+    }
+    units[0] = static_cast<char_t>(0xf0 | (code_point >> 18));
+    units[1] = static_cast<char_t>(0x80 | ((code_point >> 12) & 0x3f));
+    units[2] = static_cast<char_t>(0x80 | ((code_point >> 6) & 0x3f));
+    units[3] = static_cast<char_t>(0x80 | (code_point & 0x3f));
+    return 4;
+  } else if constexpr (sizeof(char_t) == 2) {
+    if (code_point < 0x10000) {
+      units[0] = static_cast<char_t>(code_point);
+      return 1;
+    }
+    units[0] = static_cast<char_t>(0xd800 + ((code_point - 0x10000) >> 10));
+    units[1] = static_cast<char_t>(0xdc00 + ((code_point - 0x10000) & 0x3ff));
+    return 2;
+  } else {
+    units[0] = static_cast<char_t>(code_point);
+    return 1;
+  }
+}
+
+// Returns true if the count code units of data do not contain any ill-formed or cut sequence.
+template<typename char_t>
+inline bool __xtd_is_well_formed(const char_t* data, xtd::size count) noexcept {
+  auto index = xtd::size {0};
+  while (index < count) {
+    if (__xtd_is_ascii_unit(data[index])) {
+      index = __xtd_skip_ascii(data, count, index);
+      continue;
+    }
+    auto sequence_length = xtd::size {0};
+    if (__xtd_decode_sequence(data, count, index, sequence_length) > 0x10ffff) return false;
+    index += sequence_length;
+  }
+  return true;
+}
+
+// Returns the number of target_t code units of the transcoding of the count code units of data, the ill-formed sequences being replaced by U+FFFD.
+template<typename target_t, typename source_t>
+inline xtd::size __xtd_transcoded_length(const source_t* data, xtd::size count) noexcept {
+  auto length = xtd::size {0};
+  auto index = xtd::size {0};
+  while (index < count) {
+    if (__xtd_is_ascii_unit(data[index])) {
+      auto ascii_end = __xtd_skip_ascii(data, count, index);
+      length += ascii_end - index;
+      index = ascii_end;
+      continue;
+    }
+    auto sequence_length = xtd::size {0};
+    auto code_point = __xtd_decode_sequence(data, count, index, sequence_length);
+    length += __xtd_encoded_length<target_t>(code_point > 0x10ffff ? __xtd_replacement_character : code_point);
+    index += sequence_length;
+  }
+  return length;
+}
+
+// Returns the number of target_t code units of the transcoding of the UTF-16 or UTF-32 code unit minus one, provided that the code unit is part of a well-formed sequence.
+// The difference wraps around for the second code unit of a UTF-16 surrogate pair, which is not counted for UTF-32.
+template<typename target_t, typename source_t>
+inline xtd::size __xtd_well_formed_transcoded_length_difference(source_t value) noexcept {
+  if constexpr (sizeof(source_t) == 2) {
+    auto unit = static_cast<xtd::uint16>(value);
+    if constexpr (sizeof(target_t) == 1) return (unit >= 0x80) + (unit >= 0x800) - (unit >= 0xd800 && unit <= 0xdfff);
+    else return xtd::size {0} - (unit >= 0xdc00 && unit <= 0xdfff);
+  } else {
+    auto unit = static_cast<xtd::char32>(value);
+    if constexpr (sizeof(target_t) == 1) return (unit >= 0x80) + (unit >= 0x800) + (unit >= 0x10000);
+    else return unit >= 0x10000;
+  }
+}
+
+// Returns the number of target_t code units of the transcoding of the count code units of data, provided that data is well-formed.
+// Unlike __xtd_transcoded_length, the code points are not decoded : the length is deduced from the ranges of the code units, eight bytes at a time in a 64-bit word (SWAR) for UTF-8. For UTF-16 and UTF-32, the blocks of ASCII characters are skipped.
+template<typename target_t, typename source_t>
+inline xtd::size __xtd_well_formed_transcoded_length(const source_t* data, xtd::size count) noexcept {
+  auto length = count;
+  auto index = xtd::size {0};
+  if constexpr (sizeof(source_t) == 1) {
+    // A code point is one UTF-16 or UTF-32 code unit, except the four-byte code points that are two UTF-16 code units : the continuation bytes are not counted and the four-byte leading bytes are counted twice for UTF-16.
+    for (; count - index >= sizeof(xtd::uint64); index += sizeof(xtd::uint64)) {
+      auto word = __xtd_load_word(data + index);
+      length -= __xtd_count_high_bits(word & ~(word << 1) & __xtd_ascii_high_bits);
+      if constexpr (sizeof(target_t) == 2) length += __xtd_count_high_bits(word & (word << 1) & (word << 2) & (word << 3) & __xtd_ascii_high_bits);
+    }
+    for (; index < count; ++index) {
+      auto unit = static_cast<unsigned char>(data[index]);
+      length -= (unit & 0xc0) == 0x80;
+      if constexpr (sizeof(target_t) == 2) length += unit >= 0xf0;
+    }
+  } else if constexpr (sizeof(source_t) != sizeof(target_t)) {
+    // A block of ASCII characters has the same length in every encoding : only the code units of the other blocks are measured.
+    for (; count - index >= __xtd_ascii_block_size; index += __xtd_ascii_block_size)
+      if (!__xtd_is_ascii_block(data + index))
+        for (auto unit_index = index; unit_index < index + __xtd_ascii_block_size; ++unit_index)
+          length += __xtd_well_formed_transcoded_length_difference<target_t>(data[unit_index]);
+    for (; index < count; ++index)
+      length += __xtd_well_formed_transcoded_length_difference<target_t>(data[index]);
+  }
+  return length;
+}
+
+// Transcodes the source_count code units of source into the target_count code units of target. On return, read and written are the numbers of code units read from source and written to target.
+// The transcoding stops before the first ill-formed sequence if replace_invalid is false, and before a sequence cut by the end of source if is_final_block is false.
+template<typename target_t, typename source_t>
+inline __xtd_transcoding_status __xtd_transcode(const source_t* source, xtd::size source_count, xtd::size& read, target_t* target, xtd::size target_count, xtd::size& written, bool replace_invalid, bool is_final_block) noexcept {
+  read = 0;
+  written = 0;
+  while (read < source_count) {
+    if (__xtd_is_ascii_unit(source[read])) {
+      // A 64-bit word holds only two UTF-32 code units : they are copied one by one.
+      if constexpr (sizeof(source_t) < 4) {
+        while (source_count - read >= __xtd_ascii_block_size && target_count - written >= __xtd_ascii_block_size && __xtd_is_ascii_block(source + read)) {
+          for (auto index = xtd::size {0}; index < __xtd_ascii_block_size; ++index)
+            target[written + index] = static_cast<target_t>(source[read + index]);
+          read += __xtd_ascii_block_size;
+          written += __xtd_ascii_block_size;
+        }
+      }
+      for (; read < source_count && __xtd_is_ascii_unit(source[read]); ++read) {
+        if (written == target_count) return __xtd_transcoding_status::destination_too_small;
+        target[written++] = static_cast<target_t>(source[read]);
+      }
+      continue;
+    }
+    auto sequence_length = xtd::size {0};
+    auto code_point = __xtd_decode_sequence(source, source_count, read, sequence_length);
+    if (code_point == __xtd_incomplete_sequence && !is_final_block) return __xtd_transcoding_status::need_more_data;
+    if (code_point > 0x10ffff) {
+      if (!replace_invalid) return __xtd_transcoding_status::invalid_data;
+      code_point = __xtd_replacement_character;
+    }
+    if (target_count - written < 4 && target_count - written < __xtd_encoded_length<target_t>(code_point)) return __xtd_transcoding_status::destination_too_small;
+    written += __xtd_encode_code_point(target + written, code_point);
+    read += sequence_length;
+  }
+  return __xtd_transcoding_status::done;
+}
+
+// Returns the transcoding of the count code units of data, the ill-formed sequences being replaced by U+FFFD.
+// The result is allocated with the length of a well-formed source. Only when the replacement characters of ill-formed sequences do not fit, the rest of the source is measured exactly and the result is enlarged once.
+template<typename target_t, typename source_t>
+inline std::basic_string<target_t> __xtd_transcode_to_string(const source_t* data, xtd::size count) {
+  auto result = std::basic_string<target_t>(__xtd_well_formed_transcoded_length<target_t>(data, count), target_t {});
+  auto read = xtd::size {0};
+  auto written = xtd::size {0};
+  if (__xtd_transcode(data, count, read, result.data(), result.size(), written, true, true) == __xtd_transcoding_status::destination_too_small) {
+    result.resize(written + __xtd_transcoded_length<target_t>(data + read, count - read));
+    auto remaining_read = xtd::size {0};
+    auto remaining_written = xtd::size {0};
+    __xtd_transcode(data + read, count - read, remaining_read, result.data() + written, result.size() - written, remaining_written, true, true);
+    written += remaining_written;
+  }
+  result.resize(written);
+  return result;
+}
+/// @endcond
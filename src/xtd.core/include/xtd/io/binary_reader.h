@@ -2,13 +2,16 @@
 /// @brief Contains xtd::io::binary_reader class.
 /// @copyright Copyright (c) 2024 Gammasoft. All rights reserved.
 #pragma once
+#include "memory_mapped_view_accessor.h"
 #include "../optional.h"
 #include "../object.h"
 #include "../string.h"
 #include <iostream>
 #include <fstream>
-#include <vector>
+#include <span>
 #include <stack>
+#include <type_traits>
+#include <vector>
 
 /// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
 namespace xtd {
@@ -54,6 +57,11 @@ namespace xtd {
       /// @include binary_reader.cpp
       /// @remarks For a list of common I/O tasks, see [Common I/O Tasks](https://gammasoft71.github.io/xtd/docs/documentation/Guides/xtd.core/Common%20I%3AO%20tasks).
       explicit binary_reader(std::istream& stream);
+      /// @brief Initializes a new instance of the xtd::io::binary_reader class for the specified memory-mapped view.
+      /// @param view The memory-mapped view to be read.
+      /// @remarks The content of the view is read in place, without being copied into an intermediate buffer. The xtd::io::binary_reader keeps the view mapped until it is destroyed.
+      /// @remarks For a list of common I/O tasks, see [Common I/O Tasks](https://gammasoft71.github.io/xtd/docs/documentation/Guides/xtd.core/Common%20I%3AO%20tasks).
+      explicit binary_reader(const xtd::io::memory_mapped_view_accessor& view);
       /// @}
       /// @cond
       binary_reader(const binary_reader&) = delete;
@@ -122,6 +130,33 @@ namespace xtd {
       /// @remarks For a list of common I/O tasks, see [Common I/O Tasks](https://gammasoft71.github.io/xtd/docs/documentation/Guides/xtd.core/Common%20I%3AO%20tasks).
       virtual size_t read(std::vector<char>& buffer, size_t index, size_t count);
       
+      /// @brief Reads bytes from the stream into the specified span.
+      /// @param buffer The span to read data into.
+      /// @return The number of bytes read into buffer. This might be less than the size of buffer if that many bytes are not available, or it might be zero if the end of the stream is reached.
+      /// @exception xtd::io_io_exception An I/O error occurred.
+      /// @remarks The bytes are copied from the stream buffer with one call, instead of one call per byte.
+      /// @remarks For a list of common I/O tasks, see [Common I/O Tasks](https://gammasoft71.github.io/xtd/docs/documentation/Guides/xtd.core/Common%20I%3AO%20tasks).
+      virtual size_t read(std::span<xtd::byte> buffer);
+      
+      /// @brief Reads characters from the stream into the specified span.
+      /// @param buffer The span to read data into.
+      /// @return The number of characters read into buffer. This might be less than the size of buffer if that many characters are not available, or it might be zero if the end of the stream is reached.
+      /// @exception xtd::io_io_exception An I/O error occurred.
+      /// @remarks For a list of common I/O tasks, see [Common I/O Tasks](https://gammasoft71.github.io/xtd/docs/documentation/Guides/xtd.core/Common%20I%3AO%20tasks).
+      virtual size_t read(std::span<char> buffer);
+      
+      /// @brief Reads an array of values of a trivially copyable type from the stream into the specified span.
+      /// @param values The span to read values into.
+      /// @return The number of values read into values. This might be less than the size of values if the end of the stream is reached.
+      /// @exception xtd::io_io_exception An I/O error occurred.
+      /// @remarks The values are read as they are represented in memory, as written by xtd::io::binary_writer::write_array.
+      /// @remarks For a list of common I/O tasks, see [Common I/O Tasks](https://gammasoft71.github.io/xtd/docs/documentation/Guides/xtd.core/Common%20I%3AO%20tasks).
+      template<typename type_t>
+      size_t read_array(std::span<type_t> values) {
+        static_assert(std::is_trivially_copyable_v<type_t>, "type_t must be trivially copyable");
+        return read(std::span<xtd::byte> {reinterpret_cast<xtd::byte*>(values.data()), values.size_bytes()}) / sizeof(type_t);
+      }
+      
       /// @brief Reads a boolean value from the current stream and advances the current position of the stream by one byte.
       /// @return true if the byte is nonzero; otherwise, false.
       /// @exception EndOfStreamException The end of the stream is reached.
@@ -274,9 +309,13 @@ namespace xtd {
       /// @endcond
       
     private:
+      template<typename type_t>
+      type_t read_value();
+      
       std::istream* stream_ = nullptr;
       std::stack<std::streampos> pos_stack_;
       bool delete_when_destroy_ = false;
+      xtd::sptr<std::streambuf> view_buffer_;
     };
   }
 }
@@ -10,6 +10,8 @@
 #include "../string.h"
 #include <fstream>
 #include <array>
+#include <span>
+#include <type_traits>
 #include <vector>
 
 /// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
@@ -110,8 +112,7 @@ namespace xtd {
       /// @remarks For a list of common I/O tasks, see [Common I/O Tasks](https://gammasoft71.github.io/xtd/docs/documentation/Guides/xtd.core/Common%20I%3AO%20tasks).
       template<size_t size>
       void write(const std::array<xtd::byte, size>& buffer) {
-        for (auto b : buffer)
-          write(b);
+        write(std::span<const xtd::byte> {buffer});
       }
       
       /// @brief Writes a character array to the underlying stream.
@@ -120,8 +121,7 @@ namespace xtd {
       /// @remarks For a list of common I/O tasks, see [Common I/O Tasks](https://gammasoft71.github.io/xtd/docs/documentation/Guides/xtd.core/Common%20I%3AO%20tasks).
       template<size_t size>
       void write(const std::array<char, size>& buffer) {
-        for (auto c : buffer)
-          write(c);
+        write(std::span<const char> {buffer});
       }
       
       /// @brief Writes a byte array to the underlying stream.
@@ -154,6 +154,17 @@ namespace xtd {
       /// @remarks For a list of common I/O tasks, see [Common I/O Tasks](https://gammasoft71.github.io/xtd/docs/documentation/Guides/xtd.core/Common%20I%3AO%20tasks).
       virtual void write(const std::vector<char>& buffer, size_t index, size_t count);
       
+      /// @brief Writes a span of bytes to the current stream.
+      /// @param buffer A span containing the data to write.
+      /// @exception xtd::io::io_exception An I/O error occurs.
+      /// @remarks The bytes are copied to the stream buffer with one call, instead of one call per byte.
+      virtual void write(std::span<const xtd::byte> buffer);
+      
+      /// @brief Writes a span of characters to the current stream.
+      /// @param buffer A span containing the characters to write.
+      /// @exception xtd::io::io_exception An I/O error occurs.
+      virtual void write(std::span<const char> buffer);
+      
       /// @brief Writes an eight-byte floating-point value to the current stream and advances the stream position by eight bytes.
       /// @param value The eight-byte floating-point value to write.
       /// @exception xtd::io::io_exception An I/O error occurs.
@@ -229,6 +240,16 @@ namespace xtd {
       /// @exception xtd::io::io_exception An I/O error occurs.
       /// @remarks For a list of common I/O tasks, see [Common I/O Tasks](https://gammasoft71.github.io/xtd/docs/documentation/Guides/xtd.core/Common%20I%3AO%20tasks).
       virtual void write(uint64 value);
+      
+      /// @brief Writes an array of values of a trivially copyable type to the current stream.
+      /// @param values A span containing the values to write.
+      /// @exception xtd::io::io_exception An I/O error occurs.
+      /// @remarks The values are written as they are represented in memory, with one call to the stream. Use xtd::io::binary_reader::read_array to read them back.
+      template<typename type_t>
+      void write_array(std::span<const type_t> values) {
+        static_assert(std::is_trivially_copyable_v<type_t>, "type_t must be trivially copyable");
+        write(std::span<const xtd::byte> {reinterpret_cast<const xtd::byte*>(values.data()), values.size_bytes()});
+      }
       /// @}
       
       /// @cond
@@ -268,6 +289,9 @@ namespace xtd {
       /// @endcond
       
     private:
+      template<typename type_t>
+      void write_value(type_t value);
+      
       std::ostream* stream_ = nullptr;
       bool delete_when_destroy_ = false;
     };
@@ -4,6 +4,7 @@
 #pragma once
 #include "file_attributes.h"
 #include "file_permissions.h"
+#include "memory_mapped_view_accessor.h"
 #include "stream_reader.h"
 #include "stream_writer.h"
 #include "../chrono.h"
@@ -165,6 +166,15 @@ namespace xtd {
       /// @exception xtd::io::file_not_found_exception if file src does not exists.
       static xtd::io::file_permissions get_permissions(const xtd::string& path);
       
+      /// @brief Maps a file into memory and returns a read-only view over its whole content, without copying it.
+      /// @param path The file to map.
+      /// @return A read-only view over the content of the file. The view is empty if the file is empty.
+      /// @exception xtd::io::file_not_found_exception if path does not exists.
+      /// @exception xtd::argument_exception path contains one or more of the invalid characters<br>-or-<br>The system could not retrieve the absolute path.
+      /// @exception xtd::io::io_exception the specified file cannot be opened or mapped.
+      /// @remarks Unlike xtd::io::file::read_all_bytes, the content is not read up front : pages are loaded on first access and shared with the page cache of the operating system. Use xtd::io::memory_mapped_view_accessor::as_span or xtd::io::memory_mapped_view_accessor::as_string_view to access the content, or xtd::io::binary_reader to read it.
+      static xtd::io::memory_mapped_view_accessor map_all_bytes(const xtd::string& path);
+      
       /// @brief Moves a specified file to a new location, providing the option to specify a new file name.
       /// @param src The name of the file to move.
       /// @param dest The new path for the file.
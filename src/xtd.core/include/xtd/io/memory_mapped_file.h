@@ -0,0 +1,118 @@
+/// @file
+/// @brief Contains xtd::io::memory_mapped_file class.
+/// @copyright Copyright (c) 2024 Gammasoft. All rights reserved.
+#pragma once
+#include "file_access.h"
+#include "memory_mapped_view_accessor.h"
+#include "../object.h"
+#include "../sptr.h"
+#include "../string.h"
+
+/// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
+namespace xtd {
+  /// @brief The xtd::io namespace contains types that allow reading and writing to files and data streams, and types that provide basic file and directory support.
+  namespace io {
+    /// @brief Represents a memory-mapped file.
+    /// ```cpp
+    /// class core_export_ memory_mapped_file : public xtd::object
+    /// ```
+    /// @par Inheritance
+    /// xtd::object → xtd::io::memory_mapped_file
+    /// @par Header
+    /// ```cpp
+    /// #include <xtd/io/memory_mapped_file>
+    /// ```
+    /// @par Namespace
+    /// xtd::io
+    /// @par Library
+    /// xtd.core
+    /// @ingroup xtd_core io
+    /// @remarks A memory-mapped file maps the contents of a file to the logical address space of the application. Memory-mapped files enable programmers to work with extremely large files, because memory can be managed concurrently, and they allow complete, random access to a file without the need for seeking.
+    /// @remarks The mapped pages come from the page cache of the operating system : several processes that map the same file share the same physical memory, and nothing is read from the disk until a page is accessed.
+    /// @remarks Use xtd::io::memory_mapped_file::create_view_accessor to access the content of the file. The views remain valid after the xtd::io::memory_mapped_file is destroyed.
+    class core_export_ memory_mapped_file : public xtd::object {
+      struct data;
+      
+    public:
+      /// @cond
+      memory_mapped_file(const memory_mapped_file&) = default;
+      ~memory_mapped_file();
+      memory_mapped_file& operator =(const memory_mapped_file&) = default;
+      /// @endcond
+      
+      /// @name Public Properties
+      
+      /// @{
+      /// @brief Gets the access rights of the memory-mapped file.
+      /// @return xtd::io::file_access::read or xtd::io::file_access::read_write.
+      xtd::io::file_access access() const noexcept;
+      
+      /// @brief Gets the capacity of the memory-mapped file.
+      /// @return The capacity of the memory-mapped file, in bytes.
+      size_t capacity() const noexcept;
+      /// @}
+      
+      /// @name Public Methods
+      
+      /// @{
+      /// @brief Creates a xtd::io::memory_mapped_view_accessor that maps to the whole memory-mapped file, with the access rights of the memory-mapped file.
+      /// @return A view of the memory-mapped file.
+      /// @exception xtd::io::io_exception The view cannot be mapped.
+      xtd::io::memory_mapped_view_accessor create_view_accessor() const;
+      /// @brief Creates a xtd::io::memory_mapped_view_accessor that maps to a view of the memory-mapped file, with the access rights of the memory-mapped file.
+      /// @param offset The byte at which to start the view.
+      /// @param size The size of the view. Specify 0 (zero) to create a view that starts at offset and ends approximately at the end of the memory-mapped file.
+      /// @return A view of the memory-mapped file.
+      /// @exception xtd::argument_out_of_range_exception offset + size is greater than the capacity of the memory-mapped file.
+      /// @exception xtd::io::io_exception The view cannot be mapped.
+      /// @remarks offset does not need to be aligned : the view is mapped from the nearest allocation boundary and xtd::io::memory_mapped_view_accessor::data points to offset.
+      xtd::io::memory_mapped_view_accessor create_view_accessor(size_t offset, size_t size) const;
+      /// @brief Creates a xtd::io::memory_mapped_view_accessor that maps to a view of the memory-mapped file, with the specified access rights.
+      /// @param offset The byte at which to start the view.
+      /// @param size The size of the view. Specify 0 (zero) to create a view that starts at offset and ends approximately at the end of the memory-mapped file.
+      /// @param access xtd::io::file_access::read or xtd::io::file_access::read_write.
+      /// @return A view of the memory-mapped file.
+      /// @exception xtd::argument_out_of_range_exception offset + size is greater than the capacity of the memory-mapped file.
+      /// @exception xtd::unauthorized_access_exception access is not allowed for the memory-mapped file.
+      /// @exception xtd::io::io_exception The view cannot be mapped.
+      xtd::io::memory_mapped_view_accessor create_view_accessor(size_t offset, size_t size, xtd::io::file_access access) const;
+      /// @}
+      
+      /// @name Public Static Methods
+      
+      /// @{
+      /// @brief Creates a read-only memory-mapped file from the specified file.
+      /// @param path The path to the file to map.
+      /// @return A memory-mapped file.
+      /// @exception xtd::argument_exception path contains one or more of the invalid characters<br>-or-<br>The file is empty.
+      /// @exception xtd::io::file_not_found_exception path does not exists.
+      /// @exception xtd::io::io_exception The file cannot be opened.
+      static memory_mapped_file create_from_file(const xtd::string& path);
+      /// @brief Creates a memory-mapped file with the specified access rights from the specified file.
+      /// @param path The path to the file to map.
+      /// @param access xtd::io::file_access::read or xtd::io::file_access::read_write.
+      /// @return A memory-mapped file.
+      /// @exception xtd::argument_exception path contains one or more of the invalid characters<br>-or-<br>The file is empty<br>-or-<br>access is xtd::io::file_access::write.
+      /// @exception xtd::io::file_not_found_exception path does not exists.
+      /// @exception xtd::io::io_exception The file cannot be opened.
+      static memory_mapped_file create_from_file(const xtd::string& path, xtd::io::file_access access);
+      /// @brief Creates a memory-mapped file with the specified access rights and capacity from the specified file.
+      /// @param path The path to the file to map.
+      /// @param access xtd::io::file_access::read or xtd::io::file_access::read_write.
+      /// @param capacity The capacity of the memory-mapped file, in bytes. Specify 0 (zero) to use the size of the file.
+      /// @return A memory-mapped file.
+      /// @exception xtd::argument_exception path contains one or more of the invalid characters<br>-or-<br>capacity and the file are both empty<br>-or-<br>access is xtd::io::file_access::write<br>-or-<br>capacity is greater than the size of the file and access is xtd::io::file_access::read.
+      /// @exception xtd::argument_out_of_range_exception capacity is less than the size of the file.
+      /// @exception xtd::io::file_not_found_exception path does not exists.
+      /// @exception xtd::io::io_exception The file cannot be opened or extended.
+      /// @remarks If capacity is greater than the size of the file, the file is extended to capacity.
+      static memory_mapped_file create_from_file(const xtd::string& path, xtd::io::file_access access, size_t capacity);
+      /// @}
+      
+    private:
+      memory_mapped_file();
+      
+      xtd::sptr<data> data_;
+    };
+  }
+}
@@ -0,0 +1,44 @@
+/// @file
+/// @brief Contains xtd::io::memory_mapped_file_advice enum class.
+/// @copyright Copyright (c) 2024 Gammasoft. All rights reserved.
+#pragma once
+#include "../enum.h"
+
+/// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
+namespace xtd {
+  /// @brief The xtd::io namespace contains types that allow reading and writing to files and data streams, and types that provide basic file and directory support.
+  namespace io {
+    /// @brief Specifies the expected access pattern of a memory-mapped view, so that the operating system can choose its read-ahead and caching strategy.
+    /// ```cpp
+    /// enum class memory_mapped_file_advice
+    /// ```
+    /// @par Header
+    /// ```cpp
+    /// #include <xtd/io/memory_mapped_file_advice>
+    /// ```
+    /// @par Namespace
+    /// xtd::io
+    /// @par Library
+    /// xtd.core
+    /// @ingroup xtd_core
+    /// @remarks The advice is only a hint : the operating system is free to ignore it.
+    enum class memory_mapped_file_advice {
+      /// @brief No specific access pattern. This is the default.
+      normal = 0,
+      /// @brief The view will be accessed sequentially, from lower to higher addresses. Pages can be read ahead aggressively and freed soon after they are accessed.
+      sequential = 1,
+      /// @brief The view will be accessed in random order. Read-ahead is disabled.
+      random = 2,
+      /// @brief The view will be accessed in the near future. Pages are read ahead into the page cache.
+      will_need = 3,
+      /// @brief The view will not be accessed in the near future. Its pages can be released from memory.
+      dont_need = 4,
+    };
+  }
+}
+
+/// @cond
+template<> struct xtd::enum_register<xtd::io::memory_mapped_file_advice> {
+  explicit operator auto() const noexcept {return xtd::enum_collection<xtd::io::memory_mapped_file_advice> {{xtd::io::memory_mapped_file_advice::normal, "normal"}, {xtd::io::memory_mapped_file_advice::sequential, "sequential"}, {xtd::io::memory_mapped_file_advice::random, "random"}, {xtd::io::memory_mapped_file_advice::will_need, "will_need"}, {xtd::io::memory_mapped_file_advice::dont_need, "dont_need"}};}
+};
+/// @endcond
@@ -0,0 +1,170 @@
+/// @file
+/// @brief Contains xtd::io::memory_mapped_view_accessor class.
+/// @copyright Copyright (c) 2024 Gammasoft. All rights reserved.
+#pragma once
+#include "file_access.h"
+#include "memory_mapped_file_advice.h"
+#include "../argument_out_of_range_exception.h"
+#include "../not_supported_exception.h"
+#include "../object.h"
+#include "../sptr.h"
+#include "../types.h"
+#include <algorithm>
+#include <cstring>
+#include <span>
+#include <string_view>
+#include <type_traits>
+
+/// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
+namespace xtd {
+  /// @brief The xtd::io namespace contains types that allow reading and writing to files and data streams, and types that provide basic file and directory support.
+  namespace io {
+    /// @cond
+    class memory_mapped_file;
+    /// @endcond
+    
+    /// @brief Represents a randomly accessed view of a memory-mapped file.
+    /// ```cpp
+    /// class core_export_ memory_mapped_view_accessor : public xtd::object
+    /// ```
+    /// @par Inheritance
+    /// xtd::object → xtd::io::memory_mapped_view_accessor
+    /// @par Header
+    /// ```cpp
+    /// #include <xtd/io/memory_mapped_view_accessor>
+    /// ```
+    /// @par Namespace
+    /// xtd::io
+    /// @par Library
+    /// xtd.core
+    /// @ingroup xtd_core io
+    /// @remarks To obtain a view, use the xtd::io::memory_mapped_file::create_view_accessor method or the xtd::io::file::map_all_bytes method.
+    /// @remarks The content of the view is accessed in place : xtd::io::memory_mapped_view_accessor::as_span and xtd::io::memory_mapped_view_accessor::as_string_view do not copy the file. Pages are loaded on first access and are shared with the page cache of the operating system.
+    /// @remarks Copies of an xtd::io::memory_mapped_view_accessor share the same view. The view is unmapped when the last copy is destroyed.
+    class core_export_ memory_mapped_view_accessor : public xtd::object {
+      struct view_data;
+      
+    public:
+      /// @name Public Constructors
+      
+      /// @{
+      /// @brief Initializes a new instance of the xtd::io::memory_mapped_view_accessor class with an empty view.
+      memory_mapped_view_accessor();
+      /// @}
+      
+      /// @cond
+      memory_mapped_view_accessor(const memory_mapped_view_accessor&) = default;
+      ~memory_mapped_view_accessor();
+      memory_mapped_view_accessor& operator =(const memory_mapped_view_accessor&) = default;
+      /// @endcond
+      
+      /// @name Public Properties
+      
+      /// @{
+      /// @brief Gets a value that indicates whether the view is readable.
+      /// @return true if the view is readable; otherwise, false.
+      bool can_read() const noexcept;
+      
+      /// @brief Gets a value that indicates whether the view is writable.
+      /// @return true if the view is writable; otherwise, false.
+      bool can_write() const noexcept;
+      
+      /// @brief Gets the capacity of the view.
+      /// @return The capacity of the view, in bytes.
+      size_t capacity() const noexcept;
+      
+      /// @brief Gets the first byte of the view.
+      /// @return A pointer to the first byte of the view, or nullptr if the view is empty.
+      const xtd::byte* data() const noexcept;
+      
+      /// @brief Gets the first byte of the view for writing.
+      /// @return A pointer to the first byte of the view, or nullptr if the view is empty.
+      /// @exception xtd::not_supported_exception The view is read-only.
+      xtd::byte* data();
+      /// @}
+      
+      /// @name Public Methods
+      
+      /// @{
+      /// @brief Gives the operating system a hint about how the view will be accessed.
+      /// @param advice One of xtd::io::memory_mapped_file_advice values.
+      /// @remarks The hint can be changed at any time. Unsupported hints are ignored.
+      void advise(xtd::io::memory_mapped_file_advice advice);
+      
+      /// @brief Gets the content of the view as a span of bytes, without copying it.
+      /// @return A span over the view.
+      std::span<const xtd::byte> as_span() const noexcept;
+      
+      /// @brief Gets the content of the view as a writable span of bytes, without copying it.
+      /// @return A writable span over the view.
+      /// @exception xtd::not_supported_exception The view is read-only.
+      std::span<xtd::byte> as_writable_span();
+      
+      /// @brief Gets the content of the view as a string view, without copying it.
+      /// @return A string view over the view.
+      std::string_view as_string_view() const noexcept;
+      
+      /// @brief Writes the modified pages of the view to the underlying file.
+      /// @exception xtd::io::io_exception An I/O error occurred.
+      void flush();
+      
+      /// @brief Reads a structure of type type_t from the view.
+      /// @param position The number of bytes into the view at which to begin reading.
+      /// @return The structure read from the view.
+      /// @exception xtd::argument_out_of_range_exception There are not enough bytes after position to read a structure of type type_t.
+      template<typename type_t>
+      type_t read(size_t position) const {
+        static_assert(std::is_trivially_copyable_v<type_t>, "type_t must be trivially copyable");
+        if (position > capacity() || sizeof(type_t) > capacity() - position) throw xtd::argument_out_of_range_exception {csf_};
+        auto value = type_t {};
+        std::memcpy(&value, data() + position, sizeof(type_t));
+        return value;
+      }
+      
+      /// @brief Reads structures of type type_t from the view into a span.
+      /// @param position The number of bytes into the view at which to begin reading.
+      /// @param values The span to fill with the structures read from the view.
+      /// @return The number of structures read into values. This value can be less than the size of values if there are fewer structures available, or zero if the end of the view is reached.
+      /// @exception xtd::argument_out_of_range_exception position is greater than the capacity of the view.
+      template<typename type_t>
+      size_t read_array(size_t position, std::span<type_t> values) const {
+        static_assert(std::is_trivially_copyable_v<type_t>, "type_t must be trivially copyable");
+        if (position > capacity()) throw xtd::argument_out_of_range_exception {csf_};
+        auto count = std::min(values.size(), (capacity() - position) / sizeof(type_t));
+        if (count) std::memcpy(values.data(), data() + position, count * sizeof(type_t));
+        return count;
+      }
+      
+      /// @brief Writes a structure of type type_t into the view.
+      /// @param position The number of bytes into the view at which to begin writing.
+      /// @param value The structure to write.
+      /// @exception xtd::argument_out_of_range_exception There are not enough bytes after position to write a structure of type type_t.
+      /// @exception xtd::not_supported_exception The view is read-only.
+      template<typename type_t>
+      void write(size_t position, const type_t& value) {
+        static_assert(std::is_trivially_copyable_v<type_t>, "type_t must be trivially copyable");
+        if (position > capacity() || sizeof(type_t) > capacity() - position) throw xtd::argument_out_of_range_exception {csf_};
+        std::memcpy(data() + position, &value, sizeof(type_t));
+      }
+      
+      /// @brief Writes structures of type type_t from a span into the view.
+      /// @param position The number of bytes into the view at which to begin writing.
+      /// @param values The structures to write.
+      /// @exception xtd::argument_out_of_range_exception There are not enough bytes after position to write all the structures.
+      /// @exception xtd::not_supported_exception The view is read-only.
+      template<typename type_t>
+      void write_array(size_t position, std::span<const type_t> values) {
+        static_assert(std::is_trivially_copyable_v<type_t>, "type_t must be trivially copyable");
+        if (position > capacity() || values.size_bytes() > capacity() - position) throw xtd::argument_out_of_range_exception {csf_};
+        if (!values.empty()) std::memcpy(data() + position, values.data(), values.size_bytes());
+      }
+      /// @}
+      
+    private:
+      friend xtd::io::memory_mapped_file;
+      memory_mapped_view_accessor(void* address, size_t mapped_size, size_t pointer_offset, size_t capacity, xtd::io::file_access access);
+      
+      xtd::sptr<view_data> data_;
+    };
+  }
+}
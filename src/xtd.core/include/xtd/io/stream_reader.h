@@ -5,6 +5,8 @@
 #include "text_reader.h"
 #include "../optional.h"
 #include <fstream>
+#include <span>
+#include <vector>
 
 /// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
 namespace xtd {
@@ -25,6 +27,8 @@ namespace xtd {
     /// @par Library
     /// xtd.core
     /// @ingroup xtd_core io
+    /// @remarks When xtd::io::stream_reader opens the file itself, the file is read through a 64 KiB buffer owned by the reader.
+    /// @remarks xtd::io::stream_reader::read_line and xtd::io::stream_reader::read_to_end read blocks of characters from the underlying stream buffer instead of one character at a time. xtd::io::stream_reader::read_line never consumes characters after the end of the line, so several readers can be created in turn on the same stream.
     class core_export_ stream_reader : public xtd::io::text_reader {
     public:
       /// @name Public Constructors
@@ -69,9 +73,28 @@ namespace xtd {
       /// @brief Reads the next character from the input stream and advances the character position by one character.
       /// @return The next character from the input stream, or EOF if no more characters are available.
       int32 read() override;
+      
+      /// @brief Reads the characters from the current stream and writes the data to the specified buffer.
+      /// @param buffer When this method returns, contains the specified span of characters replaced by the characters read from the current source.
+      /// @return The number of characters that have been read, or 0 if at the end of the stream and no data was read. The number will be less than or equal to the buffer length, depending on whether the data is available within the stream.
+      /// @remarks This method waits for the first character only; the following characters are those the underlying stream buffer can provide without waiting.
+      size_t read(std::span<char> buffer) override;
+      
+      /// @brief Reads a line of characters from the current stream and returns the data as a string.
+      /// @return The next line from the input stream, or the empty string if all characters have been read.
+      xtd::string read_line() override;
+      
+      /// @brief Reads all characters from the current position to the end of the stream and returns them as one string.
+      /// @return A string containing all characters from the current position to the end of the stream.
+      /// @remarks For a file stream, the remaining length of the file is used to allocate the result once.
+      xtd::string read_to_end() override;
+      
+      using text_reader::read;
       /// @}
       
     private:
+      static constexpr size_t default_buffer_size = 65536;
+      std::vector<char> buffer_;
       std::istream* stream_ = nullptr;
       bool delete_when_destroy_ = false;
     };
@@ -7,7 +7,9 @@
 #include "../string.h"
 #include <cstdio>
 #include <istream>
+#include <span>
 #include <string>
+#include <vector>
 
 /// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
 namespace xtd {
@@ -67,6 +69,12 @@ namespace xtd {
       /// @return The number of characters that have been read. The number will be less than or equal to count, depending on whether all input characters have been read.
       virtual size_t read(std::vector<char>& buffer, size_t index, size_t count);
       
+      /// @brief Reads the characters from the current reader and writes the data to the specified buffer.
+      /// @param buffer When this method returns, contains the specified span of characters replaced by the characters read from the current source.
+      /// @return The number of characters that have been read. The number will be less than or equal to the buffer length, depending on whether the data is available within the reader. This method returns 0 (zero) if it is called when no more characters are left to read.
+      /// @remarks The default implementation calls xtd::io::text_reader::read() for each character. Derived classes that have access to a block of characters should override it.
+      virtual size_t read(std::span<char> buffer);
+      
       /// @brief Reads a specified maximum number of characters from the current text reader and writes the data to a buffer, beginning at the specified index.
       /// @param buffer When this method returns, this parameter contains the specified character array with the values between index and (index + count -1) replaced by the characters read from the current source.
       /// @param index The position in buffer at which to begin writing.
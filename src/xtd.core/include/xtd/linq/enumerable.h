@@ -0,0 +1,99 @@
+/// @file
+/// @brief Contains xtd::linq::enumerable class.
+/// @copyright Copyright (c) 2024 Gammasoft. All rights reserved.
+#pragma once
+#include "query.h"
+#include "ranges.h"
+#include "../collections/generic/ienumerable.h"
+#include "../size.h"
+#include "../static.h"
+#include <iterator>
+#include <type_traits>
+
+/// @cond
+namespace xtd {
+  namespace linq {
+    namespace ranges {
+      template<typename type_t>
+      type_t enumerable_value_type(const xtd::collections::generic::ienumerable<type_t>*);
+      
+      // A collection that implements xtd::collections::generic::ienumerable <type_t> without contiguous iterators is enumerated by spans through the interface rather than with its own iterators.
+      template<typename collection_t>
+      concept enumerable_without_contiguous_iterator = requires {enumerable_value_type(static_cast<const collection_t*>(nullptr));} && !std::contiguous_iterator<std::remove_cvref_t<decltype(std::begin(std::declval<const collection_t&>()))>>;
+    }
+  }
+}
+/// @endcond
+
+/// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
+namespace xtd {
+  /// @brief The xtd::linq namespace provides classes that support queries that use Language-Integrated Query (LINQ) style operators.
+  namespace linq {
+    /// @brief Provides a set of static methods that create an xtd::linq::query.
+    /// @par Header
+    /// ```cpp
+    /// #include <xtd/linq/enumerable>
+    /// ```
+    /// @par Namespace
+    /// xtd::linq
+    /// @par Library
+    /// xtd.core
+    /// @ingroup xtd_core linq
+    /// @par Examples
+    /// The following example shows how to filter, project and sort a list with a query.
+    /// ```cpp
+    /// auto words = list<string> {"apple", "blueberry", "cherry", "kiwi", "banana"};
+    /// for (auto word : enumerable::from(words).where([](const string& word) {return word.size() > 4;}).order_by([](const string& word) {return word.size();}))
+    ///   console::write_line(word);
+    /// // apple, cherry, banana, blueberry
+    /// ```
+    class enumerable static_ {
+    public:
+      /// @name Public Static Methods
+      
+      /// @{
+      /// @brief Returns an empty query of the specified type.
+      /// @return An empty xtd::linq::query.
+      template<typename type_t>
+      static auto empty() noexcept {return query<ranges::source_range<const type_t*>> {ranges::source_range<const type_t*> {nullptr, nullptr}};}
+      
+      /// @brief Creates a query over the specified collection.
+      /// @param source The collection to query. It must outlive the query : a temporary collection cannot be queried.
+      /// @return A new xtd::linq::query that enumerates source.
+      /// @remarks The query iterates the collection with its own iterators, such as the contiguous iterators of xtd::collections::generic::list <type_t> or std::vector <type_t>.
+      /// @remarks A collection that is only known by its xtd::collections::generic::ienumerable <type_t> interface is enumerated by spans : the whole collection when xtd::collections::generic::ienumerable::try_get_span succeeds; otherwise the batches of xtd::collections::generic::ienumerator::move_next_batch.
+      template<typename collection_t>
+      static auto from(const collection_t& source) {
+        if constexpr (ranges::enumerable_without_contiguous_iterator<collection_t>) {
+          using range_t = ranges::enumerable_range<decltype(ranges::enumerable_value_type(static_cast<const collection_t*>(nullptr)))>;
+          return query<range_t> {range_t {source}};
+        } else {
+          using range_t = ranges::source_range<std::remove_cvref_t<decltype(std::begin(source))>>;
+          return query<range_t> {range_t {std::begin(source), std::end(source)}};
+        }
+      }
+      /// @cond
+      // A query does not own its source : a temporary collection would be destroyed before the query is enumerated.
+      template<typename collection_t>
+      requires (!std::is_lvalue_reference_v<collection_t>)
+      static void from(collection_t&& source) = delete;
+      /// @endcond
+      
+      /// @brief Generates a query of integral numbers within a specified range.
+      /// @param start The value of the first integer.
+      /// @param count The number of sequential integers to generate.
+      /// @return A new xtd::linq::query that contains a range of sequential integral numbers.
+      template<typename type_t>
+      requires std::is_integral_v<type_t>
+      static auto range(type_t start, xtd::size count) noexcept {return query<ranges::range_range<type_t>> {ranges::range_range<type_t> {start, count}};}
+      
+      /// @brief Generates a query that contains one repeated value.
+      /// @param value The value to be repeated.
+      /// @param count The number of times to repeat the value.
+      /// @return A new xtd::linq::query that contains a repeated value.
+      template<typename type_t>
+      static auto repeat(const type_t& value, xtd::size count) {return query<ranges::repeat_range<type_t>> {ranges::repeat_range<type_t> {value, count}};}
+      /// @}
+    };
+  }
+}
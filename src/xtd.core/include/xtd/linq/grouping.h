@@ -0,0 +1,88 @@
+/// @file
+/// @brief Contains xtd::linq::grouping <key_t, element_t> class.
+/// @copyright Copyright (c) 2024 Gammasoft. All rights reserved.
+#pragma once
+#include "../collections/generic/list.h"
+#include "../object.h"
+#include "../size.h"
+
+/// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
+namespace xtd {
+  /// @brief The xtd::linq namespace provides classes that support queries that use Language-Integrated Query (LINQ) style operators.
+  namespace linq {
+    /// @brief Represents a collection of objects that have a common key.
+    /// @par Definition
+    /// ```cpp
+    /// template<typename key_t, typename element_t>
+    /// class grouping : public xtd::object
+    /// ```
+    /// @par Header
+    /// ```cpp
+    /// #include <xtd/linq/grouping>
+    /// ```
+    /// @par Namespace
+    /// xtd::linq
+    /// @par Library
+    /// xtd.core
+    /// @ingroup xtd_core linq
+    /// @remarks An xtd::linq::grouping <key_t, element_t> is returned by xtd::linq::query::group_by. The elements keep the order in which they appear in the source.
+    template<typename key_t, typename element_t>
+    class grouping : public xtd::object {
+    public:
+      /// @name Public Aliases
+      
+      /// @{
+      /// @brief Represents the key type.
+      using key_type = key_t;
+      /// @brief Represents the value type.
+      using value_type = element_t;
+      /// @brief Represents the const iterator of the grouping.
+      using const_iterator = typename xtd::collections::generic::list<element_t>::const_iterator;
+      /// @brief Represents the iterator of the grouping.
+      using iterator = const_iterator;
+      /// @}
+      
+      /// @name Public Constructors
+      
+      /// @{
+      /// @brief Initializes a new instance of the xtd::linq::grouping class.
+      grouping() = default;
+      /// @brief Initializes a new instance of the xtd::linq::grouping class with specified key and elements.
+      /// @param key The key of the grouping.
+      /// @param elements The elements of the grouping.
+      grouping(const key_t& key, xtd::collections::generic::list<element_t>&& elements) : key_(key), elements_(std::move(elements)) {}
+      /// @}
+      
+      /// @name Public Properties
+      
+      /// @{
+      /// @brief Gets the number of elements of the grouping.
+      /// @return The number of elements.
+      xtd::size count() const noexcept {return elements_.count();}
+      
+      /// @brief Gets the elements of the grouping.
+      /// @return The elements of the grouping.
+      const xtd::collections::generic::list<element_t>& elements() const noexcept {return elements_;}
+      
+      /// @brief Gets the key of the grouping.
+      /// @return The key of the grouping.
+      const key_t& key() const noexcept {return key_;}
+      /// @}
+      
+      /// @name Public Methods
+      
+      /// @{
+      /// @brief Returns an iterator to the first element of the grouping.
+      /// @return Iterator to the first element.
+      const_iterator begin() const noexcept {return elements_.begin();}
+      /// @brief Returns an iterator to the element following the last element of the grouping.
+      /// @return Iterator to the element following the last element.
+      const_iterator end() const noexcept {return elements_.end();}
+      /// @}
+    
+    private:
+      key_t key_ {};
+      xtd::collections::generic::list<element_t> elements_;
+    };
+  }
+}
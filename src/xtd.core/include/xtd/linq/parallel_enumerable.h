@@ -0,0 +1,60 @@
+/// @file
+/// @brief Contains xtd::linq::parallel_enumerable class.
+/// @copyright Copyright (c) 2024 Gammasoft. All rights reserved.
+#pragma once
+#include "../action.h"
+#include "../core_export.h"
+#include "../size.h"
+#include "../static.h"
+
+/// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
+namespace xtd {
+  /// @brief The xtd::linq namespace provides classes that support queries that use Language-Integrated Query (LINQ) style operators.
+  namespace linq {
+    /// @brief Provides the partitioning used to run an xtd::linq::parallel_query on the xtd::threading::thread_pool.
+    /// @par Header
+    /// ```cpp
+    /// #include <xtd/linq/parallel_enumerable>
+    /// ```
+    /// @par Namespace
+    /// xtd::linq
+    /// @par Library
+    /// xtd.core
+    /// @ingroup xtd_core linq
+    class core_export_ parallel_enumerable static_ {
+    public:
+      /// @name Public Fields
+      
+      /// @{
+      /// @brief Represents the minimum number of elements of a partition.
+      /// @remarks A source with fewer elements than twice this value is not split, and runs on the calling thread.
+      static constexpr xtd::size min_partition_size = 1024;
+      /// @}
+      
+      /// @name Public Static Properties
+      
+      /// @{
+      /// @brief Gets the default maximum number of partitions processed concurrently.
+      /// @return The number of processors of the current machine.
+      static xtd::size default_degree_of_parallelism() noexcept;
+      /// @}
+      
+      /// @name Public Static Methods
+      
+      /// @{
+      /// @brief Gets the number of partitions used to process the specified number of elements.
+      /// @param count The number of elements to process.
+      /// @param degree_of_parallelism The maximum number of partitions processed concurrently.
+      /// @return The number of partitions, between 1 and degree_of_parallelism.
+      static xtd::size partition_count(xtd::size count, xtd::size degree_of_parallelism) noexcept;
+      
+      /// @brief Invokes the specified action for each partition index, possibly in parallel.
+      /// @param partition_count The number of partitions.
+      /// @param partition_action The action invoked with each partition index, from 0 to partition_count - 1.
+      /// @remarks The calling thread processes partitions too, and only waits for the partitions already started by the xtd::threading::thread_pool threads : a query run from a thread pool thread can not starve the pool.
+      /// @remarks If partition_action throws, the partitions that are not started yet are skipped and the first exception is rethrown on the calling thread.
+      static void invoke(xtd::size partition_count, const xtd::action<xtd::size>& partition_action);
+      /// @}
+    };
+  }
+}
@@ -0,0 +1,308 @@
+/// @file
+/// @brief Contains xtd::linq::parallel_query <source_t, value_t, stage_t> class.
+/// @copyright Copyright (c) 2024 Gammasoft. All rights reserved.
+#pragma once
+#include "parallel_enumerable.h"
+#include "../collections/generic/list.h"
+#include "../argument_out_of_range_exception.h"
+#include "../array.h"
+#include "../invalid_operation_exception.h"
+#include "../size.h"
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/// @cond
+namespace xtd {
+  namespace linq {
+    namespace ranges {
+      // The stages of a parallel query push each element of the source to a sink : the where and select stages of a query are composed into a single function called once per source element.
+      struct identity_stage {
+        template<typename value_t, typename sink_t>
+        void operator ()(const value_t& value, sink_t&& sink) const {sink(value);}
+      };
+      
+      template<typename stage_t, typename predicate_t>
+      struct where_stage {
+        stage_t stage;
+        predicate_t predicate;
+        
+        template<typename value_t, typename sink_t>
+        void operator ()(const value_t& value, sink_t&& sink) const {
+          stage(value, [&](auto&& item) {
+            if (std::invoke(predicate, item)) sink(std::forward<decltype(item)>(item));
+          });
+        }
+      };
+      
+      template<typename stage_t, typename selector_t>
+      struct select_stage {
+        stage_t stage;
+        selector_t selector;
+        
+        template<typename value_t, typename sink_t>
+        void operator ()(const value_t& value, sink_t&& sink) const {
+          stage(value, [&](auto&& item) {sink(std::invoke(selector, std::forward<decltype(item)>(item)));});
+        }
+      };
+    }
+  }
+}
+/// @endcond
+
+/// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
+namespace xtd {
+  /// @brief The xtd::linq namespace provides classes that support queries that use Language-Integrated Query (LINQ) style operators.
+  namespace linq {
+    /// @brief Represents a query that processes the partitions of a contiguous source in parallel.
+    /// @par Definition
+    /// ```cpp
+    /// template<typename source_t, typename value_t, typename stage_t>
+    /// class parallel_query
+    /// ```
+    /// @par Header
+    /// ```cpp
+    /// #include <xtd/linq/parallel_query>
+    /// ```
+    /// @par Namespace
+    /// xtd::linq
+    /// @par Library
+    /// xtd.core
+    /// @ingroup xtd_core linq
+    /// @remarks An xtd::linq::parallel_query is returned by xtd::linq::query::as_parallel. The source is split into contiguous partitions that are processed by the xtd::threading::thread_pool threads and the calling thread; see xtd::linq::parallel_enumerable::invoke.
+    /// @remarks The xtd::linq::parallel_query::where and xtd::linq::parallel_query::select methods are deferred and fused : the query is run by its terminal method, such as xtd::linq::parallel_query::to_list or xtd::linq::parallel_query::sum, with one pass on each partition.
+    /// @remarks The results of xtd::linq::parallel_query::to_list and xtd::linq::parallel_query::to_array keep the order of the source. The function objects must be safe to call concurrently; xtd::linq::parallel_query::for_each calls its action concurrently and in no particular order.
+    /// @par Examples
+    /// ```cpp
+    /// auto items = list<int> {/*...*/};
+    /// auto sum = enumerable::from(items).as_parallel().where([](int item) {return item % 2 == 0;}).select([](int item) {return int64 {item} * item;}).sum();
+    /// ```
+    template<typename source_t, typename value_t = source_t, typename stage_t = ranges::identity_stage>
+    class parallel_query {
+    public:
+      /// @name Public Aliases
+      
+      /// @{
+      /// @brief Represents the source value type.
+      using source_type = source_t;
+      /// @brief Represents the value type.
+      using value_type = value_t;
+      /// @}
+      
+      /// @name Public Constructors
+      
+      /// @{
+      /// @brief Initializes a new instance of the xtd::linq::parallel_query class with specified source.
+      /// @param source The elements to process.
+      /// @param storage The storage that owns the elements of source, or null if the source is owned by the caller.
+      /// @param stage The fused where and select stages.
+      /// @param degree_of_parallelism The maximum number of partitions processed concurrently.
+      parallel_query(std::span<const source_t> source, std::shared_ptr<const std::vector<source_t>> storage, const stage_t& stage = stage_t {}, xtd::size degree_of_parallelism = parallel_enumerable::default_degree_of_parallelism()) : source_(source), storage_(std::move(storage)), stage_(stage), degree_of_parallelism_(degree_of_parallelism) {}
+      /// @}
+      
+      /// @name Public Properties
+      
+      /// @{
+      /// @brief Gets the maximum number of partitions processed concurrently.
+      /// @return The degree of parallelism.
+      xtd::size degree_of_parallelism() const noexcept {return degree_of_parallelism_;}
+      /// @}
+      
+      /// @name Public Methods
+      
+      /// @{
+      /// @brief Determines whether the query contains any elements.
+      /// @return true if the query contains any elements; otherwise, false.
+      bool any() const {return any([](const value_t&) {return true;});}
+      /// @brief Determines whether any element of the query satisfies a condition.
+      /// @param predicate A function to test each element for a condition.
+      /// @return true if any element satisfies the condition; otherwise, false.
+      template<typename predicate_t>
+      bool any(const predicate_t& predicate) const {
+        auto found = std::atomic<bool> {false};
+        run_until(found, [&](auto&& item) {
+          if (std::invoke(predicate, item)) found.store(true, std::memory_order_relaxed);
+        });
+        return found.load();
+      }
+      
+      /// @brief Determines whether all elements of the query satisfy a condition.
+      /// @param predicate A function to test each element for a condition.
+      /// @return true if every element satisfies the condition, or if the query is empty; otherwise, false.
+      template<typename predicate_t>
+      bool all(const predicate_t& predicate) const {return !any([&](const auto& item) {return !std::invoke(predicate, item);});}
+      
+      /// @brief Applies an accumulator function over each partition, and combines the partition results.
+      /// @param seed The initial accumulator value of each partition.
+      /// @param func An accumulator function to be invoked on each element of a partition.
+      /// @param combine A function that combines the accumulator values of two partitions, in the order of the source.
+      /// @return The final accumulator value.
+      template<typename accumulate_t, typename func_t, typename combine_t>
+      accumulate_t aggregate(const accumulate_t& seed, const func_t& func, const combine_t& combine) const {
+        auto results = std::vector<accumulate_t>(partition_count(), seed);
+        run([&](xtd::size index, xtd::size first, xtd::size last) {
+          auto result = seed;
+          for_each_in(first, last, [&](auto&& item) {result = std::invoke(func, std::move(result), item);});
+          results[index] = std::move(result);
+        });
+        auto result = std::move(results[0]);
+        for (auto index = xtd::size {1}; index < results.size(); ++index)
+          result = std::invoke(combine, std::move(result), std::move(results[index]));
+        return result;
+      }
+      
+      /// @brief Computes the average of the query.
+      /// @return The average of the elements.
+      /// @exception xtd::invalid_operation_exception The query contains no elements.
+      double average() const {
+        auto result = aggregate(std::pair<double, xtd::size> {}, [](std::pair<double, xtd::size> accumulate, const value_t& item) {return std::pair<double, xtd::size> {accumulate.first + static_cast<double>(item), accumulate.second + 1};}, [](const std::pair<double, xtd::size>& a, const std::pair<double, xtd::size>& b) {return std::pair<double, xtd::size> {a.first + b.first, a.second + b.second};});
+        if (result.second == 0) throw xtd::invalid_operation_exception {"Sequence contains no elements", csf_};
+        return result.first / static_cast<double>(result.second);
+      }
+      
+      /// @brief Returns the number of elements of the query.
+      /// @return The number of elements.
+      xtd::size count() const {return aggregate(xtd::size {0}, [](xtd::size result, const value_t&) {return result + 1;}, std::plus<xtd::size> {});}
+      /// @brief Returns the number of elements of the query that satisfy a condition.
+      /// @param predicate A function to test each element for a condition.
+      /// @return The number of elements that satisfy the condition.
+      template<typename predicate_t>
+      xtd::size count(const predicate_t& predicate) const {return aggregate(xtd::size {0}, [&](xtd::size result, const value_t& item) {return std::invoke(predicate, item) ? result + 1 : result;}, std::plus<xtd::size> {});}
+      
+      /// @brief Invokes the specified action on each element of the query.
+      /// @param action The action to invoke on each element. It is called concurrently and in no particular order.
+      template<typename action_t>
+      void for_each(const action_t& action) const {
+        run([&](xtd::size, xtd::size first, xtd::size last) {
+          for_each_in(first, last, [&](auto&& item) {std::invoke(action, item);});
+        });
+      }
+      
+      /// @brief Returns the maximum value of the query.
+      /// @return The maximum value.
+      /// @exception xtd::invalid_operation_exception The query contains no elements.
+      value_t max() const {return extremum([](const value_t& a, const value_t& b) {return b < a;});}
+      
+      /// @brief Returns the minimum value of the query.
+      /// @return The minimum value.
+      /// @exception xtd::invalid_operation_exception The query contains no elements.
+      value_t min() const {return extremum([](const value_t& a, const value_t& b) {return a < b;});}
+      
+      /// @brief Projects each element of the query into a new form.
+      /// @param selector A transform function to apply to each element.
+      /// @return A new xtd::linq::parallel_query whose elements are the result of invoking the transform function on each element.
+      template<typename selector_t>
+      auto select(const selector_t& selector) const {
+        using result_t = std::remove_cvref_t<std::invoke_result_t<const selector_t&, const value_t&>>;
+        using result_stage_t = ranges::select_stage<stage_t, selector_t>;
+        return parallel_query<source_t, result_t, result_stage_t> {source_, storage_, result_stage_t {stage_, selector}, degree_of_parallelism_};
+      }
+      
+      /// @brief Computes the sum of the query.
+      /// @return The sum of the elements.
+      value_t sum() const {return aggregate(value_t {}, [](value_t result, const value_t& item) {return result + item;}, std::plus<value_t> {});}
+      
+      /// @brief Creates an xtd::array from the query.
+      /// @return An xtd::array that contains the elements of the query, in the order of the source.
+      xtd::array<value_t> to_array() const {
+        auto result = xtd::array<value_t> {};
+        concat(result);
+        return result;
+      }
+      
+      /// @brief Creates an xtd::collections::generic::list from the query.
+      /// @return An xtd::collections::generic::list that contains the elements of the query, in the order of the source.
+      xtd::collections::generic::list<value_t> to_list() const {
+        auto result = typename xtd::collections::generic::list<value_t>::base_type {};
+        concat(result);
+        return xtd::collections::generic::list<value_t>(std::move(result));
+      }
+      
+      /// @brief Filters the query based on a predicate.
+      /// @param predicate A function to test each element for a condition.
+      /// @return A new xtd::linq::parallel_query that contains the elements that satisfy the condition.
+      template<typename predicate_t>
+      auto where(const predicate_t& predicate) const {
+        using result_stage_t = ranges::where_stage<stage_t, predicate_t>;
+        return parallel_query<source_t, value_t, result_stage_t> {source_, storage_, result_stage_t {stage_, predicate}, degree_of_parallelism_};
+      }
+      
+      /// @brief Sets the maximum number of partitions processed concurrently.
+      /// @param degree_of_parallelism The maximum number of partitions processed concurrently.
+      /// @return A new xtd::linq::parallel_query with the specified degree of parallelism.
+      /// @exception xtd::argument_out_of_range_exception degree_of_parallelism is 0.
+      parallel_query with_degree_of_parallelism(xtd::size degree_of_parallelism) const {
+        if (degree_of_parallelism == 0) throw xtd::argument_out_of_range_exception {csf_};
+        return parallel_query {source_, storage_, stage_, degree_of_parallelism};
+      }
+      /// @}
+    
+    private:
+      template<typename container_t>
+      void concat(container_t& result) const {
+        auto results = std::vector<std::vector<value_t>>(partition_count());
+        run([&](xtd::size index, xtd::size first, xtd::size last) {
+          for_each_in(first, last, [&](auto&& item) {results[index].push_back(std::forward<decltype(item)>(item));});
+        });
+        auto count = xtd::size {0};
+        for (const auto& items : results)
+          count += items.size();
+        result.reserve(count);
+        for (auto& items : results)
+          for (auto& item : items)
+            result.push_back(std::move(item));
+      }
+      
+      template<typename less_t>
+      value_t extremum(const less_t& less) const {
+        auto results = std::vector<std::optional<value_t>>(partition_count());
+        run([&](xtd::size index, xtd::size first, xtd::size last) {
+          auto result = std::optional<value_t> {};
+          for_each_in(first, last, [&](auto&& item) {
+            if (!result || less(item, *result)) result = item;
+          });
+          results[index] = std::move(result);
+        });
+        auto result = std::optional<value_t> {};
+        for (auto& item : results)
+          if (item && (!result || less(*item, *result))) result = std::move(item);
+        if (!result) throw xtd::invalid_operation_exception {"Sequence contains no elements", csf_};
+        return *result;
+      }
+      
+      template<typename sink_t>
+      void for_each_in(xtd::size first, xtd::size last, sink_t&& sink) const {
+        for (auto index = first; index < last; ++index)
+          stage_(source_[index], sink);
+      }
+      
+      xtd::size partition_count() const noexcept {return parallel_enumerable::partition_count(source_.size(), degree_of_parallelism_);}
+      
+      template<typename partition_action_t>
+      void run(const partition_action_t& partition_action) const {
+        auto count = partition_count();
+        parallel_enumerable::invoke(count, xtd::action<xtd::size> {[&](xtd::size index) {
+          partition_action(index, source_.size() * index / count, source_.size() * (index + 1) / count);
+        }});
+      }
+      
+      template<typename sink_t>
+      void run_until(const std::atomic<bool>& stop, sink_t&& sink) const {
+        run([&](xtd::size, xtd::size first, xtd::size last) {
+          for (auto index = first; index < last && !stop.load(std::memory_order_relaxed); ++index)
+            stage_(source_[index], sink);
+        });
+      }
+      
+      std::span<const source_t> source_;
+      std::shared_ptr<const std::vector<source_t>> storage_;
+      stage_t stage_;
+      xtd::size degree_of_parallelism_ = 0;
+    };
+  }
+}
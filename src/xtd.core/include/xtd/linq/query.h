@@ -0,0 +1,393 @@
+/// @file
+/// @brief Contains xtd::linq::query <range_t> class.
+/// @copyright Copyright (c) 2024 Gammasoft. All rights reserved.
+#pragma once
+#include "parallel_query.h"
+#include "ranges.h"
+#include "../collections/generic/list.h"
+#include "../argument_out_of_range_exception.h"
+#include "../array.h"
+#include "../invalid_operation_exception.h"
+#include "../size.h"
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
+namespace xtd {
+  /// @brief The xtd::linq namespace provides classes that support queries that use Language-Integrated Query (LINQ) style operators.
+  namespace linq {
+    /// @brief Represents a deferred query over a sequence of elements.
+    /// @par Definition
+    /// ```cpp
+    /// template<typename range_t>
+    /// class query
+    /// ```
+    /// @par Header
+    /// ```cpp
+    /// #include <xtd/linq/query>
+    /// ```
+    /// @par Namespace
+    /// xtd::linq
+    /// @par Library
+    /// xtd.core
+    /// @ingroup xtd_core linq
+    /// @remarks An xtd::linq::query is created by xtd::linq::enumerable::from, xtd::linq::enumerable::range or xtd::linq::enumerable::repeat. The query keeps a reference to its source : the source must outlive the query.
+    /// @remarks The adapter methods, such as xtd::linq::query::where, xtd::linq::query::select or xtd::linq::query::take, are deferred : they return a new xtd::linq::query whose type holds the whole chain, and the source is only enumerated by a range-based for loop or by a terminal method, such as xtd::linq::query::to_list, xtd::linq::query::count or xtd::linq::query::sum.
+    /// @remarks The adapters are fused at compile time : the iterator of a query wraps the iterators of the previous adapters and calls the function objects directly, without virtual call nor allocation by element. A query over a contiguous collection, such as xtd::collections::generic::list <type_t>, iterates with pointers.
+    /// @remarks xtd::linq::query::order_by, xtd::linq::query::order_by_descending and xtd::linq::query::group_by need all the elements : they store the sorted or grouped elements the first time the query is enumerated.
+    /// @remarks xtd::linq::query::as_parallel returns an xtd::linq::parallel_query that processes the partitions of the elements on the xtd::threading::thread_pool.
+    /// @par Examples
+    /// ```cpp
+    /// auto items = list<int> {1, 2, 3, 4, 5, 6, 7, 8, 9};
+    /// auto squares = enumerable::from(items).where([](int item) {return item % 2 == 0;}).select([](int item) {return item * item;}).to_list();
+    /// // squares : [4, 16, 36, 64]
+    /// ```
+    template<typename range_t>
+    class query {
+    public:
+      /// @name Public Aliases
+      
+      /// @{
+      /// @brief Represents the range type.
+      using range_type = range_t;
+      /// @brief Represents the iterator of the query.
+      using iterator = ranges::iterator_t<range_t>;
+      /// @brief Represents the const iterator of the query.
+      using const_iterator = iterator;
+      /// @brief Represents the value type.
+      using value_type = ranges::value_t<range_t>;
+      /// @}
+      
+      /// @name Public Constructors
+      
+      /// @{
+      /// @brief Initializes a new instance of the xtd::linq::query class with specified range.
+      /// @param range The range enumerated by the query.
+      explicit query(const range_t& range) : range_(range) {}
+      /// @}
+      
+      /// @name Public Properties
+      
+      /// @{
+      /// @brief Gets the range enumerated by the query.
+      /// @return The range of the query.
+      const range_t& range() const noexcept {return range_;}
+      /// @}
+      
+      /// @name Public Methods
+      
+      /// @{
+      /// @brief Applies an accumulator function over the query. The first element is used as the initial accumulator value.
+      /// @param func An accumulator function to be invoked on each element.
+      /// @return The final accumulator value.
+      /// @exception xtd::invalid_operation_exception The query contains no elements.
+      template<typename func_t>
+      value_type aggregate(const func_t& func) const {
+        auto first = range_.begin();
+        auto last = range_.end();
+        if (first == last) throw xtd::invalid_operation_exception {"Sequence contains no elements", csf_};
+        auto result = value_type {*first};
+        for (++first; first != last; ++first)
+          result = std::invoke(func, std::move(result), *first);
+        return result;
+      }
+      /// @brief Applies an accumulator function over the query. The specified seed value is used as the initial accumulator value.
+      /// @param seed The initial accumulator value.
+      /// @param func An accumulator function to be invoked on each element.
+      /// @return The final accumulator value.
+      template<typename accumulate_t, typename func_t>
+      accumulate_t aggregate(const accumulate_t& seed, const func_t& func) const {
+        auto result = seed;
+        for (auto&& item : range_)
+          result = std::invoke(func, std::move(result), item);
+        return result;
+      }
+      /// @brief Applies an accumulator function over the query. The specified seed value is used as the initial accumulator value, and the specified function is used to select the result value.
+      /// @param seed The initial accumulator value.
+      /// @param func An accumulator function to be invoked on each element.
+      /// @param result_selector A function to transform the final accumulator value into the result value.
+      /// @return The transformed final accumulator value.
+      template<typename accumulate_t, typename func_t, typename result_selector_t>
+      auto aggregate(const accumulate_t& seed, const func_t& func, const result_selector_t& result_selector) const {return std::invoke(result_selector, aggregate(seed, func));}
+      
+      /// @brief Determines whether all elements of the query satisfy a condition.
+      /// @param predicate A function to test each element for a condition.
+      /// @return true if every element satisfies the condition, or if the query is empty; otherwise, false.
+      template<typename predicate_t>
+      bool all(const predicate_t& predicate) const {
+        for (auto&& item : range_)
+          if (!std::invoke(predicate, item)) return false;
+        return true;
+      }
+      
+      /// @brief Determines whether the query contains any elements.
+      /// @return true if the query contains any elements; otherwise, false.
+      bool any() const {return range_.begin() != range_.end();}
+      /// @brief Determines whether any element of the query satisfies a condition.
+      /// @param predicate A function to test each element for a condition.
+      /// @return true if any element satisfies the condition; otherwise, false.
+      template<typename predicate_t>
+      bool any(const predicate_t& predicate) const {
+        for (auto&& item : range_)
+          if (std::invoke(predicate, item)) return true;
+        return false;
+      }
+      
+      /// @brief Returns an xtd::linq::parallel_query that processes the elements of the query in parallel.
+      /// @return A new xtd::linq::parallel_query.
+      /// @remarks The elements of a contiguous collection are partitioned in place. The other queries, such as a query after a xtd::linq::query::where, are enumerated into a temporary storage first.
+      auto as_parallel() const {
+        if constexpr (std::contiguous_iterator<iterator>) {
+          auto first = range_.begin();
+          auto last = range_.end();
+          return parallel_query<value_type> {std::span<const value_type> {std::to_address(first), static_cast<xtd::size>(last - first)}, nullptr};
+        } else {
+          if constexpr (requires(std::span<const value_type>& span) {range_.try_get_span(span);}) {
+            auto span = std::span<const value_type> {};
+            if (range_.try_get_span(span)) return parallel_query<value_type> {span, nullptr};
+          }
+          auto storage = std::make_shared<std::vector<value_type>>();
+          for (auto&& item : range_)
+            storage->push_back(item);
+          return parallel_query<value_type> {std::span<const value_type> {storage->data(), storage->size()}, storage};
+        }
+      }
+      
+      /// @brief Computes the average of the query.
+      /// @return The average of the elements.
+      /// @exception xtd::invalid_operation_exception The query contains no elements.
+      double average() const {
+        auto sum = 0.0;
+        auto count = xtd::size {0};
+        for (auto&& item : range_) {
+          sum += static_cast<double>(item);
+          ++count;
+        }
+        if (count == 0) throw xtd::invalid_operation_exception {"Sequence contains no elements", csf_};
+        return sum / static_cast<double>(count);
+      }
+      
+      /// @brief Returns an iterator to the first element of the query.
+      /// @return Iterator to the first element.
+      iterator begin() const {return range_.begin();}
+      
+      /// @brief Determines whether the query contains a specified element.
+      /// @param value The value to locate.
+      /// @return true if the query contains an element that has the specified value; otherwise, false.
+      bool contains(const value_type& value) const {return any([&](const value_type& item) {return item == value;});}
+      
+      /// @brief Returns the number of elements of the query.
+      /// @return The number of elements.
+      xtd::size count() const {
+        if constexpr (std::sized_sentinel_for<iterator, iterator>) return static_cast<xtd::size>(range_.end() - range_.begin());
+        else {
+          auto result = xtd::size {0};
+          for (auto first = range_.begin(), last = range_.end(); first != last; ++first)
+            ++result;
+          return result;
+        }
+      }
+      /// @brief Returns the number of elements of the query that satisfy a condition.
+      /// @param predicate A function to test each element for a condition.
+      /// @return The number of elements that satisfy the condition.
+      template<typename predicate_t>
+      xtd::size count(const predicate_t& predicate) const {
+        auto result = xtd::size {0};
+        for (auto&& item : range_)
+          if (std::invoke(predicate, item)) ++result;
+        return result;
+      }
+      
+      /// @brief Returns the distinct elements of the query.
+      /// @return A new xtd::linq::query that contains the first occurrence of each element.
+      /// @remarks The elements are compared with xtd::collections::generic::helpers::hasher and xtd::collections::generic::helpers::equator.
+      auto distinct() const {return make_query(ranges::distinct_range<range_t> {range_});}
+      
+      /// @brief Returns the element at a specified index of the query.
+      /// @param index The zero-based index of the element to retrieve.
+      /// @return The element at the specified position.
+      /// @exception xtd::argument_out_of_range_exception index is greater than or equal to the number of elements.
+      value_type element_at(xtd::size index) const {
+        auto first = range_.begin();
+        auto last = range_.end();
+        if constexpr (std::random_access_iterator<iterator>) {
+          if (index >= static_cast<xtd::size>(last - first)) throw xtd::argument_out_of_range_exception {csf_};
+          return first[static_cast<xtd::ptrdiff>(index)];
+        } else {
+          for (; first != last; ++first, --index)
+            if (index == 0) return *first;
+          throw xtd::argument_out_of_range_exception {csf_};
+        }
+      }
+      
+      /// @brief Returns an iterator to the element following the last element of the query.
+      /// @return Iterator to the element following the last element.
+      iterator end() const {return range_.end();}
+      
+      /// @brief Returns the first element of the query.
+      /// @return The first element.
+      /// @exception xtd::invalid_operation_exception The query contains no elements.
+      value_type first() const {
+        auto first = range_.begin();
+        if (first == range_.end()) throw xtd::invalid_operation_exception {"Sequence contains no elements", csf_};
+        return *first;
+      }
+      /// @brief Returns the first element of the query that satisfies a condition.
+      /// @param predicate A function to test each element for a condition.
+      /// @return The first element that satisfies the condition.
+      /// @exception xtd::invalid_operation_exception No element satisfies the condition.
+      template<typename predicate_t>
+      value_type first(const predicate_t& predicate) const {
+        for (auto&& item : range_)
+          if (std::invoke(predicate, item)) return item;
+        throw xtd::invalid_operation_exception {"Sequence contains no matching element", csf_};
+      }
+      
+      /// @brief Returns the first element of the query, or a default value if the query contains no elements.
+      /// @return The first element, or value_type {} if the query is empty.
+      value_type first_or_default() const {return first_or_default(value_type {});}
+      /// @brief Returns the first element of the query, or the specified default value if the query contains no elements.
+      /// @param default_value The value to return if the query is empty.
+      /// @return The first element, or default_value if the query is empty.
+      value_type first_or_default(const value_type& default_value) const {
+        auto first = range_.begin();
+        return first == range_.end() ? default_value : value_type {*first};
+      }
+      
+      /// @brief Invokes the specified action on each element of the query.
+      /// @param action The action to invoke on each element.
+      template<typename action_t>
+      void for_each(const action_t& action) const {
+        for (auto&& item : range_)
+          std::invoke(action, item);
+      }
+      
+      /// @brief Groups the elements of the query according to a key selector function.
+      /// @param key_selector A function to extract the key of each element.
+      /// @return A new xtd::linq::query of xtd::linq::grouping <key_t, value_type>, in the order of the first appearance of each key.
+      /// @remarks The keys are compared with xtd::collections::generic::helpers::hasher and xtd::collections::generic::helpers::equator.
+      template<typename key_selector_t>
+      auto group_by(const key_selector_t& key_selector) const {return make_query(ranges::group_by_range<range_t, key_selector_t> {range_, key_selector});}
+      
+      /// @brief Returns the last element of the query.
+      /// @return The last element.
+      /// @exception xtd::invalid_operation_exception The query contains no elements.
+      value_type last() const {
+        auto result = std::optional<value_type> {};
+        for (auto&& item : range_)
+          result = item;
+        if (!result) throw xtd::invalid_operation_exception {"Sequence contains no elements", csf_};
+        return *result;
+      }
+      
+      /// @brief Returns the maximum value of the query.
+      /// @return The maximum value.
+      /// @exception xtd::invalid_operation_exception The query contains no elements.
+      value_type max() const {return aggregate([](value_type result, const value_type& item) {return result < item ? item : result;});}
+      
+      /// @brief Returns the minimum value of the query.
+      /// @return The minimum value.
+      /// @exception xtd::invalid_operation_exception The query contains no elements.
+      value_type min() const {return aggregate([](value_type result, const value_type& item) {return item < result ? item : result;});}
+      
+      /// @brief Sorts the elements of the query in ascending order according to a key.
+      /// @param key_selector A function to extract the key of each element.
+      /// @return A new xtd::linq::query whose elements are sorted according to the key.
+      /// @remarks The sort is stable. The keys are compared with xtd::collections::generic::helpers::comparer.
+      template<typename key_selector_t>
+      auto order_by(const key_selector_t& key_selector) const {return make_query(ranges::order_by_range<range_t, key_selector_t> {range_, key_selector, false});}
+      
+      /// @brief Sorts the elements of the query in descending order according to a key.
+      /// @param key_selector A function to extract the key of each element.
+      /// @return A new xtd::linq::query whose elements are sorted in descending order according to the key.
+      /// @remarks The sort is stable. The keys are compared with xtd::collections::generic::helpers::comparer.
+      template<typename key_selector_t>
+      auto order_by_descending(const key_selector_t& key_selector) const {return make_query(ranges::order_by_range<range_t, key_selector_t> {range_, key_selector, true});}
+      
+      /// @brief Projects each element of the query into a new form.
+      /// @param selector A transform function to apply to each element.
+      /// @return A new xtd::linq::query whose elements are the result of invoking the transform function on each element.
+      template<typename selector_t>
+      auto select(const selector_t& selector) const {return make_query(ranges::select_range<range_t, selector_t> {range_, selector});}
+      
+      /// @brief Projects each element of the query to a collection and flattens the resulting collections into one query.
+      /// @param selector A transform function that returns the collection of each element.
+      /// @return A new xtd::linq::query whose elements are the elements of the collections returned by the transform function.
+      template<typename selector_t>
+      auto select_many(const selector_t& selector) const {return make_query(ranges::select_many_range<range_t, selector_t> {range_, selector});}
+      
+      /// @brief Bypasses a specified number of elements of the query and then returns the remaining elements.
+      /// @param count The number of elements to skip.
+      /// @return A new xtd::linq::query that contains the elements that occur after the specified index.
+      auto skip(xtd::size count) const {return make_query(ranges::skip_range<range_t> {range_, count});}
+      
+      /// @brief Bypasses the elements of the query as long as a specified condition is true and then returns the remaining elements.
+      /// @param predicate A function to test each element for a condition.
+      /// @return A new xtd::linq::query that contains the elements starting at the first element that does not satisfy the condition.
+      template<typename predicate_t>
+      auto skip_while(const predicate_t& predicate) const {return make_query(ranges::skip_while_range<range_t, predicate_t> {range_, predicate});}
+      
+      /// @brief Computes the sum of the query.
+      /// @return The sum of the elements.
+      value_type sum() const {
+        auto result = value_type {};
+        for (auto&& item : range_)
+          result += item;
+        return result;
+      }
+      
+      /// @brief Returns a specified number of contiguous elements from the start of the query.
+      /// @param count The number of elements to return.
+      /// @return A new xtd::linq::query that contains the specified number of elements from the start of the query.
+      auto take(xtd::size count) const {return make_query(ranges::take_range<range_t> {range_, count});}
+      
+      /// @brief Returns the elements of the query as long as a specified condition is true.
+      /// @param predicate A function to test each element for a condition.
+      /// @return A new xtd::linq::query that contains the elements that occur before the first element that does not satisfy the condition.
+      template<typename predicate_t>
+      auto take_while(const predicate_t& predicate) const {return make_query(ranges::take_while_range<range_t, predicate_t> {range_, predicate});}
+      
+      /// @brief Creates an xtd::array from the query.
+      /// @return An xtd::array that contains the elements of the query.
+      xtd::array<value_type> to_array() const {
+        auto result = xtd::array<value_type> {};
+        append_to(result);
+        return result;
+      }
+      
+      /// @brief Creates an xtd::collections::generic::list from the query.
+      /// @return An xtd::collections::generic::list that contains the elements of the query.
+      xtd::collections::generic::list<value_type> to_list() const {
+        auto result = typename xtd::collections::generic::list<value_type>::base_type {};
+        append_to(result);
+        return xtd::collections::generic::list<value_type>(std::move(result));
+      }
+      
+      /// @brief Filters the query based on a predicate.
+      /// @param predicate A function to test each element for a condition.
+      /// @return A new xtd::linq::query that contains the elements that satisfy the condition.
+      template<typename predicate_t>
+      auto where(const predicate_t& predicate) const {return make_query(ranges::where_range<range_t, predicate_t> {range_, predicate});}
+      /// @}
+    
+    private:
+      template<typename container_t>
+      void append_to(container_t& result) const {
+        if constexpr (std::sized_sentinel_for<iterator, iterator>) result.reserve(count());
+        for (auto&& item : range_)
+          result.push_back(item);
+      }
+      
+      template<typename result_range_t>
+      static query<result_range_t> make_query(const result_range_t& range) {return query<result_range_t> {range};}
+      
+      range_t range_;
+    };
+  }
+}
@@ -0,0 +1,676 @@
+/// @file
+/// @brief Contains the ranges of xtd::linq::query <range_t> class.
+/// @copyright Copyright (c) 2024 Gammasoft. All rights reserved.
+#pragma once
+#include "grouping.h"
+#include "../collections/generic/enumerator.h"
+#include "../collections/generic/ienumerable.h"
+#include "../collections/generic/list.h"
+#include "../collections/generic/helpers/comparer.h"
+#include "../collections/generic/helpers/equator.h"
+#include "../collections/generic/helpers/hasher.h"
+#include "../ptrdiff.h"
+#include "../size.h"
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+/// @cond
+namespace xtd {
+  namespace linq {
+    namespace ranges {
+      // Every range exposes const begin and end methods returning the same iterator type. The adapters keep their source range by value and their iterators keep a pointer to the range, so a query chain is a single object whose iteration is inlined by the compiler.
+      template<typename range_t>
+      using iterator_t = std::remove_cvref_t<decltype(std::declval<const range_t&>().begin())>;
+      
+      template<typename range_t>
+      using value_t = std::iter_value_t<iterator_t<range_t>>;
+      
+      template<typename range_t>
+      using reference_t = std::iter_reference_t<iterator_t<range_t>>;
+      
+      template<typename iterator_t>
+      class source_range {
+      public:
+        source_range(iterator_t first, iterator_t last) : first_(first), last_(last) {}
+        
+        iterator_t begin() const {return first_;}
+        iterator_t end() const {return last_;}
+      
+      private:
+        iterator_t first_;
+        iterator_t last_;
+      };
+      
+      // Iterates an xtd::collections::generic::ienumerable <type_t> by spans : the whole collection when xtd::collections::generic::ienumerable::try_get_span succeeds, otherwise the batches returned by xtd::collections::generic::ienumerator::move_next_batch.
+      template<typename type_t>
+      class enumerable_range {
+      public:
+        class iterator {
+        public:
+          using iterator_category = std::input_iterator_tag;
+          using value_type = type_t;
+          using difference_type = xtd::ptrdiff;
+          using pointer = const type_t*;
+          using reference = const type_t&;
+          
+          iterator() = default;
+          explicit iterator(const xtd::collections::generic::ienumerable<type_t>& enumerable) {
+            auto span = std::span<const type_t> {};
+            if (enumerable.try_get_span(span)) assign(span);
+            else {
+              enumerator_ = enumerable.get_enumerator();
+              has_enumerator_ = true;
+              next_batch();
+            }
+          }
+          
+          reference operator *() const noexcept {return *current_;}
+          pointer operator ->() const noexcept {return current_;}
+          
+          iterator& operator ++() {
+            if (++current_ == last_) next_batch();
+            return *this;
+          }
+          iterator operator ++(int) {
+            auto result = *this;
+            operator ++();
+            return result;
+          }
+          
+          friend bool operator ==(const iterator& a, const iterator& b) noexcept {return a.current_ == b.current_;}
+        
+        private:
+          void assign(std::span<const type_t> span) noexcept {
+            current_ = span.empty() ? nullptr : span.data();
+            last_ = span.empty() ? nullptr : span.data() + span.size();
+          }
+          
+          void next_batch() {
+            if (has_enumerator_) assign(enumerator_.move_next_batch());
+            else assign({});
+          }
+          
+          xtd::collections::generic::enumerator<type_t> enumerator_;
+          bool has_enumerator_ = false;
+          const type_t* current_ = nullptr;
+          const type_t* last_ = nullptr;
+        };
+        
+        explicit enumerable_range(const xtd::collections::generic::ienumerable<type_t>& enumerable) : enumerable_(&enumerable) {}
+        
+        iterator begin() const {return iterator {*enumerable_};}
+        iterator end() const {return iterator {};}
+        
+        bool try_get_span(std::span<const type_t>& result) const noexcept {return enumerable_->try_get_span(result);}
+      
+      private:
+        const xtd::collections::generic::ienumerable<type_t>* enumerable_ = nullptr;
+      };
+      
+      template<typename type_t>
+      class repeat_range {
+      public:
+        class iterator {
+        public:
+          using iterator_category = std::random_access_iterator_tag;
+          using value_type = type_t;
+          using difference_type = xtd::ptrdiff;
+          using pointer = const type_t*;
+          using reference = const type_t&;
+          
+          iterator() = default;
+          iterator(const repeat_range* range, xtd::size index) noexcept : range_(range), index_(index) {}
+          
+          reference operator *() const noexcept {return range_->value_;}
+          pointer operator ->() const noexcept {return &range_->value_;}
+          reference operator [](difference_type) const noexcept {return range_->value_;}
+          
+          iterator& operator ++() noexcept {++index_; return *this;}
+          iterator operator ++(int) noexcept {return iterator {range_, index_++};}
+          iterator& operator --() noexcept {--index_; return *this;}
+          iterator operator --(int) noexcept {return iterator {range_, index_--};}
+          iterator& operator +=(difference_type value) noexcept {index_ += value; return *this;}
+          iterator& operator -=(difference_type value) noexcept {index_ -= value; return *this;}
+          iterator operator +(difference_type value) const noexcept {return iterator {range_, index_ + value};}
+          friend iterator operator +(difference_type value, const iterator& iterator) noexcept {return iterator + value;}
+          iterator operator -(difference_type value) const noexcept {return iterator {range_, index_ - value};}
+          difference_type operator -(const iterator& value) const noexcept {return static_cast<difference_type>(index_) - static_cast<difference_type>(value.index_);}
+          
+          bool operator ==(const iterator& value) const noexcept {return index_ == value.index_;}
+          auto operator <=>(const iterator& value) const noexcept {return index_ <=> value.index_;}
+        
+        private:
+          const repeat_range* range_ = nullptr;
+          xtd::size index_ = 0;
+        };
+        
+        repeat_range(const type_t& value, xtd::size count) : value_(value), count_(count) {}
+        
+        iterator begin() const noexcept {return iterator {this, 0};}
+        iterator end() const noexcept {return iterator {this, count_};}
+      
+      private:
+        type_t value_;
+        xtd::size count_ = 0;
+      };
+      
+      template<typename type_t>
+      class range_range {
+      public:
+        class iterator {
+        public:
+          using iterator_category = std::random_access_iterator_tag;
+          using value_type = type_t;
+          using difference_type = xtd::ptrdiff;
+          using pointer = void;
+          using reference = type_t;
+          
+          iterator() = default;
+          explicit iterator(type_t value) noexcept : value_(value) {}
+          
+          reference operator *() const noexcept {return value_;}
+          reference operator [](difference_type index) const noexcept {return static_cast<type_t>(value_ + index);}
+          
+          iterator& operator ++() noexcept {++value_; return *this;}
+          iterator operator ++(int) noexcept {return iterator {value_++};}
+          iterator& operator --() noexcept {--value_; return *this;}
+          iterator operator --(int) noexcept {return iterator {value_--};}
+          iterator& operator +=(difference_type value) noexcept {value_ = static_cast<type_t>(value_ + value); return *this;}
+          iterator& operator -=(difference_type value) noexcept {value_ = static_cast<type_t>(value_ - value); return *this;}
+          iterator operator +(difference_type value) const noexcept {return iterator {static_cast<type_t>(value_ + value)};}
+          friend iterator operator +(difference_type value, const iterator& iterator) noexcept {return iterator + value;}
+          iterator operator -(difference_type value) const noexcept {return iterator {static_cast<type_t>(value_ - value)};}
+          difference_type operator -(const iterator& value) const noexcept {return static_cast<difference_type>(value_) - static_cast<difference_type>(value.value_);}
+          
+          bool operator ==(const iterator& value) const noexcept {return value_ == value.value_;}
+          auto operator <=>(const iterator& value) const noexcept {return value_ <=> value.value_;}
+        
+        private:
+          type_t value_ {};
+        };
+        
+        range_range(type_t start, xtd::size count) noexcept : start_(start), count_(count) {}
+        
+        iterator begin() const noexcept {return iterator {start_};}
+        iterator end() const noexcept {return iterator {static_cast<type_t>(start_ + static_cast<type_t>(count_))};}
+      
+      private:
+        type_t start_ {};
+        xtd::size count_ = 0;
+      };
+      
+      template<typename range_t, typename predicate_t>
+      class where_range {
+      public:
+        class iterator {
+        public:
+          using iterator_category = std::input_iterator_tag;
+          using value_type = value_t<range_t>;
+          using difference_type = xtd::ptrdiff;
+          using reference = reference_t<range_t>;
+          
+          iterator() = default;
+          iterator(const where_range* range, iterator_t<range_t> current, iterator_t<range_t> last) : range_(range), current_(current), last_(last) {satisfy();}
+          
+          reference operator *() const {return *current_;}
+          
+          iterator& operator ++() {
+            ++current_;
+            satisfy();
+            return *this;
+          }
+          iterator operator ++(int) {
+            auto result = *this;
+            operator ++();
+            return result;
+          }
+          
+          friend bool operator ==(const iterator& a, const iterator& b) {return a.current_ == b.current_;}
+        
+        private:
+          void satisfy() {
+            while (current_ != last_ && !std::invoke(range_->predicate_, *current_))
+              ++current_;
+          }
+          
+          const where_range* range_ = nullptr;
+          iterator_t<range_t> current_;
+          iterator_t<range_t> last_;
+        };
+        
+        where_range(const range_t& range, const predicate_t& predicate) : range_(range), predicate_(predicate) {}
+        
+        iterator begin() const {return iterator {this, range_.begin(), range_.end()};}
+        iterator end() const {return iterator {this, range_.end(), range_.end()};}
+      
+      private:
+        range_t range_;
+        predicate_t predicate_;
+      };
+      
+      template<typename range_t, typename selector_t>
+      class select_range {
+      public:
+        class iterator {
+        public:
+          using iterator_category = std::input_iterator_tag;
+          using reference = std::invoke_result_t<const selector_t&, reference_t<range_t>>;
+          using value_type = std::remove_cvref_t<reference>;
+          using difference_type = xtd::ptrdiff;
+          
+          iterator() = default;
+          iterator(const select_range* range, iterator_t<range_t> current) : range_(range), current_(current) {}
+          
+          reference operator *() const {return std::invoke(range_->selector_, *current_);}
+          
+          iterator& operator ++() {
+            ++current_;
+            return *this;
+          }
+          iterator operator ++(int) {
+            auto result = *this;
+            operator ++();
+            return result;
+          }
+          
+          friend bool operator ==(const iterator& a, const iterator& b) {return a.current_ == b.current_;}
+        
+        private:
+          const select_range* range_ = nullptr;
+          iterator_t<range_t> current_;
+        };
+        
+        select_range(const range_t& range, const selector_t& selector) : range_(range), selector_(selector) {}
+        
+        iterator begin() const {return iterator {this, range_.begin()};}
+        iterator end() const {return iterator {this, range_.end()};}
+      
+      private:
+        range_t range_;
+        selector_t selector_;
+      };
+      
+      template<typename range_t, typename selector_t>
+      class select_many_range {
+        using collection_result = std::invoke_result_t<const selector_t&, reference_t<range_t>>;
+        using collection_type = std::remove_cvref_t<collection_result>;
+        // A collection returned by reference is kept by pointer; a collection returned by value is shared by the copies of the iterator.
+        using collection_holder = std::conditional_t<std::is_lvalue_reference_v<collection_result>, const collection_type*, std::shared_ptr<const collection_type>>;
+        using inner_iterator = std::remove_cvref_t<decltype(std::begin(std::declval<const collection_type&>()))>;
+      
+      public:
+        class iterator {
+        public:
+          using iterator_category = std::input_iterator_tag;
+          using value_type = std::iter_value_t<inner_iterator>;
+          using difference_type = xtd::ptrdiff;
+          using reference = std::iter_reference_t<inner_iterator>;
+          
+          iterator() = default;
+          iterator(const select_many_range* range, iterator_t<range_t> current, iterator_t<range_t> last) : range_(range), current_(current), last_(last) {satisfy();}
+          
+          reference operator *() const {return *inner_current_;}
+          
+          iterator& operator ++() {
+            if (++inner_current_ == inner_last_) {
+              collection_ = {};
+              ++current_;
+              satisfy();
+            }
+            return *this;
+          }
+          iterator operator ++(int) {
+            auto result = *this;
+            operator ++();
+            return result;
+          }
+          
+          friend bool operator ==(const iterator& a, const iterator& b) {
+            auto a_end = a.current_ == a.last_;
+            auto b_end = b.current_ == b.last_;
+            return a_end || b_end ? a_end == b_end : a.current_ == b.current_ && a.inner_current_ == b.inner_current_;
+          }
+        
+        private:
+          void satisfy() {
+            for (; current_ != last_; ++current_) {
+              if constexpr (std::is_lvalue_reference_v<collection_result>) collection_ = &std::invoke(range_->selector_, *current_);
+              else collection_ = std::make_shared<const collection_type>(std::invoke(range_->selector_, *current_));
+              inner_current_ = std::begin(*collection_);
+              inner_last_ = std::end(*collection_);
+              if (inner_current_ != inner_last_) return;
+              collection_ = {};
+            }
+          }
+          
+          const select_many_range* range_ = nullptr;
+          iterator_t<range_t> current_;
+          iterator_t<range_t> last_;
+          collection_holder collection_ {};
+          inner_iterator inner_current_ {};
+          inner_iterator inner_last_ {};
+        };
+        
+        select_many_range(const range_t& range, const selector_t& selector) : range_(range), selector_(selector) {}
+        
+        iterator begin() const {return iterator {this, range_.begin(), range_.end()};}
+        iterator end() const {return iterator {this, range_.end(), range_.end()};}
+      
+      private:
+        range_t range_;
+        selector_t selector_;
+      };
+      
+      template<typename range_t>
+      class take_range {
+      public:
+        class iterator {
+        public:
+          using iterator_category = std::input_iterator_tag;
+          using value_type = value_t<range_t>;
+          using difference_type = xtd::ptrdiff;
+          using reference = reference_t<range_t>;
+          
+          iterator() = default;
+          iterator(iterator_t<range_t> current, iterator_t<range_t> last, xtd::size remaining) : current_(current), last_(last), remaining_(remaining) {}
+          
+          reference operator *() const {return *current_;}
+          
+          iterator& operator ++() {
+            // The source is not advanced past the last taken element, so a take after a where does not test the predicate on the following elements.
+            if (--remaining_) ++current_;
+            return *this;
+          }
+          iterator operator ++(int) {
+            auto result = *this;
+            operator ++();
+            return result;
+          }
+          
+          friend bool operator ==(const iterator& a, const iterator& b) {
+            auto a_end = a.remaining_ == 0 || a.current_ == a.last_;
+            auto b_end = b.remaining_ == 0 || b.current_ == b.last_;
+            return a_end || b_end ? a_end == b_end : a.current_ == b.current_;
+          }
+        
+        private:
+          iterator_t<range_t> current_;
+          iterator_t<range_t> last_;
+          xtd::size remaining_ = 0;
+        };
+        
+        take_range(const range_t& range, xtd::size count) : range_(range), count_(count) {}
+        
+        iterator begin() const {return iterator {range_.begin(), range_.end(), count_};}
+        iterator end() const {return iterator {range_.end(), range_.end(), 0};}
+      
+      private:
+        range_t range_;
+        xtd::size count_ = 0;
+      };
+      
+      template<typename range_t, typename predicate_t>
+      class take_while_range {
+      public:
+        class iterator {
+        public:
+          using iterator_category = std::input_iterator_tag;
+          using value_type = value_t<range_t>;
+          using difference_type = xtd::ptrdiff;
+          using reference = reference_t<range_t>;
+          
+          iterator() = default;
+          iterator(const take_while_range* range, iterator_t<range_t> current, iterator_t<range_t> last) : range_(range), current_(current), last_(last) {satisfy();}
+          
+          reference operator *() const {return *current_;}
+          
+          iterator& operator ++() {
+            ++current_;
+            satisfy();
+            return *this;
+          }
+          iterator operator ++(int) {
+            auto result = *this;
+            operator ++();
+            return result;
+          }
+          
+          friend bool operator ==(const iterator& a, const iterator& b) {
+            auto a_end = a.done_ || a.current_ == a.last_;
+            auto b_end = b.done_ || b.current_ == b.last_;
+            return a_end || b_end ? a_end == b_end : a.current_ == b.current_;
+          }
+        
+        private:
+          void satisfy() {
+            if (current_ != last_ && !std::invoke(range_->predicate_, *current_)) done_ = true;
+          }
+          
+          const take_while_range* range_ = nullptr;
+          iterator_t<range_t> current_;
+          iterator_t<range_t> last_;
+          bool done_ = false;
+        };
+        
+        take_while_range(const range_t& range, const predicate_t& predicate) : range_(range), predicate_(predicate) {}
+        
+        iterator begin() const {return iterator {this, range_.begin(), range_.end()};}
+        iterator end() const {return iterator {this, range_.end(), range_.end()};}
+      
+      private:
+        range_t range_;
+        predicate_t predicate_;
+      };
+      
+      template<typename range_t>
+      class skip_range {
+      public:
+        skip_range(const range_t& range, xtd::size count) : range_(range), count_(count) {}
+        
+        iterator_t<range_t> begin() const {
+          auto first = range_.begin();
+          auto last = range_.end();
+          if constexpr (std::random_access_iterator<iterator_t<range_t>>) return first + static_cast<xtd::ptrdiff>(std::min(count_, static_cast<xtd::size>(last - first)));
+          else {
+            for (auto index = xtd::size {0}; index < count_ && first != last; ++index)
+              ++first;
+            return first;
+          }
+        }
+        iterator_t<range_t> end() const {return range_.end();}
+      
+      private:
+        range_t range_;
+        xtd::size count_ = 0;
+      };
+      
+      template<typename range_t, typename predicate_t>
+      class skip_while_range {
+      public:
+        skip_while_range(const range_t& range, const predicate_t& predicate) : range_(range), predicate_(predicate) {}
+        
+        iterator_t<range_t> begin() const {
+          auto first = range_.begin();
+          auto last = range_.end();
+          while (first != last && std::invoke(predicate_, *first))
+            ++first;
+          return first;
+        }
+        iterator_t<range_t> end() const {return range_.end();}
+      
+      private:
+        range_t range_;
+        predicate_t predicate_;
+      };
+      
+      template<typename range_t>
+      class distinct_range {
+        using set_type = std::unordered_set<value_t<range_t>, xtd::collections::generic::helpers::hasher<value_t<range_t>>, xtd::collections::generic::helpers::equator<value_t<range_t>>>;
+      
+      public:
+        class iterator {
+        public:
+          using iterator_category = std::input_iterator_tag;
+          using value_type = value_t<range_t>;
+          using difference_type = xtd::ptrdiff;
+          using reference = reference_t<range_t>;
+          
+          iterator() = default;
+          iterator(iterator_t<range_t> current, iterator_t<range_t> last, bool is_begin) : current_(current), last_(last) {
+            if (!is_begin) return;
+            seen_ = std::make_shared<set_type>();
+            satisfy();
+          }
+          
+          reference operator *() const {return *current_;}
+          
+          iterator& operator ++() {
+            ++current_;
+            satisfy();
+            return *this;
+          }
+          iterator operator ++(int) {
+            auto result = *this;
+            operator ++();
+            return result;
+          }
+          
+          friend bool operator ==(const iterator& a, const iterator& b) {return a.current_ == b.current_;}
+        
+        private:
+          void satisfy() {
+            while (current_ != last_ && !seen_->insert(*current_).second)
+              ++current_;
+          }
+          
+          iterator_t<range_t> current_;
+          iterator_t<range_t> last_;
+          std::shared_ptr<set_type> seen_;
+        };
+        
+        explicit distinct_range(const range_t& range) : range_(range) {}
+        
+        iterator begin() const {return iterator {range_.begin(), range_.end(), true};}
+        iterator end() const {return iterator {range_.end(), range_.end(), false};}
+      
+      private:
+        range_t range_;
+      };
+      
+      // The ordered and grouped ranges need all the elements : each enumeration enumerates the source into a buffer that the copies of its begin iterator share.
+      // A buffer_iterator without buffer is the end of every enumeration, so the ranges can be enumerated again, and from several threads, with the current elements of the source.
+      template<typename items_t>
+      class buffer_iterator {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = typename items_t::value_type;
+        using difference_type = xtd::ptrdiff;
+        using pointer = const value_type*;
+        using reference = const value_type&;
+        
+        buffer_iterator() = default;
+        explicit buffer_iterator(std::shared_ptr<const items_t> items) : items_(std::move(items)) {}
+        
+        reference operator *() const noexcept {return (*items_)[index_];}
+        pointer operator ->() const noexcept {return &(*items_)[index_];}
+        
+        buffer_iterator& operator ++() noexcept {
+          ++index_;
+          return *this;
+        }
+        buffer_iterator operator ++(int) noexcept {
+          auto result = *this;
+          ++index_;
+          return result;
+        }
+        
+        friend bool operator ==(const buffer_iterator& a, const buffer_iterator& b) noexcept {
+          if (a.is_end() || b.is_end()) return a.is_end() == b.is_end();
+          return a.items_ == b.items_ && a.index_ == b.index_;
+        }
+      
+      private:
+        bool is_end() const noexcept {return !items_ || index_ == items_->size();}
+        
+        std::shared_ptr<const items_t> items_;
+        xtd::size index_ = 0;
+      };
+      
+      template<typename range_t, typename key_selector_t>
+      class order_by_range {
+        using items_type = std::vector<value_t<range_t>>;
+      
+      public:
+        using iterator = buffer_iterator<items_type>;
+        
+        order_by_range(const range_t& range, const key_selector_t& key_selector, bool descending) : range_(range), key_selector_(key_selector), descending_(descending) {}
+        
+        iterator begin() const {return iterator {items()};}
+        iterator end() const {return iterator {};}
+      
+      private:
+        std::shared_ptr<const items_type> items() const {
+          auto items = std::make_shared<items_type>();
+          for (auto&& item : range_)
+            items->push_back(item);
+          using key_type = std::remove_cvref_t<std::invoke_result_t<const key_selector_t&, const value_t<range_t>&>>;
+          auto comparer = xtd::collections::generic::helpers::comparer<key_type> {};
+          if (descending_) std::stable_sort(items->begin(), items->end(), [&](const auto& a, const auto& b) {return comparer(std::invoke(key_selector_, b), std::invoke(key_selector_, a));});
+          else std::stable_sort(items->begin(), items->end(), [&](const auto& a, const auto& b) {return comparer(std::invoke(key_selector_, a), std::invoke(key_selector_, b));});
+          return items;
+        }
+        
+        range_t range_;
+        key_selector_t key_selector_;
+        bool descending_ = false;
+      };
+      
+      template<typename range_t, typename key_selector_t>
+      class group_by_range {
+        using key_type = std::remove_cvref_t<std::invoke_result_t<const key_selector_t&, const value_t<range_t>&>>;
+        using items_type = std::vector<xtd::linq::grouping<key_type, value_t<range_t>>>;
+      
+      public:
+        using iterator = buffer_iterator<items_type>;
+        
+        group_by_range(const range_t& range, const key_selector_t& key_selector) : range_(range), key_selector_(key_selector) {}
+        
+        iterator begin() const {return iterator {items()};}
+        iterator end() const {return iterator {};}
+      
+      private:
+        std::shared_ptr<const items_type> items() const {
+          auto keys = std::vector<key_type> {};
+          auto elements = std::vector<xtd::collections::generic::list<value_t<range_t>>> {};
+          auto indexes = std::unordered_map<key_type, xtd::size, xtd::collections::generic::helpers::hasher<key_type>, xtd::collections::generic::helpers::equator<key_type>> {};
+          for (auto&& item : range_) {
+            auto key = std::invoke(key_selector_, item);
+            auto [position, inserted] = indexes.try_emplace(key, keys.size());
+            if (inserted) {
+              keys.push_back(key);
+              elements.emplace_back();
+            }
+            elements[position->second].add(item);
+          }
+          auto items = std::make_shared<items_type>();
+          items->reserve(keys.size());
+          for (auto index = xtd::size {0}; index < keys.size(); ++index)
+            items->emplace_back(keys[index], std::move(elements[index]));
+          return items;
+        }
+        
+        range_t range_;
+        key_selector_t key_selector_;
+      };
+    }
+  }
+}
+/// @endcond
@@ -0,0 +1,119 @@
+/// @file
+/// @brief Contains xtd::net::sockets::datagram_buffer class.
+/// @copyright Copyright (c) 2024 Gammasoft. All rights reserved.
+#pragma once
+#include "../ip_end_point.h"
+#include "../../object.h"
+#include "../../types.h"
+#include <span>
+#include <vector>
+
+/// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
+namespace xtd {
+  /// @brief The xtd::net namespace provides a simple programming interface for many of the protocols used on networks today. The xtd::net::web_request and xtd::net::web_response classes form the basis of what are called pluggable protocols, an implementation of network services that enables you to develop applications that use Internet resources without worrying about the specific details of the individual protocols.
+  namespace net {
+    /// @brief The xtd::net::sockets namespace provides a managed implementation of the Berkeley Sockets interface for developers who need to tightly control access to the network.
+    namespace sockets {
+      /// @cond
+      class udp_client;
+      /// @endcond
+      
+      /// @brief Represents a preallocated datagram slot used by xtd::net::sockets::udp_client::receive_batch and xtd::net::sockets::udp_client::send_batch.
+      /// ```cpp
+      /// class core_export_ datagram_buffer : public xtd::object
+      /// ```
+      /// @par Inheritance
+      /// xtd::object → xtd::net::sockets::datagram_buffer
+      /// @par Header
+      /// ```cpp
+      /// #include <xtd/net/sockets/datagram_buffer>
+      /// ```
+      /// @par Namespace
+      /// xtd::net::sockets
+      /// @par Library
+      /// xtd.core
+      /// @ingroup xtd_core
+      /// @remarks The storage of a xtd::net::sockets::datagram_buffer is allocated once, when it is created. Reuse the same datagram buffers for each batch : no memory is allocated when a datagram is received into or sent from them.
+      /// @remarks The remote end point is kept in its serialized form too. It is only serialized again when it changes, and it is only decoded again when a datagram comes from another remote host than the previous one received in the same datagram buffer.
+      class core_export_ datagram_buffer : public xtd::object {
+      public:
+        /// @name Public Fields
+        
+        /// @{
+        /// @brief Represents the default capacity of a xtd::net::sockets::datagram_buffer. This capacity can hold the largest UDP datagram.
+        static constexpr size_t default_capacity = 0x10000;
+        /// @}
+        
+        /// @name Public Constructors
+        
+        /// @{
+        /// @brief Initializes a new instance of the xtd::net::sockets::datagram_buffer class with the xtd::net::sockets::datagram_buffer::default_capacity capacity.
+        datagram_buffer();
+        /// @brief Initializes a new instance of the xtd::net::sockets::datagram_buffer class with the specified capacity.
+        /// @param capacity The largest datagram, in bytes, that can be held.
+        /// @remarks A received datagram larger than capacity is truncated. See xtd::net::sockets::datagram_buffer::truncated.
+        explicit datagram_buffer(size_t capacity);
+        /// @}
+        
+        /// @cond
+        datagram_buffer(datagram_buffer&&) = default;
+        datagram_buffer(const datagram_buffer&) = default;
+        datagram_buffer& operator =(datagram_buffer&&) = default;
+        datagram_buffer& operator =(const datagram_buffer&) = default;
+        /// @endcond
+        
+        /// @name Public Properties
+        
+        /// @{
+        /// @brief Gets the whole storage of the datagram buffer.
+        /// @return A span of xtd::net::sockets::datagram_buffer::capacity bytes. Write the datagram to send at the beginning of this span, then set xtd::net::sockets::datagram_buffer::size.
+        std::span<xtd::byte> buffer() noexcept;
+        
+        /// @brief Gets the largest datagram, in bytes, that can be held.
+        /// @return The capacity of the datagram buffer.
+        size_t capacity() const noexcept;
+        
+        /// @brief Gets the datagram held.
+        /// @return A span of xtd::net::sockets::datagram_buffer::size bytes.
+        std::span<const xtd::byte> data() const noexcept;
+        
+        /// @brief Gets the remote end point the datagram was received from or is sent to.
+        /// @return An xtd::net::ip_end_point.
+        const xtd::net::ip_end_point& remote_end_point() const noexcept;
+        /// @brief Sets the remote end point the datagram is sent to.
+        /// @param value An xtd::net::ip_end_point.
+        /// @return The current instance.
+        /// @remarks A datagram buffer whose remote end point is not set is sent to the default remote host established with xtd::net::sockets::udp_client::connect.
+        datagram_buffer& remote_end_point(const xtd::net::ip_end_point& value);
+        
+        /// @brief Gets the size of the segments held by the datagram buffer.
+        /// @return The size of each segment, in bytes.
+        /// @remarks When generic receive offload is enabled with xtd::net::sockets::udp_client::receive_offload, the operating system can coalesce several datagrams of the same remote host into one datagram buffer. The datagram buffer then holds consecutive segments of xtd::net::sockets::datagram_buffer::segment_size bytes, the last one can be shorter. Otherwise, xtd::net::sockets::datagram_buffer::segment_size is equal to xtd::net::sockets::datagram_buffer::size.
+        size_t segment_size() const noexcept;
+        
+        /// @brief Gets the size of the datagram held.
+        /// @return The size of the datagram, in bytes.
+        size_t size() const noexcept;
+        /// @brief Sets the size of the datagram to send.
+        /// @param value The size of the datagram, in bytes.
+        /// @return The current instance.
+        /// @exception xtd::argument_out_of_range_exception value is greater than xtd::net::sockets::datagram_buffer::capacity.
+        datagram_buffer& size(size_t value);
+        
+        /// @brief Gets a value that indicates whether the received datagram was larger than the capacity of the datagram buffer.
+        /// @return true if the end of the datagram was discarded; otherwise false.
+        bool truncated() const noexcept;
+        /// @}
+      
+      private:
+        friend class udp_client;
+        std::vector<xtd::byte> buffer_;
+        size_t size_ = 0;
+        size_t segment_size_ = 0;
+        bool truncated_ = false;
+        xtd::net::ip_end_point remote_end_point_;
+        std::vector<xtd::byte> socket_address_;
+      };
+    }
+  }
+}
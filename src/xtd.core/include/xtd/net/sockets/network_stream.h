@@ -4,6 +4,8 @@
 #pragma once
 #include "socket.h"
 #include <iostream>
+#include <span>
+#include <vector>
 
 /// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
 namespace xtd {
@@ -29,6 +31,7 @@ namespace xtd {
       /// @remarks The xtd::net::sockets::network_stream class provides methods for sending and receiving data over std::iostream sockets in blocking mode. You can use the xtd::net::sockets::network_stream class for both synchronous and asynchronous data transfer.
       /// @remarks To create a xtd::net::sockets::network_stream, you must provide a connected xtd::net::sockets::socket. By default, closing the xtd::net::sockets::network_stream does not close the provided xtd::net::sockets::socket. If you want the xtd::net::sockets::network_stream to have permission to close the provided xtd::net::sockets::socket, you must specify true for the value of the owns_socket parameter.
       /// @remarks Use the std::iostream::write and std::iostream::read methods for simple single thread synchronous blocking I/O.
+      /// @remarks The received data is read ahead into a receive buffer and the written data is gathered in a send buffer, so that a whole buffer is transferred per system call. The std::ios_base::unitbuf flag is set by default : the send buffer is flushed at the end of each output operation, as each write was sent immediately. Clear this flag with std::iostream::unsetf to send the data only when the buffer is full or when std::iostream::flush is called.
       /// @remarks The xtd::net::sockets::network_stream does not support random access to the network data stream.
       /// @remarks std::iostream::read and std::iostream::write operations can be performed simultaneously on an instance of the xtd::net::sockets::network_stream class without the need for synchronization. As long as there is one unique thread for the write operations and one unique thread for the read operations, there will be no cross-interference between read and write threads and no synchronization is required.
       /// @par Examples
@@ -37,15 +40,27 @@ namespace xtd {
       class core_export_ network_stream : public std::iostream {
         class socket_streambuf : public std::streambuf {
         public:
-          socket_streambuf(const xtd::net::sockets::socket& socket, bool owns_socket);
+          socket_streambuf(const xtd::net::sockets::socket& socket, bool owns_socket, size_t receive_buffer_size, size_t send_buffer_size);
           ~socket_streambuf();
           
           int32 underflow() override;
           int32 overflow(int32 value) override;
+          std::streamsize showmanyc() override;
+          int32 sync() override;
+          std::streamsize xsgetn(char* s, std::streamsize count) override;
+          std::streamsize xsputn(const char* s, std::streamsize count) override;
+          
+          bool has_received_data() const noexcept {return gptr() < egptr();}
+          void advance_get_area(size_t size);
+          void advance_put_area(size_t size);
+          size_t read_some(std::span<xtd::byte> buffer);
+          bool send_all(const std::vector<xtd::byte>& buffer, size_t size);
+          bool send_all(std::span<const xtd::byte> buffer);
           
           xtd::net::sockets::socket socket_;
           bool owns_socket_ = false;
-          char value_ = EOF;
+          std::vector<xtd::byte> receive_buffer_;
+          std::vector<xtd::byte> send_buffer_;
         };
         
       public:
@@ -62,6 +77,21 @@ namespace xtd {
         /// @param owns_socket Set to true to indicate that the xtd::net::sockets::network_stream will take ownership of the xtd::net::sockets::socket; otherwise, false.
         /// @remarks The xtd::net::sockets::network_stream is created with read/write access to the specified xtd::net::sockets::socket. If the value of owns_socket parameter is true, the xtd::net::sockets::network_stream takes ownership of the underlying xtd::net::sockets::socket, and calling the close method also closes the underlying xtd::net::sockets::socket.
         network_stream(const xtd::net::sockets::socket& socket, bool owns_socket);
+        
+        /// @brief Initializes a new instance of the xtd::net::sockets::network_stream class for the specified xtd::net::sockets::socket with the specified xtd::net::sockets::socket ownership and buffer sizes.
+        /// @param socket The xtd::net::sockets::socket that the xtd::net::sockets::network_stream will use to send and receive data.
+        /// @param owns_socket Set to true to indicate that the xtd::net::sockets::network_stream will take ownership of the xtd::net::sockets::socket; otherwise, false.
+        /// @param receive_buffer_size The size of the buffer that holds the received data not read yet. 0 (zero) receives one byte at a time.
+        /// @param send_buffer_size The size of the buffer that holds the written data not sent yet. 0 (zero) sends one byte at a time.
+        /// @remarks The other constructors use xtd::net::sockets::network_stream::default_buffer_size for both buffers.
+        network_stream(const xtd::net::sockets::socket& socket, bool owns_socket, size_t receive_buffer_size, size_t send_buffer_size);
+        /// @}
+        
+        /// @name Public Fields
+        
+        /// @{
+        /// @brief Represents the default size of the receive and send buffers, in bytes.
+        static constexpr size_t default_buffer_size = 65536;
         /// @}
         
         /// @name Public Properties
@@ -80,6 +110,28 @@ namespace xtd {
         xtd::net::sockets::socket socket() const;
         /// @}
         
+        /// @name Public Methods
+        
+        /// @{
+        /// @brief Reads data from the xtd::net::sockets::network_stream into the specified span.
+        /// @param buffer The span to read data into.
+        /// @return The number of bytes read into buffer, or 0 (zero) if the connection is closed.
+        /// @remarks This method blocks until at least one byte is available, then returns the buffered and already received data, up to the size of buffer. Unlike std::iostream::read, it does not wait for buffer to be full and does not go through the std::iostream sentry and state flags.
+        size_t read(std::span<xtd::byte> buffer);
+        /// @cond
+        using std::iostream::read;
+        /// @endcond
+        
+        /// @brief Writes data to the xtd::net::sockets::network_stream from the specified span.
+        /// @param buffer The data to write.
+        /// @exception xtd::io::io_exception The data cannot be sent.
+        /// @remarks The data is sent immediately, after the data already written to the send buffer. Data at least as large as the send buffer is not copied to it.
+        void write(std::span<const xtd::byte> buffer);
+        /// @cond
+        using std::iostream::write;
+        /// @endcond
+        /// @}
+        
       private:
         socket_streambuf stream_buf_;
       };
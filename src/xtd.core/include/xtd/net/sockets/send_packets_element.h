@@ -84,7 +84,7 @@ namespace xtd {
         send_packets_element(const xtd::string& file_path, size_t offset, size_t count);
         
         /// @brief Initializes a new instance of the xtd::net::sockets::send_packets_element class using the specified range of the buffer with an option to combine this element with the next element in a single send request from the sockets layer to the transport.
-        /// @param file_stream The file to be transmitted using the xtd::net::sockets::socket::send_packets_async method.
+        /// @param file_stream The file to be transmitted using the xtd::net::sockets::socket::send_packets_async method. The stream is not owned by the element and must remain open until the operation completes.
         /// @param offset The offset, in bytes, from the beginning of the file to the location in the file to start sending the bytes in the file.
         /// @param count The number of bytes to send starting from the offset parameter. If count is zero, the entire file is sent.
         /// @param end_of_packet Specifies that this element should not be combined with the next element in a single send request from the sockets layer to the transport. This flag is used for granular control of the content of each message on a datagram or message-oriented socket.
@@ -105,14 +105,17 @@ namespace xtd {
         explicit send_packets_element(const xtd::string& file_path);
         
         /// @brief Initializes a new instance of the xtd::net::sockets::send_packets_element class using the specified FileStream object.
-        /// @param file_stream The file to be transmitted using the xtd::net::sockets::socket::send_packets_async method.
+        /// @param file_stream The file to be transmitted using the xtd::net::sockets::socket::send_packets_async method. The stream is not owned by the element and must remain open until the operation completes.
         /// @remarks The xtd::net::sockets::send_packets_element class is used with the xtd::net::sockets::socket::socket_async_event_args::send_packets_elements property to get or set a data buffer or file to be sent using the xtd::net::sockets::socket::socket::send_packets_async method.
         explicit send_packets_element(std::ifstream& file_stream);
         /// @}
         
         /// @cond
-        send_packets_element(send_packets_element&& socket) = default;
+        send_packets_element(const send_packets_element&) = default;
+        send_packets_element(send_packets_element&&) = default;
         ~send_packets_element();
+        send_packets_element& operator =(const send_packets_element&) = default;
+        send_packets_element& operator =(send_packets_element&&) = default;
         /// @endcond
         
         /// @name Public Properties
@@ -121,7 +124,7 @@ namespace xtd {
         /// @brief Gets the buffer to be sent if the xtd::net::sockets::send_packets_element object was initialized with a buffer parameter.
         /// @return The byte buffer to send if the xtd::net::sockets::send_packets_element object was initialized with a buffer parameter.
         /// @remarks The default value for the xtd::net::sockets::send_packets_element::buffer property is empty if the xtd::net::sockets::send_packets_element object was not initialized with a buffer parameter.
-        std::vector<xtd::byte> buffer() const noexcept;
+        const std::vector<xtd::byte>& buffer() const noexcept;
         
         /// @brief Gets the count of bytes to be sent.
         /// @return The count of bytes to send if the xtd::net::sockets::send_packets_element class was initialized with a count parameter.
@@ -158,7 +161,6 @@ namespace xtd {
         xtd::string file_path_;
         std::ifstream* file_stream_ = nullptr;
         size_t offset_ = 0;
-        bool delete_file_stream_when_destroy_ = false;
       };
     }
   }
@@ -18,6 +18,7 @@
 #include "socket_option_name.h"
 #include "socket_shutdown.h"
 #include "socket_type.h"
+#include "transmit_file_options.h"
 #include "../end_point.h"
 #include "../ip_address.h"
 #include "../../threading/manual_reset_event.h"
@@ -32,6 +33,7 @@
 #include "../../types.h"
 #include "../../string.h"
 #include <memory>
+#include <span>
 
 /// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
 namespace xtd {
@@ -40,6 +42,7 @@ namespace xtd {
     /// @brief The xtd::net::sockets namespace provides a managed implementation of the Berkeley Sockets interface for developers who need to tightly control access to the network.
     namespace sockets {
       /// @cond
+      class send_packets_element;
       class socket_async_event_args;
       /// @endcond
       
@@ -67,6 +70,7 @@ namespace xtd {
       /// * If you are using a connection-oriented protocol such as TCP, use the xtd::net::sockets::socket, xtd::net::sockets::socket::begin_connect, and xtd::net::sockets::socket::end_connect methods to connect with a listening host. Use the xtd::net::sockets::socket::begin_send and xtd::net::sockets::socket::end_send or xtd::net::sockets::socket::begin_receive and xtd::net::sockets::socket::end_receive methods to communicate data asynchronously. Incoming connection requests can be processed using xtd::net::sockets::socket::begin_accept and xtd::net::sockets::socket::end_accept.
       /// * If you are using a connectionless protocol such as UDP, you can use xtd::net::sockets::socket::begin_send_to and xtd::net::sockets::socket::end_send_tto to send datagrams, and xtd::net::sockets::socket::begin_receive_from and xtd::net::sockets::socket::end_receive_from to receive datagrams.
       /// @remarks If you perform multiple asynchronous operations on a socket, they do not necessarily complete in the order in which they are started.
+      /// @remarks The asynchronous operations do not block a thread each : a small fixed number of I/O threads wait for the readiness of all the sockets with pending operations (epoll on Linux, poll or WSAPoll on the other systems), then the operations and their callbacks run on the xtd::threading::thread_pool. The callback is called even if the operation fails ; the matching end method then throws the error.
       /// @remarks When you are finished sending and receiving data, use the xtd::net::sockets::socket::shutdown method to disable the xtd::net::sockets::socket. After calling xtd::net::sockets::socket::shutdown, call the xtd::net::sockets::socket::close method to release all resources associated with the xtd::net::sockets::socket.
       /// @remarks The xtd::net::sockets::socket class allows you to configure your xtd::net::sockets::socket using the xtd::net::sockets::socket::set_socket_option method. Retrieve these settings using the xtd::net::sockets::socket::get_socket_option method.
       /// @note If you are writing a relatively simple application and do not require maximum performance, consider using xtd::net::sockets::tcp_client, xtd::net::sockets::tcp_listener, and xtd::net::sockets::udp_client. These classes provide a simpler and more user-friendly interface to xtd::net::sockets::socket communications.
@@ -1086,7 +1090,7 @@ namespace xtd {
         void listen();
         
         /// @brief Determines the status of the xtd::net::sockets::socket.
-        /// @param micro_seconds The time to wait for a response, in microseconds.
+        /// @param micro_seconds The time to wait for a response, in microseconds. A -1 value indicates an infinite time-out.
         /// @param mode One of the xtd::net::sockets::select_mode values.
         /// @return The status of the xtd::net::sockets::socket based on the polling mode value passed in the mode parameter.
         /// | Mode                                         | Return Value                                                                                                                                                                                                                                               |
@@ -1179,6 +1183,30 @@ namespace xtd {
         /// @remarks If you are using a connectionless xtd::net::sockets::socket, xtd::net::sockets::socket::receive will read the first queued datagram from the destination address you specify in the xtd::net::sockets::socket::connect method. If the datagram you receive is larger than the size of the buffer parameter, buffer gets filled with the first part of the message, the excess data is lost and a xtd::net::sockets::socket::socket_exception is thrown.
         /// @note If you receive a xtd::net::sockets::socket_exception, use the xtd::net::sockets::socket_exception::error_code property to obtain the specific error code. After you have obtained this code, refer to the Windows Sockets version 2 API error code documentation in the MSDN library for a detailed description of the error.
         size_t receive(std::vector<xtd::byte>& buffer, size_t offset, size_t size, xtd::net::sockets::socket_flags socket_flags, xtd::net::sockets::socket_error& error);
+        /// @brief Receives data from a bound xtd::net::sockets::socket into the list of receive buffers.
+        /// @param buffers A list of spans that are the storage locations for the received data.
+        /// @return The number of bytes received.
+        /// @exception xtd::net::sockets::socket_exception An error occurred when attempting to access the socket.
+        /// @exception xtd::object_closed_exception The xtd::net::sockets::socket has been closed.
+        /// @remarks The buffers are filled in order with one system call (recvmsg on Unix, WSARecv on Windows), so that a header and a body can be received in separate buffers without copying them.
+        /// @remarks The spans must remain valid during the call. The list is not copied : reuse it between calls to avoid allocations.
+        size_t receive(const std::vector<std::span<xtd::byte>>& buffers);
+        /// @brief Receives data from a bound xtd::net::sockets::socket into the list of receive buffers, using the specified xtd::net::sockets::socket_flags.
+        /// @param buffers A list of spans that are the storage locations for the received data.
+        /// @param socket_flags A bitwise combination of the xtd::net::sockets::socket_flags values.
+        /// @return The number of bytes received.
+        /// @exception xtd::net::sockets::socket_exception An error occurred when attempting to access the socket.
+        /// @exception xtd::object_closed_exception The xtd::net::sockets::socket has been closed.
+        /// @remarks The buffers are filled in order with one system call (recvmsg on Unix, WSARecv on Windows), so that a header and a body can be received in separate buffers without copying them.
+        size_t receive(const std::vector<std::span<xtd::byte>>& buffers, xtd::net::sockets::socket_flags socket_flags);
+        /// @brief Receives data from a bound xtd::net::sockets::socket into the list of receive buffers, using the specified xtd::net::sockets::socket_flags.
+        /// @param buffers A list of spans that are the storage locations for the received data.
+        /// @param socket_flags A bitwise combination of the xtd::net::sockets::socket_flags values.
+        /// @param error_code A xtd::net::sockets::socket_error object that stores the socket error.
+        /// @return The number of bytes received.
+        /// @exception xtd::object_closed_exception The xtd::net::sockets::socket has been closed.
+        /// @remarks The buffers are filled in order with one system call (recvmsg on Unix, WSARecv on Windows), so that a header and a body can be received in separate buffers without copying them.
+        size_t receive(const std::vector<std::span<xtd::byte>>& buffers, xtd::net::sockets::socket_flags socket_flags, xtd::net::sockets::socket_error& error_code);
         
         /// @brief Receives data from a bound xtd::net::sockets::socket into a receive buffer.
         /// @param buffer An array of type byte that is the storage location for the received data.
@@ -1337,6 +1365,62 @@ namespace xtd {
         /// @remarks If you are using a connection-oriented protocol, xtd::net::sockets::socket::send will block until all of the bytes in the buffer are sent, unless a time-out was set by using xtd::net::sockets::socket::send_timeout. If the time-out value was exceeded, the xtd::net::sockets::socket::send call will throw a xtd::net::sockets::socket_exception. In nonblocking mode, xtd::net::sockets::socket::send may complete successfully even if it sends less than the number of bytes in the buffer. It is your application's responsibility to keep track of the number of bytes sent and to retry the operation until the application sends the bytes in the buffer. There is also no guarantee that the data you send will appear on the network immediately. To increase network efficiency, the underlying system may delay transmission until a significant amount of outgoing data is collected. A successful completion of the Send method means that the underlying system has had room to buffer your data for a network send.
         /// @note The successful completion of a send does not indicate that the data was successfully delivered. If no buffer space is available within the transport system to hold the data to be transmitted, send will block unless the socket has been placed in nonblocking mode.
         size_t send(const std::vector<xtd::byte>& buffer, size_t offset, size_t size, xtd::net::sockets::socket_flags socket_flags, xtd::net::sockets::socket_error& error_code);
+        /// @brief Sends the set of buffers in the list to a connected xtd::net::sockets::socket.
+        /// @param buffers A list of spans that contains the data to be sent.
+        /// @return The number of bytes sent to the xtd::net::sockets::socket.
+        /// @exception xtd::net::sockets::socket_exception An error occurred when attempting to access the socket.
+        /// @exception xtd::object_closed_exception The xtd::net::sockets::socket has been closed.
+        /// @remarks The buffers are sent in order with one system call (sendmsg on Unix, WSASend on Windows) : a header and a body kept in separate buffers are sent without being copied into a single buffer, and without the extra packets that separate calls can produce.
+        /// @remarks The spans must remain valid during the call. The list is not copied : reuse it between calls to avoid allocations.
+        size_t send(const std::vector<std::span<const xtd::byte>>& buffers);
+        /// @brief Sends the set of buffers in the list to a connected xtd::net::sockets::socket, using the specified xtd::net::sockets::socket_flags.
+        /// @param buffers A list of spans that contains the data to be sent.
+        /// @param socket_flags A bitwise combination of the xtd::net::sockets::socket_flags values.
+        /// @return The number of bytes sent to the xtd::net::sockets::socket.
+        /// @exception xtd::net::sockets::socket_exception An error occurred when attempting to access the socket.
+        /// @exception xtd::object_closed_exception The xtd::net::sockets::socket has been closed.
+        /// @remarks The buffers are sent in order with one system call (sendmsg on Unix, WSASend on Windows) : a header and a body kept in separate buffers are sent without being copied into a single buffer, and without the extra packets that separate calls can produce.
+        size_t send(const std::vector<std::span<const xtd::byte>>& buffers, xtd::net::sockets::socket_flags socket_flags);
+        /// @brief Sends the set of buffers in the list to a connected xtd::net::sockets::socket, using the specified xtd::net::sockets::socket_flags.
+        /// @param buffers A list of spans that contains the data to be sent.
+        /// @param socket_flags A bitwise combination of the xtd::net::sockets::socket_flags values.
+        /// @param error_code A xtd::net::sockets::socket_error object that stores the socket error.
+        /// @return The number of bytes sent to the xtd::net::sockets::socket.
+        /// @exception xtd::object_closed_exception The xtd::net::sockets::socket has been closed.
+        /// @remarks The buffers are sent in order with one system call (sendmsg on Unix, WSASend on Windows) : a header and a body kept in separate buffers are sent without being copied into a single buffer, and without the extra packets that separate calls can produce.
+        size_t send(const std::vector<std::span<const xtd::byte>>& buffers, xtd::net::sockets::socket_flags socket_flags, xtd::net::sockets::socket_error& error_code);
+        
+        /// @brief Sends the file file_name to a connected xtd::net::sockets::socket object.
+        /// @param file_name A string that contains the path and name of the file to be sent.
+        /// @exception xtd::io::file_not_found_exception The file file_name was not found.
+        /// @exception xtd::net::sockets::socket_exception An error occurred when attempting to access the socket.
+        /// @exception xtd::object_closed_exception The xtd::net::sockets::socket has been closed.
+        /// @exception xtd::not_supported_exception The socket is not connected to a remote host.
+        /// @remarks The file is sent by the operating system, without being copied through the memory of the application : sendfile on Linux and macOS, TransmitFile on Windows. On other systems, the file is read in blocks and sent.
+        /// @remarks This method blocks until the whole file has been sent.
+        void send_file(const xtd::string& file_name);
+        /// @brief Sends the file file_name and buffers of data to a connected xtd::net::sockets::socket object using the specified xtd::net::sockets::transmit_file_options value.
+        /// @param file_name A string that contains the path and name of the file to be sent.
+        /// @param pre_buffer The data to be sent before the file is sent. This parameter can be empty.
+        /// @param post_buffer The data to be sent after the file is sent. This parameter can be empty.
+        /// @param flags One or more of xtd::net::sockets::transmit_file_options values.
+        /// @exception xtd::io::file_not_found_exception The file file_name was not found.
+        /// @exception xtd::net::sockets::socket_exception An error occurred when attempting to access the socket.
+        /// @exception xtd::object_closed_exception The xtd::net::sockets::socket has been closed.
+        /// @exception xtd::not_supported_exception The socket is not connected to a remote host.
+        /// @remarks The file is sent by the operating system, without being copied through the memory of the application : sendfile on Linux and macOS, TransmitFile on Windows. On other systems, the file is read in blocks and sent.
+        /// @remarks If flags contains xtd::net::sockets::transmit_file_options::disconnect, the socket is disconnected after the data is sent, and can be reused if flags also contains xtd::net::sockets::transmit_file_options::reuse_socket. The other flags are ignored.
+        void send_file(const xtd::string& file_name, const std::vector<xtd::byte>& pre_buffer, const std::vector<xtd::byte>& post_buffer, xtd::net::sockets::transmit_file_options flags);
+        
+        /// @brief Sends a collection of files or in memory data buffers asynchronously to a connected xtd::net::sockets::socket object.
+        /// @param e The xtd::net::sockets::socket_async_event_args object to use for this asynchronous socket operation.
+        /// @return true if the I/O operation is pending. The xtd::net::sockets::socket_async_event_args::completed event on the e parameter will be raised upon completion of the operation.
+        /// @exception xtd::object_closed_exception The xtd::net::sockets::socket has been closed.
+        /// @exception xtd::not_supported_exception The socket is not connected to a remote host.
+        /// @remarks The elements are taken from the xtd::net::sockets::socket_async_event_args::send_packets_elements property. Consecutive buffer elements are gathered and sent with a single system call, and file elements are sent as with xtd::net::sockets::socket::send_file.
+        /// @remarks When the operation completes, the xtd::net::sockets::socket_async_event_args::bytes_transferred property contains the number of bytes sent, and the xtd::net::sockets::socket_async_event_args::socket_error property contains the result.
+        /// @remarks If xtd::net::sockets::socket_async_event_args::send_packets_flags contains xtd::net::sockets::transmit_file_options::disconnect, the socket is disconnected after the data is sent.
+        bool send_packets_async(xtd::net::sockets::socket_async_event_args& e);
         
         /// @brief Sends data to the specified endpoint.
         /// @param buffer An array of type byte that contains the data to be sent.
@@ -1555,6 +1639,7 @@ namespace xtd {
         /// @remarks If you make a nonblocking call to xtd::net::sockets::socket::connect, writability means that you have connected successfully. If you already have a connection established, writability means that all send operations will succeed without blocking.
         /// @remarks If you have made a non-blocking call to xtd::net::sockets::socket::connect, the check_error parameter identifies sockets that have not connected successfully.
         /// @remarks Use the xtd::net::sockets::socket::poll method if you only want to determine the status of a single xtd::net::sockets::socket.
+        /// @remarks The number of sockets and the value of their handles are not limited by FD_SETSIZE. To wait repeatedly on the same large set of sockets, use xtd::net::sockets::socket_poller instead : the sockets are registered only once.
         /// @note This method cannot detect certain kinds of connection problems, such as a broken network cable, or that the remote host was shut down ungracefully. You must attempt to send or receive data to detect these kinds of errors.
         /// @note If you receive a xtd::net::sockets::socket_exception exception, use the xtd::net::sockets::socket_exception::error_code property to obtain the specific error code. After you have obtained this code, refer to the Windows Sockets version 2 API error code documentation in the MSDN library for a detailed description of the error.
         static size_t select(std::vector<socket>& check_read, std::vector<socket>& check_write, std::vector<socket>& check_error, int32 microseconds);
@@ -1565,6 +1650,10 @@ namespace xtd {
         xtd::sptr<xtd::iasync_result> begin_connect_(xtd::sptr<xtd::net::end_point> remote_end_point, xtd::async_callback callback, const std::any& state);
         void bind_(xtd::sptr<xtd::net::end_point> local_end_point);
         void connect_(xtd::sptr<xtd::net::end_point> remote_end_point);
+        void make_native_non_blocking_();
+        size_t send_all_(std::vector<std::span<const xtd::byte>>& buffers);
+        void send_packets_(const std::vector<xtd::net::sockets::send_packets_element>& elements, size_t& bytes_sent);
+        bool wait_until_ready_(xtd::net::sockets::select_mode mode, xtd::net::sockets::socket_error& error);
         
         xtd::sptr<data> data_;
       };
@@ -93,6 +93,30 @@ namespace xtd {
         /// @remarks This property gets the data buffer currently associated with the xtd::net::sockets::socket_async_event_args instance. To set the buffer, the xtd::net::sockets::socket_async_event_args::set_buffer method must be used.
         /// @remarks This property is used with the xtd::net::sockets::socket::accept_async, xtd::net::sockets::socket::connect_async, xtd::net::sockets::socket::receive_async, xtd::net::sockets::socket::receive_from_async, xtd::net::sockets::socket::receive_message_from_async, xtd::net::sockets::socket::send_async, and xtd::net::sockets::socket::send_to_async methods.
         std::vector<xtd::byte>& buffer() noexcept;
+        
+        /// @brief Gets the number of bytes transferred in the socket operation.
+        /// @return A size_t that contains the number of bytes transferred in the socket operation.
+        size_t bytes_transferred() const noexcept;
+        
+        /// @brief Gets the array of buffers to be sent for an asynchronous operation used by the xtd::net::sockets::socket::send_packets_async method.
+        /// @return An array of xtd::net::sockets::send_packets_element objects that represent the array of buffers to be sent.
+        const std::vector<xtd::net::sockets::send_packets_element>& send_packets_elements() const noexcept;
+        /// @brief Sets the array of buffers to be sent for an asynchronous operation used by the xtd::net::sockets::socket::send_packets_async method.
+        /// @param value An array of xtd::net::sockets::send_packets_element objects that represent the array of buffers to be sent.
+        /// @return This current instance.
+        socket_async_event_args& send_packets_elements(const std::vector<xtd::net::sockets::send_packets_element>& value);
+        
+        /// @brief Gets a bitwise combination of xtd::net::sockets::transmit_file_options values for an asynchronous operation used by the xtd::net::sockets::socket::send_packets_async method.
+        /// @return A xtd::net::sockets::transmit_file_options that contains a bitwise combination of values that are used with an asynchronous operation.
+        xtd::net::sockets::transmit_file_options send_packets_flags() const noexcept;
+        /// @brief Sets a bitwise combination of xtd::net::sockets::transmit_file_options values for an asynchronous operation used by the xtd::net::sockets::socket::send_packets_async method.
+        /// @param value A xtd::net::sockets::transmit_file_options that contains a bitwise combination of values that are used with an asynchronous operation.
+        /// @return This current instance.
+        socket_async_event_args& send_packets_flags(xtd::net::sockets::transmit_file_options value) noexcept;
+        
+        /// @brief Gets the result of the asynchronous socket operation.
+        /// @return A xtd::net::sockets::socket_error that represents the result of the asynchronous socket operation.
+        xtd::net::sockets::socket_error socket_error() const noexcept;
         /// @}
         
         /// @name Public Methods
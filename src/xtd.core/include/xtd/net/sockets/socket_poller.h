@@ -0,0 +1,138 @@
+/// @file
+/// @brief Contains xtd::net::sockets::socket_poller class.
+/// @copyright Copyright (c) 2024 Gammasoft. All rights reserved.
+#pragma once
+#include "socket.h"
+#include "socket_poller_events.h"
+#include "socket_poller_mode.h"
+#include "../../object.h"
+#include "../../sptr.h"
+#include <vector>
+
+/// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
+namespace xtd {
+  /// @brief The xtd::net namespace provides a simple programming interface for many of the protocols used on networks today. The xtd::net::web_request and xtd::net::web_response classes form the basis of what are called pluggable protocols, an implementation of network services that enables you to develop applications that use Internet resources without worrying about the specific details of the individual protocols.
+  namespace net {
+    /// @brief The xtd::net::sockets namespace provides a managed implementation of the Berkeley Sockets interface for developers who need to tightly control access to the network.
+    namespace sockets {
+      /// @brief Waits for readiness events on a set of sockets that are registered once.
+      /// ```cpp
+      /// class core_export_ socket_poller : public xtd::object
+      /// ```
+      /// @par Inheritance
+      /// xtd::object → xtd::net::sockets::socket_poller
+      /// @par Header
+      /// ```cpp
+      /// #include <xtd/net/sockets/socket_poller>
+      /// ```
+      /// @par Namespace
+      /// xtd::net::sockets
+      /// @par Library
+      /// xtd.core
+      /// @ingroup xtd_core net
+      /// @remarks Unlike xtd::net::sockets::socket::select, which builds and checks the whole set of sockets at each call, the sockets are registered once with xtd::net::sockets::socket_poller::add, and the cost of xtd::net::sockets::socket_poller::wait depends only on the number of ready sockets. It uses epoll on Linux, poll on the other Unix systems and WSAPoll on Windows.
+      /// @remarks Several threads can call xtd::net::sockets::socket_poller::wait on the same poller at the same time. The sockets can be added, modified and removed while other threads wait.
+      /// @remarks Copies of a xtd::net::sockets::socket_poller share the same poller. The poller is closed when the last copy is destroyed.
+      class core_export_ socket_poller : public xtd::object {
+        struct data;
+      
+      public:
+        /// @brief Represents a socket reported as ready by xtd::net::sockets::socket_poller::wait.
+        struct ready_socket {
+          /// @brief The ready socket.
+          xtd::net::sockets::socket socket;
+          /// @brief The events reported for the socket.
+          xtd::net::sockets::socket_poller_events events = xtd::net::sockets::socket_poller_events::none;
+        };
+        
+        /// @name Public Fields
+        
+        /// @{
+        /// @brief Represents the maximum number of ready sockets returned by one call to xtd::net::sockets::socket_poller::wait. The other ready sockets are returned by the next calls.
+        static constexpr size_t max_ready_sockets = 1024;
+        /// @}
+        
+        /// @name Public Constructors
+        
+        /// @{
+        /// @brief Initializes a new instance of the xtd::net::sockets::socket_poller class.
+        /// @exception xtd::net::sockets::socket_exception The poller cannot be created.
+        socket_poller();
+        /// @}
+        
+        /// @cond
+        socket_poller(const socket_poller&) = default;
+        ~socket_poller();
+        socket_poller& operator =(const socket_poller&) = default;
+        /// @endcond
+        
+        /// @name Public Properties
+        
+        /// @{
+        /// @brief Gets the number of sockets registered in the poller.
+        /// @return The number of registered sockets.
+        size_t count() const noexcept;
+        /// @}
+        
+        /// @name Public Methods
+        
+        /// @{
+        /// @brief Registers a socket in level-triggered mode.
+        /// @param socket The socket to register.
+        /// @param events The events to wait for.
+        /// @exception xtd::argument_exception The socket is already registered.
+        /// @exception xtd::object_closed_exception The socket or the poller has been closed.
+        /// @exception xtd::net::sockets::socket_exception An error occurred when attempting to register the socket.
+        /// @remarks The poller keeps a copy of the socket until it is removed : a registered socket is not closed when the other copies are destroyed. Call xtd::net::sockets::socket_poller::remove before closing the socket.
+        void add(const xtd::net::sockets::socket& socket, xtd::net::sockets::socket_poller_events events);
+        /// @brief Registers a socket in the specified mode.
+        /// @param socket The socket to register.
+        /// @param events The events to wait for.
+        /// @param mode One of xtd::net::sockets::socket_poller_mode values.
+        /// @exception xtd::argument_exception The socket is already registered.
+        /// @exception xtd::object_closed_exception The socket or the poller has been closed.
+        /// @exception xtd::net::sockets::socket_exception An error occurred when attempting to register the socket.
+        /// @remarks The poller keeps a copy of the socket until it is removed : a registered socket is not closed when the other copies are destroyed. Call xtd::net::sockets::socket_poller::remove before closing the socket.
+        void add(const xtd::net::sockets::socket& socket, xtd::net::sockets::socket_poller_events events, xtd::net::sockets::socket_poller_mode mode);
+        
+        /// @brief Closes the poller and removes all the registered sockets.
+        /// @remarks The threads waiting on the poller return with no ready socket.
+        void close();
+        
+        /// @brief Changes the events of a registered socket, in level-triggered mode.
+        /// @param socket The registered socket.
+        /// @param events The events to wait for.
+        /// @exception xtd::argument_exception The socket is not registered.
+        /// @exception xtd::object_closed_exception The poller has been closed.
+        /// @exception xtd::net::sockets::socket_exception An error occurred when attempting to modify the socket.
+        void modify(const xtd::net::sockets::socket& socket, xtd::net::sockets::socket_poller_events events);
+        /// @brief Changes the events and the mode of a registered socket.
+        /// @param socket The registered socket.
+        /// @param events The events to wait for.
+        /// @param mode One of xtd::net::sockets::socket_poller_mode values.
+        /// @exception xtd::argument_exception The socket is not registered.
+        /// @exception xtd::object_closed_exception The poller has been closed.
+        /// @exception xtd::net::sockets::socket_exception An error occurred when attempting to modify the socket.
+        void modify(const xtd::net::sockets::socket& socket, xtd::net::sockets::socket_poller_events events, xtd::net::sockets::socket_poller_mode mode);
+        
+        /// @brief Unregisters a socket.
+        /// @param socket The socket to unregister.
+        /// @return true if the socket was registered; otherwise false.
+        /// @exception xtd::object_closed_exception The poller has been closed.
+        bool remove(const xtd::net::sockets::socket& socket);
+        
+        /// @brief Waits until at least one registered socket is ready, or the timeout expires.
+        /// @param ready_sockets Receives the ready sockets and their events. Its previous content is replaced ; reuse the same list between calls to avoid allocations.
+        /// @param milliseconds_timeout The number of milliseconds to wait, or xtd::threading::timeout::infinite (-1) to wait indefinitely.
+        /// @return The number of ready sockets, 0 if the timeout expired or if the poller was closed while waiting.
+        /// @exception xtd::object_closed_exception The poller has been closed.
+        /// @exception xtd::net::sockets::socket_exception An error occurred when attempting to wait.
+        size_t wait(std::vector<ready_socket>& ready_sockets, int32 milliseconds_timeout);
+        /// @}
+      
+      private:
+        xtd::sptr<data> data_;
+      };
+    }
+  }
+}
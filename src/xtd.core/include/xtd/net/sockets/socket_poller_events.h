@@ -0,0 +1,53 @@
+/// @file
+/// @brief Contains xtd::net::sockets::socket_poller_events enum.
+/// @copyright Copyright (c) 2024 Gammasoft. All rights reserved.
+#pragma once
+#include "../../enum.h"
+
+/// @cond
+#undef unix
+/// @endcond
+
+/// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
+namespace xtd {
+  /// @brief The xtd::net namespace provides a simple programming interface for many of the protocols used on networks today. The xtd::net::web_request and xtd::net::web_response classes form the basis of what are called pluggable protocols, an implementation of network services that enables you to develop applications that use Internet resources without worrying about the specific details of the individual protocols.
+  namespace net {
+    /// @brief The xtd::net::sockets namespace provides a managed implementation of the Berkeley Sockets interface for developers who need to tightly control access to the network.
+    namespace sockets {
+      /// @brief Specifies the readiness events that a xtd::net::sockets::socket_poller waits for and reports. This enumeration has a flags attribute that allows a bitwise combination of its member values.
+      /// ```cpp
+      /// enum class socket_poller_events
+      /// ```
+      /// @par Header
+      /// ```cpp
+      /// #include <xtd/net/sockets/socket_poller_events>
+      /// ```
+      /// @par Namespace
+      /// xtd::net::sockets
+      /// @par Library
+      /// xtd.core
+      /// @ingroup xtd_core
+      /// @remarks xtd::net::sockets::socket_poller_events::error and xtd::net::sockets::socket_poller_events::hang_up are always reported, even if they are not requested.
+      enum class socket_poller_events {
+        /// @brief No event.
+        none = 0b0,
+        /// @brief Data is available for reading, a connection is pending on a listening socket, or the connection has been closed.
+        read = 0b1,
+        /// @brief Data can be sent, or a non-blocking connection has succeeded.
+        write = 0b10,
+        /// @brief An error is pending on the socket, for example a non-blocking connection has failed.
+        error = 0b100,
+        /// @brief The remote host has closed the connection.
+        hang_up = 0b1000,
+      };
+    }
+  }
+}
+
+/// @cond
+flags_attribute_(xtd::net::sockets, socket_poller_events);
+
+template<> struct xtd::enum_register<xtd::net::sockets::socket_poller_events> {
+  explicit operator auto() const noexcept {return xtd::enum_collection<xtd::net::sockets::socket_poller_events> {{xtd::net::sockets::socket_poller_events::none, "none"}, {xtd::net::sockets::socket_poller_events::read, "read"}, {xtd::net::sockets::socket_poller_events::write, "write"}, {xtd::net::sockets::socket_poller_events::error, "error"}, {xtd::net::sockets::socket_poller_events::hang_up, "hang_up"}};}
+};
+/// @endcond
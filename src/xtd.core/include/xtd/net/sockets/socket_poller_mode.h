@@ -0,0 +1,45 @@
+/// @file
+/// @brief Contains xtd::net::sockets::socket_poller_mode enum.
+/// @copyright Copyright (c) 2024 Gammasoft. All rights reserved.
+#pragma once
+#include "../../enum.h"
+
+/// @cond
+#undef unix
+/// @endcond
+
+/// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
+namespace xtd {
+  /// @brief The xtd::net namespace provides a simple programming interface for many of the protocols used on networks today. The xtd::net::web_request and xtd::net::web_response classes form the basis of what are called pluggable protocols, an implementation of network services that enables you to develop applications that use Internet resources without worrying about the specific details of the individual protocols.
+  namespace net {
+    /// @brief The xtd::net::sockets namespace provides a managed implementation of the Berkeley Sockets interface for developers who need to tightly control access to the network.
+    namespace sockets {
+      /// @brief Specifies when a xtd::net::sockets::socket_poller reports the events of a socket.
+      /// ```cpp
+      /// enum class socket_poller_mode
+      /// ```
+      /// @par Header
+      /// ```cpp
+      /// #include <xtd/net/sockets/socket_poller_mode>
+      /// ```
+      /// @par Namespace
+      /// xtd::net::sockets
+      /// @par Library
+      /// xtd.core
+      /// @ingroup xtd_core
+      /// @remarks The edge-triggered mode requires epoll (Linux). On the other systems, it is handled as the level-triggered mode, which reports a superset of the events : a loop that reads or writes until xtd::net::sockets::socket_error::would_block works with both modes.
+      enum class socket_poller_mode {
+        /// @brief The events are reported by each wait as long as the socket is ready, like xtd::net::sockets::socket::select. This is the default.
+        level_triggered = 0,
+        /// @brief The events are reported once when the socket becomes ready. The socket must be read or written until xtd::net::sockets::socket_error::would_block before the next event is reported.
+        edge_triggered = 1,
+      };
+    }
+  }
+}
+
+/// @cond
+template<> struct xtd::enum_register<xtd::net::sockets::socket_poller_mode> {
+  explicit operator auto() const noexcept {return xtd::enum_collection<xtd::net::sockets::socket_poller_mode> {{xtd::net::sockets::socket_poller_mode::level_triggered, "level_triggered"}, {xtd::net::sockets::socket_poller_mode::edge_triggered, "edge_triggered"}};}
+};
+/// @endcond
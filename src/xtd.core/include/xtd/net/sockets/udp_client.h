@@ -2,12 +2,14 @@
 /// @brief Contains xtd::net::sockets::udp_client class.
 /// @copyright Copyright (c) 2024 Gammasoft. All rights reserved.
 #pragma once
+#include "datagram_buffer.h"
 #include "socket.h"
 #include "../ip_end_point.h"
 #include "../../threading/manual_reset_event.h"
 #include "../../iequatable.h"
 #include "../../object.h"
 #include "../../string.h"
+#include <span>
 
 /// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
 namespace xtd {
@@ -220,6 +222,18 @@ namespace xtd {
         /// @note If you receive a xtd::net::sockets::socket_exception, use the xtd::net::sockets::socket_exception::error_code property to obtain the specific error code. After you have obtained this code, refer to the Windows Sockets version 2 API error code documentation in the MSDN library for a detailed description of the error.
         udp_client& multicast_loopback(bool value);
         
+        /// @brief Gets a value that indicates whether the operating system can coalesce the datagrams received from the same remote host (generic receive offload).
+        /// @return true if generic receive offload is enabled; otherwise, false. The default is false.
+        /// @remarks Generic receive offload only applies to xtd::net::sockets::udp_client::receive_batch. See xtd::net::sockets::datagram_buffer::segment_size.
+        bool receive_offload() const noexcept;
+        /// @brief Sets a value that indicates whether the operating system can coalesce the datagrams received from the same remote host (generic receive offload).
+        /// @param value true to enable generic receive offload; otherwise, false.
+        /// @return This current instance.
+        /// @exception xtd::object_closed_exception The underlying xtd::net::sockets::socket has been closed.
+        /// @remarks When generic receive offload is enabled, a datagram buffer received by xtd::net::sockets::udp_client::receive_batch can hold several datagrams. Use xtd::net::sockets::datagram_buffer::segment_size to split it.
+        /// @remarks xtd::net::sockets::udp_client::receive_offload remains false when the operating system does not support generic receive offload (only Linux 5.0 and later support it).
+        udp_client& receive_offload(bool value);
+        
         /// @brief Gets a value that specifies the Time to Live (TTL) value of Internet Protocol (IP) packets sent by the xtd::net::sockets::udp_client.
         /// @return The TTL value.
         /// @exception xtd::net::sockets::socket_exception An error occurred when attempting to access the underlying socket.
@@ -436,6 +450,16 @@ namespace xtd {
         /// @note If you receive a xtd::net::sockets::socket_exception, use the xtd::net::sockets::socket_exception::error_code property to obtain the specific error code. After you have obtained this code, refer to the Windows Sockets version 2 API error code documentation in the MSDN library for a detailed description of the error.
         std::vector<xtd::byte> receive(xtd::net::ip_end_point& remote_end_point);
         
+        /// @brief Receives several UDP datagrams with as few system calls as possible.
+        /// @param datagrams The datagram buffers that receive the datagrams. One datagram is received in each datagram buffer.
+        /// @return The number of datagrams received. It is greater than 0 and not greater than the size of datagrams.
+        /// @exception xtd::net::sockets::socket_exception An error occurred when attempting to access the underlying socket.
+        /// @exception xtd::object_closed_exception The underlying xtd::net::sockets::socket has been closed.
+        /// @remarks The xtd::net::sockets::udp_client::receive_batch method blocks until a datagram arrives from a remote host, then receives the datagrams already queued, up to the size of datagrams. It does not wait for the datagram buffers to be filled.
+        /// @remarks Nothing is allocated when the datagrams are received : reuse the same datagram buffers for each call. The sizes, the truncated flags and the remote end points of the first datagram buffers are updated.
+        /// @remarks On Linux, the datagrams are received with one recvmmsg call. On the other operating systems, they are received one by one.
+        size_t receive_batch(std::span<xtd::net::sockets::datagram_buffer> datagrams);
+        
         /// @brief xtd::net::sockets::udp_client::sends a UDP datagram to a specified port on a specified remote host.
         /// @param dgram An array of type Byte that specifies the UDP datagram that you intend to send represented as an array of bytes.
         /// @param bytes The number of bytes in the datagram.
@@ -471,6 +495,15 @@ namespace xtd {
         /// @remarks If you want to send datagrams to a different remote host, you must call the xtd::net::sockets::udp_client::connect method and specify the desired remote host. Use either of the other xtd::net::sockets::udp_client::send method overloads to send datagrams to a broadcast address.
         /// @note If you receive a xtd::net::sockets::socket_exception, use the xtd::net::sockets::socket_exception::error_code property to obtain the specific error code. After you have obtained this code, refer to the Windows Sockets version 2 API error code documentation in the MSDN library for a detailed description of the error.
         size_t send(const std::vector<xtd::byte>& dgram, size_t bytes);
+        
+        /// @brief Sends several UDP datagrams with as few system calls as possible.
+        /// @param datagrams The datagram buffers to send. Each datagram buffer is sent to its remote end point, or to the default remote host established with xtd::net::sockets::udp_client::connect if its remote end point is not set.
+        /// @return The number of bytes sent.
+        /// @exception xtd::net::sockets::socket_exception An error occurred when attempting to access the underlying socket.
+        /// @exception xtd::object_closed_exception The underlying xtd::net::sockets::socket has been closed.
+        /// @remarks The xtd::net::sockets::udp_client::send_batch method returns when all the datagrams are sent. To send to a broadcast address, set xtd::net::sockets::udp_client::enable_broadcast first.
+        /// @remarks On Linux, the datagrams are sent with sendmmsg, and consecutive datagrams of the same size sent to the same remote host are gathered with UDP generic segmentation offload when the kernel and the network device support it. On the other operating systems, they are sent one by one.
+        size_t send_batch(std::span<const xtd::net::sockets::datagram_buffer> datagrams);
         /// @}
         
       protected:
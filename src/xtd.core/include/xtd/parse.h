@@ -21,6 +21,8 @@
 #include "number_styles.h"
 #include "types.h"
 #include <string>
+#include <string_view>
+#include <type_traits>
 
 /// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
 namespace xtd {
@@ -415,6 +417,10 @@ namespace xtd {
   /// @ingroup xtd_core
   template<typename value_t, typename char_t>
   inline bool try_parse(const std::basic_string<char_t>& str, value_t& value) noexcept {
+    if constexpr (std::is_same_v<char_t, char> && __parse_has_fast_path<value_t>) {
+      auto status = __parse_try_fast_number(std::string_view {str}, std::is_floating_point_v<value_t> ? number_styles::fixed_point : number_styles::integer, value);
+      if (status != __parse_status::not_handled) return status == __parse_status::success;
+    }
     try {
       value = parse<value_t>(str);
       return true;
@@ -447,6 +453,10 @@ namespace xtd {
   /// @ingroup xtd_core
   template<typename value_t, typename char_t>
   inline bool try_parse(const char_t* str, value_t& value) noexcept {
+    if constexpr (std::is_same_v<char_t, char> && __parse_has_fast_path<value_t>) {
+      auto status = __parse_try_fast_number(std::string_view {str}, std::is_floating_point_v<value_t> ? number_styles::fixed_point : number_styles::integer, value);
+      if (status != __parse_status::not_handled) return status == __parse_status::success;
+    }
     return try_parse(std::basic_string<char_t>(str), value);
   }
   
@@ -469,6 +479,10 @@ namespace xtd {
   /// @ingroup xtd_core
   template<typename value_t, typename char_t>
   inline bool try_parse(const std::basic_string<char_t>& str, value_t& value, number_styles style) noexcept {
+    if constexpr (std::is_same_v<char_t, char> && __parse_has_fast_path<value_t>) {
+      auto status = __parse_try_fast_number(std::string_view {str}, style, value);
+      if (status != __parse_status::not_handled) return status == __parse_status::success;
+    }
     try {
       value = parse<value_t>(str, style);
       return true;
@@ -501,6 +515,10 @@ namespace xtd {
   /// @ingroup xtd_core
   template<typename value_t, typename char_t>
   inline bool try_parse(const char_t* str, value_t& value, number_styles style) noexcept {
+    if constexpr (std::is_same_v<char_t, char> && __parse_has_fast_path<value_t>) {
+      auto status = __parse_try_fast_number(std::string_view {str}, style, value);
+      if (status != __parse_status::not_handled) return status == __parse_status::success;
+    }
     return try_parse(std::basic_string<char_t>(str), value, style);
   }
   
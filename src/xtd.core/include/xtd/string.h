@@ -7,11 +7,6 @@
 #undef __XTD_CORE_INTERNAL__
 #include "basic_string.h"
 
-/// @cond
-template<typename ...args_t>
-void __ustring_extract_format_arg(xtd::string& fmt, std::vector<__format_information<char>>& formats, args_t&& ... args);
-/// @endcond
-
 /// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
 namespace xtd {
   /// @brief Represents text as a sequence of UTF-8 code units.
@@ -1115,78 +1110,28 @@ namespace xtd {
     /// @remarks for more information about format see @ref FormatPage "Format".
     template<typename ...args_t>
     static string format(const string& fmt, args_t&& ... args) {
-      string result;
-      xtd::size index = 0;
-      std::vector<__format_information<char>> formats;
-      auto begin_format_iterator = fmt.end();
-      auto end_format_iterator = fmt.end();
-      for (auto iterator = fmt.begin(); iterator != fmt.end(); ++iterator) {
-        if (*iterator == '{') {
-          if (++iterator == fmt.end())
-            __throw_basic_string_format_exception_open_bracket(__FILE__, __LINE__, __func__);
-          if (*iterator == '{')
-            result += *iterator;
-          else {
-            begin_format_iterator = iterator;
-            while (iterator != fmt.end() && *iterator != '}') ++iterator;
-            if (iterator == fmt.end())
-              __throw_basic_string_format_exception_open_bracket(__FILE__, __LINE__, __func__);
-            end_format_iterator = iterator;
-            __format_information<char> fi;
-            fi.location = result.size();
-            std::string format_str {begin_format_iterator, end_format_iterator};
-            if (format_str.size() == 0)
-              fi.index = index++;
-            else {
-              xtd::size index_alignment_separator = string(format_str).index_of(',');
-              xtd::size index_format_separator = string(format_str).index_of(u':');
-              
-              if (index_alignment_separator != std::string::npos && index_format_separator != std::string::npos && index_alignment_separator > index_format_separator)
-                index_alignment_separator = std::string::npos;
-                
-              if (index_alignment_separator != std::string::npos)
-                fi.alignment = format_str.substr(index_alignment_separator + 1, index_format_separator != std::string::npos ? index_format_separator - index_alignment_separator - 1 : std::string::npos);
-                
-              if (index_format_separator != std::string::npos)
-                fi.format = format_str.substr(index_format_separator + 1);
-                
-              if (index_alignment_separator == 0 || index_format_separator == 0)
-                fi.index = index++;
-              else {
-                std::string index_str;
-                if (index_alignment_separator != std::string::npos)
-                  index_str = format_str.substr(0, index_alignment_separator);
-                else if (index_format_separator != std::string::npos)
-                  index_str = format_str.substr(0, index_format_separator);
-                else
-                  index_str = std::move(format_str);
-                try {
-                  for (auto c : index_str)
-                    if (!std::isdigit(c)) __throw_basic_string_format_exception_start_colon(__FILE__, __LINE__, __func__);
-                  fi.index = std::stoi(index_str);
-                } catch (...) {
-                  __throw_basic_string_format_exception_start_colon(__FILE__, __LINE__, __func__);
-                }
-              }
-            }
-            formats.push_back(fi);
-          }
-        } else if (*iterator == '}') {
-          if (++iterator == fmt.end()) {
-            __throw_basic_string_format_exception_close_bracket(__FILE__, __LINE__, __func__);
-            break;
-          }
-          if (*iterator != '}') {
-            __throw_basic_string_format_exception_close_bracket(__FILE__, __LINE__, __func__);
-            break;
-          }
-          result += *iterator;
-        } else
-          result += *iterator;
-      }
-      
-      __ustring_extract_format_arg(result, formats, std::forward<args_t>(args)...);
-      return result.c_str();
+      auto result = string {};
+      __basic_string_format<string>(result, *__basic_string_parse_format(fmt), std::forward<args_t>(args)...);
+      return result;
+    }
+    
+    /// @brief Writes the text representation of the specified arguments list, to string using the specified format information.
+    /// @tparam fmt A composite format string literal.
+    /// @param args arguments list to write using format.
+    /// @return string formatted.
+    /// @ingroup format_parse
+    /// @remarks The format is parsed and checked while compiling : a malformed format, or an index that does not refer to one of the arguments, does not compile.
+    /// @remarks for more information about format see @ref FormatPage "Format".
+    /// @par Examples
+    /// @code
+    /// auto str = xtd::string::format<"{0} items from {1}">(42, "source");
+    /// @endcode
+    template<__format_literal fmt, typename ...args_t>
+    requires (__format_literal_is_valid<fmt>(sizeof...(args_t)))
+    static string format(args_t&& ... args) {
+      auto result = string {};
+      __basic_string_format<string>(result, __format_literal_pattern<fmt>(), std::forward<args_t>(args)...);
+      return result;
     }
     
     /// @brief Gets the fully qualified class name of the objec_t, including the namespace of the objec_t.
@@ -1695,39 +1640,6 @@ namespace xtd {
   inline xtd::string basic_string<char_t, traits_t, allocator_t>::to_string() const noexcept {return __xtd_convert_to_string<char>(chars_);}
 }
 
-/// @cond
-template<typename arg_t>
-void __ustring_extract_format_arg(std::string& fmt, xtd::size& index, std::vector<__format_information<char>>& formats, arg_t&& arg) {
-  xtd::size offset = 0;
-  for (auto& format : formats) {
-    format.location += offset;
-    if (format.index == index) {
-      xtd::string arg_str = xtd::to_string(arg, format.format);
-      
-      if (!format.alignment.empty()) {
-        xtd::int32 alignment = 0;
-        try {
-          alignment = std::stoi(format.alignment);
-        } catch (...) {
-          __throw_basic_string_format_exception(__FILE__, __LINE__, __func__);
-        }
-        if (alignment > 0) arg_str = arg_str.pad_left(alignment);
-        else if (alignment < 0) arg_str = arg_str.pad_right(-alignment);
-      }
-      fmt.insert(format.location, arg_str);
-      offset += arg_str.size();
-    }
-  }
-  ++index;
-}
-
-template<typename ...args_t>
-void __ustring_extract_format_arg(xtd::string& fmt, std::vector<__format_information<char>>& formats, args_t&& ... args) {
-  xtd::size index = 0;
-  (__ustring_extract_format_arg(fmt, index, formats, args), ...);
-  unused_(index); // workaround to mute gcc warning: unused-but-set-variable
-}
-/// @endcond
 
 /*
 /// @cond
@@ -2,6 +2,9 @@
 /// @brief Contains xtd::system_exception exception.
 /// @copyright Copyright (c) 2024 Gammasoft. All rights reserved.
 #pragma once
+#define __XTD_CORE_INTERNAL__
+#include "internal/__atomic_sptr.h"
+#undef __XTD_CORE_INTERNAL__
 #include "diagnostics/stack_frame.h"
 #include "diagnostics/stack_trace.h"
 #include "optional.h"
@@ -9,6 +12,7 @@
 #include "literals.h"
 #include "object.h"
 #include "string.h"
+#include <array>
 #include <cstdint>
 #include <stdexcept>
 #include <system_error>
@@ -130,6 +134,7 @@ namespace xtd {
     
     /// @brief Gets a string representation of the immediate frames on the call stack.
     /// @return A string that describes the immediate frames of the call stack.
+    /// @remarks When the exception is created, only the return addresses of the call stack are captured. They are resolved to methods, files and lines the first time the stack trace is requested, through a per-process cache shared by all exceptions.
     virtual xtd::string stack_trace() const noexcept;
     /// @}
     
@@ -161,6 +166,7 @@ namespace xtd {
     xtd::string stack_trace_to_string() const noexcept;
     const char* default_message() const noexcept;
     
+    static constexpr size_t max_stack_frames = 64;
     static bool enable_stack_trace_;
     mutable xtd::string name_;
     xtd::string message_;
@@ -168,7 +174,9 @@ namespace xtd {
     std::error_code error_;
     xtd::string help_link_;
     xtd::diagnostics::stack_frame information_;
-    xtd::sptr<xtd::diagnostics::stack_trace> stack_trace_;
+    std::array<void*, max_stack_frames> stack_addresses_;
+    size_t stack_address_count_ = 0;
+    mutable __xtd_atomic_sptr<xtd::diagnostics::stack_trace> stack_trace_;
   };
 }
 
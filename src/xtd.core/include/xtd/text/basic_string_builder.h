@@ -769,11 +769,27 @@ namespace xtd {
       /// @remarks Equivalent to return `basic_string_builder(*this, pos, count);`.
       basic_string_builder substr(size_type pos, size_type count) const {return chars_.substr(pos, count);}
       
+      /// @brief Converts the characters of this instance to lowercase.
+      /// @return A reference to this instance after the conversion has completed.
+      /// @remarks The characters are converted in place with the Unicode simple case mapping; the code units that do not form a valid code point are left unchanged.
+      basic_string_builder& to_lower() {
+        __xtd_map_case_in_place(chars_, __xtd_case::lower);
+        return *this;
+      }
+      
       /// @brief Converts the value of this instance to a xtd::basic_string_builder <char>.
       /// @return The current string.
       /// @todo Uncomment the folllowing line and remove the next..
       //xtd::string to_string() const noexcept override {return __xtd_convert_to_string<char>(chars_);}
       xtd::string to_string() const noexcept override {return xtd::string {chars_};}
+      
+      /// @brief Converts the characters of this instance to uppercase.
+      /// @return A reference to this instance after the conversion has completed.
+      /// @remarks The characters are converted in place with the Unicode simple case mapping; the code units that do not form a valid code point are left unchanged.
+      basic_string_builder& to_upper() {
+        __xtd_map_case_in_place(chars_, __xtd_case::upper);
+        return *this;
+      }
       /// @}
       
       /// @name Public Static Methods
@@ -0,0 +1,101 @@
+/// @file
+/// @brief Contains xtd::text::unicode::utf8 class.
+/// @copyright Copyright (c) 2024 Gammasoft. All rights reserved.
+#pragma once
+#include "../../buffers/operation_status.h"
+#include "../../char16.h"
+#include "../../char32.h"
+#include "../../core_export.h"
+#include "../../size.h"
+#include "../../static.h"
+#include <span>
+
+/// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
+namespace xtd {
+  /// @brief Contains classes that represent ASCII and Unicode character encodings; abstract base classes for converting blocks of characters to and from blocks of bytes; and a helper class that manipulates and formats xtd::string objects without creating intermediate instances of xtd::string.
+  namespace text {
+    /// @brief Contains types that support UTF-8 and other Unicode encodings.
+    namespace unicode {
+      /// @brief Provides static methods that convert chunked data between UTF-8, UTF-16 and UTF-32 encodings.
+      /// @par Header
+      /// ```cpp
+      /// #include <xtd/text/unicode/utf8>
+      /// ```
+      /// @par Namespace
+      /// xtd::text::unicode
+      /// @par Library
+      /// xtd.core
+      /// @ingroup xtd_core text
+      /// @remarks The sources are validated. An ill-formed sequence is either replaced by U+FFFD, one replacement character per maximal subpart as recommended by the Unicode Standard, or reported by xtd::buffers::operation_status::invalid_data. No exception is thrown.
+      /// @remarks The xtd::text::unicode::utf8::get_byte_count, xtd::text::unicode::utf8::get_char16_count and xtd::text::unicode::utf8::get_char32_count methods give the exact size of the destination of a complete conversion, so that it can be allocated once.
+      /// @remarks This is the transcoding used by the conversions between xtd::string, xtd::u8string, xtd::u16string, xtd::u32string and xtd::wstring.
+      class core_export_ utf8 static_ {
+      public:
+        /// @name Public Static Methods
+        
+        /// @{
+        /// @brief Transcodes the UTF-16 encoded source to UTF-8.
+        /// @param source A UTF-16 encoded span of characters.
+        /// @param destination The span into which the UTF-8 encoded bytes are written.
+        /// @param chars_read When the method returns, the number of characters read from source.
+        /// @param bytes_written When the method returns, the number of bytes written to destination.
+        /// @param replace_invalid_sequences true to replace the invalid UTF-16 sequences of source with U+FFFD; false to return xtd::buffers::operation_status::invalid_data when an invalid sequence is found in source.
+        /// @param is_final_block true if the method should not return xtd::buffers::operation_status::need_more_data; otherwise false.
+        /// @return An xtd::buffers::operation_status value that indicates the status of the conversion.
+        static xtd::buffers::operation_status from_utf16(std::span<const xtd::char16> source, std::span<char> destination, xtd::size& chars_read, xtd::size& bytes_written, bool replace_invalid_sequences = true, bool is_final_block = true) noexcept;
+        /// @brief Transcodes the UTF-32 encoded source to UTF-8.
+        /// @param source A UTF-32 encoded span of characters.
+        /// @param destination The span into which the UTF-8 encoded bytes are written.
+        /// @param chars_read When the method returns, the number of characters read from source.
+        /// @param bytes_written When the method returns, the number of bytes written to destination.
+        /// @param replace_invalid_sequences true to replace the invalid UTF-32 characters of source with U+FFFD; false to return xtd::buffers::operation_status::invalid_data when an invalid character is found in source.
+        /// @return An xtd::buffers::operation_status value that indicates the status of the conversion.
+        static xtd::buffers::operation_status from_utf32(std::span<const xtd::char32> source, std::span<char> destination, xtd::size& chars_read, xtd::size& bytes_written, bool replace_invalid_sequences = true) noexcept;
+        
+        /// @brief Gets the number of bytes of the UTF-8 encoding of the specified UTF-16 encoded characters.
+        /// @param source A UTF-16 encoded span of characters.
+        /// @return The number of bytes written by xtd::text::unicode::utf8::from_utf16 when the invalid sequences are replaced.
+        static xtd::size get_byte_count(std::span<const xtd::char16> source) noexcept;
+        /// @brief Gets the number of bytes of the UTF-8 encoding of the specified UTF-32 encoded characters.
+        /// @param source A UTF-32 encoded span of characters.
+        /// @return The number of bytes written by xtd::text::unicode::utf8::from_utf32 when the invalid characters are replaced.
+        static xtd::size get_byte_count(std::span<const xtd::char32> source) noexcept;
+        
+        /// @brief Gets the number of UTF-16 characters of the decoding of the specified UTF-8 encoded bytes.
+        /// @param source A UTF-8 encoded span of bytes.
+        /// @return The number of characters written by xtd::text::unicode::utf8::to_utf16 when the invalid sequences are replaced.
+        static xtd::size get_char16_count(std::span<const char> source) noexcept;
+        
+        /// @brief Gets the number of UTF-32 characters of the decoding of the specified UTF-8 encoded bytes.
+        /// @param source A UTF-8 encoded span of bytes.
+        /// @return The number of characters written by xtd::text::unicode::utf8::to_utf32 when the invalid sequences are replaced.
+        static xtd::size get_char32_count(std::span<const char> source) noexcept;
+        
+        /// @brief Validates that the specified bytes are well-formed UTF-8.
+        /// @param value A span of bytes.
+        /// @return true if value is well-formed UTF-8; otherwise false.
+        static bool is_valid(std::span<const char> value) noexcept;
+        
+        /// @brief Transcodes the UTF-8 encoded source to UTF-16.
+        /// @param source A UTF-8 encoded span of bytes.
+        /// @param destination The span into which the UTF-16 encoded characters are written.
+        /// @param bytes_read When the method returns, the number of bytes read from source.
+        /// @param chars_written When the method returns, the number of characters written to destination.
+        /// @param replace_invalid_sequences true to replace the invalid UTF-8 sequences of source with U+FFFD; false to return xtd::buffers::operation_status::invalid_data when an invalid sequence is found in source.
+        /// @param is_final_block true if the method should not return xtd::buffers::operation_status::need_more_data; otherwise false.
+        /// @return An xtd::buffers::operation_status value that indicates the status of the conversion.
+        static xtd::buffers::operation_status to_utf16(std::span<const char> source, std::span<xtd::char16> destination, xtd::size& bytes_read, xtd::size& chars_written, bool replace_invalid_sequences = true, bool is_final_block = true) noexcept;
+        /// @brief Transcodes the UTF-8 encoded source to UTF-32.
+        /// @param source A UTF-8 encoded span of bytes.
+        /// @param destination The span into which the UTF-32 encoded characters are written.
+        /// @param bytes_read When the method returns, the number of bytes read from source.
+        /// @param chars_written When the method returns, the number of characters written to destination.
+        /// @param replace_invalid_sequences true to replace the invalid UTF-8 sequences of source with U+FFFD; false to return xtd::buffers::operation_status::invalid_data when an invalid sequence is found in source.
+        /// @param is_final_block true if the method should not return xtd::buffers::operation_status::need_more_data; otherwise false.
+        /// @return An xtd::buffers::operation_status value that indicates the status of the conversion.
+        static xtd::buffers::operation_status to_utf32(std::span<const char> source, std::span<xtd::char32> destination, xtd::size& bytes_read, xtd::size& chars_written, bool replace_invalid_sequences = true, bool is_final_block = true) noexcept;
+        /// @}
+      };
+    }
+  }
+}
@@ -179,6 +179,9 @@ namespace xtd {
       /// @}
 
     private:
+      bool add_waiter(waiter& waiter, size_t index) override;
+      void remove_waiter(waiter& waiter, size_t index) override;
+      
       void create(bool initial_state, bool& created_new);
       
       xtd::sptr<data> data_;
@@ -131,7 +131,6 @@ namespace xtd {
       class condition_variable;
       class critical_section;
       struct item;
-      using item_collection = std::unordered_map<intptr, item>;
       using object_ptr = xtd::collections::generic::key_value_pair<intptr, bool>;
       struct static_data;
       
@@ -441,6 +440,7 @@ namespace xtd {
       static void enter_ptr(object_ptr obj);
       static void enter_ptr(object_ptr obj, bool& lock_taken);
       static void exit_ptr(object_ptr obj);
+      static item& get_owned_item(object_ptr obj);
       static intptr get_ustring_ptr(const string& str);
       static bool is_entered_ptr(object_ptr obj) noexcept;
       static void pulse_ptr(object_ptr obj);
@@ -193,6 +193,9 @@ namespace xtd {
       /// @}
 
     private:
+      bool add_waiter(waiter& waiter, size_t index) override;
+      void remove_waiter(waiter& waiter, size_t index) override;
+      
       friend class thread;
       void create(bool initially_owned, bool& created_new);
       xtd::sptr<mutex_base> mutex_;
@@ -212,6 +212,9 @@ namespace xtd {
       /// @}
 
     private:
+      bool add_waiter(waiter& waiter, size_t index) override;
+      void remove_waiter(waiter& waiter, size_t index) override;
+      
       void create(int32 initial_count, int32 maximum_count, bool& created_new);
       xtd::sptr<semaphore_base> semaphore_;
       xtd::sptr<data> data_;
@@ -391,6 +391,7 @@ namespace xtd {
       /// @endcond
       
     private:
+      friend class monitor;
       friend class thread_pool;
       friend class wait_handle;
 
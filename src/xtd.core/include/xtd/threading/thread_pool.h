@@ -43,6 +43,7 @@ namespace xtd {
     /// * When you call the xtd::threading::thread_pool::queue_user_work_item method to queue a method for execution on a thread pool thread. You do this by passing the method a xtd::threading::wait_callback delegate. The delegate has the signature @verbatom using wait_callback = action<std::any> @endverbatim where state is an object that contains data to be used by the delegate. The actual data can be passed to the delegate by calling the xtd::threading::thread_pool::queue_user_work_item(xtd::threading::wait_callback, std::any) method.
     /// @note The threads in the managed thread pool are background threads. That is, their xtd::threading::thread::is_background properties are true. This means that a xtd::threading::thread_pool thread will not keep an application running after all foreground threads have exited.
     /// @remarks You can also queue work items that are not related to a wait operation to the thread pool. To request that a work item be handled by a thread in the thread pool, call the xtd::threading::thread_pool::queue_user_work_item method. This method takes as a parameter a reference to the method or delegate that will be called by the thread selected from the thread pool. There is no way to cancel a work item after it has been queued.
+    /// @remarks Each worker thread owns a local work-stealing queue. Work items queued from a thread pool thread are pushed on the local queue of this thread and are executed in LIFO order by it. Work items queued from other threads are pushed on a lock-free global queue and are executed in FIFO order. An idle worker thread steals the oldest work items of the other worker threads.
     /// @remarks Timer-queue timers and registered wait operations also use the thread pool. Their callback functions are queued to the thread pool.
     /// @remarks There is one thread pool per process.The default size of the thread pool for a process depends on several factors, such as the size of the virtual address space. A process can call the xtd::threading::thread_pool::gt_max_threads method to determine the number of threads. The number of threads in the thread pool can be changed by using the xtd::threading::thread_pool::set_max_threads method. Each thread uses the default stack size and runs at the default priority.
     /// @remarks The thread pool provides new worker threads or I/O completion threads on demand until it reaches the maximum for each category. When a maximum is reached, the thread pool can create additional threads in that category or wait until some tasks complete. The thread pool creates and destroys worker threads in order to optimize throughput, which is defined as the number of tasks that complete per unit of time. Too few threads might not make optimal use of available resources, whereas too many threads could increase resource contention.
@@ -79,7 +80,6 @@ namespace xtd {
       
       using thread_pool_item = thread_item<wait_callback>;
       using thread_pool_asynchronous_io_item = thread_item<wait_or_timer_callback>;
-      using thread_pool_item_collection = std::vector<thread_pool_item>;
       using thread_pool_asynchronous_io_item_collection = std::vector<thread_pool_asynchronous_io_item>;
 
       using thread_vector = std::vector<thread>;
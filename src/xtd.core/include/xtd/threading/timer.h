@@ -45,6 +45,7 @@ namespace xtd {
     /// @note As long as you are using a xtd::threading::timer, you must keep a reference to it. As with any managed object, a xtd::threading::timer is subject to garbage collection when there are no references to it. The fact that a xtd::threading::timer is still active does not prevent it from being collecte
     /// @note The system clock that is used is the same clock used by GetTickCount, which is not affected by changes made with timeBeginPeriod and timeEndPeriod.
     /// @remarks The callback method executed by the timer should be reentrant, because it is called onxtd::threading::thread-pool threads. The callback can be executed simultaneously on two thread pool threads if the timer interval is less than the time required to execute the callback, or if all thread pool threads are in use and the callback is queued multiple times.
+    /// @remarks All the xtd::threading::timer instances share a single scheduling thread that keeps the pending due times ordered and queues the expired callbacks to the xtd::threading::thread_pool. A timer does not hold a thread pool thread while it waits.
     /// @note xtd::threading::timer is a simple, lightweight timer that uses callback methods and is served by thread pool threads. It is not recommended for use with Windows Forms, because its callbacks do not occur on the user interface thread. xtd::forms::timer is a better choice for use with Windows Forms. For server-based timer functionality, you might consider using xtd::timers::timer, which raises events and has additional features.
     class core_export_ timer final : public object {
       struct data;
@@ -183,6 +184,10 @@ namespace xtd {
       /// @}
 
     private:
+      struct static_data;
+      
+      static static_data& get_static_data();
+      
       xtd::sptr<data> data_;
     };
   }
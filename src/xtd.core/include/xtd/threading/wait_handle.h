@@ -50,7 +50,10 @@ namespace xtd {
     /// The following code example shows how two threads can do background tasks while the Main thread waits for the tasks to complete using the static xtd::threading::wait_handle::wait_any and xtd::threading::wait_handle::wait_all methods of the xtd::threading::wait_handle class.
     /// @include wait_handle.cpp
     class core_export_ wait_handle abstract_ {
+      friend class event_wait_handle;
+      friend class mutex;
       friend class registered_wait_handle;
+      friend class semaphore;
       friend class thread;
     public:
       /// @name Public Fields
@@ -157,6 +160,7 @@ namespace xtd {
       /// @exception xtd::object_closed_exception the to_signal and/or to_wait are invalid
       /// @exception xtd::argument_exception The number of objects in wait_handles is greater than the system permits.
       /// @exception xtd::threading::abandoned_mutex_exception The wait completed because a thread exited without releasing a mutex.
+      /// @remarks The wait is not atomic : the wait handles are acquired one after the other, and the ones already acquired are released again when another one is not signaled. In the meantime, other threads can see them as not signaled.
       template<typename collection_t>
       static bool wait_all(const collection_t& wait_handles) {return wait_all(wait_handles, timeout::infinite);}
       
@@ -168,6 +172,7 @@ namespace xtd {
       /// @exception xtd::object_closed_exception the to_signal and/or to_wait are invalid
       /// @exception xtd::argument_exception The number of objects in wait_handles is greater than the system permits.
       /// @exception xtd::threading::abandoned_mutex_exception The wait completed because a thread exited without releasing a mutex.
+      /// @remarks The wait is not atomic : the wait handles are acquired one after the other, and the ones already acquired are released again when another one is not signaled. In the meantime, other threads can see them as not signaled.
       template<typename collection_t>
       static bool wait_all(const collection_t& wait_handles, int32 milliseconds_timeout) {
         std::vector<wait_handle*> wait_handle_pointers;
@@ -184,6 +189,7 @@ namespace xtd {
       /// @exception xtd::object_closed_exception the to_signal and/or to_wait are invalid
       /// @exception xtd::argument_exception The number of objects in wait_handles is greater than the system permits.
       /// @exception xtd::threading::abandoned_mutex_exception The wait completed because a thread exited without releasing a mutex.
+      /// @remarks The wait is not atomic : the wait handles are acquired one after the other, and the ones already acquired are released again when another one is not signaled. In the meantime, other threads can see them as not signaled.
       template<typename collection_t>
       static bool wait_all(const collection_t& wait_handles, const time_span& timeout) {return wait_all(wait_handles, as<int32>(timeout.total_milliseconds_duration().count()));}
       
@@ -316,6 +322,16 @@ namespace xtd {
       /// @}
 
     private:
+      class waiter;
+      class waiter_collection;
+      class waiter_registration;
+      
+      // Registers a waiter to be notified each time the wait handle is signaled. Returns false if the wait handle does not notify waiters : wait_any and wait_all then poll it.
+      // Only the wait handles of xtd.core override it; the default implementation does nothing and returns false.
+      virtual bool add_waiter(waiter& waiter, size_t index);
+      // Unregisters a waiter registered with add_waiter. The default implementation does nothing.
+      virtual void remove_waiter(waiter& waiter, size_t index);
+      
       template <typename item_t, typename... items_t>
       static void fill_wait_handle_pointers(std::vector<wait_handle*>& wait_handle_pointers, item_t& first, items_t&... rest) {
         wait_handle_pointers.push_back(const_cast<wait_handle*>(as<wait_handle>(&first)));
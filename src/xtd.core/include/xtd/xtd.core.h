@@ -4,6 +4,7 @@
 #pragma once
 #include "std.h"
 
+#include "buffers/operation_status.h"
 #include "collections/any_pair.h"
 #include "collections/array_list.h"
 #include "collections/enumerator.h"
@@ -29,6 +30,7 @@
 #include "collections/generic/helpers/comparer.h"
 #include "collections/generic/helpers/equator.h"
 #include "collections/generic/helpers/hasher.h"
+#include "collections/generic/helpers/wrap_pointer_iterator.h"
 #include "collections/object_model/read_only_collection.h"
 #include "collections/specialized/string_collection.h"
 #include "collections/specialized/string_dictionary.h"
@@ -38,6 +40,7 @@
 #include "configuration/settings.h"
 #include "diagnostics/assert.h"
 #include "diagnostics/assert_dialog_result.h"
+#include "diagnostics/async_trace_listener.h"
 #include "diagnostics/boolean_switch.h"
 #include "diagnostics/console_trace_listener.h"
 #include "diagnostics/data_received_event_args.h"
@@ -67,6 +70,7 @@
 #include "diagnostics/trace_listener.h"
 #include "diagnostics/trace_listener_collection.h"
 #include "diagnostics/trace_options.h"
+#include "diagnostics/trace_overflow_policy.h"
 #include "diagnostics/trace_source.h"
 #include "diagnostics/trace_switch.h"
 #include "io/binary_reader.h"
@@ -88,6 +92,9 @@
 #include "io/file_permissions.h"
 #include "io/file_system_info.h"
 #include "io/io_exception.h"
+#include "io/memory_mapped_file.h"
+#include "io/memory_mapped_file_advice.h"
+#include "io/memory_mapped_view_accessor.h"
 #include "io/path.h"
 #include "io/path_too_long_exception.h"
 #include "io/search_option.h"
@@ -97,6 +104,11 @@
 #include "io/string_writer.h"
 #include "io/text_reader.h"
 #include "io/text_writer.h"
+#include "linq/enumerable.h"
+#include "linq/grouping.h"
+#include "linq/parallel_enumerable.h"
+#include "linq/parallel_query.h"
+#include "linq/query.h"
 #include "media/system_sound.h"
 #include "media/system_sounds.h"
 #include "net/cookie_exception.h"
@@ -111,6 +123,7 @@
 #include "net/socket_address.h"
 #include "net/web_exception.h"
 #include "net/sockets/address_family.h"
+#include "net/sockets/datagram_buffer.h"
 #include "net/sockets/io_control_code.h"
 #include "net/sockets/ip_packet_information.h"
 #include "net/sockets/ip_protection_level.h"
@@ -132,6 +145,9 @@
 #include "net/sockets/socket_information_options.h"
 #include "net/sockets/socket_option_level.h"
 #include "net/sockets/socket_option_name.h"
+#include "net/sockets/socket_poller.h"
+#include "net/sockets/socket_poller_events.h"
+#include "net/sockets/socket_poller_mode.h"
 #include "net/sockets/socket_shutdown.h"
 #include "net/sockets/socket_type.h"
 #include "net/sockets/tcp_client.h"
@@ -176,6 +192,7 @@
 #include "text/u16string_builder.h"
 #include "text/u32string_builder.h"
 #include "text/u8string_builder.h"
+#include "text/unicode/utf8.h"
 #include "threading/abandoned_mutex_exception.h"
 #include "threading/auto_reset_event.h"
 #include "threading/barrier.h"
@@ -8,9 +8,90 @@
 #include "../../include/xtd/index_out_of_range_exception.h"
 #include "../../include/xtd/null_pointer_exception.h"
 #include "../../include/xtd/diagnostics/stack_frame.h"
+#include <string_view>
+#include <unordered_map>
 
 using namespace xtd;
 
+namespace {
+  // Parsed patterns are cached per thread; the cache is simply flushed when it grows too large.
+  constexpr xtd::size max_cached_format_patterns = 256;
+  
+  void parse_format_item(std::string_view item, xtd::size& index, __format_information<char>& information) {
+    if (item.empty()) {
+      information.index = index++;
+      return;
+    }
+    
+    auto alignment_separator = item.find(',');
+    auto format_separator = item.find(':');
+    if (alignment_separator != std::string_view::npos && format_separator != std::string_view::npos && alignment_separator > format_separator)
+      alignment_separator = std::string_view::npos;
+    
+    if (alignment_separator != std::string_view::npos) {
+      information.alignment = item.substr(alignment_separator + 1, format_separator != std::string_view::npos ? format_separator - alignment_separator - 1 : std::string_view::npos);
+      try {
+        information.alignment_width = std::stoi(information.alignment);
+      } catch (...) {
+        information.is_alignment_valid = false;
+      }
+    }
+    
+    if (format_separator != std::string_view::npos)
+      information.format = item.substr(format_separator + 1);
+    
+    if (alignment_separator == 0 || format_separator == 0) {
+      information.index = index++;
+      return;
+    }
+    
+    auto index_str = item.substr(0, alignment_separator != std::string_view::npos ? alignment_separator : format_separator);
+    auto value = xtd::size {0};
+    for (auto c : index_str) {
+      if (c < '0' || c > '9') __throw_basic_string_format_exception_start_colon(__FILE__, __LINE__, __func__);
+      value = value * 10 + static_cast<xtd::size>(c - '0');
+      if (value > static_cast<xtd::size>(std::numeric_limits<int32>::max())) __throw_basic_string_format_exception_start_colon(__FILE__, __LINE__, __func__);
+    }
+    information.index = value;
+  }
+  
+  std::shared_ptr<const __format_pattern<char>> parse_format(const std::basic_string<char>& fmt) {
+    auto pattern = std::make_shared<__format_pattern<char>>();
+    pattern->text.reserve(fmt.size());
+    auto index = xtd::size {0};
+    for (auto position = xtd::size {0}; position < fmt.size(); ++position) {
+      if (fmt[position] == '{') {
+        if (++position == fmt.size()) __throw_basic_string_format_exception_open_bracket(__FILE__, __LINE__, __func__);
+        if (fmt[position] == '{') pattern->text += '{';
+        else {
+          auto end_position = fmt.find('}', position);
+          if (end_position == std::basic_string<char>::npos) __throw_basic_string_format_exception_open_bracket(__FILE__, __LINE__, __func__);
+          auto information = __format_information<char> {};
+          information.location = pattern->text.size();
+          parse_format_item(std::string_view {fmt}.substr(position, end_position - position), index, information);
+          pattern->formats.push_back(std::move(information));
+          position = end_position;
+        }
+      } else if (fmt[position] == '}') {
+        if (++position == fmt.size() || fmt[position] != '}') __throw_basic_string_format_exception_close_bracket(__FILE__, __LINE__, __func__);
+        pattern->text += '}';
+      } else pattern->text += fmt[position];
+    }
+    return pattern;
+  }
+}
+
+std::shared_ptr<const __format_pattern<char>> __basic_string_parse_format(const std::basic_string<char>& fmt) {
+  thread_local auto patterns = std::unordered_map<std::basic_string<char>, std::shared_ptr<const __format_pattern<char>>> {};
+  auto iterator = patterns.find(fmt);
+  if (iterator != patterns.end()) return iterator->second;
+  
+  auto pattern = parse_format(fmt);
+  if (patterns.size() >= max_cached_format_patterns) patterns.clear();
+  patterns.emplace(fmt, pattern);
+  return pattern;
+}
+
 void __throw_basic_string_argument_exception(const char* file, uint32 line, const char* func) {
   throw argument_exception {{file, line, func}};
 }
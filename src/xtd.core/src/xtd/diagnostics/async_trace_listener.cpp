@@ -0,0 +1,200 @@
+#include "../../../include/xtd/diagnostics/async_trace_listener.h"
+#include "../../../include/xtd/argument_null_exception.h"
+#include "../../../include/xtd/argument_out_of_range_exception.h"
+#include "../../../include/xtd/new_sptr.h"
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <condition_variable>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+using namespace xtd;
+using namespace xtd::diagnostics;
+
+namespace {
+  constexpr size_t max_batch_size = 256;
+  
+  int64 now() noexcept {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+  }
+}
+
+struct async_trace_listener::data {
+  // The queue is a bounded multi-producer ring : each cell carries a sequence number that tells whether it is free for the producer reserving its position or ready for the consumer.
+  // The consumer writes the message directly from its cell and never moves it out, so the cells keep their string storage and steady-state tracing does not allocate.
+  struct cell {
+    std::atomic<size_t> sequence = 0;
+    xtd::string message;
+    bool new_line = false;
+    uint32 indent_level = 0;
+    uint32 indent_size = 0;
+    int64 queued = 0;
+  };
+  
+  data(const xtd::sptr<trace_listener>& listener, size_t capacity, trace_overflow_policy overflow_policy) : listener(listener), overflow_policy(overflow_policy), cells(new cell[capacity]), mask(capacity - 1) {
+    for (auto index = 0_z; index < capacity; ++index)
+      cells[index].sequence.store(index, std::memory_order_relaxed);
+    consumer = std::thread {[this] {run();}};
+  }
+  
+  bool try_enqueue(const xtd::string& message, bool new_line, uint32 indent_level, uint32 indent_size, int64 queued) {
+    auto position = enqueue_position.load(std::memory_order_relaxed);
+    auto current = static_cast<cell*>(nullptr);
+    for (;;) {
+      current = &cells[position & mask];
+      auto difference = static_cast<intptr>(current->sequence.load(std::memory_order_acquire)) - static_cast<intptr>(position);
+      if (difference < 0) return false;
+      if (difference == 0 && enqueue_position.compare_exchange_weak(position, position + 1)) break;
+      if (difference > 0) position = enqueue_position.load(std::memory_order_relaxed);
+    }
+    current->message = message;
+    current->new_line = new_line;
+    current->indent_level = indent_level;
+    current->indent_size = indent_size;
+    current->queued = queued;
+    current->sequence.store(position + 1, std::memory_order_release);
+    if (consumer_waiting.load()) wake_consumer();
+    return true;
+  }
+  
+  void run() {
+    auto dequeue_position = 0_z;
+    for (;;) {
+      auto count = 0_z;
+      auto total_queued = int64 {0};
+      auto oldest_queued = std::numeric_limits<int64>::max();
+      while (count < max_batch_size) {
+        auto& current = cells[dequeue_position & mask];
+        if (current.sequence.load(std::memory_order_acquire) != dequeue_position + 1) break;
+        if (listener->indent_level() != current.indent_level) listener->indent_level(current.indent_level);
+        if (listener->indent_size() != current.indent_size) listener->indent_size(current.indent_size);
+        if (current.new_line) listener->write_line(current.message);
+        else listener->write(current.message);
+        total_queued += current.queued;
+        oldest_queued = std::min(oldest_queued, current.queued);
+        current.sequence.store(dequeue_position + mask + 1, std::memory_order_release);
+        ++dequeue_position;
+        ++count;
+      }
+      
+      if (count) {
+        listener->flush();
+        auto written = now();
+        total_latency.fetch_add(written * static_cast<int64>(count) - total_queued, std::memory_order_relaxed);
+        max_latency.store(std::max(max_latency.load(std::memory_order_relaxed), written - oldest_queued), std::memory_order_relaxed);
+        written_position.store(dequeue_position, std::memory_order_release);
+        auto lock = std::lock_guard<std::mutex> {sync_root};
+        flushed.notify_all();
+        continue;
+      }
+      
+      auto lock = std::unique_lock<std::mutex> {sync_root};
+      if (closed.load() && enqueue_position.load() == dequeue_position) break;
+      consumer_waiting.store(true);
+      queued.wait(lock, [&] {return closed.load() || enqueue_position.load() != dequeue_position;});
+      consumer_waiting.store(false);
+    }
+    
+    auto lock = std::lock_guard<std::mutex> {sync_root};
+    stopped = true;
+    flushed.notify_all();
+  }
+  
+  void wake_consumer() {
+    auto lock = std::lock_guard<std::mutex> {sync_root};
+    queued.notify_one();
+  }
+  
+  xtd::sptr<trace_listener> listener;
+  trace_overflow_policy overflow_policy = trace_overflow_policy::block;
+  std::unique_ptr<cell[]> cells;
+  size_t mask = 0;
+  alignas(64) std::atomic<size_t> enqueue_position = 0;
+  alignas(64) std::atomic<size_t> written_position = 0;
+  std::atomic<size_t> dropped_count = 0;
+  std::atomic<int64> total_latency = 0;
+  std::atomic<int64> max_latency = 0;
+  std::atomic<bool> consumer_waiting = false;
+  std::atomic<bool> closed = false;
+  bool stopped = false;
+  std::mutex sync_root;
+  std::condition_variable queued;
+  std::condition_variable flushed;
+  std::thread consumer;
+};
+
+async_trace_listener::async_trace_listener(const xtd::sptr<trace_listener>& listener) : async_trace_listener(listener, default_capacity, trace_overflow_policy::block) {
+}
+
+async_trace_listener::async_trace_listener(const xtd::sptr<trace_listener>& listener, size_t capacity) : async_trace_listener(listener, capacity, trace_overflow_policy::block) {
+}
+
+async_trace_listener::async_trace_listener(const xtd::sptr<trace_listener>& listener, size_t capacity, trace_overflow_policy overflow_policy) {
+  if (!listener) throw argument_null_exception {csf_};
+  if (capacity < 2) throw argument_out_of_range_exception {csf_};
+  data_ = xtd::new_sptr<data>(listener, std::bit_ceil(capacity), overflow_policy);
+  thread_safe(true);
+}
+
+async_trace_listener::~async_trace_listener() {
+  close();
+}
+
+time_span async_trace_listener::average_latency() const noexcept {
+  auto count = written_count();
+  return count ? time_span {std::chrono::nanoseconds {data_->total_latency.load(std::memory_order_relaxed) / static_cast<int64>(count)}} : time_span {};
+}
+
+size_t async_trace_listener::capacity() const noexcept {
+  return data_->mask + 1;
+}
+
+size_t async_trace_listener::dropped_count() const noexcept {
+  return data_->dropped_count.load(std::memory_order_relaxed);
+}
+
+const xtd::sptr<trace_listener>& async_trace_listener::listener() const noexcept {
+  return data_->listener;
+}
+
+time_span async_trace_listener::max_latency() const noexcept {
+  return time_span {std::chrono::nanoseconds {data_->max_latency.load(std::memory_order_relaxed)}};
+}
+
+trace_overflow_policy async_trace_listener::overflow_policy() const noexcept {
+  return data_->overflow_policy;
+}
+
+size_t async_trace_listener::written_count() const noexcept {
+  return data_->written_position.load(std::memory_order_acquire);
+}
+
+void async_trace_listener::close() {
+  if (data_->closed.exchange(true)) return;
+  data_->wake_consumer();
+  if (data_->consumer.joinable()) data_->consumer.join();
+  data_->listener->close();
+}
+
+void async_trace_listener::flush_() {
+  auto position = data_->enqueue_position.load();
+  if (data_->written_position.load(std::memory_order_acquire) >= position) return;
+  auto lock = std::unique_lock<std::mutex> {data_->sync_root};
+  data_->queued.notify_one();
+  data_->flushed.wait(lock, [&] {return data_->stopped || data_->written_position.load(std::memory_order_acquire) >= position;});
+}
+
+void async_trace_listener::write_(const string& message, bool new_line) {
+  auto queued = now();
+  while (data_->closed.load(std::memory_order_relaxed) || !data_->try_enqueue(message, new_line, indent_level(), indent_size(), queued)) {
+    if (data_->overflow_policy == trace_overflow_policy::drop || data_->closed.load(std::memory_order_relaxed)) {
+      data_->dropped_count.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+    std::this_thread::yield();
+  }
+}
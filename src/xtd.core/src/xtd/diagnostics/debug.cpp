@@ -135,14 +135,15 @@ void debug::flush_() {
 }
 
 void debug::trace_event_(trace_event_type trace_event_type, const string& message) {
+  auto event_cache = trace_event_cache {};
   for (auto listener : listeners_) {
     if (listener->indent_level() != indent_level_) listener->indent_level(indent_level_);
     if (listener->indent_size() != indent_size_) listener->indent_size(indent_size_);
     if (!listener->is_thread_safe() && __debug_use_debug_global_lock__) {
       std::lock_guard<std::recursive_mutex> lock {__debug_mutex__};
-      listener->trace_event(trace_event_cache(), source_name_, trace_event_type, 0, message);
+      listener->trace_event(event_cache, source_name_, trace_event_type, 0, message);
     } else
-      listener->trace_event(trace_event_cache(), source_name_, trace_event_type, 0, message);
+      listener->trace_event(event_cache, source_name_, trace_event_type, 0, message);
   }
   if (auto_flush_) flush();
 }
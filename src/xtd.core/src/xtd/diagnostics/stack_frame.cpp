@@ -3,11 +3,30 @@
 #define __XTD_CORE_NATIVE_LIBRARY__
 #include <xtd/native/stack_trace>
 #undef __XTD_CORE_NATIVE_LIBRARY__
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
 
 using namespace xtd;
 using namespace xtd::collections::generic;
 using namespace xtd::diagnostics;
 
+namespace {
+  constexpr size_t max_frames = 1024;
+  
+  // Resolving a return address (dladdr and demangling, or DbgHelp) is far more expensive than capturing it, and the same addresses are resolved again and again.
+  // The resolved frames are kept for the lifetime of the process. The cache is never destroyed, so that it can still be used by exceptions thrown during static destruction.
+  struct symbol_cache {
+    std::shared_mutex sync_root;
+    std::unordered_map<void*, std::tuple<std::string, size_t, size_t, std::string, size_t>> frames;
+  };
+  
+  symbol_cache& get_symbol_cache() {
+    static auto cache = new symbol_cache {};
+    return *cache;
+  }
+}
+
 stack_frame::stack_frame() {
   auto frames = get_stack_frames("", 0, false);
   if (frames.size()) {
@@ -101,12 +120,35 @@ string stack_frame::to_string() const noexcept {
 }
 
 std::vector<stack_frame> stack_frame::get_stack_frames(const string& str, size_t skip_frames, bool need_file_info) noexcept {
-  auto call_stack = native::stack_trace::get_frames(2);
+  void* addresses[max_frames];
+  auto count = native::stack_trace::get_addresses(2, addresses, max_frames);
+  return get_stack_frames(std::span<void* const> {addresses, count}, str, skip_frames, need_file_info);
+}
+
+std::vector<stack_frame> stack_frame::get_stack_frames(std::span<void* const> addresses, const string& str, size_t skip_frames, bool need_file_info) noexcept {
+  auto& cache = get_symbol_cache();
+  auto call_stack = std::vector<const native::stack_trace::frame*> {};
+  for (auto address : addresses) {
+    auto frame = static_cast<const native::stack_trace::frame*>(nullptr);
+    {
+      auto lock = std::shared_lock<std::shared_mutex> {cache.sync_root};
+      auto iterator = cache.frames.find(address);
+      if (iterator != cache.frames.end()) frame = &iterator->second;
+    }
+    if (!frame) {
+      auto resolved_frame = native::stack_trace::get_frame(address);
+      auto lock = std::unique_lock<std::shared_mutex> {cache.sync_root};
+      frame = &cache.frames.try_emplace(address, std::move(resolved_frame)).first->second;
+    }
+    if (std::get<3>(*frame).empty()) break;
+    call_stack.push_back(frame);
+    if (std::get<3>(*frame) == "main") break;
+  }
   auto skip_frames_before_str = 0_z;
   if (!str.empty()) {
     skip_frames_before_str = call_stack.size();
     for (auto index = 0_z; index < call_stack.size(); ++index) {
-      auto [file, line, column, function, offset] = call_stack[index];
+      auto& [file, line, column, function, offset] = *call_stack[index];
       if (string {function}.starts_with(str)) {
         skip_frames_before_str = index;
         break;
@@ -117,7 +159,7 @@ std::vector<stack_frame> stack_frame::get_stack_frames(const string& str, size_t
   auto stack_frames = std::vector<stack_frame> {};
   if (call_stack.size() == 0) return stack_frames;
   for (auto index = skip_frames_before_str + skip_frames; index < call_stack.size(); ++index) {
-    auto [file, line, column, function, offset] = call_stack[index];
+    auto& [file, line, column, function, offset] = *call_stack[index];
     auto skip = false;
     for (auto starting_str : {"__startup__::run", "decltype", "std::_", "std::invoke", "void std::_", "long std::_", "xtd::delegate<"})
       if (string(function).starts_with(starting_str)) skip = true;
@@ -1,6 +1,9 @@
 #include "../../../include/xtd/environment.h"
 #include "../../../include/xtd/typeof.h"
 #include "../../../include/xtd/diagnostics/stack_trace.h"
+#define __XTD_CORE_NATIVE_LIBRARY__
+#include <xtd/native/stack_trace>
+#undef __XTD_CORE_NATIVE_LIBRARY__
 
 using namespace xtd;
 using namespace xtd::diagnostics;
@@ -45,6 +48,10 @@ stack_trace::stack_trace(const std::exception& exception, size_t skip_frames, bo
   frames_ = stack_frame::get_stack_frames(typeof_(exception).full_name(), skip_frames + METHODS_TO_SKIP + 1, need_file_info);
 }
 
+stack_trace::stack_trace(std::span<void* const> addresses, const string& str, size_t skip_frames, bool need_file_info) {
+  frames_ = stack_frame::get_stack_frames(addresses, str, skip_frames, need_file_info);
+}
+
 size_t stack_trace::frame_count() const noexcept {
   return frames_.size();
 }
@@ -60,6 +67,10 @@ const stack_trace::stack_frame_collection& stack_trace::get_frames() const noexc
   return frames_;
 }
 
+size_t stack_trace::get_addresses(size_t skip_frames, std::span<void*> addresses) noexcept {
+  return native::stack_trace::get_addresses(skip_frames + 1, addresses.data(), addresses.size());
+}
+
 string stack_trace::to_string() const noexcept {
   return to_string(0);
 }
@@ -129,14 +129,15 @@ void trace::flush_() {
 }
 
 void trace::trace_event_(trace_event_type trace_event_type, const string& message) {
+  auto event_cache = trace_event_cache {};
   for (auto listener : listeners_) {
     if (listener->indent_level() != indent_level_) listener->indent_level(indent_level_);
     if (listener->indent_size() != indent_size_) listener->indent_size(indent_size_);
     if (!listener->is_thread_safe() && use_global_lock_) {
       auto lock = std::lock_guard<std::recursive_mutex> {__debug_mutex__};
-      listener->trace_event(trace_event_cache(), source_name_, trace_event_type, 0, message);
+      listener->trace_event(event_cache, source_name_, trace_event_type, 0, message);
     } else
-      listener->trace_event(trace_event_cache(), source_name_, trace_event_type, 0, message);
+      listener->trace_event(event_cache, source_name_, trace_event_type, 0, message);
   }
   if (auto_flush_) flush();
 }
@@ -6,8 +6,26 @@
 using namespace xtd;
 using namespace xtd::diagnostics;
 
+namespace {
+  constexpr size_t max_call_stack_frames = 128;
+  
+  int32 current_managed_thread_id() noexcept {
+    thread_local auto managed_thread_id = threading::thread::current_thread().managed_thread_id();
+    return managed_thread_id;
+  }
+}
+
+trace_event_cache::trace_event_cache() : timestamp_(stopwatch::get_timestamp()), managed_thread_id_(current_managed_thread_id()) {
+}
+
 string trace_event_cache::call_stack() const noexcept {
-  return stack_trace(true).to_string();
+  if (!call_stack_captured_) {
+    void* addresses[max_call_stack_frames];
+    auto count = stack_trace::get_addresses(1, addresses);
+    call_stack_ = stack_trace(std::span<void* const> {addresses, count}, string::empty_string, 0, true).to_string();
+    call_stack_captured_ = true;
+  }
+  return call_stack_;
 }
 
 const date_time& trace_event_cache::date_time() const noexcept {
@@ -20,26 +38,30 @@ std::vector<string> trace_event_cache::logical_operation_stack() const noexcept
   return std::vector<string>();
 }
 
+int32 trace_event_cache::managed_thread_id() const noexcept {
+  return managed_thread_id_;
+}
+
 int32 trace_event_cache::process_id() const noexcept {
   return -1;
 }
 
 string trace_event_cache::thread_id() const noexcept {
-  return string::format("{}", threading::thread::current_thread().managed_thread_id());
+  return std::to_string(managed_thread_id_);
 }
 
 std::chrono::nanoseconds trace_event_cache::timestamp() const noexcept {
-  return stopwatch::get_timestamp();
+  return timestamp_;
 }
 
 int64 trace_event_cache::timestamp_milliseconds() const noexcept {
-  return stopwatch::get_timestamp_milliseconds();
+  return std::chrono::duration_cast<std::chrono::milliseconds>(timestamp_).count();
 }
 
 int64 trace_event_cache::timestamp_nanoseconds() const noexcept {
-  return stopwatch::get_timestamp_nanoseconds();
+  return timestamp_.count();
 }
 
 int64 trace_event_cache::timestamp_ticks() const noexcept {
-  return stopwatch::get_timestamp_ticks();
+  return std::chrono::duration_cast<xtd::ticks>(timestamp_).count();
 }
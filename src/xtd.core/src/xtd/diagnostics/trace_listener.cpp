@@ -63,16 +63,18 @@ void trace_listener::thread_safe(bool thread_safe) noexcept {
 }
 
 void trace_listener::write_event_cache(const trace_event_cache& event_cache) {
+  if (trace_output_options_ == xtd::diagnostics::trace_options::none) return;
+  auto indent = string(indent_size_, ' ');
   if (((int32)trace_output_options_ & (int32)xtd::diagnostics::trace_options::process_id) == (int32)xtd::diagnostics::trace_options::process_id)
-    write_line(string::format("{0}ProcessId={1}", string(indent_size_, ' '), event_cache.process_id()));
+    write_line(string::format("{0}ProcessId={1}", indent, event_cache.process_id()));
   if (((int32)trace_output_options_ & (int32)xtd::diagnostics::trace_options::logical_operation_stack) == (int32)xtd::diagnostics::trace_options::logical_operation_stack)
-    write_line(string::format("{0}LogicalOperationStack={1}", string(indent_size_, ' '), string::join(", ", event_cache.logical_operation_stack())));
+    write_line(indent + "LogicalOperationStack=" + string::join(", ", event_cache.logical_operation_stack()));
   if (((int32)trace_output_options_ & (int32)xtd::diagnostics::trace_options::thread_id) == (int32)xtd::diagnostics::trace_options::thread_id)
-    write_line(string::format("{0}ThreadId={1}", string(indent_size_, ' '), event_cache.thread_id()));
+    write_line(indent + "ThreadId=" + event_cache.thread_id());
   if (((int32)trace_output_options_ & (int32)xtd::diagnostics::trace_options::date_time) == (int32)xtd::diagnostics::trace_options::date_time)
-    write_line(string::format("{0}DateTime={1:D}T{1:T}", string(indent_size_, ' '), event_cache.date_time()));
+    write_line(string::format("{0}DateTime={1:D}T{1:T}", indent, event_cache.date_time()));
   if (((int32)trace_output_options_ & (int32)xtd::diagnostics::trace_options::timestamp) == (int32)xtd::diagnostics::trace_options::timestamp)
-    write_line(string::format("{0}Timestamp={1}", string(indent_size_, ' '), event_cache.timestamp()));
+    write_line(string::format("{0}Timestamp={1}", indent, event_cache.timestamp()));
   if (((int32)trace_output_options_ & (int32)xtd::diagnostics::trace_options::callstack) == (int32)xtd::diagnostics::trace_options::callstack)
-    write_line(string::format("{0}Callstack={1}", string(indent_size_, ' '), event_cache.call_stack()));
+    write_line(indent + "Callstack=" + event_cache.call_stack());
 }
@@ -0,0 +1,110 @@
+#define __XTD_CORE_INTERNAL__
+#include "../../../include/xtd/internal/__epoch_reclaimer.h"
+#undef __XTD_CORE_INTERNAL__
+
+namespace {
+  // The epoch of a record is 0 while its thread is outside any guard, and the global epoch it saw, with the lowest bit set, while it is inside one.
+  struct epoch_record {
+    std::atomic<std::uintptr_t> epoch {0};
+    std::atomic<bool> in_use {false};
+    epoch_record* next = nullptr;
+    std::uint32_t depth = 0;
+    std::uint32_t retired_count = 0;
+  };
+  
+  // A thread scans the records and the retired nodes once every reclaim_interval retirements instead of at each one.
+  constexpr std::uint32_t reclaim_interval = 8;
+  
+  // Records are never freed : a thread that exits gives its record back for the next thread.
+  constinit std::atomic<epoch_record*> records {nullptr};
+  constinit std::atomic<std::uintptr_t> global_epoch {2};
+  constinit std::atomic<__xtd_epoch_node*> retired_nodes {nullptr};
+  
+  // The record is a plain pointer so that a guard reads it without going through the initialization of a thread_local object.
+  constinit thread_local epoch_record* current_record = nullptr;
+  
+  void try_advance_epoch() noexcept;
+  void reclaim() noexcept;
+  
+  struct thread_epoch_record_releaser {
+    ~thread_epoch_record_releaser() {
+      if (!current_record) return;
+      auto record = current_record;
+      current_record = nullptr;
+      record->epoch.store(0, std::memory_order_release);
+      record->retired_count = 0;
+      record->in_use.store(false, std::memory_order_release);
+      try_advance_epoch();
+      reclaim();
+    }
+  };
+  
+  thread_local thread_epoch_record_releaser releaser;
+  
+  epoch_record* acquire_record() noexcept {
+    static_cast<void>(&releaser);
+    for (auto record = records.load(std::memory_order_acquire); record; record = record->next) {
+      auto in_use = false;
+      if (!record->in_use.load(std::memory_order_relaxed) && record->in_use.compare_exchange_strong(in_use, true, std::memory_order_acquire))
+        return current_record = record;
+    }
+    
+    auto record = new epoch_record {};
+    record->in_use.store(true, std::memory_order_relaxed);
+    record->next = records.load(std::memory_order_relaxed);
+    while (!records.compare_exchange_weak(record->next, record, std::memory_order_release, std::memory_order_relaxed));
+    return current_record = record;
+  }
+  
+  // The global epoch moves on only when every thread inside a guard has seen the current one.
+  void try_advance_epoch() noexcept {
+    auto epoch = global_epoch.load(std::memory_order_seq_cst);
+    for (auto record = records.load(std::memory_order_acquire); record; record = record->next) {
+      auto record_epoch = record->epoch.load(std::memory_order_seq_cst);
+      if ((record_epoch & 1) && (record_epoch & ~std::uintptr_t {1}) != epoch) return;
+    }
+    global_epoch.compare_exchange_strong(epoch, epoch + 2, std::memory_order_seq_cst);
+  }
+  
+  // A node retired in epoch e may still be used by a guard that saw e, so it is destroyed once the global epoch has moved on twice.
+  void reclaim() noexcept {
+    auto node = retired_nodes.exchange(nullptr, std::memory_order_acquire);
+    auto epoch = global_epoch.load(std::memory_order_seq_cst);
+    __xtd_epoch_node* kept_first = nullptr;
+    __xtd_epoch_node* kept_last = nullptr;
+    while (node) {
+      auto next = node->next_retired;
+      if (node->retired_epoch + 4 <= epoch) delete node;
+      else {
+        node->next_retired = kept_first;
+        kept_first = node;
+        if (!kept_last) kept_last = node;
+      }
+      node = next;
+    }
+    if (!kept_first) return;
+    kept_last->next_retired = retired_nodes.load(std::memory_order_relaxed);
+    while (!retired_nodes.compare_exchange_weak(kept_last->next_retired, kept_first, std::memory_order_release, std::memory_order_relaxed));
+  }
+}
+
+__xtd_epoch_guard::__xtd_epoch_guard() noexcept {
+  auto record = current_record ? current_record : acquire_record();
+  record_ = record;
+  if (record->depth++ == 0) record->epoch.store(global_epoch.load(std::memory_order_relaxed) | 1, std::memory_order_seq_cst);
+}
+
+__xtd_epoch_guard::~__xtd_epoch_guard() {
+  auto record = static_cast<epoch_record*>(record_);
+  if (--record->depth == 0) record->epoch.store(0, std::memory_order_release);
+}
+
+void __xtd_epoch_retire(__xtd_epoch_node* node) noexcept {
+  node->retired_epoch = global_epoch.load(std::memory_order_seq_cst);
+  node->next_retired = retired_nodes.load(std::memory_order_relaxed);
+  while (!retired_nodes.compare_exchange_weak(node->next_retired, node, std::memory_order_release, std::memory_order_relaxed));
+  auto record = current_record ? current_record : acquire_record();
+  if (++record->retired_count % reclaim_interval != 0) return;
+  try_advance_epoch();
+  reclaim();
+}
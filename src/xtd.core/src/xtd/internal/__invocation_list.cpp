@@ -0,0 +1,8 @@
+#define __XTD_CORE_INTERNAL__
+#include "../../../include/xtd/internal/__invocation_list.h"
+#undef __XTD_CORE_INTERNAL__
+
+xtd::size __xtd_invocation_list_reserve_tokens(xtd::size count) noexcept {
+  static auto next_token = std::atomic<xtd::size> {1};
+  return next_token.fetch_add(count, std::memory_order_relaxed);
+}
@@ -2,13 +2,40 @@
 #include "../../../include/xtd/io/end_of_stream_exception.h"
 #include "../../../include/xtd/io/file.h"
 #include "../../../include/xtd/io/file_not_found_exception.h"
+#include "../../../include/xtd/io/io_exception.h"
 #include "../../../include/xtd/io/path.h"
 #include "../../../include/xtd/argument_exception.h"
-#include "../../../include/xtd/bit_converter.h"
 
 using namespace xtd;
 using namespace xtd::io;
 
+namespace {
+  // Exposes a memory-mapped view as the get area of a stream buffer, so that the stream reads the mapped pages directly.
+  class view_streambuf : public std::streambuf {
+  public:
+    explicit view_streambuf(const memory_mapped_view_accessor& view) : view_(view) {
+      auto begin = const_cast<char*>(view_.as_string_view().data());
+      setg(begin, begin, begin + view_.capacity());
+    }
+    
+  protected:
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override {
+      if ((which & std::ios_base::in) != std::ios_base::in) return pos_type(off_type(-1));
+      auto position = dir == std::ios_base::beg ? off : dir == std::ios_base::cur ? static_cast<off_type>(gptr() - eback()) + off : static_cast<off_type>(egptr() - eback()) + off;
+      if (position < 0 || position > static_cast<off_type>(egptr() - eback())) return pos_type(off_type(-1));
+      setg(eback(), eback() + position, egptr());
+      return pos_type(position);
+    }
+    
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which) override {
+      return seekoff(off_type(pos), std::ios_base::beg, which);
+    }
+    
+  private:
+    memory_mapped_view_accessor view_;
+  };
+}
+
 binary_reader::binary_reader(const string& path) : stream_(new std::ifstream(path, std::ios::binary)), delete_when_destroy_(true) {
   if (path.trim(' ').length() == 0 || path.index_of_any(io::path::get_invalid_path_chars()) != string::npos) throw argument_exception {csf_};
   if (!file::exists(path)) throw file_not_found_exception {csf_};
@@ -17,6 +44,10 @@ binary_reader::binary_reader(const string& path) : stream_(new std::ifstream(pat
 binary_reader::binary_reader(std::istream& stream) : stream_(&stream) {
 }
 
+binary_reader::binary_reader(const memory_mapped_view_accessor& view) : delete_when_destroy_(true), view_buffer_(xtd::new_sptr<view_streambuf>(view)) {
+  stream_ = new std::istream(view_buffer_.get());
+}
+
 binary_reader::~binary_reader() {
   if (delete_when_destroy_ && stream_) {
     if (dynamic_cast<std::ifstream*>(stream_)) static_cast<std::ifstream*>(stream_)->close();
@@ -36,6 +67,16 @@ void binary_reader::close() {
   if (stream_ && dynamic_cast<std::ifstream*>(stream_)) static_cast<std::ifstream*>(stream_)->close();
   if (delete_when_destroy_) delete stream_;
   stream_ = nullptr;
+  view_buffer_.reset();
+}
+
+template<typename type_t>
+type_t binary_reader::read_value() {
+  // Read straight into the storage of the value. Bytes are in native order, as xtd::bit_converter::get_bytes produces them.
+  auto value = type_t {};
+  if (read(std::span<xtd::byte> {reinterpret_cast<xtd::byte*>(&value), sizeof(type_t)}) != sizeof(type_t))
+    throw end_of_stream_exception {csf_};
+  return value;
 }
 
 int32 binary_reader::peek_char() const {
@@ -64,30 +105,30 @@ int32 binary_reader::read() {
 
 size_t binary_reader::read(std::vector<xtd::byte>& buffer, size_t index, size_t count) {
   if (index + count > buffer.size()) throw argument_exception {csf_};
-  for (auto i = 0_z; i < count; i++) {
-    auto current = read();
-    if (current == EOF) return i;
-    buffer[index + i] = static_cast<xtd::byte>(current);
-  }
-  return count;
+  return read(std::span<xtd::byte> {buffer.data() + index, count});
 }
 
 size_t binary_reader::read(std::vector<char>& buffer, size_t index, size_t count) {
   if (index + count > buffer.size()) throw argument_exception {csf_};
-  for (auto i = 0_z; i < count; i++) {
-    auto current = read();
-    if (current == EOF) return i;
-    buffer[index + i] = static_cast<char>(current);
-  }
-  return count;
+  return read(std::span<char> {buffer.data() + index, count});
+}
+
+size_t binary_reader::read(std::span<xtd::byte> buffer) {
+  return read(std::span<char> {reinterpret_cast<char*>(buffer.data()), buffer.size()});
+}
+
+size_t binary_reader::read(std::span<char> buffer) {
+  if (!stream_ || buffer.empty()) return 0;
+  stream_->read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+  return static_cast<size_t>(stream_->gcount());
 }
 
 bool binary_reader::read_boolean() {
-  return bit_converter::to_boolean(read_bytes(sizeof(bool)), 0);
+  return read_value<xtd::byte>() != 0;
 }
 
 xtd::byte binary_reader::read_byte() {
-  return read_bytes(sizeof(xtd::byte))[0];
+  return read_value<xtd::byte>();
 }
 
 std::vector<xtd::byte> binary_reader::read_bytes(size_t count) {
@@ -98,7 +139,7 @@ std::vector<xtd::byte> binary_reader::read_bytes(size_t count) {
 }
 
 char binary_reader::read_char() {
-  return read_bytes(sizeof(char))[0];
+  return read_value<char>();
 }
 
 std::vector<char> binary_reader::read_chars(size_t count) {
@@ -109,44 +150,48 @@ std::vector<char> binary_reader::read_chars(size_t count) {
 }
 
 double binary_reader::read_double() {
-  return bit_converter::to_double(read_bytes(sizeof(double)), 0);
+  return read_value<double>();
 }
 
 int16 binary_reader::read_int16() {
-  return bit_converter::to_int16(read_bytes(sizeof(int16)), 0);
+  return read_value<int16>();
 }
 
 int32 binary_reader::read_int32() {
-  return bit_converter::to_int32(read_bytes(sizeof(int32)), 0);
+  return read_value<int32>();
 }
 
 int64 binary_reader::read_int64() {
-  return bit_converter::to_int16(read_bytes(sizeof(int64)), 0);
+  return read_value<int64>();
 }
 
 sbyte binary_reader::read_sbyte() {
-  return read_bytes(sizeof(sbyte))[0];
+  return read_value<sbyte>();
 }
 
 float binary_reader::read_single() {
-  return bit_converter::to_single(read_bytes(sizeof(float)), 0);
+  return read_value<float>();
 }
 
 string binary_reader::read_string() {
   auto length = read_int32();
-  return string(read_chars(length).data(), static_cast<size_t>(length));
+  if (length < 0) throw io_exception {csf_};
+  auto result = std::string(static_cast<size_t>(length), '\0');
+  if (read(std::span<char> {result.data(), result.size()}) != result.size())
+    throw end_of_stream_exception {csf_};
+  return string(std::move(result));
 }
 
 uint16 binary_reader::read_uint16() {
-  return bit_converter::to_int16(read_bytes(sizeof(int16)), 0);
+  return read_value<uint16>();
 }
 
 uint32 binary_reader::read_uint32() {
-  return bit_converter::to_int32(read_bytes(sizeof(int32)), 0);
+  return read_value<uint32>();
 }
 
 uint64 binary_reader::read_uint64() {
-  return bit_converter::to_int16(read_bytes(sizeof(int64)), 0);
+  return read_value<uint64>();
 }
 
 void binary_reader::rewind() {
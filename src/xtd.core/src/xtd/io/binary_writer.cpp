@@ -1,5 +1,4 @@
 #include "../../../include/xtd/argument_exception.h"
-#include "../../../include/xtd/bit_converter.h"
 #include "../../../include/xtd/unauthorized_access_exception.h"
 #include "../../../include/xtd/io/io_exception.h"
 #include "../../../include/xtd/io/file_not_found_exception.h"
@@ -31,6 +30,12 @@ binary_writer::~binary_writer() {
   }
 }
 
+template<typename type_t>
+void binary_writer::write_value(type_t value) {
+  // The value is written in place, in the byte order of xtd::bit_converter (the native one), without an intermediate std::vector.
+  write(std::span<const xtd::byte> {reinterpret_cast<const xtd::byte*>(&value), sizeof(type_t)});
+}
+
 std::optional<std::reference_wrapper<std::ostream>> binary_writer::base_stream() const {
   return stream_ ? std::optional<std::reference_wrapper<std::ostream>>(*stream_) : std::optional<std::reference_wrapper<std::ostream>>();
 }
@@ -53,7 +58,7 @@ size_t binary_writer::seek(size_t offset, std::ios::seekdir origin) {
 }
 
 void binary_writer::write(bool value) {
-  write(bit_converter::get_bytes(value));
+  write_value(static_cast<xtd::byte>(value ? 1 : 0));
 }
 
 void binary_writer::write(xtd::byte value) {
@@ -73,8 +78,7 @@ void binary_writer::write(const std::vector<xtd::byte>& buffer) {
 void binary_writer::write(const std::vector<xtd::byte>& buffer, size_t index, size_t count) {
   if (!stream_) throw io_exception {csf_};
   if (index + count > buffer.size()) throw argument_exception {csf_};
-  for (auto i = index; i < (index + count); ++i)
-    write(buffer[i]);
+  write(std::span<const xtd::byte> {buffer.data() + index, count});
 }
 
 void binary_writer::write(const std::vector<char>& buffer) {
@@ -84,24 +88,32 @@ void binary_writer::write(const std::vector<char>& buffer) {
 void binary_writer::write(const std::vector<char>& buffer, size_t index, size_t count) {
   if (!stream_) throw io_exception {csf_};
   if (index + count > buffer.size()) throw argument_exception {csf_};
-  for (auto i = index; i < (index + count); ++i)
-    write(buffer[i]);
+  write(std::span<const char> {buffer.data() + index, count});
+}
+
+void binary_writer::write(std::span<const xtd::byte> buffer) {
+  write(std::span<const char> {reinterpret_cast<const char*>(buffer.data()), buffer.size()});
+}
+
+void binary_writer::write(std::span<const char> buffer) {
+  if (!stream_) throw io_exception {csf_};
+  if (!buffer.empty()) stream_->write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
 }
 
 void binary_writer::write(double value) {
-  write(bit_converter::get_bytes(value));
+  write_value(value);
 }
 
 void binary_writer::write(int16 value) {
-  write(bit_converter::get_bytes(value));
+  write_value(value);
 }
 
 void binary_writer::write(int32 value) {
-  write(bit_converter::get_bytes(value));
+  write_value(value);
 }
 
 void binary_writer::write(int64 value) {
-  write(bit_converter::get_bytes(value));
+  write_value(value);
 }
 
 void binary_writer::write(sbyte value) {
@@ -110,13 +122,12 @@ void binary_writer::write(sbyte value) {
 }
 
 void binary_writer::write(float value) {
-  write(bit_converter::get_bytes(value));
+  write_value(value);
 }
 
 void binary_writer::write(const string& value) {
   write(static_cast<int32>(value.size()));
-  for (auto c : value)
-    write(c);
+  write(std::span<const char> {value.data(), value.size()});
 }
 
 void binary_writer::write(const std::string& value) {
@@ -164,13 +175,13 @@ void binary_writer::write(const wchar* value) {
 }
 
 void binary_writer::write(uint16 value) {
-  write(bit_converter::get_bytes(value));
+  write_value(value);
 }
 
 void binary_writer::write(uint32 value) {
-  write(bit_converter::get_bytes(value));
+  write_value(value);
 }
 
 void binary_writer::write(uint64 value) {
-  write(bit_converter::get_bytes(value));
+  write_value(value);
 }
@@ -4,6 +4,7 @@
 #include "../../../include/xtd/io/directory.h"
 #include "../../../include/xtd/io/file.h"
 #include "../../../include/xtd/io/file_not_found_exception.h"
+#include "../../../include/xtd/io/memory_mapped_file.h"
 #include "../../../include/xtd/io/path.h"
 #include "../../../include/xtd/io/path_too_long_exception.h"
 #define __XTD_CORE_NATIVE_LIBRARY__
@@ -127,6 +128,16 @@ file_permissions file::get_permissions(const string& path) {
   return static_cast<file_permissions>(permission);
 }
 
+memory_mapped_view_accessor file::map_all_bytes(const string& path) {
+  if (path.index_of_any(xtd::io::path::get_invalid_path_chars()) != string::npos) throw argument_exception {csf_};
+  if (path.empty() || path.trim(' ').empty()) throw argument_exception {csf_};
+  if (native::file_system::is_path_too_long(path)) throw path_too_long_exception {csf_};
+  if (!exists(path)) throw file_not_found_exception {csf_};
+  
+  if (native::file::get_size(path) == 0) return memory_mapped_view_accessor {};
+  return memory_mapped_file::create_from_file(path).create_view_accessor();
+}
+
 void file::move(const string& src, const string& dest) {
   move(src, dest, false);
 }
@@ -202,7 +213,12 @@ std::vector<xtd::byte> file::read_all_bytes(const string& path) {
   
   auto stream = std::ifstream {path, std::ios::binary};
   if (!stream.good()) throw io_exception {csf_};
-  return std::vector<xtd::byte> {std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>()};
+  // Read the whole file with one call when its size is known; files that report a wrong size (e.g. /proc files) are completed byte by byte.
+  auto bytes = std::vector<xtd::byte>(native::file::get_size(path));
+  stream.read(reinterpret_cast<char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+  bytes.resize(static_cast<size_t>(stream.gcount()));
+  if (!stream.eof()) bytes.insert(bytes.end(), std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+  return bytes;
 }
 
 std::vector<string> file::read_all_lines(const string& path) {
@@ -0,0 +1,93 @@
+#include "../../../include/xtd/io/memory_mapped_file.h"
+#include "../../../include/xtd/io/file.h"
+#include "../../../include/xtd/io/file_not_found_exception.h"
+#include "../../../include/xtd/io/io_exception.h"
+#include "../../../include/xtd/io/path.h"
+#include "../../../include/xtd/argument_exception.h"
+#include "../../../include/xtd/argument_out_of_range_exception.h"
+#include "../../../include/xtd/unauthorized_access_exception.h"
+#define __XTD_CORE_NATIVE_LIBRARY__
+#include <xtd/native/memory_mapped_file>
+#undef __XTD_CORE_NATIVE_LIBRARY__
+
+using namespace xtd;
+using namespace xtd::io;
+
+struct memory_mapped_file::data {
+  data() = default;
+  data(const data&) = delete;
+  data& operator =(const data&) = delete;
+  ~data() {
+    native::memory_mapped_file::close(handle);
+  }
+  
+  intmax_t handle = -1;
+  size_t capacity = 0;
+  file_access access = file_access::read;
+};
+
+memory_mapped_file::memory_mapped_file() : data_(xtd::new_sptr<data>()) {
+}
+
+memory_mapped_file::~memory_mapped_file() {
+}
+
+file_access memory_mapped_file::access() const noexcept {
+  return data_->access;
+}
+
+size_t memory_mapped_file::capacity() const noexcept {
+  return data_->capacity;
+}
+
+memory_mapped_view_accessor memory_mapped_file::create_view_accessor() const {
+  return create_view_accessor(0, 0, data_->access);
+}
+
+memory_mapped_view_accessor memory_mapped_file::create_view_accessor(size_t offset, size_t size) const {
+  return create_view_accessor(offset, size, data_->access);
+}
+
+memory_mapped_view_accessor memory_mapped_file::create_view_accessor(size_t offset, size_t size, file_access access) const {
+  if (access != file_access::read && access != file_access::read_write) throw argument_exception {csf_};
+  if (access == file_access::read_write && data_->access != file_access::read_write) throw unauthorized_access_exception {csf_};
+  if (offset > data_->capacity) throw argument_out_of_range_exception {csf_};
+  if (size == 0) size = data_->capacity - offset;
+  if (size > data_->capacity - offset) throw argument_out_of_range_exception {csf_};
+  if (size == 0) return memory_mapped_view_accessor {nullptr, 0, 0, 0, access};
+  
+  // The operating system only maps views that start on an allocation boundary, so the view starts at the previous boundary and data() skips the extra bytes.
+  auto pointer_offset = offset % native::memory_mapped_file::allocation_granularity();
+  auto address = native::memory_mapped_file::map(data_->handle, offset - pointer_offset, size + pointer_offset, access == file_access::read_write);
+  if (!address) throw io_exception {csf_};
+  return memory_mapped_view_accessor {address, size + pointer_offset, pointer_offset, size, access};
+}
+
+memory_mapped_file memory_mapped_file::create_from_file(const string& path) {
+  return create_from_file(path, file_access::read, 0);
+}
+
+memory_mapped_file memory_mapped_file::create_from_file(const string& path, file_access access) {
+  return create_from_file(path, access, 0);
+}
+
+memory_mapped_file memory_mapped_file::create_from_file(const string& path, file_access access, size_t capacity) {
+  if (path.index_of_any(xtd::io::path::get_invalid_path_chars()) != string::npos) throw argument_exception {csf_};
+  if (path.empty() || path.trim(' ').empty()) throw argument_exception {csf_};
+  if (access != file_access::read && access != file_access::read_write) throw argument_exception {csf_};
+  if (!file::exists(path)) throw file_not_found_exception {csf_};
+  
+  auto result = memory_mapped_file {};
+  result.data_->handle = native::memory_mapped_file::open(path, access == file_access::read_write);
+  if (result.data_->handle == -1) throw io_exception {csf_};
+  result.data_->access = access;
+  
+  auto size = native::memory_mapped_file::size(result.data_->handle);
+  if (capacity == 0) capacity = size;
+  if (capacity == 0) throw argument_exception {csf_};
+  if (capacity < size) throw argument_out_of_range_exception {csf_};
+  if (capacity > size && access == file_access::read) throw argument_exception {csf_};
+  if (capacity > size && !native::memory_mapped_file::set_size(result.data_->handle, capacity)) throw io_exception {csf_};
+  result.data_->capacity = capacity;
+  return result;
+}
@@ -0,0 +1,78 @@
+#include "../../../include/xtd/io/memory_mapped_view_accessor.h"
+#include "../../../include/xtd/io/io_exception.h"
+#define __XTD_CORE_NATIVE_LIBRARY__
+#include <xtd/native/memory_mapped_file>
+#undef __XTD_CORE_NATIVE_LIBRARY__
+
+using namespace xtd;
+using namespace xtd::io;
+
+struct memory_mapped_view_accessor::view_data {
+  view_data() = default;
+  view_data(void* address, size_t mapped_size, size_t pointer_offset, size_t capacity, file_access access) : address {address}, mapped_size {mapped_size}, pointer_offset {pointer_offset}, capacity {capacity}, access {access} {}
+  view_data(const view_data&) = delete;
+  view_data& operator =(const view_data&) = delete;
+  ~view_data() {
+    if (address) native::memory_mapped_file::unmap(address, mapped_size);
+  }
+  
+  xtd::byte* begin() const noexcept {return address ? static_cast<xtd::byte*>(address) + pointer_offset : nullptr;}
+  
+  void* address = nullptr;
+  size_t mapped_size = 0;
+  size_t pointer_offset = 0;
+  size_t capacity = 0;
+  file_access access = file_access::read;
+};
+
+memory_mapped_view_accessor::memory_mapped_view_accessor() : data_(xtd::new_sptr<view_data>()) {
+}
+
+memory_mapped_view_accessor::memory_mapped_view_accessor(void* address, size_t mapped_size, size_t pointer_offset, size_t capacity, file_access access) : data_(xtd::new_sptr<view_data>(address, mapped_size, pointer_offset, capacity, access)) {
+}
+
+memory_mapped_view_accessor::~memory_mapped_view_accessor() {
+}
+
+bool memory_mapped_view_accessor::can_read() const noexcept {
+  return (data_->access & file_access::read) == file_access::read;
+}
+
+bool memory_mapped_view_accessor::can_write() const noexcept {
+  return (data_->access & file_access::write) == file_access::write;
+}
+
+size_t memory_mapped_view_accessor::capacity() const noexcept {
+  return data_->capacity;
+}
+
+const xtd::byte* memory_mapped_view_accessor::data() const noexcept {
+  return data_->begin();
+}
+
+xtd::byte* memory_mapped_view_accessor::data() {
+  if (!can_write()) throw not_supported_exception {csf_};
+  return data_->begin();
+}
+
+void memory_mapped_view_accessor::advise(memory_mapped_file_advice advice) {
+  if (!data_->address) return;
+  native::memory_mapped_file::advise(data_->address, data_->mapped_size, static_cast<int32>(advice));
+}
+
+std::span<const xtd::byte> memory_mapped_view_accessor::as_span() const noexcept {
+  return {data_->begin(), data_->capacity};
+}
+
+std::span<xtd::byte> memory_mapped_view_accessor::as_writable_span() {
+  return {data(), data_->capacity};
+}
+
+std::string_view memory_mapped_view_accessor::as_string_view() const noexcept {
+  return {reinterpret_cast<const char*>(data_->begin()), data_->capacity};
+}
+
+void memory_mapped_view_accessor::flush() {
+  if (!data_->address || !can_write()) return;
+  if (!native::memory_mapped_file::flush(data_->address, data_->mapped_size)) throw io_exception {csf_};
+}
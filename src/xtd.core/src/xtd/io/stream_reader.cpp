@@ -3,13 +3,19 @@
 #include "../../../include/xtd/io/file.h"
 #include "../../../include/xtd/io/path.h"
 #include "../../../include/xtd/io/stream_reader.h"
+#include <algorithm>
 
 using namespace xtd;
 using namespace xtd::io;
 
-stream_reader::stream_reader(const string& path) : stream_(new std::ifstream(path)), delete_when_destroy_(true) {
+stream_reader::stream_reader(const string& path) : buffer_(default_buffer_size), delete_when_destroy_(true) {
   if (path.trim(' ').length() == 0 || path.index_of_any(io::path::get_invalid_path_chars()) != string::npos) throw argument_exception {csf_};
   if (!file::exists(path)) throw file_not_found_exception {csf_};
+  auto file_stream = new std::ifstream {};
+  // The buffer must be set before the file is opened.
+  file_stream->rdbuf()->pubsetbuf(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+  file_stream->open(path);
+  stream_ = file_stream;
 }
 
 stream_reader::stream_reader(std::istream& stream) : stream_(&stream) {
@@ -47,3 +53,49 @@ int32 stream_reader::read() {
   int32 value = stream_->get();
   return value;
 }
+
+size_t stream_reader::read(std::span<char> buffer) {
+  if (!stream_ || !stream_->rdbuf() || buffer.empty()) return 0;
+  auto stream_buffer = stream_->rdbuf();
+  auto current = stream_buffer->sbumpc();
+  if (current == EOF) {
+    stream_->setstate(std::ios_base::eofbit);
+    return 0;
+  }
+  buffer[0] = static_cast<char>(current);
+  auto count = 1_z;
+  auto available = stream_buffer->in_avail();
+  if (available > 0) count += static_cast<size_t>(stream_buffer->sgetn(buffer.data() + 1, std::min(static_cast<std::streamsize>(buffer.size() - 1), available)));
+  return count;
+}
+
+string stream_reader::read_line() {
+  auto line = string::empty_string;
+  if (!stream_) return line;
+  auto& chars = static_cast<std::string&>(line);
+  // std::getline searches the newline in the stream buffer block by block and stops right after it.
+  std::getline(*stream_, chars);
+  if (chars.find('\r') != std::string::npos) std::erase(chars, '\r');
+  return line;
+}
+
+string stream_reader::read_to_end() {
+  auto text = string::empty_string;
+  if (!stream_ || !stream_->rdbuf()) return text;
+  auto& chars = static_cast<std::string&>(text);
+  auto stream_buffer = stream_->rdbuf();
+  // For a file, in_avail returns the number of characters left in the file.
+  auto size_hint = stream_buffer->in_avail();
+  auto block_size = size_hint > 0 ? static_cast<size_t>(size_hint) + 1 : default_buffer_size;
+  for (;;) {
+    auto size = chars.size();
+    chars.resize(size + block_size);
+    auto count = static_cast<size_t>(stream_buffer->sgetn(chars.data() + size, static_cast<std::streamsize>(block_size)));
+    chars.resize(size + count);
+    if (count < block_size) break;
+    block_size = default_buffer_size;
+  }
+  stream_->setstate(std::ios_base::eofbit);
+  if (chars.find('\r') != std::string::npos) std::erase(chars, '\r');
+  return text;
+}
@@ -1,5 +1,7 @@
 #include "../../../include/xtd/io/text_reader.h"
 #include "../../../include/xtd/argument_out_of_range_exception.h"
+#include <algorithm>
+#include <iterator>
 #include <mutex>
 
 using namespace xtd;
@@ -25,12 +27,16 @@ int32 text_reader::read() {
 
 size_t text_reader::read(std::vector<char>& buffer, size_t index, size_t count) {
   if (index + count > buffer.size()) throw argument_exception {csf_};
-  for (auto i = 0_z; i < count; i++) {
+  return read(std::span<char> {buffer.data() + index, count});
+}
+
+size_t text_reader::read(std::span<char> buffer) {
+  for (auto i = 0_z; i < buffer.size(); i++) {
     auto current = read();
     if (current == EOF) return i;
-    buffer[index + i] = static_cast<char>(current);
+    buffer[i] = static_cast<char>(current);
   }
-  return count;
+  return buffer.size();
 }
 
 size_t text_reader::read_block(std::vector<char>& buffer, size_t index, size_t count) {
@@ -48,10 +54,10 @@ string text_reader::read_line() {
 
 string text_reader::read_to_end() {
   auto text = string::empty_string;
-  for (int32 current = read(); current != EOF; current = read()) {
-    if (current == '\r') continue;
-    text += static_cast<char>(current);
-  }
+  auto& chars = static_cast<std::string&>(text);
+  char buffer[4096];
+  for (auto count = read(std::span<char> {buffer}); count != 0; count = read(std::span<char> {buffer}))
+    std::copy_if(buffer, buffer + count, std::back_inserter(chars), [](char c) {return c != '\r';});
   return text;
 }
 
@@ -0,0 +1,66 @@
+#include "../../../include/xtd/linq/parallel_enumerable.h"
+#include "../../../include/xtd/threading/countdown_event.h"
+#include "../../../include/xtd/threading/thread_pool.h"
+#include "../../../include/xtd/environment.h"
+#include "../../../include/xtd/new_sptr.h"
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+
+using namespace xtd;
+using namespace xtd::linq;
+using namespace xtd::threading;
+
+namespace {
+  struct partitions {
+    explicit partitions(size count) : count(count), completed(static_cast<int32>(count)) {}
+    
+    // Each thread claims the next partition until all partitions are claimed, so the thread pool work items that start late find nothing to do and never touch the action.
+    void run(const action<size>* partition_action) {
+      for (auto index = next.fetch_add(1); index < count; index = next.fetch_add(1)) {
+        if (!faulted.load(std::memory_order_relaxed)) {
+          try {
+            (*partition_action)(index);
+          } catch (...) {
+            auto lock = std::lock_guard<std::mutex> {sync_root};
+            if (!error) error = std::current_exception();
+            faulted.store(true, std::memory_order_relaxed);
+          }
+        }
+        completed.signal();
+      }
+    }
+    
+    size count = 0;
+    std::atomic<size> next = 0;
+    std::atomic<bool> faulted = false;
+    countdown_event completed;
+    std::mutex sync_root;
+    std::exception_ptr error;
+  };
+}
+
+size parallel_enumerable::default_degree_of_parallelism() noexcept {
+  return std::max(size {1}, static_cast<size>(environment::processor_count()));
+}
+
+size parallel_enumerable::partition_count(size count, size degree_of_parallelism) noexcept {
+  return std::max(size {1}, std::min(degree_of_parallelism, count / min_partition_size));
+}
+
+void parallel_enumerable::invoke(size partition_count, const action<size>& partition_action) {
+  if (partition_count == 0) return;
+  if (partition_count == 1) {
+    partition_action(0);
+    return;
+  }
+  
+  auto state = new_sptr<partitions>(partition_count);
+  auto action_pointer = &partition_action;
+  for (auto worker = size {1}; worker < partition_count; ++worker)
+    thread_pool::queue_user_work_item([state, action_pointer](std::any) {state->run(action_pointer);});
+  state->run(action_pointer);
+  state->completed.wait();
+  if (state->error) std::rethrow_exception(state->error);
+}
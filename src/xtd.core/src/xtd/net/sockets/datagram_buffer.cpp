@@ -0,0 +1,57 @@
+#include "../../../../include/xtd/net/sockets/datagram_buffer.h"
+#include "../../../../include/xtd/argument_out_of_range_exception.h"
+
+using namespace xtd;
+using namespace xtd::net;
+using namespace xtd::net::sockets;
+
+datagram_buffer::datagram_buffer() : datagram_buffer(default_capacity) {
+}
+
+datagram_buffer::datagram_buffer(size_t capacity) : buffer_(capacity) {
+}
+
+std::span<xtd::byte> datagram_buffer::buffer() noexcept {
+  return buffer_;
+}
+
+size_t datagram_buffer::capacity() const noexcept {
+  return buffer_.size();
+}
+
+std::span<const xtd::byte> datagram_buffer::data() const noexcept {
+  return std::span<const xtd::byte> {buffer_.data(), size_};
+}
+
+const ip_end_point& datagram_buffer::remote_end_point() const noexcept {
+  return remote_end_point_;
+}
+
+datagram_buffer& datagram_buffer::remote_end_point(const ip_end_point& value) {
+  auto socket_address = value.serialize();
+  socket_address_.resize(socket_address.size());
+  for (auto index = size_t {0}; index < socket_address.size(); ++index)
+    socket_address_[index] = socket_address[index];
+  remote_end_point_ = value;
+  return *this;
+}
+
+size_t datagram_buffer::segment_size() const noexcept {
+  return segment_size_;
+}
+
+size_t datagram_buffer::size() const noexcept {
+  return size_;
+}
+
+datagram_buffer& datagram_buffer::size(size_t value) {
+  if (value > buffer_.size()) throw argument_out_of_range_exception {csf_};
+  size_ = value;
+  segment_size_ = value;
+  truncated_ = false;
+  return *this;
+}
+
+bool datagram_buffer::truncated() const noexcept {
+  return truncated_;
+}
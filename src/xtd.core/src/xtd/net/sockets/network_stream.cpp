@@ -1,46 +1,152 @@
 #include "../../../../include/xtd/net/sockets/network_stream.h"
+#include "../../../../include/xtd/io/io_exception.h"
+#include <algorithm>
+#include <cstring>
+#include <limits>
 
 using namespace xtd;
 using namespace xtd::net;
 using namespace xtd::net::sockets;
 
-network_stream::socket_streambuf::socket_streambuf(const xtd::net::sockets::socket& socket, bool owns_socket) : socket_(socket), owns_socket_(owns_socket) {
+network_stream::socket_streambuf::socket_streambuf(const xtd::net::sockets::socket& socket, bool owns_socket, size_t receive_buffer_size, size_t send_buffer_size) : socket_(socket), owns_socket_(owns_socket), receive_buffer_(std::max(receive_buffer_size, size_t {1})), send_buffer_(send_buffer_size) {
+  auto receive_begin = reinterpret_cast<char*>(receive_buffer_.data());
+  setg(receive_begin, receive_begin, receive_begin);
+  auto send_begin = reinterpret_cast<char*>(send_buffer_.data());
+  setp(send_begin, send_begin + send_buffer_.size());
 }
 
 network_stream::socket_streambuf::~socket_streambuf() {
+  if (pptr() != pbase() && socket_.handle() != 0) sync();
   if (owns_socket_) socket_.close();
 }
 
 int32 network_stream::socket_streambuf::underflow() {
-  auto buffer = std::vector<xtd::byte>(1);
-  if (socket_.receive(buffer) == 1) {
-    value_ = static_cast<char>(buffer[0]);
-    setg(&value_, &value_, &value_ + 1);
-    return value_;
-  }
-  return std::streambuf::underflow(); // EOF
+  if (gptr() < egptr()) return traits_type::to_int_type(*gptr());
+  auto error = socket_error::success;
+  auto count = socket_.receive(receive_buffer_, 0, receive_buffer_.size(), socket_flags::none, error);
+  if (count == 0 || count > receive_buffer_.size()) return traits_type::eof();
+  auto begin = reinterpret_cast<char*>(receive_buffer_.data());
+  setg(begin, begin, begin + count);
+  return traits_type::to_int_type(*gptr());
 }
 
 int32 network_stream::socket_streambuf::overflow(int32 value) {
-  value_ = static_cast<char>(value);
-  auto buffer = std::vector {static_cast<xtd::byte>(value_)};
-  if (socket_.send(buffer) == 1) {
-    setp(&value_, &value_);
-    return 0;
+  if (send_buffer_.empty()) {
+    if (traits_type::eq_int_type(value, traits_type::eof())) return traits_type::not_eof(value);
+    auto buffer = std::vector {static_cast<xtd::byte>(value)};
+    return send_all(buffer, 1) ? value : traits_type::eof();
+  }
+  if (sync() == -1) return traits_type::eof();
+  if (traits_type::eq_int_type(value, traits_type::eof())) return traits_type::not_eof(value);
+  *pptr() = traits_type::to_char_type(value);
+  pbump(1);
+  return value;
+}
+
+std::streamsize network_stream::socket_streambuf::showmanyc() {
+  return static_cast<std::streamsize>(socket_.available());
+}
+
+int32 network_stream::socket_streambuf::sync() {
+  auto size = static_cast<size_t>(pptr() - pbase());
+  if (size == 0) return 0;
+  auto succeeded = send_all(send_buffer_, size);
+  setp(pbase(), epptr());
+  return succeeded ? 0 : -1;
+}
+
+std::streamsize network_stream::socket_streambuf::xsgetn(char* s, std::streamsize count) {
+  auto result = std::streamsize {0};
+  while (result < count) {
+    if (gptr() == egptr() && traits_type::eq_int_type(underflow(), traits_type::eof())) break;
+    auto size = std::min(count - result, static_cast<std::streamsize>(egptr() - gptr()));
+    std::memcpy(s + result, gptr(), static_cast<size_t>(size));
+    advance_get_area(static_cast<size_t>(size));
+    result += size;
   }
-  return std::streambuf::overflow(value); // EOF
+  return result;
 }
 
-network_stream::network_stream(const xtd::net::sockets::socket& socket) : std::iostream(&stream_buf_), stream_buf_(socket, false) {
+std::streamsize network_stream::socket_streambuf::xsputn(const char* s, std::streamsize count) {
+  // Data at least as large as the send buffer is sent directly, after the data already buffered.
+  if (count >= static_cast<std::streamsize>(send_buffer_.size())) return sync() == 0 && send_all(std::span<const xtd::byte> {reinterpret_cast<const xtd::byte*>(s), static_cast<size_t>(count)}) ? count : 0;
+  auto result = std::streamsize {0};
+  while (result < count) {
+    if (pptr() == epptr() && sync() == -1) break;
+    auto size = std::min(count - result, static_cast<std::streamsize>(epptr() - pptr()));
+    std::memcpy(pptr(), s + result, static_cast<size_t>(size));
+    advance_put_area(static_cast<size_t>(size));
+    result += size;
+  }
+  return result;
+}
+
+// gbump and pbump take an int : a buffer larger than 2 GiB is advanced in several steps.
+void network_stream::socket_streambuf::advance_get_area(size_t size) {
+  for (auto step = size_t {0}; size != 0; size -= step) {
+    step = std::min(size, static_cast<size_t>(std::numeric_limits<int32>::max()));
+    gbump(static_cast<int32>(step));
+  }
 }
 
-network_stream::network_stream(const xtd::net::sockets::socket& socket, bool owns_socket) : std::iostream(&stream_buf_), stream_buf_(socket, owns_socket) {
+void network_stream::socket_streambuf::advance_put_area(size_t size) {
+  for (auto step = size_t {0}; size != 0; size -= step) {
+    step = std::min(size, static_cast<size_t>(std::numeric_limits<int32>::max()));
+    pbump(static_cast<int32>(step));
+  }
+}
+
+size_t network_stream::socket_streambuf::read_some(std::span<xtd::byte> buffer) {
+  if (buffer.empty() || (gptr() == egptr() && traits_type::eq_int_type(underflow(), traits_type::eof()))) return 0;
+  auto size = std::min(buffer.size(), static_cast<size_t>(egptr() - gptr()));
+  std::memcpy(buffer.data(), gptr(), size);
+  advance_get_area(size);
+  return size;
+}
+
+bool network_stream::socket_streambuf::send_all(const std::vector<xtd::byte>& buffer, size_t size) {
+  auto error = socket_error::success;
+  for (auto offset = size_t {0}; offset < size;) {
+    auto count = socket_.send(buffer, offset, size - offset, socket_flags::none, error);
+    if (count == 0 || count > size - offset) return false;
+    offset += count;
+  }
+  return true;
+}
+
+bool network_stream::socket_streambuf::send_all(std::span<const xtd::byte> buffer) {
+  auto error = socket_error::success;
+  auto buffers = std::vector<std::span<const xtd::byte>> {buffer};
+  while (!buffers.front().empty()) {
+    auto count = socket_.send(buffers, socket_flags::none, error);
+    if (count == 0 || count > buffers.front().size()) return false;
+    buffers.front() = buffers.front().subspan(count);
+  }
+  return true;
+}
+
+network_stream::network_stream(const xtd::net::sockets::socket& socket) : network_stream(socket, false) {
+}
+
+network_stream::network_stream(const xtd::net::sockets::socket& socket, bool owns_socket) : network_stream(socket, owns_socket, default_buffer_size, default_buffer_size) {
+}
+
+network_stream::network_stream(const xtd::net::sockets::socket& socket, bool owns_socket, size_t receive_buffer_size, size_t send_buffer_size) : std::iostream(&stream_buf_), stream_buf_(socket, owns_socket, receive_buffer_size, send_buffer_size) {
+  setf(std::ios_base::unitbuf);
 }
 
 bool network_stream::data_available() const {
-  return stream_buf_.socket_.available() != 0;
+  return stream_buf_.has_received_data() || stream_buf_.socket_.available() != 0;
 }
 
 xtd::net::sockets::socket network_stream::socket() const {
   return stream_buf_.socket_;
 }
+
+size_t network_stream::read(std::span<xtd::byte> buffer) {
+  return stream_buf_.read_some(buffer);
+}
+
+void network_stream::write(std::span<const xtd::byte> buffer) {
+  if (stream_buf_.sputn(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size())) != static_cast<std::streamsize>(buffer.size()) || stream_buf_.pubsync() == -1) throw xtd::io::io_exception {csf_};
+}
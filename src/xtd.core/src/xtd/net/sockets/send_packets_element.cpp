@@ -15,7 +15,7 @@ send_packets_element::send_packets_element(const std::vector<xtd::byte>& buffer,
 send_packets_element::send_packets_element(const xtd::string& file_path, size_t offset, size_t count) : count_(count), file_path_(file_path), offset_(offset) {
 }
 
-send_packets_element::send_packets_element(std::ifstream& file_stream, size_t offset, size_t count, bool end_of_packet) : count_(count), end_of_packet_(end_of_packet), file_stream_(&file_stream), offset_(offset), delete_file_stream_when_destroy_(true) {
+send_packets_element::send_packets_element(std::ifstream& file_stream, size_t offset, size_t count, bool end_of_packet) : count_(count), end_of_packet_(end_of_packet), file_stream_(&file_stream), offset_(offset) {
 }
 
 send_packets_element::send_packets_element(const std::vector<xtd::byte>& buffer, size_t offset, size_t count) : buffer_(buffer), count_(count), offset_(offset) {
@@ -24,14 +24,13 @@ send_packets_element::send_packets_element(const std::vector<xtd::byte>& buffer,
 send_packets_element::send_packets_element(const xtd::string& file_path) : file_path_(file_path) {
 }
 
-send_packets_element::send_packets_element(std::ifstream& file_stream) : file_stream_(&file_stream), delete_file_stream_when_destroy_(true) {
+send_packets_element::send_packets_element(std::ifstream& file_stream) : file_stream_(&file_stream) {
 }
 
 send_packets_element::~send_packets_element() {
-  if (delete_file_stream_when_destroy_) delete file_stream_;
 }
 
-std::vector<xtd::byte> send_packets_element::buffer() const noexcept {
+const std::vector<xtd::byte>& send_packets_element::buffer() const noexcept {
   return buffer_;
 }
 
@@ -3,20 +3,26 @@
 #include "../../../../include/xtd/invalid_operation_exception.h"
 #include "../../../../include/xtd/as.h"
 #include "../../../../include/xtd/is.h"
+#include "../../../../include/xtd/not_supported_exception.h"
 #include "../../../../include/xtd/object_closed_exception.h"
 #include "../../../../include/xtd/diagnostics/boolean_switch.h"
 #include "../../../../include/xtd/diagnostics/debug.h"
+#include "../../../../include/xtd/io/file.h"
+#include "../../../../include/xtd/io/file_not_found_exception.h"
 #include "../../../../include/xtd/net/dns.h"
 #include "../../../../include/xtd/net/ip_end_point.h"
+#include "../../../../include/xtd/net/sockets/send_packets_element.h"
 #include "../../../../include/xtd/net/sockets/socket.h"
 #include "../../../../include/xtd/net/sockets/socket_async_event_args.h"
 #include "../../../../include/xtd/net/sockets/socket_error.h"
 #include "../../../../include/xtd/net/sockets/socket_exception.h"
+#include "socket_io_engine.h"
 #define __XTD_CORE_NATIVE_LIBRARY__
 #include <xtd/native/socket>
 #undef __XTD_CORE_NATIVE_LIBRARY__
 #include <algorithm>
-#include <thread>
+#include <fstream>
+#include <limits>
 
 using namespace xtd;
 using namespace xtd::diagnostics;
@@ -31,11 +37,52 @@ public:
 
 namespace {
   boolean_switch show_debug_socket("socket", "Shows xtd::net::sockets:socket log", "false");
+  
+  // Set while the I/O engine attempts an operation : the operation reports that it would block instead of waiting, and the engine waits for the next readiness event.
+  thread_local bool attempting_operation = false;
+  
+  class operation_attempt {
+  public:
+    operation_attempt() noexcept {attempting_operation = true;}
+    ~operation_attempt() {attempting_operation = false;}
+  };
+  
+  bool is_would_block(socket_error error) noexcept {
+    return error == socket_error::would_block || error == socket_error::in_progress || error == socket_error::already_in_progress;
+  }
+  
+  // Wraps the operation of an asynchronous call : the result is always signaled and the callback always called, even if the operation fails. Returns false, without completing, if the operation would block.
+  template<typename async_result_t, typename operation_t>
+  socket_io_engine::operation make_completion(xtd::sptr<async_result_t> ar, xtd::async_callback callback, operation_t operation) {
+    return [ar, callback, operation]() mutable {
+      try {
+        auto attempt = operation_attempt {};
+        operation();
+      } catch (const socket_exception& exception) {
+        ar->error_code_ = as<socket_error>(exception.error_code().value());
+        ar->exception_ = std::current_exception();
+      } catch (...) {
+        ar->error_code_ = socket_error::sock_error;
+        ar->exception_ = std::current_exception();
+      }
+      if (is_would_block(ar->error_code_)) {
+        ar->error_code_ = socket_error::success;
+        ar->exception_ = nullptr;
+        return false;
+      }
+      ar->is_completed_ = true;
+      ar->async_event_.set();
+      if (!callback.is_empty()) callback(ar);
+      return true;
+    };
+  }
 }
 
 struct socket::data {
   xtd::net::sockets::address_family address_family = xtd::net::sockets::address_family::unspecified;
   bool will_block = true;
+  // The sockets used by asynchronous operations stay non-blocking : the synchronous operations then wait for the socket to be ready, as long as xtd::net::sockets::socket::blocking is true.
+  bool is_native_non_blocking = false;
   bool is_connected = false;
   bool is_disconnected = false;
   intptr handle = 0;
@@ -113,7 +160,7 @@ bool socket::blocking() const {
 
 socket& socket::blocking(bool value) {
   if (data_->handle == 0) throw object_closed_exception {csf_};
-  if (native::socket::set_blocking(data_->handle, value) != 0) throw socket_exception(get_last_error_(), csf_);
+  if ((!value || !data_->is_native_non_blocking) && native::socket::set_blocking(data_->handle, value) != 0) throw socket_exception(get_last_error_(), csf_);
   data_->will_block = value;
   return *this;
 }
@@ -186,6 +233,14 @@ socket& socket::linger_state(const xtd::net::sockets::linger_option& value) {
 
 xtd::sptr<xtd::net::end_point> socket::local_end_point() const {
   if (data_->handle == 0) throw object_closed_exception {csf_};
+  // A socket that is not explicitly bound is bound by the system when it connects or sends : the local end point reports the address the socket is bound to.
+  if (!data_->local_end_point && (data_->address_family == address_family::inter_network || data_->address_family == address_family::inter_network_v6)) {
+    auto bound_address = xtd::net::socket_address {data_->address_family};
+    if (native::socket::get_socket_name(data_->handle, bound_address.bytes_) == 0) {
+      auto bound_end_point = xtd::sptr<xtd::net::end_point> {ip_end_point {data_->address_family == address_family::inter_network ? ip_address::any : ip_address::ip_v6_any, 0}.create(bound_address)};
+      if (as<ip_end_point>(bound_end_point)->port() != 0) data_->local_end_point = bound_end_point;
+    }
+  }
   return data_->local_end_point;
 }
 
@@ -290,8 +345,17 @@ socket socket::accept() {
   if (data_->is_bound == false || data_->is_listening == false) throw invalid_operation_exception {csf_};
   
   auto address = socket_address {data_->address_family};
+  auto error = socket_error::success;
   auto new_socket_handle = native::socket::accept(data_->handle, address.bytes_);
-  if (new_socket_handle == static_cast<intptr>(-1)) throw socket_exception(get_last_error_(), csf_);
+  while (new_socket_handle == static_cast<intptr>(-1) && wait_until_ready_(select_mode::select_read, error))
+    new_socket_handle = native::socket::accept(data_->handle, address.bytes_);
+  if (new_socket_handle == static_cast<intptr>(-1)) throw socket_exception(error, csf_);
+  // On some systems, the accepted socket inherits the non-blocking mode of the listening socket.
+  if (data_->is_native_non_blocking && native::socket::set_blocking(new_socket_handle, true) != 0) {
+    error = get_last_error_();
+    native::socket::destroy(new_socket_handle);
+    throw socket_exception(error, csf_);
+  }
   
   auto new_socket = socket {new_socket_handle};
   new_socket.data_->address_family = data_->address_family;
@@ -306,17 +370,23 @@ bool socket::accept_async(xtd::net::sockets::socket_async_event_args& e) {
   if (data_->handle == 0) throw object_closed_exception {csf_};
   if (data_->is_bound == false || data_->is_listening == false) throw invalid_operation_exception {csf_};
   
-  auto operation_thread = std::thread {[](xtd::net::sockets::socket_async_event_args * e, xtd::net::sockets::address_family address_family, xtd::net::sockets::socket_type socket_type, xtd::net::sockets::protocol_type protocol_type) {
-    if (e->accept_socket_.data_->address_family == xtd::net::sockets::address_family::unknown && e->accept_socket_.data_->socket_type == xtd::net::sockets::socket_type::unknown && e->accept_socket_.data_->protocol_type == xtd::net::sockets::protocol_type::unknown) {
-      e->accept_socket_.data_->address_family = address_family;
-      e->accept_socket_.data_->socket_type = socket_type;
-      e->accept_socket_.data_->protocol_type = protocol_type;
-      e->connect_socket_ = e->accept_socket_.accept();
-      e->on_complete(*e);
+  e.last_operation = socket_async_operation::accept;
+  make_native_non_blocking_();
+  socket_io_engine::begin_read(data_->handle, [s = *this, e = &e]() mutable {
+    try {
+      auto attempt = operation_attempt {};
+      e->accept_socket_ = s.accept();
+      e->socket_error_ = socket_error::success;
+    } catch (const socket_exception& exception) {
+      e->socket_error_ = as<socket_error>(exception.error_code().value());
+    } catch (...) {
+      e->socket_error_ = socket_error::sock_error;
     }
-  }, &e, data_->address_family, data_->socket_type, data_->protocol_type};
-  operation_thread.detach();
-  return false;
+    if (is_would_block(e->socket_error_)) return false;
+    e->on_complete(*e);
+    return true;
+  });
+  return true;
 }
 
 xtd::sptr<xtd::iasync_result> socket::begin_accept(xtd::async_callback callback, const std::any& state) {
@@ -324,18 +394,10 @@ xtd::sptr<xtd::iasync_result> socket::begin_accept(xtd::async_callback callback,
   if (data_->is_bound == false || data_->is_listening == false) throw invalid_operation_exception {csf_};
   
   auto ar = xtd::new_sptr<async_result_accept>(state);
-  auto operation_thread = std::thread {[](socket s, xtd::sptr<async_result_accept> ar, xtd::async_callback callback) {
-    try {
-      ar->socket_ = s.accept();
-      ar->is_completed_ = true;
-      as<xtd::threading::manual_reset_event>(ar->async_wait_handle()).set();
-      callback(ar);
-    } catch (...) {
-      ar->error_code_ = s.get_last_error_();
-      ar->exception_ = std::current_exception();
-    }
-  }, *this, ar, callback};
-  operation_thread.detach();
+  make_native_non_blocking_();
+  socket_io_engine::begin_read(data_->handle, make_completion(ar, callback, [s = *this, ar]() mutable {
+    ar->socket_ = s.accept();
+  }));
   return ar;
 }
 
@@ -360,18 +422,9 @@ xtd::sptr<xtd::iasync_result> socket::begin_disconnect(bool reuse_socket, xtd::a
   if (!data_->is_connected) throw object_closed_exception {csf_};
   
   auto ar = xtd::new_sptr<async_result_disconnect>(state);
-  auto operation_thread = std::thread {[](socket s, bool reuse_socket, xtd::sptr<async_result_disconnect> ar, xtd::async_callback callback) {
-    try {
-      s.disconnect(reuse_socket);
-      ar->is_completed_ = true;
-      as<xtd::threading::manual_reset_event>(ar->async_wait_handle()).set();
-      callback(ar);
-    } catch (...) {
-      ar->error_code_ = s.get_last_error_();
-      ar->exception_ = std::current_exception();
-    }
-  }, *this, reuse_socket, ar, callback};
-  operation_thread.detach();
+  socket_io_engine::dispatch(make_completion(ar, callback, [s = *this, reuse_socket]() mutable {
+    s.disconnect(reuse_socket);
+  }));
   return ar;
 }
 
@@ -381,18 +434,10 @@ xtd::sptr<xtd::iasync_result> socket::begin_receive(std::vector<xtd::byte>& buff
   if (!data_->is_connected) throw socket_exception(socket_error::not_connected, csf_);
   
   auto ar = xtd::new_sptr<async_result_receive>(state);
-  auto operation_thread = std::thread {[](socket s, std::vector<xtd::byte>* buffer, size_t offset, size_t size, xtd::net::sockets::socket_flags socket_flags, xtd::sptr<async_result_receive> ar, xtd::async_callback callback) {
-    try {
-      ar->number_of_bytes_received_ = s.receive(*buffer, offset, size, socket_flags);
-      ar->is_completed_ = true;
-      as<xtd::threading::manual_reset_event>(ar->async_wait_handle()).set();
-      callback(ar);
-    } catch (...) {
-      ar->error_code_ = s.get_last_error_();
-      ar->exception_ = std::current_exception();
-    }
-  }, *this, &buffer, offset, size, socket_flags, ar, callback};
-  operation_thread.detach();
+  make_native_non_blocking_();
+  socket_io_engine::begin_read(data_->handle, make_completion(ar, callback, [s = *this, buffer = &buffer, offset, size, socket_flags, ar]() mutable {
+    ar->number_of_bytes_received_ = s.receive(*buffer, offset, size, socket_flags);
+  }));
   return ar;
 }
 
@@ -402,18 +447,10 @@ xtd::sptr<xtd::iasync_result> socket::begin_receive(std::vector<xtd::byte>& buff
   if (!data_->is_connected) throw socket_exception(socket_error::not_connected, csf_);
   
   auto ar = xtd::new_sptr<async_result_receive>(state);
-  auto operation_thread = std::thread {[](socket s, std::vector<xtd::byte>* buffer, size_t offset, size_t size, xtd::net::sockets::socket_flags socket_flags, xtd::sptr<async_result_receive> ar, xtd::async_callback callback) {
-    try {
-      ar->number_of_bytes_received_ = s.receive(*buffer, offset, size, socket_flags, ar->error_code_);
-      ar->is_completed_ = true;
-      as<xtd::threading::manual_reset_event>(ar->async_wait_handle()).set();
-      callback(ar);
-    } catch (...) {
-      ar->error_code_ = s.get_last_error_();
-      ar->exception_ = std::current_exception();
-    }
-  }, *this, &buffer, offset, size, socket_flags, ar, callback};
-  operation_thread.detach();
+  make_native_non_blocking_();
+  socket_io_engine::begin_read(data_->handle, make_completion(ar, callback, [s = *this, buffer = &buffer, offset, size, socket_flags, ar]() mutable {
+    ar->number_of_bytes_received_ = s.receive(*buffer, offset, size, socket_flags, ar->error_code_);
+  }));
   return ar;
 }
 
@@ -422,19 +459,11 @@ xtd::sptr<xtd::iasync_result> socket::begin_receive_from(std::vector<xtd::byte>&
   if (data_->handle == 0) throw object_closed_exception {csf_};
   
   auto ar = xtd::new_sptr<async_result_receive_from>(state);
-  auto operation_thread = std::thread {[](socket s, std::vector<xtd::byte>* buffer, size_t offset, size_t size, xtd::net::sockets::socket_flags socket_flags, xtd::sptr<async_result_receive_from> ar, xtd::async_callback callback) {
-    try {
-      ar->end_point_ = xtd::new_sptr<ip_end_point>();
-      ar->number_of_bytes_received_ = s.receive_from(*buffer, offset, size, socket_flags, *ar->end_point_);
-      ar->is_completed_ = true;
-      as<xtd::threading::manual_reset_event>(ar->async_wait_handle()).set();
-      callback(ar);
-    } catch (...) {
-      ar->error_code_ = s.get_last_error_();
-      ar->exception_ = std::current_exception();
-    }
-  }, *this, &buffer, offset, size, socket_flags, ar, callback};
-  operation_thread.detach();
+  make_native_non_blocking_();
+  socket_io_engine::begin_read(data_->handle, make_completion(ar, callback, [s = *this, buffer = &buffer, offset, size, socket_flags, ar]() mutable {
+    ar->end_point_ = xtd::new_sptr<ip_end_point>();
+    ar->number_of_bytes_received_ = s.receive_from(*buffer, offset, size, socket_flags, *ar->end_point_);
+  }));
   return ar;
 }
 
@@ -444,19 +473,11 @@ xtd::sptr<xtd::iasync_result> socket::begin_receive_message_from(std::vector<xtd
   
   auto ar = xtd::new_sptr<async_result_receive_message_from>(state);
   ar->socket_flags_ = socket_flags;
-  auto operation_thread = std::thread {[](socket s, std::vector<xtd::byte>* buffer, size_t offset, size_t size, xtd::sptr<async_result_receive_message_from> ar, xtd::async_callback callback) {
-    try {
-      ar->end_point_ = xtd::new_sptr<ip_end_point>();
-      ar->number_of_bytes_received_ = s.receive_message_from(*buffer, offset, size, ar->socket_flags_, *ar->end_point_, ar->ip_packet_information_);
-      ar->is_completed_ = true;
-      as<xtd::threading::manual_reset_event>(ar->async_wait_handle()).set();
-      callback(ar);
-    } catch (...) {
-      ar->error_code_ = s.get_last_error_();
-      ar->exception_ = std::current_exception();
-    }
-  }, *this, &buffer, offset, size, ar, callback};
-  operation_thread.detach();
+  make_native_non_blocking_();
+  socket_io_engine::begin_read(data_->handle, make_completion(ar, callback, [s = *this, buffer = &buffer, offset, size, ar]() mutable {
+    ar->end_point_ = xtd::new_sptr<ip_end_point>();
+    ar->number_of_bytes_received_ = s.receive_message_from(*buffer, offset, size, ar->socket_flags_, *ar->end_point_, ar->ip_packet_information_);
+  }));
   return ar;
 }
 
@@ -466,18 +487,12 @@ xtd::sptr<xtd::iasync_result> socket::begin_send(const std::vector<xtd::byte>& b
   if (!data_->is_connected) throw socket_exception(socket_error::not_connected, csf_);
   
   auto ar = xtd::new_sptr<async_result_send>(state);
-  auto operation_thread = std::thread {[](socket s, const std::vector<xtd::byte>& buffer, size_t offset, size_t size, xtd::net::sockets::socket_flags socket_flags, xtd::sptr<async_result_send> ar, xtd::async_callback callback) {
-    try {
-      ar->number_of_bytes_sent_ = s.send(buffer, offset, size, socket_flags);
-      ar->is_completed_ = true;
-      as<xtd::threading::manual_reset_event>(ar->async_wait_handle()).set();
-      callback(ar);
-    } catch (...) {
-      ar->error_code_ = s.get_last_error_();
-      ar->exception_ = std::current_exception();
-    }
-  }, *this, buffer, offset, size, socket_flags, ar, callback};
-  operation_thread.detach();
+  make_native_non_blocking_();
+  socket_io_engine::begin_write(data_->handle, make_completion(ar, callback, [s = *this, buffer, offset, size, socket_flags, ar]() mutable {
+    // A non-blocking socket can send a part of the buffer : the rest is sent at the next readiness event.
+    ar->number_of_bytes_sent_ += s.send(buffer, offset + ar->number_of_bytes_sent_, size - ar->number_of_bytes_sent_, socket_flags);
+    if (ar->number_of_bytes_sent_ < size) ar->error_code_ = socket_error::would_block;
+  }));
   return ar;
 }
 
@@ -487,18 +502,13 @@ xtd::sptr<xtd::iasync_result> socket::begin_send(const std::vector<xtd::byte>& b
   if (!data_->is_connected) throw socket_exception(socket_error::not_connected, csf_);
   
   auto ar = xtd::new_sptr<async_result_send>(state);
-  auto operation_thread = std::thread {[](socket s, const std::vector<xtd::byte>& buffer, size_t offset, size_t size, xtd::net::sockets::socket_flags socket_flags, xtd::sptr<async_result_send> ar, xtd::async_callback callback) {
-    try {
-      ar->number_of_bytes_sent_ = s.send(buffer, offset, size, socket_flags, ar->error_code_);
-      ar->is_completed_ = true;
-      as<xtd::threading::manual_reset_event>(ar->async_wait_handle()).set();
-      callback(ar);
-    } catch (...) {
-      ar->error_code_ = s.get_last_error_();
-      ar->exception_ = std::current_exception();
-    }
-  }, *this, buffer, offset, size, socket_flags, ar, callback};
-  operation_thread.detach();
+  make_native_non_blocking_();
+  socket_io_engine::begin_write(data_->handle, make_completion(ar, callback, [s = *this, buffer, offset, size, socket_flags, ar]() mutable {
+    auto number_of_bytes_sent = s.send(buffer, offset + ar->number_of_bytes_sent_, size - ar->number_of_bytes_sent_, socket_flags, ar->error_code_);
+    if (ar->error_code_ != socket_error::success) return;
+    ar->number_of_bytes_sent_ += number_of_bytes_sent;
+    if (ar->number_of_bytes_sent_ < size) ar->error_code_ = socket_error::would_block;
+  }));
   return ar;
 }
 
@@ -507,29 +517,26 @@ xtd::sptr<xtd::iasync_result> socket::begin_send_to(const std::vector<xtd::byte>
   if (data_->handle == 0) throw object_closed_exception {csf_};
   
   auto ar = xtd::new_sptr<async_result_send_to>(state);
-  auto operation_thread = std::thread {[](socket s, const std::vector<xtd::byte>& buffer, size_t offset, size_t size, xtd::net::sockets::socket_flags socket_flags, const xtd::net::end_point & remote_end_point, xtd::sptr<async_result_send_to> ar, xtd::async_callback callback) {
-    try {
-      ar->number_of_bytes_sent_ = s.send_to(buffer, offset, size, socket_flags, remote_end_point);
-      ar->is_completed_ = true;
-      as<xtd::threading::manual_reset_event>(ar->async_wait_handle()).set();
-      callback(ar);
-    } catch (...) {
-      ar->error_code_ = s.get_last_error_();
-      ar->exception_ = std::current_exception();
-    }
-  }, *this, buffer, offset, size, socket_flags, remote_end_point, ar, callback};
-  operation_thread.detach();
+  make_native_non_blocking_();
+  socket_io_engine::begin_write(data_->handle, make_completion(ar, callback, [s = *this, buffer, offset, size, socket_flags, remote_end_point = xtd::sptr<xtd::net::end_point> {remote_end_point.create(remote_end_point.serialize())}, ar]() mutable {
+    ar->number_of_bytes_sent_ = s.send_to(buffer, offset, size, socket_flags, *remote_end_point);
+  }));
   return ar;
 }
 
 void socket::close() {
   debug::write_if(show_debug_socket.enabled(), string::format("socket::close() : socket=[{}]", data_->handle));
+  auto canceled_operations = data_->handle != 0 ? socket_io_engine::cancel(data_->handle) : std::vector<socket_io_engine::operation> {};
   if (data_->handle != 0 && native::socket::destroy(data_->handle) != 0) {
-    debug::write_line_if(show_debug_socket.enabled(), string::format(" error=[{}]", get_last_error_()));
-    throw socket_exception(get_last_error_(), csf_);
+    auto error = get_last_error_();
+    debug::write_line_if(show_debug_socket.enabled(), string::format(" error=[{}]", error));
+    for (auto& operation : canceled_operations)
+      socket_io_engine::dispatch(std::move(operation));
+    throw socket_exception(error, csf_);
   }
   data_->address_family = xtd::net::sockets::address_family::unspecified;
   data_->will_block = true;
+  data_->is_native_non_blocking = false;
   data_->is_connected = false;
   data_->handle = 0;
   data_->is_bound = false;
@@ -539,6 +546,9 @@ void socket::close() {
   data_->remote_end_point.reset();
   data_->socket_type = xtd::net::sockets::socket_type::unknown;
   debug::write_line_if(show_debug_socket.enabled(), " succeed");
+  // The canceled operations see a closed socket and complete with an xtd::object_closed_exception.
+  for (auto& operation : canceled_operations)
+    socket_io_engine::dispatch(std::move(operation));
 }
 
 void socket::connect(const xtd::net::ip_address& address, uint16 port) {
@@ -761,8 +771,38 @@ size_t socket::receive(std::vector<xtd::byte>& buffer, size_t offset, size_t siz
   if (data_->handle == 0) throw object_closed_exception {csf_};
   if (!data_->is_connected) throw socket_exception(socket_error::not_connected, csf_);
   
+  auto error = socket_error::success;
   auto number_of_bytes_received = native::socket::receive(data_->handle, buffer, offset, size, static_cast<int32>(socket_flags));
-  error_code = number_of_bytes_received > 0 ? get_last_error_() : socket_error::success;
+  while (number_of_bytes_received == -1 && wait_until_ready_(select_mode::select_read, error))
+    number_of_bytes_received = native::socket::receive(data_->handle, buffer, offset, size, static_cast<int32>(socket_flags));
+  error_code = number_of_bytes_received == -1 ? error : socket_error::success;
+  return static_cast<size_t>(number_of_bytes_received);
+}
+
+size_t socket::receive(const std::vector<std::span<xtd::byte>>& buffers) {
+  return receive(buffers, socket_flags::none);
+}
+
+size_t socket::receive(const std::vector<std::span<xtd::byte>>& buffers, socket_flags socket_flags) {
+  auto error_code = socket_error::success;
+  auto number_of_bytes_received = receive(buffers, socket_flags, error_code);
+  if (error_code != socket_error::success) throw socket_exception(error_code, csf_);
+  return number_of_bytes_received;
+}
+
+size_t socket::receive(const std::vector<std::span<xtd::byte>>& buffers, socket_flags socket_flags, socket_error& error_code) {
+  if (data_->handle == 0) throw object_closed_exception {csf_};
+  if (!data_->is_connected) throw socket_exception(socket_error::not_connected, csf_);
+  
+  static thread_local auto native_buffers = std::vector<std::pair<xtd::byte*, size_t>> {};
+  native_buffers.clear();
+  for (auto buffer : buffers)
+    native_buffers.emplace_back(buffer.data(), buffer.size());
+  auto error = socket_error::success;
+  auto number_of_bytes_received = native::socket::receive(data_->handle, native_buffers, static_cast<int32>(socket_flags));
+  while (number_of_bytes_received == -1 && wait_until_ready_(select_mode::select_read, error))
+    number_of_bytes_received = native::socket::receive(data_->handle, native_buffers, static_cast<int32>(socket_flags));
+  error_code = number_of_bytes_received == -1 ? error : socket_error::success;
   return static_cast<size_t>(number_of_bytes_received);
 }
 
@@ -782,8 +822,11 @@ size_t socket::receive_from(std::vector<xtd::byte>& buffer, size_t offset, size_
   if (offset + size > buffer.size()) throw argument_out_of_range_exception {csf_};
   if (data_->handle == 0) throw object_closed_exception {csf_};
   auto socket_address = remote_end_point.serialize();
+  auto error = socket_error::success;
   auto number_of_bytes_received = native::socket::receive_from(data_->handle, buffer, offset, size, static_cast<int32>(socket_flags), socket_address.bytes_);
-  if (number_of_bytes_received == -1) throw socket_exception(get_last_error_(), csf_);
+  while (number_of_bytes_received == -1 && wait_until_ready_(select_mode::select_read, error))
+    number_of_bytes_received = native::socket::receive_from(data_->handle, buffer, offset, size, static_cast<int32>(socket_flags), socket_address.bytes_);
+  if (number_of_bytes_received == -1) throw socket_exception(error, csf_);
   return static_cast<size_t>(number_of_bytes_received);
 }
 
@@ -791,36 +834,44 @@ size_t socket::receive_message_from(std::vector<xtd::byte>& buffer, size_t offse
   if (offset + size > buffer.size()) throw argument_out_of_range_exception {csf_};
   if (data_->handle == 0) throw object_closed_exception {csf_};
   auto socket_address = remote_end_point.serialize();
+  auto error = socket_error::success;
   auto number_of_bytes_received = native::socket::receive_from(data_->handle, buffer, offset, size, static_cast<int32>(socket_flags), socket_address.bytes_);
-  if (number_of_bytes_received == -1) throw socket_exception(get_last_error_(), csf_);
+  while (number_of_bytes_received == -1 && wait_until_ready_(select_mode::select_read, error))
+    number_of_bytes_received = native::socket::receive_from(data_->handle, buffer, offset, size, static_cast<int32>(socket_flags), socket_address.bytes_);
+  if (number_of_bytes_received == -1) throw socket_exception(error, csf_);
   
   if (data_->address_family == address_family::inter_network)
     ip_packet_information.address_ = ip_address(std::vector<xtd::byte>(socket_address.bytes_.begin() + 4, socket_address.bytes_.begin() + 8));
   if (data_->address_family == address_family::inter_network_v6)
     ip_packet_information.address_ = ip_address(std::vector<xtd::byte>(socket_address.bytes_.begin() + 8, socket_address.bytes_.begin() + 24), bit_converter::to_uint32(socket_address.bytes_, 25));
-    
+  
   return static_cast<size_t>(number_of_bytes_received);
 }
 
 size_t socket::select(std::vector<socket>& check_read, std::vector<socket>& check_write, std::vector<socket>& check_error, int32 microseconds) {
   if (check_read.size() == 0 && check_write.size() == 0 && check_error.size() == 0) throw argument_exception {csf_};
   
-  auto check_read_handles = std::vector<intptr> {};
-  std::for_each(check_read.begin(), check_read.end(), [&](auto s) {check_read_handles.push_back(s.data_->handle);});
-  
-  auto check_write_handles = std::vector<intptr> {};
-  std::for_each(check_write.begin(), check_write.end(), [&](auto s) {check_write_handles.push_back(s.data_->handle);});
-  
-  auto check_error_handles = std::vector<intptr> {};
-  std::for_each(check_error.begin(), check_error.end(), [&](auto s) {check_error_handles.push_back(s.data_->handle);});
+  // The handle lists are reused by the next calls on the same thread.
+  static thread_local auto check_read_handles = std::vector<intptr> {};
+  static thread_local auto check_write_handles = std::vector<intptr> {};
+  static thread_local auto check_error_handles = std::vector<intptr> {};
+  auto get_handles = [](const std::vector<socket>& sockets, std::vector<intptr>& handles) {
+    handles.clear();
+    for (const auto& s : sockets)
+      handles.push_back(s.data_->handle);
+  };
+  get_handles(check_read, check_read_handles);
+  get_handles(check_write, check_write_handles);
+  get_handles(check_error, check_error_handles);
   
   auto status = native::socket::select(check_read_handles, check_write_handles, check_error_handles, microseconds);
   if (status < 0) throw socket_exception(get_last_error_(), csf_);
   
-  auto update_check_sockets = [](auto & sockets, auto & handles) {
-    for (auto i = 0_z, j = 0_z; i < handles.size() && j < sockets.size(); ++i, ++j)
-      if (handles[i] == 0)
-        sockets.erase(sockets.begin() + j--);
+  auto update_check_sockets = [](std::vector<socket>& sockets, const std::vector<intptr>& handles) {
+    auto count = 0_z;
+    for (auto index = 0_z; index < sockets.size(); ++index)
+      if (handles[index] != 0 && count++ != index) sockets[count - 1] = std::move(sockets[index]);
+    sockets.resize(count);
   };
   
   update_check_sockets(check_read, check_read_handles);
@@ -852,11 +903,81 @@ size_t socket::send(const std::vector<xtd::byte>& buffer, size_t offset, size_t
 size_t socket::send(const std::vector<xtd::byte>& buffer, size_t offset, size_t size, socket_flags socket_flags, socket_error& error_code) {
   if (offset + size > buffer.size()) throw argument_out_of_range_exception {csf_};
   if (data_->handle == 0) throw object_closed_exception {csf_};
+  auto error = socket_error::success;
   auto number_of_bytes_sent = native::socket::send(data_->handle, buffer, offset, size, static_cast<int32>(socket_flags));
-  error_code = number_of_bytes_sent == -1 ? get_last_error_() : socket_error::success;
+  while (number_of_bytes_sent == -1 && wait_until_ready_(select_mode::select_write, error))
+    number_of_bytes_sent = native::socket::send(data_->handle, buffer, offset, size, static_cast<int32>(socket_flags));
+  error_code = number_of_bytes_sent == -1 ? error : socket_error::success;
+  return static_cast<size_t>(number_of_bytes_sent);
+}
+
+size_t socket::send(const std::vector<std::span<const xtd::byte>>& buffers) {
+  return send(buffers, socket_flags::none);
+}
+
+size_t socket::send(const std::vector<std::span<const xtd::byte>>& buffers, socket_flags socket_flags) {
+  auto error_code = socket_error::success;
+  auto number_of_bytes_sent = send(buffers, socket_flags, error_code);
+  if (error_code != socket_error::success) throw socket_exception(error_code, csf_);
+  return number_of_bytes_sent;
+}
+
+size_t socket::send(const std::vector<std::span<const xtd::byte>>& buffers, socket_flags socket_flags, socket_error& error_code) {
+  if (data_->handle == 0) throw object_closed_exception {csf_};
+  
+  static thread_local auto native_buffers = std::vector<std::pair<const xtd::byte*, size_t>> {};
+  native_buffers.clear();
+  for (auto buffer : buffers)
+    native_buffers.emplace_back(buffer.data(), buffer.size());
+  auto error = socket_error::success;
+  auto number_of_bytes_sent = native::socket::send(data_->handle, native_buffers, static_cast<int32>(socket_flags));
+  while (number_of_bytes_sent == -1 && wait_until_ready_(select_mode::select_write, error))
+    number_of_bytes_sent = native::socket::send(data_->handle, native_buffers, static_cast<int32>(socket_flags));
+  error_code = number_of_bytes_sent == -1 ? error : socket_error::success;
   return static_cast<size_t>(number_of_bytes_sent);
 }
 
+void socket::send_file(const xtd::string& file_name) {
+  send_file(file_name, {}, {}, transmit_file_options::use_default_worker_thread);
+}
+
+void socket::send_file(const xtd::string& file_name, const std::vector<xtd::byte>& pre_buffer, const std::vector<xtd::byte>& post_buffer, transmit_file_options flags) {
+  if (data_->handle == 0) throw object_closed_exception {csf_};
+  if (!data_->is_connected) throw not_supported_exception {csf_};
+  if (!xtd::io::file::exists(file_name)) throw xtd::io::file_not_found_exception {csf_};
+  
+  auto buffers = std::vector<std::span<const xtd::byte>> {pre_buffer};
+  send_all_(buffers);
+  if (native::socket::send_file(data_->handle, file_name, 0, -1) == -1) throw socket_exception(get_last_error_(), csf_);
+  buffers = {post_buffer};
+  send_all_(buffers);
+  if ((flags & transmit_file_options::disconnect) == transmit_file_options::disconnect) disconnect((flags & transmit_file_options::reuse_socket) == transmit_file_options::reuse_socket);
+}
+
+bool socket::send_packets_async(xtd::net::sockets::socket_async_event_args& e) {
+  if (data_->handle == 0) throw object_closed_exception {csf_};
+  if (!data_->is_connected) throw not_supported_exception {csf_};
+  
+  e.last_operation = socket_async_operation::send_packets;
+  e.bytes_transferred_ = 0;
+  make_native_non_blocking_();
+  // The packets cannot be resumed after a partial send : the operation is not an attempt, it waits on its thread pool thread each time the socket would block.
+  socket_io_engine::begin_write(data_->handle, [s = *this, e = &e]() mutable {
+    try {
+      s.send_packets_(e->send_packets_elements_, e->bytes_transferred_);
+      if ((e->send_packets_flags_ & transmit_file_options::disconnect) == transmit_file_options::disconnect) s.disconnect((e->send_packets_flags_ & transmit_file_options::reuse_socket) == transmit_file_options::reuse_socket);
+      e->socket_error_ = socket_error::success;
+    } catch (const socket_exception& exception) {
+      e->socket_error_ = as<socket_error>(exception.error_code().value());
+    } catch (...) {
+      e->socket_error_ = socket_error::sock_error;
+    }
+    e->on_complete(*e);
+    return true;
+  });
+  return true;
+}
+
 size_t socket::send_to(const std::vector<xtd::byte>& buffer, const end_point& remote_end_point) {
   return send_to(buffer, 0, buffer.size(), socket_flags::none, remote_end_point);
 }
@@ -873,8 +994,11 @@ size_t socket::send_to(const std::vector<xtd::byte>& buffer, size_t offset, size
   if (offset + size > buffer.size()) throw argument_out_of_range_exception {csf_};
   if (data_->handle == 0) throw object_closed_exception {csf_};
   auto socket_address = remote_end_point.serialize();
+  auto error = socket_error::success;
   auto number_of_bytes_sent = native::socket::send_to(data_->handle, buffer, offset, size, static_cast<int32>(socket_flags), socket_address.bytes_);
-  if (number_of_bytes_sent == -1) throw socket_exception(get_last_error_(), csf_);
+  while (number_of_bytes_sent == -1 && wait_until_ready_(select_mode::select_write, error))
+    number_of_bytes_sent = native::socket::send_to(data_->handle, buffer, offset, size, static_cast<int32>(socket_flags), socket_address.bytes_);
+  if (number_of_bytes_sent == -1) throw socket_exception(error, csf_);
   return static_cast<int32>(number_of_bytes_sent);
 }
 
@@ -933,18 +1057,21 @@ xtd::sptr<xtd::iasync_result> socket::begin_connect_(xtd::sptr<xtd::net::end_poi
   if (data_->handle == 0) throw object_closed_exception {csf_};
   
   auto ar = xtd::new_sptr<async_result_connect>(state);
-  auto operation_thread = std::thread {[](socket s, xtd::sptr<xtd::net::end_point> remote_end_point, xtd::sptr<async_result_connect> ar, xtd::async_callback callback) {
-    try {
-      s.connect_(remote_end_point);
-      ar->is_completed_ = true;
-      as<xtd::threading::manual_reset_event>(ar->async_wait_handle()).set();
-      callback(ar);
-    } catch (...) {
-      ar->error_code_ = s.get_last_error_();
-      ar->exception_ = std::current_exception();
-    }
-  }, *this, remote_end_point, ar, callback};
-  operation_thread.detach();
+  data_->remote_end_point = remote_end_point;
+  auto socket_address = data_->remote_end_point->serialize();
+  // The connection is started in non-blocking mode, and completed when the socket becomes writable.
+  make_native_non_blocking_();
+  auto error = native::socket::connect(data_->handle, socket_address.bytes_) == 0 ? socket_error::success : get_last_error_();
+  auto pending = is_would_block(error);
+  auto completion = make_completion(ar, callback, [s = *this, socket_address, pending, error]() mutable {
+    if (s.data_->handle == 0) throw object_closed_exception {csf_};
+    // Connecting again reports the result of the pending connection, or that it is still in progress.
+    if (pending) error = native::socket::connect(s.data_->handle, socket_address.bytes_) == 0 ? socket_error::success : get_last_error_();
+    if (error != socket_error::success && error != socket_error::is_connected) throw socket_exception(error, csf_);
+    s.data_->is_connected = true;
+  });
+  if (pending) socket_io_engine::begin_write(data_->handle, completion);
+  else socket_io_engine::dispatch(completion);
   return ar;
 }
 
@@ -960,6 +1087,11 @@ void socket::bind_(xtd::sptr<xtd::net::end_point> local_end_point) {
     debug::write_line_if(show_debug_socket.enabled(), string::format(" error=[{}]", get_last_error_()));
     throw socket_exception(get_last_error_(), csf_);
   }
+  // When the port is zero, the system chooses it : the local end point reports the address the socket is bound to.
+  if (data_->address_family == address_family::inter_network || data_->address_family == address_family::inter_network_v6) {
+    auto bound_address = xtd::net::socket_address {data_->address_family};
+    if (native::socket::get_socket_name(data_->handle, bound_address.bytes_) == 0) data_->local_end_point = local_end_point->create(bound_address);
+  }
   debug::write_line_if(show_debug_socket.enabled(), " succeed");
   data_->is_bound = true;
 }
@@ -973,14 +1105,98 @@ void socket::connect_(xtd::sptr<xtd::net::end_point> remote_end_point) {
   
   data_->remote_end_point = remote_end_point;
   auto socket_address = data_->remote_end_point->serialize();
-  if (native::socket::connect(data_->handle, socket_address.bytes_) != 0) {
-    debug::write_line_if(show_debug_socket.enabled(), string::format(" error=[{}]", get_last_error_()));
-    throw socket_exception(get_last_error_(), csf_);
+  auto error = socket_error::success;
+  auto result = native::socket::connect(data_->handle, socket_address.bytes_);
+  // A non-blocking connection is established when the socket becomes writable ; connecting again reports its result.
+  while (result != 0 && wait_until_ready_(select_mode::select_write, error)) {
+    result = native::socket::connect(data_->handle, socket_address.bytes_);
+    if (result != 0 && get_last_error_() == socket_error::is_connected) result = 0;
+  }
+  if (result != 0) {
+    debug::write_line_if(show_debug_socket.enabled(), string::format(" error=[{}]", error));
+    throw socket_exception(error, csf_);
   }
   debug::write_line_if(show_debug_socket.enabled(), " succeed");
   data_->is_connected = true;
 }
 
+void socket::make_native_non_blocking_() {
+  if (data_->is_native_non_blocking) return;
+  if (data_->will_block && native::socket::set_blocking(data_->handle, false) != 0) throw socket_exception(get_last_error_(), csf_);
+  data_->is_native_non_blocking = true;
+}
+
+size_t socket::send_all_(std::vector<std::span<const xtd::byte>>& buffers) {
+  static thread_local auto native_buffers = std::vector<std::pair<const xtd::byte*, size_t>> {};
+  auto error = socket_error::success;
+  auto number_of_bytes_sent = 0_z;
+  for (auto index = 0_z; index < buffers.size();) {
+    native_buffers.clear();
+    for (auto buffer_index = index; buffer_index < buffers.size(); ++buffer_index)
+      if (!buffers[buffer_index].empty()) native_buffers.emplace_back(buffers[buffer_index].data(), buffers[buffer_index].size());
+    if (native_buffers.empty()) break;
+    auto count = native::socket::send(data_->handle, native_buffers, 0);
+    if (count == -1 && wait_until_ready_(select_mode::select_write, error)) continue;
+    if (count == -1) throw socket_exception(error, csf_);
+    number_of_bytes_sent += static_cast<size_t>(count);
+    // Skips the buffers that are completely sent, and the part of the next one that is sent.
+    auto remaining = static_cast<size_t>(count);
+    while (index < buffers.size() && remaining >= buffers[index].size())
+      remaining -= buffers[index++].size();
+    if (index < buffers.size()) buffers[index] = buffers[index].subspan(remaining);
+  }
+  return number_of_bytes_sent;
+}
+
+void socket::send_packets_(const std::vector<xtd::net::sockets::send_packets_element>& elements, size_t& bytes_sent) {
+  // Consecutive buffers are gathered, and sent with one system call when a file, an end of packet or the end of the list is reached.
+  auto buffers = std::vector<std::span<const xtd::byte>> {};
+  auto flush = [&] {
+    bytes_sent += send_all_(buffers);
+    buffers.clear();
+  };
+  
+  for (const auto& element : elements) {
+    if (!element.file_path().empty()) {
+      flush();
+      if (!xtd::io::file::exists(element.file_path())) throw xtd::io::file_not_found_exception {csf_};
+      auto count = native::socket::send_file(data_->handle, element.file_path(), static_cast<int64>(element.offset()), element.count() == 0 ? -1 : static_cast<int64>(element.count()));
+      if (count == -1) throw socket_exception(get_last_error_(), csf_);
+      bytes_sent += static_cast<size_t>(count);
+    } else if (element.file_stream().has_value()) {
+      flush();
+      auto& stream = element.file_stream()->get();
+      stream.seekg(static_cast<std::streamoff>(element.offset()));
+      auto block = std::vector<xtd::byte>(65536);
+      for (auto remaining = element.count() == 0 ? std::numeric_limits<size_t>::max() : element.count(); remaining != 0 && stream;) {
+        stream.read(reinterpret_cast<char*>(block.data()), static_cast<std::streamsize>(std::min(remaining, block.size())));
+        auto size = static_cast<size_t>(stream.gcount());
+        if (size == 0) break;
+        buffers = {std::span<const xtd::byte> {block.data(), size}};
+        flush();
+        remaining -= size;
+      }
+    } else {
+      const auto& buffer = element.buffer();
+      if (element.offset() > buffer.size() || element.count() > buffer.size() - element.offset()) throw argument_out_of_range_exception {csf_};
+      buffers.push_back(std::span<const xtd::byte> {buffer}.subspan(element.offset(), element.count() == 0 ? buffer.size() - element.offset() : element.count()));
+      if (element.end_of_packet()) flush();
+    }
+  }
+  flush();
+}
+
+bool socket::wait_until_ready_(xtd::net::sockets::select_mode mode, xtd::net::sockets::socket_error& error) {
+  error = get_last_error_();
+  // A socket set non-blocking by the user reports that the operation would block, and an operation attempted by the I/O engine waits for the next readiness event.
+  if (!data_->will_block || !data_->is_native_non_blocking || attempting_operation || !is_would_block(error)) return false;
+  auto timeout = mode == select_mode::select_read ? receive_timeout() : send_timeout();
+  auto result = native::socket::poll(data_->handle, timeout <= 0 || timeout > std::numeric_limits<int32>::max() / 1000 ? -1 : timeout * 1000, static_cast<int32>(mode));
+  if (result == -1) error = get_last_error_();
+  if (result == 0) error = socket_error::timed_out;
+  return result == 1;
+}
+
 socket_error socket::get_last_error_() {
   return static_cast<socket_error>(native::socket::get_last_error());
 }
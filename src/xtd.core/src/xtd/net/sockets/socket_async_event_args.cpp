@@ -22,6 +22,32 @@ std::vector<xtd::byte>& socket_async_event_args::buffer() noexcept {
   return buffer_;
 }
 
+size_t socket_async_event_args::bytes_transferred() const noexcept {
+  return bytes_transferred_;
+}
+
+const std::vector<send_packets_element>& socket_async_event_args::send_packets_elements() const noexcept {
+  return send_packets_elements_;
+}
+
+socket_async_event_args& socket_async_event_args::send_packets_elements(const std::vector<send_packets_element>& value) {
+  send_packets_elements_ = value;
+  return *this;
+}
+
+transmit_file_options socket_async_event_args::send_packets_flags() const noexcept {
+  return send_packets_flags_;
+}
+
+socket_async_event_args& socket_async_event_args::send_packets_flags(transmit_file_options value) noexcept {
+  send_packets_flags_ = value;
+  return *this;
+}
+
+xtd::net::sockets::socket_error socket_async_event_args::socket_error() const noexcept {
+  return socket_error_;
+}
+
 void socket_async_event_args::set_buffer(const std::vector<xtd::byte>& memory_buffer) {
   memory_buffer_ = memory_buffer;
 }
@@ -0,0 +1,247 @@
+#include "socket_io_engine.h"
+#include "../../../../include/xtd/as.h"
+#include "../../../../include/xtd/environment.h"
+#include "../../../../include/xtd/threading/thread_pool.h"
+#define __XTD_CORE_NATIVE_LIBRARY__
+#include <xtd/native/select_mode_constants>
+#include <xtd/native/socket>
+#include <xtd/native/socket_poller>
+#include <xtd/native/socket_poller_constants>
+#undef __XTD_CORE_NATIVE_LIBRARY__
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <iterator>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+using namespace xtd;
+using namespace xtd::net::sockets;
+using namespace xtd::threading;
+
+namespace {
+  constexpr size_t max_events = 256;
+  // Without a poller, a waiting thread checks for the end of the engine at this interval.
+  constexpr int32 wait_without_poller_timeout = 100'000;
+  constexpr int32 read_events = SOCKET_POLLER_EVENT_READ | SOCKET_POLLER_EVENT_ERROR | SOCKET_POLLER_EVENT_HANG_UP;
+  constexpr int32 write_events = SOCKET_POLLER_EVENT_WRITE | SOCKET_POLLER_EVENT_ERROR | SOCKET_POLLER_EVENT_HANG_UP;
+  
+  struct pending_operations {
+    std::deque<socket_io_engine::operation> reads;
+    std::deque<socket_io_engine::operation> writes;
+    
+    bool empty() const noexcept {return reads.empty() && writes.empty();}
+    int32 events() const noexcept {return (reads.empty() ? 0 : SOCKET_POLLER_EVENT_READ) | (writes.empty() ? 0 : SOCKET_POLLER_EVENT_WRITE);}
+  };
+  
+  std::atomic<bool> started = false;
+}
+
+struct socket_io_engine::ready_operation {
+  intptr handle = 0;
+  // The direction the operation waits for, or 0 if it does not wait for a readiness event.
+  int32 events = 0;
+  socket_io_engine::operation operation;
+};
+
+struct socket_io_engine::static_data {
+  static_data() {
+    completion_thread = std::thread {[this] {socket_io_engine::complete_refused_operations(*this);}};
+    poller = native::socket_poller::create();
+    if (poller == -1) return;
+    auto thread_count = std::clamp(as<size_t>(environment::processor_count()) / 4, 1_z, 4_z);
+    for (auto index = 0_z; index < thread_count; ++index)
+      threads.emplace_back([this] {socket_io_engine::run(*this);});
+    started = true;
+  }
+  
+  ~static_data() {socket_io_engine::stop(*this);}
+  
+  std::mutex sync_root;
+  std::unordered_map<intptr, pending_operations> operations;
+  intmax_t poller = -1;
+  std::atomic<bool> closed = false;
+  std::vector<std::thread> threads;
+  
+  std::mutex ready_sync_root;
+  std::condition_variable ready_condition;
+  std::deque<ready_operation> ready_operations;
+  // The number of ready operations that the thread pool refused, and that the completion thread completes.
+  size_t refused_count = 0;
+  // The number of threads that wait for a socket because the poller could not be created.
+  size_t waiting_count = 0;
+  std::thread completion_thread;
+};
+
+void socket_io_engine::begin_read(intptr handle, operation operation) {
+  begin_operation(handle, SOCKET_POLLER_EVENT_READ, std::move(operation), false);
+}
+
+void socket_io_engine::begin_write(intptr handle, operation operation) {
+  begin_operation(handle, SOCKET_POLLER_EVENT_WRITE, std::move(operation), false);
+}
+
+std::vector<socket_io_engine::operation> socket_io_engine::cancel(intptr handle) {
+  auto result = std::vector<operation> {};
+  if (!started) return result;
+  auto& data = get_static_data();
+  auto lock = std::lock_guard<std::mutex> {data.sync_root};
+  auto iterator = data.operations.find(handle);
+  if (iterator == data.operations.end()) return result;
+  std::move(iterator->second.reads.begin(), iterator->second.reads.end(), std::back_inserter(result));
+  std::move(iterator->second.writes.begin(), iterator->second.writes.end(), std::back_inserter(result));
+  data.operations.erase(iterator);
+  native::socket_poller::remove(data.poller, handle);
+  return result;
+}
+
+void socket_io_engine::dispatch(operation operation) {
+  dispatch(get_static_data(), ready_operation {0, 0, std::move(operation)});
+}
+
+void socket_io_engine::begin_operation(intptr handle, int32 events, operation operation, bool first) {
+  auto& data = get_static_data();
+  if (data.poller == -1) {
+    wait_without_poller(data, ready_operation {handle, events, std::move(operation)});
+    return;
+  }
+  
+  {
+    auto lock = std::lock_guard<std::mutex> {data.sync_root};
+    auto [iterator, inserted] = data.operations.try_emplace(handle);
+    auto& operations = iterator->second;
+    auto& queue = events == SOCKET_POLLER_EVENT_READ ? operations.reads : operations.writes;
+    // An operation that would have blocked keeps its place before the operations queued after it.
+    if (first) queue.push_front(std::move(operation));
+    else queue.push_back(std::move(operation));
+    // The sockets are registered in one-shot mode : each event is reported to only one I/O thread, which rearms the socket if operations are still pending.
+    if (inserted ? native::socket_poller::add(data.poller, handle, operations.events(), SOCKET_POLLER_MODE_ONE_SHOT) : native::socket_poller::modify(data.poller, handle, operations.events(), SOCKET_POLLER_MODE_ONE_SHOT)) return;
+    operation = std::move(first ? queue.front() : queue.back());
+    if (first) queue.pop_front();
+    else queue.pop_back();
+    if (operations.empty()) data.operations.erase(iterator);
+  }
+  // The socket cannot be polled (it is probably closed) : the operation is attempted now and reports the error.
+  dispatch(data, ready_operation {handle, 0, std::move(operation)});
+}
+
+void socket_io_engine::complete_ready_operation(static_data& data) {
+  auto ready_operation = socket_io_engine::ready_operation {};
+  {
+    auto lock = std::lock_guard<std::mutex> {data.ready_sync_root};
+    if (data.ready_operations.empty()) return;
+    ready_operation = std::move(data.ready_operations.front());
+    data.ready_operations.pop_front();
+  }
+  if (ready_operation.operation()) return;
+  // The readiness event was spurious, or another operation took the data first : the operation waits for the next event.
+  if (ready_operation.events != 0) begin_operation(ready_operation.handle, ready_operation.events, std::move(ready_operation.operation), true);
+  else dispatch(data, std::move(ready_operation));
+}
+
+void socket_io_engine::complete_refused_operations(static_data& data) {
+  while (true) {
+    {
+      auto lock = std::unique_lock<std::mutex> {data.ready_sync_root};
+      data.ready_condition.wait(lock, [&] {return data.refused_count != 0 || data.closed;});
+      if (data.refused_count == 0) return;
+      --data.refused_count;
+    }
+    complete_ready_operation(data);
+  }
+}
+
+void socket_io_engine::dispatch(static_data& data, ready_operation&& ready_operation) {
+  {
+    auto lock = std::lock_guard<std::mutex> {data.ready_sync_root};
+    data.ready_operations.push_back(std::move(ready_operation));
+  }
+  // Each work item completes the oldest ready operation. The thread pool refuses new items when all its threads are busy : the completion thread then completes the operation, so that it never runs on an I/O thread or on the calling thread.
+  if (thread_pool::queue_user_work_item([&data](std::any) {socket_io_engine::complete_ready_operation(data);})) return;
+  {
+    auto lock = std::lock_guard<std::mutex> {data.ready_sync_root};
+    ++data.refused_count;
+  }
+  data.ready_condition.notify_one();
+}
+
+socket_io_engine::static_data& socket_io_engine::get_static_data() {
+  static auto data = static_data {};
+  return data;
+}
+
+void socket_io_engine::run(static_data& data) {
+  auto handles = std::vector<intmax_t>(max_events);
+  auto events = std::vector<int32>(max_events);
+  auto ready_operations = std::vector<ready_operation> {};
+  while (!data.closed) {
+    auto count = native::socket_poller::wait(data.poller, handles, events, -1);
+    if (count < 0) break;
+    {
+      auto lock = std::lock_guard<std::mutex> {data.sync_root};
+      for (auto index = 0; index < count; ++index) {
+        auto handle = as<intptr>(handles[index]);
+        auto iterator = data.operations.find(handle);
+        if (iterator == data.operations.end()) continue;
+        auto& operations = iterator->second;
+        if ((events[index] & read_events) != 0 && !operations.reads.empty()) {
+          ready_operations.push_back(ready_operation {handle, SOCKET_POLLER_EVENT_READ, std::move(operations.reads.front())});
+          operations.reads.pop_front();
+        }
+        if ((events[index] & write_events) != 0 && !operations.writes.empty()) {
+          ready_operations.push_back(ready_operation {handle, SOCKET_POLLER_EVENT_WRITE, std::move(operations.writes.front())});
+          operations.writes.pop_front();
+        }
+        if (!operations.empty() && native::socket_poller::modify(data.poller, handles[index], operations.events(), SOCKET_POLLER_MODE_ONE_SHOT)) continue;
+        for (auto& operation : operations.reads)
+          ready_operations.push_back(ready_operation {handle, 0, std::move(operation)});
+        for (auto& operation : operations.writes)
+          ready_operations.push_back(ready_operation {handle, 0, std::move(operation)});
+        native::socket_poller::remove(data.poller, handles[index]);
+        data.operations.erase(iterator);
+      }
+    }
+    for (auto& ready_operation : ready_operations)
+      dispatch(data, std::move(ready_operation));
+    ready_operations.clear();
+  }
+}
+
+void socket_io_engine::stop(static_data& data) {
+  started = false;
+  data.closed = true;
+  if (data.poller != -1) native::socket_poller::interrupt(data.poller);
+  for (auto& thread : data.threads)
+    if (thread.joinable()) thread.join();
+  {
+    auto lock = std::unique_lock<std::mutex> {data.ready_sync_root};
+    data.ready_condition.notify_all();
+    data.ready_condition.wait(lock, [&] {return data.waiting_count == 0;});
+  }
+  if (data.completion_thread.joinable()) data.completion_thread.join();
+  if (data.poller != -1) native::socket_poller::destroy(data.poller);
+}
+
+void socket_io_engine::wait_without_poller(static_data& data, ready_operation&& ready_operation) {
+  // The operation would block and nothing reports when the socket is ready : a dedicated thread waits for it, instead of attempting the operation again and again on the thread pool.
+  {
+    auto lock = std::lock_guard<std::mutex> {data.ready_sync_root};
+    ++data.waiting_count;
+  }
+  std::thread {[&data, ready_operation = std::move(ready_operation)]() mutable {
+    auto mode = ready_operation.events == SOCKET_POLLER_EVENT_READ ? SELECT_MODE_READ : SELECT_MODE_WRITE;
+    auto result = 0;
+    while (!data.closed && (result = native::socket::poll(ready_operation.handle, wait_without_poller_timeout, mode)) == 0);
+    // The socket is ready, or it cannot be waited for (it is probably closed) : the operation is attempted and reports the error.
+    if (!data.closed) {
+      if (result != 1) ready_operation.events = 0;
+      dispatch(data, std::move(ready_operation));
+    }
+    auto lock = std::lock_guard<std::mutex> {data.ready_sync_root};
+    --data.waiting_count;
+    data.ready_condition.notify_all();
+  }}.detach();
+}
@@ -0,0 +1,41 @@
+#pragma once
+#include "../../../../include/xtd/types.h"
+#include <functional>
+#include <vector>
+
+namespace xtd {
+  namespace net {
+    namespace sockets {
+      // Completes the asynchronous socket operations from readiness events : a small fixed number of I/O threads wait on one poller for all the sockets with pending operations.
+      // When a socket is ready, its next pending operation for that direction is queued for the thread pool, which attempts the operation and calls the user callback. The I/O threads never run an operation.
+      // If the poller cannot be created, each operation that would block waits for its socket on a dedicated thread.
+      class socket_io_engine {
+      public:
+        // Attempts the operation on the non-blocking socket. Returns false if the operation would block : it then waits for the next readiness event, before the other pending operations of that direction.
+        using operation = std::function<bool()>;
+        
+        socket_io_engine() = delete;
+        
+        static void begin_read(intptr handle, operation operation);
+        static void begin_write(intptr handle, operation operation);
+        // Removes the socket and returns its pending operations. Must be called before the socket is closed ; the operations are dispatched after, so that they complete with an error.
+        static std::vector<operation> cancel(intptr handle);
+        // Queues an operation that does not wait for a readiness event.
+        static void dispatch(operation operation);
+      
+      private:
+        struct ready_operation;
+        struct static_data;
+        
+        static void begin_operation(intptr handle, int32 events, operation operation, bool first);
+        static void complete_ready_operation(static_data& data);
+        static void complete_refused_operations(static_data& data);
+        static void dispatch(static_data& data, ready_operation&& ready_operation);
+        static static_data& get_static_data();
+        static void run(static_data& data);
+        static void stop(static_data& data);
+        static void wait_without_poller(static_data& data, ready_operation&& ready_operation);
+      };
+    }
+  }
+}
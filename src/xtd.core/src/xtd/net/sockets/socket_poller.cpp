@@ -0,0 +1,146 @@
+#include "../../../../include/xtd/net/sockets/socket_poller.h"
+#include "../../../../include/xtd/net/sockets/socket_exception.h"
+#include "../../../../include/xtd/argument_exception.h"
+#include "../../../../include/xtd/as.h"
+#include "../../../../include/xtd/object_closed_exception.h"
+#define __XTD_CORE_NATIVE_LIBRARY__
+#include <xtd/native/socket>
+#include <xtd/native/socket_poller>
+#include <xtd/native/socket_poller_constants>
+#undef __XTD_CORE_NATIVE_LIBRARY__
+#include <map>
+#include <mutex>
+
+using namespace xtd;
+using namespace xtd::net;
+using namespace xtd::net::sockets;
+
+namespace {
+  int32 to_native_events(socket_poller_events events) {
+    auto result = 0;
+    if ((events & socket_poller_events::read) == socket_poller_events::read) result |= SOCKET_POLLER_EVENT_READ;
+    if ((events & socket_poller_events::write) == socket_poller_events::write) result |= SOCKET_POLLER_EVENT_WRITE;
+    if ((events & socket_poller_events::error) == socket_poller_events::error) result |= SOCKET_POLLER_EVENT_ERROR;
+    if ((events & socket_poller_events::hang_up) == socket_poller_events::hang_up) result |= SOCKET_POLLER_EVENT_HANG_UP;
+    return result;
+  }
+  
+  socket_poller_events to_socket_poller_events(int32 events) {
+    auto result = socket_poller_events::none;
+    if ((events & SOCKET_POLLER_EVENT_READ) != 0) result |= socket_poller_events::read;
+    if ((events & SOCKET_POLLER_EVENT_WRITE) != 0) result |= socket_poller_events::write;
+    if ((events & SOCKET_POLLER_EVENT_ERROR) != 0) result |= socket_poller_events::error;
+    if ((events & SOCKET_POLLER_EVENT_HANG_UP) != 0) result |= socket_poller_events::hang_up;
+    return result;
+  }
+  
+  int32 to_native_mode(socket_poller_mode mode) {
+    return mode == socket_poller_mode::edge_triggered ? SOCKET_POLLER_MODE_EDGE_TRIGGERED : SOCKET_POLLER_MODE_LEVEL_TRIGGERED;
+  }
+}
+
+struct socket_poller::data {
+  ~data() {
+    if (poller != -1) native::socket_poller::destroy(poller);
+  }
+  
+  intmax_t poller = -1;
+  bool closed = false;
+  // The threads blocked in wait still use the native poller : when close is called meanwhile, the last of them destroys it.
+  size_t waiter_count = 0;
+  mutable std::mutex sync_root;
+  std::map<intptr, xtd::net::sockets::socket> sockets;
+};
+
+socket_poller::socket_poller() : data_(xtd::new_sptr<data>()) {
+  data_->poller = native::socket_poller::create();
+  if (data_->poller == -1) throw socket_exception(static_cast<socket_error>(native::socket::get_last_error()), csf_);
+}
+
+socket_poller::~socket_poller() {
+  if (data_.use_count() == 1) close();
+}
+
+size_t socket_poller::count() const noexcept {
+  auto lock = std::lock_guard<std::mutex> {data_->sync_root};
+  return data_->sockets.size();
+}
+
+void socket_poller::add(const xtd::net::sockets::socket& socket, socket_poller_events events) {
+  add(socket, events, socket_poller_mode::level_triggered);
+}
+
+void socket_poller::add(const xtd::net::sockets::socket& socket, socket_poller_events events, socket_poller_mode mode) {
+  if (socket.handle() == 0) throw object_closed_exception {csf_};
+  auto lock = std::lock_guard<std::mutex> {data_->sync_root};
+  if (data_->closed) throw object_closed_exception {csf_};
+  if (data_->sockets.find(socket.handle()) != data_->sockets.end()) throw argument_exception {csf_};
+  if (!native::socket_poller::add(data_->poller, socket.handle(), to_native_events(events), to_native_mode(mode))) throw socket_exception(static_cast<socket_error>(native::socket::get_last_error()), csf_);
+  data_->sockets.emplace(socket.handle(), socket);
+}
+
+void socket_poller::close() {
+  auto lock = std::lock_guard<std::mutex> {data_->sync_root};
+  if (data_->closed) return;
+  data_->closed = true;
+  data_->sockets.clear();
+  if (data_->waiter_count != 0) native::socket_poller::interrupt(data_->poller);
+  else {
+    native::socket_poller::destroy(data_->poller);
+    data_->poller = -1;
+  }
+}
+
+void socket_poller::modify(const xtd::net::sockets::socket& socket, socket_poller_events events) {
+  modify(socket, events, socket_poller_mode::level_triggered);
+}
+
+void socket_poller::modify(const xtd::net::sockets::socket& socket, socket_poller_events events, socket_poller_mode mode) {
+  auto lock = std::lock_guard<std::mutex> {data_->sync_root};
+  if (data_->closed) throw object_closed_exception {csf_};
+  if (data_->sockets.find(socket.handle()) == data_->sockets.end()) throw argument_exception {csf_};
+  if (!native::socket_poller::modify(data_->poller, socket.handle(), to_native_events(events), to_native_mode(mode))) throw socket_exception(static_cast<socket_error>(native::socket::get_last_error()), csf_);
+}
+
+bool socket_poller::remove(const xtd::net::sockets::socket& socket) {
+  auto lock = std::lock_guard<std::mutex> {data_->sync_root};
+  if (data_->closed) throw object_closed_exception {csf_};
+  auto iterator = data_->sockets.find(socket.handle());
+  if (iterator == data_->sockets.end()) return false;
+  native::socket_poller::remove(data_->poller, iterator->first);
+  data_->sockets.erase(iterator);
+  return true;
+}
+
+size_t socket_poller::wait(std::vector<ready_socket>& ready_sockets, int32 milliseconds_timeout) {
+  thread_local auto handles = std::vector<intmax_t> {};
+  thread_local auto events = std::vector<int32> {};
+  ready_sockets.clear();
+  // The data is kept alive by this copy if the last socket_poller is destroyed while waiting.
+  auto data = data_;
+  auto poller = intmax_t {-1};
+  {
+    auto lock = std::lock_guard<std::mutex> {data->sync_root};
+    if (data->closed) throw object_closed_exception {csf_};
+    poller = data->poller;
+    ++data->waiter_count;
+  }
+  
+  handles.resize(max_ready_sockets);
+  auto count = native::socket_poller::wait(poller, handles, events, milliseconds_timeout);
+  auto error = count < 0 ? native::socket::get_last_error() : 0;
+  
+  auto lock = std::lock_guard<std::mutex> {data->sync_root};
+  if (--data->waiter_count == 0 && data->closed && data->poller != -1) {
+    native::socket_poller::destroy(data->poller);
+    data->poller = -1;
+  }
+  if (data->closed) return 0;
+  if (count < 0) throw socket_exception(static_cast<socket_error>(error), csf_);
+  for (auto index = 0; index < count; ++index) {
+    auto iterator = data->sockets.find(as<intptr>(handles[index]));
+    if (iterator == data->sockets.end()) continue;
+    ready_sockets.push_back({iterator->second, to_socket_poller_events(events[index])});
+  }
+  return ready_sockets.size();
+}
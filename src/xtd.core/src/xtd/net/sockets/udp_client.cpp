@@ -4,17 +4,40 @@
 #include "../../../../include/xtd/net/dns.h"
 #include "../../../../include/xtd/as.h"
 #include "../../../../include/xtd/is.h"
+#include "../../../../include/xtd/object_closed_exception.h"
+#define __XTD_CORE_NATIVE_LIBRARY__
+#include <xtd/native/socket>
+#undef __XTD_CORE_NATIVE_LIBRARY__
+#include <algorithm>
+#include <limits>
 #include <thread>
 
 using namespace xtd;
 using namespace xtd::net;
 using namespace xtd::net::sockets;
 
+namespace {
+  // The client socket stays non-blocking after an asynchronous operation : a blocking client then waits for the socket to be ready, until its timeout expires.
+  bool wait_until_ready(socket& client_socket, socket_error error, select_mode mode) {
+    if (error != socket_error::would_block || !client_socket.blocking()) return false;
+    auto timeout = mode == select_mode::select_read ? client_socket.receive_timeout() : client_socket.send_timeout();
+    return client_socket.poll(timeout <= 0 || timeout > std::numeric_limits<int32>::max() / 1000 ? -1 : timeout * 1000, mode);
+  }
+}
+
 struct udp_client::data {
   //static constexpr size_t max_udp_size = 0x10000;
   socket client_socket {address_family::inter_network, socket_type::dgram, protocol_type::udp};
   bool active = false;
   std::vector<xtd::byte> buffer = std::vector<xtd::byte>(0x10000);
+  bool receive_offload = false;
+  // Batch storage, reused from one call to the next so that receive_batch and send_batch do not allocate.
+  std::vector<std::pair<xtd::byte*, size_t>> receive_buffers;
+  std::vector<std::pair<xtd::byte*, size_t>> receive_socket_addresses;
+  std::vector<std::vector<xtd::byte>> received_socket_addresses;
+  std::vector<std::pair<size_t, size_t>> received_sizes;
+  std::vector<std::pair<const xtd::byte*, size_t>> send_buffers;
+  std::vector<std::pair<const xtd::byte*, size_t>> send_socket_addresses;
 };
 
 udp_client::udp_client() : data_(xtd::new_sptr<udp_client::data>()) {
@@ -98,6 +121,16 @@ udp_client& udp_client::multicast_loopback(bool value) {
   return *this;
 }
 
+bool udp_client::receive_offload() const noexcept {
+  return data_->receive_offload;
+}
+
+udp_client& udp_client::receive_offload(bool value) {
+  if (data_->client_socket.handle() == 0) throw object_closed_exception {csf_};
+  if (native::socket::set_receive_offload(data_->client_socket.handle(), value)) data_->receive_offload = value;
+  return *this;
+}
+
 xtd::byte udp_client::ttl() const {
   return data_->client_socket.ttl();
 }
@@ -252,6 +285,42 @@ std::vector<xtd::byte> udp_client::receive(ip_end_point& remote_end_point) {
   return std::vector<xtd::byte>(data_->buffer.begin(), data_->buffer.begin() + received);
 }
 
+size_t udp_client::receive_batch(std::span<datagram_buffer> datagrams) {
+  if (data_->client_socket.handle() == 0) throw object_closed_exception {csf_};
+  if (datagrams.empty()) return 0;
+  
+  // Same sizes as the serialized ip_end_point : sockaddr_in or sockaddr_in6.
+  auto socket_address_size = data_->client_socket.address_family() == address_family::inter_network_v6 ? 28_z : 16_z;
+  if (data_->received_socket_addresses.size() < datagrams.size()) data_->received_socket_addresses.resize(datagrams.size());
+  data_->receive_buffers.clear();
+  data_->receive_socket_addresses.clear();
+  for (auto index = 0_z; index < datagrams.size(); ++index) {
+    auto& socket_address = data_->received_socket_addresses[index];
+    socket_address.resize(socket_address_size);
+    data_->receive_buffers.push_back({datagrams[index].buffer_.data(), datagrams[index].buffer_.size()});
+    data_->receive_socket_addresses.push_back({socket_address.data(), socket_address.size()});
+  }
+  
+  auto count = native::socket::receive_from(data_->client_socket.handle(), data_->receive_buffers, data_->receive_socket_addresses, data_->received_sizes, static_cast<int32>(socket_flags::none));
+  while (count == -1 && wait_until_ready(data_->client_socket, static_cast<socket_error>(native::socket::get_last_error()), select_mode::select_read))
+    count = native::socket::receive_from(data_->client_socket.handle(), data_->receive_buffers, data_->receive_socket_addresses, data_->received_sizes, static_cast<int32>(socket_flags::none));
+  if (count == -1) throw socket_exception(static_cast<socket_error>(native::socket::get_last_error()), csf_);
+  
+  for (auto index = 0_z; index < static_cast<size_t>(count); ++index) {
+    auto& datagram = datagrams[index];
+    datagram.truncated_ = data_->received_sizes[index].first > datagram.buffer_.size();
+    datagram.size_ = std::min(data_->received_sizes[index].first, datagram.buffer_.size());
+    datagram.segment_size_ = std::min(data_->received_sizes[index].second, datagram.size_);
+    // The remote end point is only decoded when the sender changes.
+    auto& socket_address = data_->received_socket_addresses[index];
+    if (datagram.socket_address_ == socket_address) continue;
+    datagram.socket_address_ = socket_address;
+    auto any_end_point = ip_end_point(data_->client_socket.address_family() == address_family::inter_network_v6 ? ip_address::ip_v6_any : ip_address::any, 0);
+    datagram.remote_end_point_ = static_cast<const ip_end_point&>(*any_end_point.create(xtd::net::socket_address {socket_address}));
+  }
+  return static_cast<size_t>(count);
+}
+
 size_t udp_client::send(const std::vector<xtd::byte>& dgram, size_t bytes, const string& hostname, uint16 port) {
   if (hostname != ip_address::broadcast.to_string()) return data_->client_socket.send_to(dgram, 0, bytes, socket_flags::none, ip_end_point(dns::get_host_addresses(hostname)[0], port));
   data_->client_socket.enable_broadcast(true);
@@ -267,6 +336,28 @@ size_t udp_client::send(const std::vector<xtd::byte>& dgram, size_t bytes) {
   return data_->client_socket.send(dgram, 0, bytes, socket_flags::none);
 }
 
+size_t udp_client::send_batch(std::span<const datagram_buffer> datagrams) {
+  if (data_->client_socket.handle() == 0) throw object_closed_exception {csf_};
+  
+  auto bytes_sent = 0_z;
+  data_->send_buffers.clear();
+  data_->send_socket_addresses.clear();
+  for (const auto& datagram : datagrams) {
+    data_->send_buffers.push_back({datagram.buffer_.data(), datagram.size_});
+    data_->send_socket_addresses.push_back({datagram.socket_address_.empty() ? nullptr : datagram.socket_address_.data(), datagram.socket_address_.size()});
+    bytes_sent += datagram.size_;
+  }
+  
+  while (!data_->send_buffers.empty()) {
+    auto count = native::socket::send_to(data_->client_socket.handle(), data_->send_buffers, data_->send_socket_addresses, static_cast<int32>(socket_flags::none));
+    if (count == -1 && wait_until_ready(data_->client_socket, static_cast<socket_error>(native::socket::get_last_error()), select_mode::select_write)) continue;
+    if (count == -1) throw socket_exception(static_cast<socket_error>(native::socket::get_last_error()), csf_);
+    data_->send_buffers.erase(data_->send_buffers.begin(), data_->send_buffers.begin() + count);
+    data_->send_socket_addresses.erase(data_->send_socket_addresses.begin(), data_->send_socket_addresses.begin() + count);
+  }
+  return bytes_sent;
+}
+
 bool udp_client::active() const noexcept {
   return data_->active;
 }
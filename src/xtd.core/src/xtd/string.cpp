@@ -2,6 +2,10 @@
 #include <xtd/native/types>
 #undef __XTD_CORE_NATIVE_LIBRARY__
 #include "../../include/xtd/string.h"
+#define __XTD_CORE_INTERNAL__
+#include "../../include/xtd/internal/__case_mapping.h"
+#include "../../include/xtd/internal/__char_set.h"
+#undef __XTD_CORE_INTERNAL__
 #include "../../include/xtd/typeof.h"
 #include "../../include/xtd/argument_exception.h"
 #include "../../include/xtd/convert_string.h"
@@ -605,7 +609,7 @@ int32 string::compare(const string& str_a, const string& str_b, bool ignore_case
 
 int32 string::compare(const string& str_a, const string& str_b, xtd::string_comparison comparison_type) noexcept {
   if (comparison_type == xtd::string_comparison::ordinal_ignore_case)
-    return str_a.to_lower().compare(str_b.to_lower());
+    return __xtd_compare_ignore_case(str_a.data(), str_a.size(), str_b.data(), str_b.size());
   return str_a.compare(str_b);
 }
 
@@ -618,10 +622,10 @@ int32 string::compare(const string& str_a, xtd::size index_a, const string& str_
 }
 
 int32 string::compare(const string& str_a, xtd::size index_a, const string& str_b, xtd::size index_b, xtd::size length, xtd::string_comparison comparison_type) noexcept {
-  auto sa = str_a.substr(index_a, length);
-  auto sb = str_b.substr(index_b, length);
+  auto sa = std::basic_string_view<value_type> {str_a}.substr(index_a, length);
+  auto sb = std::basic_string_view<value_type> {str_b}.substr(index_b, length);
   if (comparison_type == xtd::string_comparison::ordinal_ignore_case)
-    return sa.to_lower().compare(sb.to_lower());
+    return __xtd_compare_ignore_case(sa.data(), sa.size(), sb.data(), sb.size());
   return sa.compare(sb);
 }
 
@@ -724,12 +728,12 @@ bool string::equals(const string& value) const noexcept {
 }
 
 bool string::equals(const string& value, bool ignore_case) const noexcept {
-  if (ignore_case) return to_lower().compare_to(value.to_lower()) == 0;
+  if (ignore_case) return __xtd_compare_ignore_case(data(), size(), value.data(), value.size()) == 0;
   return compare_to(value) == 0;
 }
 
 bool string::ends_with(value_type value) const noexcept {
-  return rfind(value) == size() - 1;
+  return !empty() && back() == value;
 }
 
 #if defined(__xtd__cpp_lib_char8_t)
@@ -764,8 +768,8 @@ bool string::ends_with(const string& value, bool ignore_case) const noexcept {
 
 bool string::ends_with(const string& value, xtd::string_comparison comparison_type) const noexcept {
   if (comparison_type == xtd::string_comparison::ordinal_ignore_case)
-    return to_lower().rfind(value.to_lower()) + value.to_lower().size() == size();
-  return rfind(value) + value.size() == size();
+    return __xtd_ends_with_ignore_case(data(), size(), value.data(), value.size());
+  return size() >= value.size() && compare(size() - value.size(), value.size(), value) == 0;
 }
 
 string string::full_class_name(const std::type_info& info) {
@@ -811,25 +815,21 @@ xtd::size string::index_of_any(const std::vector<value_type>& values, xtd::size
 }
 
 xtd::size string::index_of_any(const std::vector<value_type>& values, xtd::size start_index, xtd::size count) const noexcept {
-  auto index = 0_z;
-  for (const auto& item : *this) {
-    if (index++ < start_index) continue;
-    if (index - 1 > start_index + count) break;
-    if (std::find(values.begin(), values.end(), item) != values.end()) return index - 1;
-  }
-  return npos;
+  if (start_index >= size()) return npos;
+  return __char_set__<value_type> {values.data(), values.data() + values.size()}.find_first(data(), start_index, std::min(size(), start_index + count + 1));
 }
 
 xtd::size string::index_of_any(const std::initializer_list<value_type>& values) const noexcept {
-  return index_of_any(std::vector<value_type>(values));
+  return index_of_any(values, 0, size());
 }
 
 xtd::size string::index_of_any(const std::initializer_list<value_type>& values, xtd::size start_index) const noexcept {
-  return index_of_any(std::vector<value_type>(values), start_index);
+  return index_of_any(values, start_index, size() - start_index);
 }
 
 xtd::size string::index_of_any(const std::initializer_list<value_type>& values, xtd::size start_index, xtd::size count) const noexcept {
-  return index_of_any(std::vector<value_type>(values), start_index, count);
+  if (start_index >= size()) return npos;
+  return __char_set__<value_type> {values.begin(), values.end()}.find_first(data(), start_index, std::min(size(), start_index + count + 1));
 }
 
 string string::insert(xtd::size start_index, const string& value) const noexcept {
@@ -877,25 +877,21 @@ xtd::size string::last_index_of_any(const std::vector<value_type>& values, xtd::
 }
 
 xtd::size string::last_index_of_any(const std::vector<value_type>& values, xtd::size start_index, xtd::size count) const noexcept {
-  auto index = size() - 1;
-  for (const_reverse_iterator it = crbegin(); it != crend(); ++it) {
-    if (index-- > start_index + count) continue;
-    if (index + 1 < start_index) break;
-    if (std::find(values.begin(), values.end(), *it) != values.end()) return index + 1;
-  }
-  return npos;
+  if (start_index >= size()) return npos;
+  return __char_set__<value_type> {values.data(), values.data() + values.size()}.find_last(data(), start_index, std::min(size(), start_index + count + 1));
 }
 
 xtd::size string::last_index_of_any(const std::initializer_list<value_type>& values) const noexcept {
-  return last_index_of_any(std::vector<value_type>(values));
+  return last_index_of_any(values, 0, size());
 }
 
 xtd::size string::last_index_of_any(const std::initializer_list<value_type>& values, xtd::size start_index) const noexcept {
-  return last_index_of_any(std::vector<value_type>(values), start_index);
+  return last_index_of_any(values, start_index, size() - start_index);
 }
 
 xtd::size string::last_index_of_any(const std::initializer_list<value_type>& values, xtd::size start_index, xtd::size count) const noexcept {
-  return last_index_of_any(std::vector<value_type>(values), start_index, count);
+  if (start_index >= size()) return npos;
+  return __char_set__<value_type> {values.begin(), values.end()}.find_last(data(), start_index, std::min(size(), start_index + count + 1));
 }
 
 string string::pad_left(xtd::size total_width) const noexcept {
@@ -936,24 +932,25 @@ string string::remove(xtd::size start_index, xtd::size count) const noexcept {
 }
 
 string string::replace(value_type old_char, value_type new_char) const noexcept {
-  return replace(string(1, old_char), string(1, new_char));
+  auto result = *this;
+  for (auto index = result.find(old_char); index != npos; index = result.find(old_char, index + 1))
+    result.basic_string<value_type>::operator [](index) = new_char;
+  return result;
 }
 
 string string::replace(const string& old_string, const string& new_string) const noexcept {
-  auto result = *this;
-  auto old_size = old_string.length();
-  auto new_size = new_string.length();
-  auto index = 0_z;
-  while (true) {
-    index = result.find(old_string, index);
-    if (index == npos) break;
-    if (old_size == new_size) result.replace(index, old_size, new_string);
-    else {
-      result.erase(index, old_string.size());
-      result.basic_string<value_type>::insert(index, new_string);
-    }
-    index += new_string.size();
-  }
+  if (old_string.empty()) return *this;
+  auto index = find(old_string);
+  if (index == npos) return *this;
+  
+  auto result = std::basic_string<value_type> {};
+  auto start_index = 0_z;
+  do {
+    result.append(*this, start_index, index - start_index).append(new_string);
+    start_index = index + old_string.size();
+    index = find(old_string, start_index);
+  } while (index != npos);
+  result.append(*this, start_index);
   return result;
 }
 
@@ -961,20 +958,24 @@ std::vector<string> string::split(const std::vector<value_type>& separators, xtd
   if (count == 0) return {};
   if (count == 1) return {*this};
   
+  const auto& split_char_separators = separators.size() == 0 ? default_split_separators : separators;
+  auto separator_set = __char_set__<value_type> {split_char_separators.data(), split_char_separators.data() + split_char_separators.size()};
   auto list = std::vector<string> {};
-  auto sub_string = string::empty_string;
-  auto split_char_separators = separators.size() == 0 ? default_split_separators : separators;
-  for (auto it = begin(); it != end(); ++it) {
-    auto is_separator = std::find(split_char_separators.begin(), split_char_separators.end(), *it) != split_char_separators.end();
-    if (!is_separator) sub_string.append(string(1, *it));
-    if ((static_cast<xtd::size>(it - begin()) == length() - 1 || is_separator) && (sub_string.length() > 0 || (sub_string.length() == 0 && options != string_split_options::remove_empty_entries))) {
+  auto start_index = 0_z;
+  while (start_index < size()) {
+    auto separator_index = separator_set.find_first(data(), start_index, size());
+    if (separator_index == npos) {
+      list.push_back(substr(start_index));
+      break;
+    }
+    if (separator_index != start_index || options != string_split_options::remove_empty_entries) {
       if (list.size() == count - 1) {
-        list.push_back(sub_string + string(c_str(), it - begin() + (is_separator ? 0 : 1), length() - (it - begin()) + (is_separator ? 0 : 1)));
-        return list;
+        list.push_back(substr(start_index));
+        break;
       }
-      list.push_back(sub_string);
-      sub_string.clear();
+      list.push_back(substr(start_index, separator_index - start_index));
     }
+    start_index = separator_index + 1;
   }
   
   return list;
@@ -1001,8 +1002,9 @@ bool string::starts_with(value_type value) const noexcept {
 }
 
 bool string::starts_with(value_type value, bool ignore_case) const noexcept {
-  if (ignore_case) return to_lower().find(static_cast<value_type>(tolower(value))) == 0;
-  return find(value) == 0;
+  if (empty()) return false;
+  if (ignore_case) return __xtd_fold_code_unit(front()) == __xtd_fold_code_unit(value);
+  return front() == value;
 }
 
 bool string::starts_with(const string& value) const noexcept {
@@ -1010,8 +1012,8 @@ bool string::starts_with(const string& value) const noexcept {
 }
 
 bool string::starts_with(const string& value, bool ignore_case) const noexcept {
-  if (ignore_case) return to_lower().find(value.to_lower()) == 0;
-  return find(value) == 0;
+  if (ignore_case) return __xtd_starts_with_ignore_case(data(), size(), value.data(), value.size());
+  return compare(0, value.size(), value) == 0;
 }
 
 string string::substr(size_type index, size_type count) const {
@@ -1043,8 +1045,8 @@ std::vector<string::value_type> string::to_array(xtd::size start_index, xtd::siz
 }
 
 string string::to_lower() const noexcept {
-  auto result = string::empty_string;
-  std::for_each(begin(), end(), [&](auto c) {result += static_cast<char>(tolower(c));});
+  auto result = std::basic_string<value_type> {};
+  __xtd_append_case_mapped(result, data(), size(), __xtd_case::lower);
   return result;
 }
 
@@ -1060,8 +1062,8 @@ string string::to_string() const noexcept {
 }
 
 string string::to_upper() const noexcept {
-  auto result = string::empty_string;
-  std::for_each(begin(), end(), [&](auto c) {result += static_cast<char>(toupper(c));});
+  auto result = std::basic_string<value_type> {};
+  __xtd_append_case_mapped(result, data(), size(), __xtd_case::upper);
   return result;
 }
 
@@ -1074,7 +1076,10 @@ string string::trim(value_type trim_char) const noexcept {
 }
 
 string string::trim(const std::vector<value_type>& trim_chars) const noexcept {
-  return trim_start(trim_chars).trim_end(trim_chars);
+  auto trim_char_set = __char_set__<value_type> {trim_chars.data(), trim_chars.data() + trim_chars.size()};
+  auto start_index = trim_char_set.skip_first(data(), 0, size());
+  auto end_index = trim_char_set.skip_last(data(), start_index, size());
+  return start_index == 0 && end_index == size() ? *this : substr(start_index, end_index - start_index);
 }
 
 string string::trim_end() const noexcept {
@@ -1086,11 +1091,8 @@ string string::trim_end(value_type trim_char) const noexcept {
 }
 
 string string::trim_end(const std::vector<value_type>& trim_chars) const noexcept {
-  if (!size()) return *this;
-  auto result = *this;
-  while (std::find(trim_chars.begin(), trim_chars.end(), result[result.size() - 1]) != trim_chars.end())
-    result.erase(result.size() - 1, 1);
-  return result;
+  auto end_index = __char_set__<value_type> {trim_chars.data(), trim_chars.data() + trim_chars.size()}.skip_last(data(), 0, size());
+  return end_index == size() ? *this : substr(0, end_index);
 }
 
 string string::trim_start() const noexcept {
@@ -1102,11 +1104,8 @@ string string::trim_start(value_type trim_char) const noexcept {
 }
 
 string string::trim_start(const std::vector<value_type>& trim_chars) const noexcept {
-  if (!size()) return *this;
-  auto result = *this;
-  while (std::find(trim_chars.begin(), trim_chars.end(), result[0]) != trim_chars.end())
-    result.erase(0, 1);
-  return result;
+  auto start_index = __char_set__<value_type> {trim_chars.data(), trim_chars.data() + trim_chars.size()}.skip_first(data(), 0, size());
+  return start_index == 0 ? *this : substr(start_index);
 }
 
 bool string::equals(const string& a, const string& b) noexcept {
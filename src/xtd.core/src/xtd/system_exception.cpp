@@ -67,18 +67,29 @@ const char* system_exception::what() const noexcept {
 }
 
 string system_exception::stack_trace_to_string() const noexcept {
-  if (!stack_trace_) return information_.to_string();
-  
-  auto skip_frames = stack_trace_->frame_count();
-  for (auto index = 0_z; index < stack_trace_->frame_count(); ++index)
-    if (stack_trace_->get_frame(index).get_method().starts_with(name()))
-      skip_frames = index;
-  return stack_trace_->to_string(skip_frames + 1, information_);
+  if (!stack_address_count_) return information_.to_string();
+  try {
+    // Several threads can format the same exception : each one may resolve the frames, but only the first resolved stack trace is kept.
+    auto stack_trace = stack_trace_.load();
+    if (!stack_trace) {
+      auto resolved_stack_trace = xtd::sptr<xtd::diagnostics::stack_trace>(new xtd::diagnostics::stack_trace(std::span<void* const> {stack_addresses_.data(), stack_address_count_}, string::empty_string, 1, true));
+      while (!stack_trace_.compare_exchange_weak(stack_trace, resolved_stack_trace) && !stack_trace);
+      if (!stack_trace) stack_trace = resolved_stack_trace;
+    }
+    
+    auto skip_frames = stack_trace->frame_count();
+    for (auto index = 0_z; index < stack_trace->frame_count(); ++index)
+      if (stack_trace->get_frame(index).get_method().starts_with(name()))
+        skip_frames = index;
+    return stack_trace->to_string(skip_frames + 1, information_);
+  } catch (...) {
+    return information_.to_string();
+  }
 }
 
 system_exception::system_exception(const string& message, const std::exception* inner_exception, const std::error_code& error, const string& help_link, const xtd::diagnostics::stack_frame& information) : message_(message), error_(error), help_link_(help_link), information_(information) {
   if (inner_exception) inner_exception_ = *inner_exception;
-  if (enable_stack_trace_) stack_trace_ = xtd::new_sptr<xtd::diagnostics::stack_trace>(0, true);
+  if (enable_stack_trace_) stack_address_count_ = xtd::diagnostics::stack_trace::get_addresses(0, stack_addresses_);
   //if (!stack_trace_.size()) stack_trace_.push_back(information_.to_string());
 }
 
@@ -0,0 +1,44 @@
+#include "../../../../include/xtd/text/unicode/utf8.h"
+#define __XTD_CORE_INTERNAL__
+#include "../../../../include/xtd/internal/__unicode_transcoding.h"
+#undef __XTD_CORE_INTERNAL__
+
+using namespace xtd;
+using namespace xtd::buffers;
+using namespace xtd::text::unicode;
+
+operation_status utf8::from_utf16(std::span<const char16> source, std::span<char> destination, size& chars_read, size& bytes_written, bool replace_invalid_sequences, bool is_final_block) noexcept {
+  return static_cast<operation_status>(__xtd_transcode(source.data(), source.size(), chars_read, destination.data(), destination.size(), bytes_written, replace_invalid_sequences, is_final_block));
+}
+
+operation_status utf8::from_utf32(std::span<const char32> source, std::span<char> destination, size& chars_read, size& bytes_written, bool replace_invalid_sequences) noexcept {
+  return static_cast<operation_status>(__xtd_transcode(source.data(), source.size(), chars_read, destination.data(), destination.size(), bytes_written, replace_invalid_sequences, true));
+}
+
+size utf8::get_byte_count(std::span<const char16> source) noexcept {
+  return __xtd_transcoded_length<char>(source.data(), source.size());
+}
+
+size utf8::get_byte_count(std::span<const char32> source) noexcept {
+  return __xtd_transcoded_length<char>(source.data(), source.size());
+}
+
+size utf8::get_char16_count(std::span<const char> source) noexcept {
+  return __xtd_transcoded_length<char16>(source.data(), source.size());
+}
+
+size utf8::get_char32_count(std::span<const char> source) noexcept {
+  return __xtd_transcoded_length<char32>(source.data(), source.size());
+}
+
+bool utf8::is_valid(std::span<const char> value) noexcept {
+  return __xtd_is_well_formed(value.data(), value.size());
+}
+
+operation_status utf8::to_utf16(std::span<const char> source, std::span<char16> destination, size& bytes_read, size& chars_written, bool replace_invalid_sequences, bool is_final_block) noexcept {
+  return static_cast<operation_status>(__xtd_transcode(source.data(), source.size(), bytes_read, destination.data(), destination.size(), chars_written, replace_invalid_sequences, is_final_block));
+}
+
+operation_status utf8::to_utf32(std::span<const char> source, std::span<char32> destination, size& bytes_read, size& chars_written, bool replace_invalid_sequences, bool is_final_block) noexcept {
+  return static_cast<operation_status>(__xtd_transcode(source.data(), source.size(), bytes_read, destination.data(), destination.size(), chars_written, replace_invalid_sequences, is_final_block));
+}
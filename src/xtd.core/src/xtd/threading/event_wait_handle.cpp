@@ -96,16 +96,21 @@ bool event_wait_handle::reset() {
   auto io_error = false;
   auto result = data_->event_wait_handle->reset(io_error);
   if (io_error) throw io::io_exception {csf_};
+  data_->is_set = false;
   return result;
 }
 
 bool event_wait_handle::set() {
   if (!data_) throw object_closed_exception {csf_};
-  if (data_->is_set) return true;
+  // A waiter woken by set can reset or destroy the event before set returns : the event is marked set before it is signaled, and the data stays alive until the end of the call.
+  auto data = data_;
+  if (data->is_set.exchange(true)) return true;
   auto io_error = false;
-  auto result = data_->event_wait_handle->set(io_error);
-  if (io_error) throw io::io_exception {csf_};
-  data_->is_set = true;
+  auto result = data->event_wait_handle->set(io_error);
+  if (io_error) {
+    data->is_set = false;
+    throw io::io_exception {csf_};
+  }
   return result;
 }
 
@@ -132,10 +137,19 @@ bool event_wait_handle::wait(int32 milliseconds_timeout) {
   if (result == 0xFFFFFFFF) throw io::io_exception {csf_};
   if (result == 0x00000080) throw abandoned_mutex_exception {csf_};
   if (result == 0x00000102) return false;
-  data_->is_set = false;
+  if (data_->mode == event_reset_mode::auto_reset) data_->is_set = false;
   return true;
 }
 
+bool event_wait_handle::add_waiter(waiter& waiter, size_t index) {
+  if (!data_ || !data_->event_wait_handle) throw object_closed_exception {csf_};
+  return data_->event_wait_handle->add_waiter(waiter, index);
+}
+
+void event_wait_handle::remove_waiter(waiter& waiter, size_t index) {
+  if (data_ && data_->event_wait_handle) data_->event_wait_handle->remove_waiter(waiter, index);
+}
+
 void event_wait_handle::create(bool initial_state, bool& created_new) {
   created_new = true;
   if (data_->name.empty()) {
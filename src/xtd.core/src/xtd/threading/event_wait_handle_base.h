@@ -13,4 +13,6 @@ public:
   virtual bool set(bool& io_error) = 0;
   virtual bool reset(bool& io_error) = 0;
   virtual uint32 wait(int32 milliseconds_timeout) = 0;
+  virtual bool add_waiter(wait_handle::waiter& waiter, size_t index) {return false;}
+  virtual void remove_waiter(wait_handle::waiter& waiter, size_t index) {}
 };
@@ -4,13 +4,13 @@
 #include "../../../include/xtd/threading/mutex.h"
 #include "../../../include/xtd/threading/synchronization_lock_exception.h"
 #include "../../../include/xtd/threading/thread.h"
-#include "../../../include/xtd/threading/thread_local_object.h"
 #include "../../../include/xtd/diagnostics/stopwatch.h"
 #include "../../../include/xtd/not_implemented_exception.h"
 #define __XTD_CORE_NATIVE_LIBRARY__
 #include <xtd/native/condition_variable>
 #include <xtd/native/critical_section>
 #undef __XTD_CORE_NATIVE_LIBRARY__
+#include <array>
 #include <atomic>
 #include <mutex>
 #include <optional>
@@ -21,15 +21,101 @@ using namespace xtd::threading;
 
 struct monitor::item {
   monitor::critical_section critical_section;
-  xtd::sptr<std::atomic<int32>> used_count = xtd::new_sptr<std::atomic<int32>>(0);
-  std::optional<string> name;
-  thread_local_object<intptr> thread_id {[] {return thread::invalid_thread_id;}};
   monitor::condition_variable condition_variable;
+  intptr key = 0;
+  std::optional<string> name;
+  // Number of threads that entered or are trying to enter the monitor; guarded by the stripe mutex.
+  int32 used_count = 0;
+  // Owner thread and its recursion count; only written by the thread that holds the critical section.
+  std::atomic<intptr> thread_id = thread::invalid_thread_id;
+  int32 recursion_count = 0;
+  item* next = nullptr;
 };
 
 struct monitor::static_data {
-  critical_section monitor_items_critical_section;
-  monitor::item_collection monitor_items;
+  // Monitor records are spread over independent stripes selected by a hash of the locked object, so unrelated
+  // locks do not contend on a single process-wide lock. Released records are kept on a per-stripe free list and
+  // reused, so an uncontended enter/exit does not allocate once the stripe is warm.
+  struct alignas(64) stripe {
+    stripe() = default;
+    stripe(const stripe&) = delete;
+    stripe& operator =(const stripe&) = delete;
+    ~stripe() {
+      delete_items(items);
+      delete_items(free_items);
+    }
+    
+    item* acquire(object_ptr obj) {
+      auto result = find(obj.first);
+      if (!result) {
+        if (free_items) {
+          result = free_items;
+          free_items = free_items->next;
+        } else result = new item {};
+        result->key = obj.first;
+        if (obj.second) result->name = *reinterpret_cast<const string*>(obj.first);
+        result->next = items;
+        items = result;
+      }
+      ++result->used_count;
+      return result;
+    }
+    
+    item* find(intptr key) const noexcept {
+      for (auto current = items; current; current = current->next)
+        if (current->key == key) return current;
+      return nullptr;
+    }
+    
+    item* find(const string& name) const noexcept {
+      for (auto current = items; current; current = current->next)
+        if (current->name.has_value() && current->name.value() == name) return current;
+      return nullptr;
+    }
+    
+    void release(item* monitor_item) noexcept {
+      if (--monitor_item->used_count != 0) return;
+      for (auto current = &items; *current; current = &(*current)->next) {
+        if (*current != monitor_item) continue;
+        *current = monitor_item->next;
+        break;
+      }
+      if (monitor_item->name.has_value()) delete reinterpret_cast<const string*>(monitor_item->key);
+      monitor_item->key = 0;
+      monitor_item->name.reset();
+      monitor_item->next = free_items;
+      free_items = monitor_item;
+    }
+    
+    std::mutex mutex;
+    item* items = nullptr;
+    item* free_items = nullptr;
+    
+  private:
+    static void delete_items(item* items) noexcept {
+      while (items) {
+        auto next = items->next;
+        delete items;
+        items = next;
+      }
+    }
+  };
+  
+  static constexpr size_t stripe_count = 64;
+  
+  stripe& get_stripe(intptr key) noexcept {
+    return stripes[(static_cast<uint64>(key) * 0x9E3779B97F4A7C15ull) >> 58];
+  }
+  
+  stripe& get_stripe(const string& name) noexcept {
+    return stripes[name.get_hash_code() % stripe_count];
+  }
+  
+  stripe& get_stripe(object_ptr obj) noexcept {
+    return obj.second ? get_stripe(*reinterpret_cast<const string*>(obj.first)) : get_stripe(obj.first);
+  }
+  
+  std::array<stripe, stripe_count> stripes;
 };
 
 void monitor::enter_ptr(object_ptr obj) {
@@ -43,97 +129,77 @@ void monitor::enter_ptr(object_ptr obj, bool& lock_taken) {
 }
 
 void monitor::exit_ptr(object_ptr obj) {
-  get_static_data().monitor_items_critical_section.enter();
-  if (!is_entered_ptr(obj)) {
-    get_static_data().monitor_items_critical_section.leave();
-    throw synchronization_lock_exception {csf_};
-  }
+  auto& stripe = get_static_data().get_stripe(obj);
+  auto lock = std::lock_guard<std::mutex> {stripe.mutex};
+  auto monitor_item = stripe.find(obj.first);
+  if (monitor_item == nullptr || monitor_item->thread_id != thread::get_current_thread_id()) throw synchronization_lock_exception {csf_};
   
-  item saved;
-  item* monitor_data = &get_static_data().monitor_items[obj.first];
-  if (--(*monitor_data->used_count) == 0) {
-    saved = get_static_data().monitor_items[obj.first];
-    if (obj.second) delete reinterpret_cast<const string*>(obj.first);
-    get_static_data().monitor_items.erase(obj.first);
-    monitor_data = &saved;
-  }
-  monitor_data->thread_id.value(thread::invalid_thread_id);
-  monitor_data->critical_section.leave();
-  get_static_data().monitor_items_critical_section.leave();
+  if (--monitor_item->recursion_count == 0) monitor_item->thread_id = thread::invalid_thread_id;
+  monitor_item->critical_section.leave();
+  stripe.release(monitor_item);
 }
 
 intptr monitor::get_ustring_ptr(const string& str) {
   if (str.empty()) throw argument_exception {csf_};
-  get_static_data().monitor_items_critical_section.enter();
-  auto ptr = reinterpret_cast<intptr>(&str);
-  for (const auto& item : get_static_data().monitor_items)
-    if (item.second.name.has_value() && item.second.name.value() == str) {
-      ptr = item.first;
-      delete &str;
-      break;
-    }
-  get_static_data().monitor_items_critical_section.leave();
-  return ptr;
+  auto& stripe = get_static_data().get_stripe(str);
+  auto lock = std::lock_guard<std::mutex> {stripe.mutex};
+  auto monitor_item = stripe.find(str);
+  if (monitor_item == nullptr) return reinterpret_cast<intptr>(&str);
+  delete &str;
+  return monitor_item->key;
 }
 
 bool monitor::is_entered_ptr(object_ptr obj) noexcept {
-  auto found = get_static_data().monitor_items.find(obj.first) != get_static_data().monitor_items.end();
-  return found;
+  auto& stripe = get_static_data().get_stripe(obj);
+  auto lock = std::lock_guard<std::mutex> {stripe.mutex};
+  return stripe.find(obj.first) != nullptr;
 }
 
 void monitor::pulse_ptr(object_ptr obj) {
-  item* monitor_item = nullptr;
-  get_static_data().monitor_items_critical_section.enter();
-  if (is_entered_ptr(obj)) monitor_item = &get_static_data().monitor_items[obj.first];
-  get_static_data().monitor_items_critical_section.leave();
-  
-  if (monitor_item == nullptr) throw invalid_operation_exception {csf_};
-  if (monitor_item->thread_id.value() != thread::current_thread().thread_id()) throw synchronization_lock_exception {csf_};
-
-  monitor_item->condition_variable.pulse();
+  get_owned_item(obj).condition_variable.pulse();
 }
 
 void monitor::pulse_all_ptr(object_ptr obj) {
-  item* monitor_item = nullptr;
-  get_static_data().monitor_items_critical_section.enter();
-  if (is_entered_ptr(obj)) monitor_item = &get_static_data().monitor_items[obj.first];
-  get_static_data().monitor_items_critical_section.leave();
-  
-  if (monitor_item == nullptr) throw invalid_operation_exception {csf_};
-  if (monitor_item->thread_id.value() != thread::current_thread().thread_id()) throw synchronization_lock_exception {csf_};
-
-  monitor_item->condition_variable.pulse_all();
+  get_owned_item(obj).condition_variable.pulse_all();
 }
 
 bool monitor::try_enter_ptr(object_ptr obj, int32 milliseconds_timeout, bool& lock_taken) noexcept {
   if (milliseconds_timeout < timeout::infinite) return false;
-  get_static_data().monitor_items_critical_section.enter();
-  if (!is_entered_ptr(obj)) {
-    auto i = item {};
-    if (obj.second) {
-      auto str = reinterpret_cast<const string*>(obj.first);
-      i.name = *str;
-    }
-    get_static_data().monitor_items.insert({obj.first, i});
+  auto& stripe = get_static_data().get_stripe(obj);
+  stripe.mutex.lock();
+  auto monitor_item = stripe.acquire(obj);
+  stripe.mutex.unlock();
+  
+  lock_taken = monitor_item->critical_section.try_enter(milliseconds_timeout);
+  if (!lock_taken) {
+    auto lock = std::lock_guard<std::mutex> {stripe.mutex};
+    stripe.release(monitor_item);
+    return false;
   }
-  item* monitor_data = &get_static_data().monitor_items[obj.first];
-  ++(*monitor_data->used_count);
-  get_static_data().monitor_items_critical_section.leave();
-  lock_taken = monitor_data->critical_section.try_enter(milliseconds_timeout);
-  if (lock_taken) monitor_data->thread_id.value(thread::current_thread().thread_id());
-  return lock_taken;
+  if (monitor_item->recursion_count++ == 0) monitor_item->thread_id = thread::get_current_thread_id();
+  return true;
 }
 
 bool monitor::wait_ptr(object_ptr obj, int32 milliseconds_timeout) {
-  item* monitor_item = nullptr;
-  get_static_data().monitor_items_critical_section.enter();
-  if (is_entered_ptr(obj)) monitor_item = &get_static_data().monitor_items[obj.first];
-  get_static_data().monitor_items_critical_section.leave();
+  auto& monitor_item = get_owned_item(obj);
+  auto recursion_count = monitor_item.recursion_count;
+  monitor_item.recursion_count = 0;
+  monitor_item.thread_id = thread::invalid_thread_id;
+  auto result = monitor_item.condition_variable.wait(monitor_item.critical_section, milliseconds_timeout);
+  monitor_item.thread_id = thread::get_current_thread_id();
+  monitor_item.recursion_count = recursion_count;
+  return result;
+}
+
+monitor::item& monitor::get_owned_item(object_ptr obj) {
+  auto& stripe = get_static_data().get_stripe(obj);
+  stripe.mutex.lock();
+  auto monitor_item = stripe.find(obj.first);
+  stripe.mutex.unlock();
   
   if (monitor_item == nullptr) throw invalid_operation_exception {csf_};
-  if (monitor_item->thread_id.value() != thread::current_thread().thread_id()) throw synchronization_lock_exception {csf_};
-
-  return monitor_item->condition_variable.wait(monitor_item->critical_section, milliseconds_timeout);
+  if (monitor_item->thread_id != thread::get_current_thread_id()) throw synchronization_lock_exception {csf_};
+  return *monitor_item;
 }
 
 monitor::static_data& monitor::get_static_data() {
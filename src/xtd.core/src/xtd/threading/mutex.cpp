@@ -136,6 +136,15 @@ bool mutex::wait(int32 milliseconds_timeout) {
   return true;
 }
 
+bool mutex::add_waiter(waiter& waiter, size_t index) {
+  if (!mutex_) throw object_closed_exception {csf_};
+  return mutex_->add_waiter(waiter, index);
+}
+
+void mutex::remove_waiter(waiter& waiter, size_t index) {
+  if (mutex_) mutex_->remove_waiter(waiter, index);
+}
+
 void mutex::create(bool initially_owned, bool& created_new) {
   created_new = true;
   if (name_.empty()) {
@@ -132,6 +132,15 @@ bool semaphore::wait(int32 milliseconds_timeout) {
   return true;
 }
 
+bool semaphore::add_waiter(waiter& waiter, size_t index) {
+  if (!semaphore_) throw object_closed_exception {csf_};
+  return semaphore_->add_waiter(waiter, index);
+}
+
+void semaphore::remove_waiter(waiter& waiter, size_t index) {
+  if (semaphore_) semaphore_->remove_waiter(waiter, index);
+}
+
 void semaphore::create(int32 initial_count, int32 maximum_count, bool& created_new) {
   data_->count.exchange(initial_count);
   data_->maximum_count = maximum_count;
@@ -3,25 +3,147 @@
 #include "../../../include/xtd/as.h"
 #include "../../../include/xtd/environment.h"
 #include "../../../include/xtd/lock.h"
+#include <atomic>
+#include <deque>
+#include <memory>
 #include <mutex>
+#include <utility>
 
 using namespace xtd;
 using namespace xtd::threading;
 
+namespace {
+  // Bounded lock-free multi-producer multi-consumer queue (Dmitry Vyukov's algorithm).
+  // Used as the global injection queue : items queued by threads that are not thread pool workers are dequeued in FIFO order.
+  template<typename item_t>
+  class injection_queue {
+  public:
+    explicit injection_queue(size_t capacity) : mask_(capacity - 1), cells_(std::make_unique<cell[]>(capacity)) {
+      for (auto index = 0_z; index < capacity; ++index)
+        cells_[index].sequence.store(index, std::memory_order_relaxed);
+    }
+    
+    bool try_enqueue(item_t* item) noexcept {
+      auto position = enqueue_position_.load(std::memory_order_relaxed);
+      while (true) {
+        auto& cell = cells_[position & mask_];
+        auto difference = as<ptrdiff>(cell.sequence.load(std::memory_order_acquire)) - as<ptrdiff>(position);
+        if (difference == 0) {
+          if (enqueue_position_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+            cell.item = item;
+            cell.sequence.store(position + 1, std::memory_order_release);
+            return true;
+          }
+        } else if (difference < 0) return false;
+        else position = enqueue_position_.load(std::memory_order_relaxed);
+      }
+    }
+    
+    item_t* try_dequeue() noexcept {
+      auto position = dequeue_position_.load(std::memory_order_relaxed);
+      while (true) {
+        auto& cell = cells_[position & mask_];
+        auto difference = as<ptrdiff>(cell.sequence.load(std::memory_order_acquire)) - as<ptrdiff>(position + 1);
+        if (difference == 0) {
+          if (dequeue_position_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+            auto item = cell.item;
+            cell.sequence.store(position + mask_ + 1, std::memory_order_release);
+            return item;
+          }
+        } else if (difference < 0) return null;
+        else position = dequeue_position_.load(std::memory_order_relaxed);
+      }
+    }
+    
+  private:
+    struct cell {
+      std::atomic<size_t> sequence {0};
+      item_t* item = null;
+    };
+    
+    alignas(64) std::atomic<size_t> enqueue_position_ {0};
+    alignas(64) std::atomic<size_t> dequeue_position_ {0};
+    size_t mask_ = 0;
+    std::unique_ptr<cell[]> cells_;
+  };
+  
+  // Fixed-size Chase-Lev work-stealing deque (Le, Pop, Cohen, Zappa Nardelli, "Correct and Efficient Work-Stealing for Weak Memory Models").
+  // The owner worker pushes and pops at the bottom (LIFO), the other workers steal at the top (FIFO).
+  template<typename item_t>
+  class work_stealing_queue {
+  public:
+    static constexpr size_t capacity = 256;
+    
+    bool try_push(item_t* item) noexcept {
+      auto bottom = bottom_.load(std::memory_order_relaxed);
+      auto top = top_.load(std::memory_order_acquire);
+      if (bottom - top >= as<int64>(capacity)) return false;
+      items_[bottom & mask].store(item, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_release);
+      bottom_.store(bottom + 1, std::memory_order_relaxed);
+      return true;
+    }
+    
+    item_t* try_pop() noexcept {
+      auto bottom = bottom_.load(std::memory_order_relaxed) - 1;
+      bottom_.store(bottom, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      auto top = top_.load(std::memory_order_relaxed);
+      if (top > bottom) {
+        bottom_.store(bottom + 1, std::memory_order_relaxed);
+        return null;
+      }
+      auto item = items_[bottom & mask].load(std::memory_order_relaxed);
+      if (top == bottom) {
+        if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) item = null;
+        bottom_.store(bottom + 1, std::memory_order_relaxed);
+      }
+      return item;
+    }
+    
+    item_t* try_steal() noexcept {
+      auto top = top_.load(std::memory_order_acquire);
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      auto bottom = bottom_.load(std::memory_order_acquire);
+      if (top >= bottom) return null;
+      auto item = items_[top & mask].load(std::memory_order_relaxed);
+      if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) return null;
+      return item;
+    }
+    
+    std::atomic<bool> owned {false};
+    work_stealing_queue* next = null;
+    
+  private:
+    static constexpr int64 mask = capacity - 1;
+    alignas(64) std::atomic<int64> top_ {0};
+    alignas(64) std::atomic<int64> bottom_ {0};
+    std::atomic<item_t*> items_[capacity] {};
+  };
+}
+
 size_t thread_pool::max_threads_ = 800;
 size_t thread_pool::max_asynchronous_io_threads_ = 800;
 size_t thread_pool::min_threads_ = environment::processor_count();
 size_t thread_pool::min_asynchronous_io_threads_ = environment::processor_count();
 
 struct thread_pool::static_data {
+  using worker_queue = work_stealing_queue<thread_pool_item>;
+  
   threading::semaphore asynchronous_io_semaphore = threading::semaphore(0, as<int32>(thread_pool::max_asynchronous_io_threads_));
   asynchronous_io_thread_vector asynchronous_io_threads;
   manual_reset_event close_asynchronous_io_threads_manual_reset_event {false};
   manual_reset_event close_threads_manual_reset_event {false};
   threading::semaphore semaphore = threading::semaphore(0, as<int32>(thread_pool::max_threads_));
   thread_vector threads;
-  thread_pool_item_collection thread_pool_items;
-  object thread_pool_items_sync_root;
+  std::atomic<size_t> thread_count {0};
+  object threads_sync_root;
+  std::atomic<size_t> thread_pool_item_count {0};
+  injection_queue<thread_pool_item> global_thread_pool_items {4096};
+  std::deque<thread_pool_item*> overflow_thread_pool_items;
+  std::atomic<size_t> overflow_thread_pool_item_count {0};
+  std::mutex overflow_thread_pool_items_mutex;
+  std::atomic<worker_queue*> worker_queues {null};
   thread_pool_asynchronous_io_item_collection thread_pool_asynchronous_io_items;
   object thread_pool_asynchronous_io_items_sync_root;
   
@@ -32,6 +154,71 @@ struct thread_pool::static_data {
       thread.close();
     for (auto& asynchronous_io_thread : asynchronous_io_threads)
       asynchronous_io_thread.close();
+    
+    while (auto item = global_thread_pool_items.try_dequeue())
+      delete item;
+    for (auto item : overflow_thread_pool_items)
+      delete item;
+    for (auto queue = worker_queues.exchange(null); queue;) {
+      while (auto item = queue->try_steal())
+        delete item;
+      delete std::exchange(queue, queue->next);
+    }
+  }
+  
+  static worker_queue*& current_worker_queue() noexcept {
+    thread_local worker_queue* queue = null;
+    return queue;
+  }
+  
+  worker_queue* acquire_worker_queue() {
+    // Reuse a queue left by a joined worker so that its pending items are processed by the new owner.
+    for (auto queue = worker_queues.load(std::memory_order_acquire); queue; queue = queue->next) {
+      auto owned = false;
+      if (queue->owned.compare_exchange_strong(owned, true)) return current_worker_queue() = queue;
+    }
+    
+    auto queue = new worker_queue {};
+    queue->owned = true;
+    queue->next = worker_queues.load(std::memory_order_relaxed);
+    while (!worker_queues.compare_exchange_weak(queue->next, queue, std::memory_order_release, std::memory_order_relaxed));
+    return current_worker_queue() = queue;
+  }
+  
+  void release_worker_queue(worker_queue* queue) noexcept {
+    current_worker_queue() = null;
+    queue->owned = false;
+  }
+  
+  void push_item(thread_pool_item* item) {
+    // Items queued from a worker go to its own deque (LIFO for the worker, stolen in FIFO order by the others).
+    auto queue = current_worker_queue();
+    if (queue && queue->try_push(item)) return;
+    if (overflow_thread_pool_item_count.load(std::memory_order_acquire) == 0 && global_thread_pool_items.try_enqueue(item)) return;
+    
+    auto lock = std::lock_guard<std::mutex> {overflow_thread_pool_items_mutex};
+    overflow_thread_pool_items.push_back(item);
+    ++overflow_thread_pool_item_count;
+  }
+  
+  thread_pool_item* pop_item(worker_queue& local_queue) {
+    // A semaphore count has been acquired so an item is pushed or being pushed : loop until it is found.
+    while (true) {
+      if (auto item = local_queue.try_pop()) return item;
+      if (auto item = global_thread_pool_items.try_dequeue()) return item;
+      if (overflow_thread_pool_item_count.load(std::memory_order_acquire) != 0) {
+        auto lock = std::lock_guard<std::mutex> {overflow_thread_pool_items_mutex};
+        if (!overflow_thread_pool_items.empty()) {
+          auto item = overflow_thread_pool_items.front();
+          overflow_thread_pool_items.pop_front();
+          --overflow_thread_pool_item_count;
+          return item;
+        }
+      }
+      for (auto queue = local_queue.next ? local_queue.next : worker_queues.load(std::memory_order_acquire); queue != &local_queue; queue = queue->next ? queue->next : worker_queues.load(std::memory_order_acquire))
+        if (auto item = queue->try_steal()) return item;
+      thread::yield();
+    }
   }
 };
 
@@ -42,7 +229,7 @@ void thread_pool::close() {
 }
 
 void thread_pool::get_available_threads(size_t& worker_threads, size_t& completion_port_threads) {
-  worker_threads = max_threads_ - static_data_.thread_pool_items.size();
+  worker_threads = max_threads_ - static_data_.thread_pool_item_count;
   completion_port_threads = max_asynchronous_io_threads_ - static_data_.thread_pool_asynchronous_io_items.size();
 }
 
@@ -75,12 +262,18 @@ bool thread_pool::queue_user_work_item(const wait_callback& callback) {
 }
 
 bool thread_pool::queue_user_work_item(const wait_callback& callback, std::any state) {
-  lock_(static_data_.thread_pool_items_sync_root) {
-    if (static_data_.threads.size() == 0) initialize_min_threads();
-    if (static_data_.thread_pool_items.size() == max_threads_) return false;
-    if (static_data_.thread_pool_items.size() + 1 > static_data_.threads.size()) create_thread();
-    static_data_.thread_pool_items.emplace(static_data_.thread_pool_items.begin(), callback, state);
+  auto item_count = static_data_.thread_pool_item_count.fetch_add(1) + 1;
+  if (item_count > max_threads_) {
+    --static_data_.thread_pool_item_count;
+    return false;
   }
+  if (item_count > static_data_.thread_count) {
+    lock_(static_data_.threads_sync_root) {
+      if (static_data_.threads.size() == 0) initialize_min_threads();
+      if (item_count > static_data_.threads.size()) create_thread();
+    }
+  }
+  static_data_.push_item(new thread_pool_item {callback, state});
   static_data_.semaphore.release();
   return true;
 }
@@ -90,7 +283,8 @@ registered_wait_handle thread_pool::register_wait_for_single_object(wait_handle&
   lock_(static_data_.thread_pool_asynchronous_io_items_sync_root) {
     if (static_data_.asynchronous_io_threads.size() == 0) initialize_min_asynchronous_io_threads();
     if (static_data_.thread_pool_asynchronous_io_items.size() == max_asynchronous_io_threads_) return result;
-    if (static_data_.thread_pool_items.size() + 1 > static_data_.threads.size()) create_thread();
+    lock_(static_data_.threads_sync_root)
+      if (static_data_.thread_pool_item_count + 1 > static_data_.threads.size()) create_thread();
     static_data_.thread_pool_asynchronous_io_items.emplace(static_data_.thread_pool_asynchronous_io_items.begin(), callback, state, wait_object, milliseconds_timeout_interval, execute_only_once);
     result.item_ = reinterpret_cast<intptr>(&static_data_.thread_pool_asynchronous_io_items.back());
   }
@@ -117,7 +311,7 @@ bool thread_pool::set_max_threads(size_t worker_threads, size_t completion_port_
   max_threads_ = worker_threads;
   max_asynchronous_io_threads_ = completion_port_threads;
   
-  static_data_.semaphore = semaphore(as<int32>(static_data_.thread_pool_items.size()), as<int32>(max_threads_));
+  static_data_.semaphore = semaphore(as<int32>(static_data_.thread_pool_item_count.load()), as<int32>(max_threads_));
   static_data_.asynchronous_io_semaphore = semaphore(as<int32>(static_data_.thread_pool_asynchronous_io_items.size()), as<int32>(max_asynchronous_io_threads_));
   
   return true;
@@ -130,7 +324,8 @@ bool thread_pool::set_min_threads(size_t worker_threads, size_t completion_port_
   min_threads_ = worker_threads;
   min_asynchronous_io_threads_ = completion_port_threads;
   
-  if (static_data_.threads.size() != 0) initialize_min_threads();
+  lock_(static_data_.threads_sync_root)
+    if (static_data_.threads.size() != 0) initialize_min_threads();
   if (static_data_.asynchronous_io_threads.size() != 0) initialize_min_asynchronous_io_threads();
   
   return true;
@@ -160,6 +355,7 @@ void thread_pool::create_thread() {
   static_data_.threads.back().is_background(true);
   static_data_.threads.back().is_thread_pool_thread(true);
   static_data_.threads.back().start();
+  ++static_data_.thread_count;
 }
 
 void thread_pool::create_asynchronous_io_thread() {
@@ -195,6 +391,7 @@ bool thread_pool::join_all_threads(int32 milliseconds_timeout) {
   static_data_.close_threads_manual_reset_event.set();
   auto result = thread::join_all(static_data_.threads, milliseconds_timeout);
   static_data_.threads.clear();
+  static_data_.thread_count = 0;
   static_data_.close_threads_manual_reset_event.reset();
   return result;
 }
@@ -215,13 +412,16 @@ bool thread_pool::join_all_asynchronous_io_threads(int32 milliseconds_timeout) {
 }
 
 void thread_pool::run() {
-  while (true) {
-    if (wait_handle::wait_any(static_data_.close_threads_manual_reset_event, static_data_.semaphore) == 0) break;
-    auto item = thread_pool_item {};
-    lock_(static_data_.thread_pool_items_sync_root) {
-      item = static_data_.thread_pool_items.back();
-      static_data_.thread_pool_items.pop_back();
-    }
-    item.callback(item.state);
-  }
+  auto worker_queue = static_data_.acquire_worker_queue();
+  auto run_item = [&] {
+    auto item = xtd::uptr<thread_pool_item> {static_data_.pop_item(*worker_queue)};
+    --static_data_.thread_pool_item_count;
+    item->callback(item->state);
+  };
+  while (wait_handle::wait_any(static_data_.close_threads_manual_reset_event, static_data_.semaphore) != 0)
+    run_item();
+  // The work items queued before the pool is closed still run.
+  while (static_data_.semaphore.wait_one(0))
+    run_item();
+  static_data_.release_worker_queue(worker_queue);
 }
@@ -1,28 +1,171 @@
 #include "../../../include/xtd/threading/timer.h"
-#include "../../../include/xtd/threading/auto_reset_event.h"
+#include "../../../include/xtd/threading/thread.h"
 #include "../../../include/xtd/threading/thread_pool.h"
 #include "../../../include/xtd/argument_out_of_range_exception.h"
 #include "../../../include/xtd/invalid_operation_exception.h"
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <vector>
 
 using namespace xtd;
 using namespace xtd::threading;
 
+namespace {
+  // Timer data whose callback is executed by the current thread, used to avoid a self deadlock when a callback closes its own timer.
+  thread_local const void* current_timer_data = null;
+}
+
 struct timer::data {
   timer_callback callback;
-  bool closed{false};
-  int32 due_time{-1};
-  auto_reset_event event {true};
-  auto_reset_event sleep {false};
+  std::any state {this};
+  int32 due_time {-1};
   int32 period {-1};
-  std::any state{this};
-  wait_callback timer_proc = wait_callback {[&] {
-    if (due_time > 0) sleep.wait_one(due_time);
+  // The following members are guarded by static_data::mutex.
+  bool closed {false};
+  bool scheduled {false};
+  uint64 generation {0};
+  int32 running_callbacks {0};
+};
+
+struct timer::static_data {
+  using clock = std::chrono::steady_clock;
+  
+  struct entry {
+    clock::time_point due_time;
+    uint64 generation = 0;
+    xtd::wptr<timer::data> timer_data;
+    
+    bool operator >(const entry& other) const noexcept {return due_time > other.due_time;}
+    bool is_stale() const noexcept {
+      auto data = timer_data.lock();
+      return !data || data->closed || data->generation != generation;
+    }
+  };
+  
+  ~static_data() {
+    {
+      auto lock = std::lock_guard<std::mutex> {mutex};
+      closed = true;
+    }
+    service_condition.notify_one();
+    if (service_thread) service_thread->join();
+  }
+  
+  // Changing or closing a timer only increments its generation; the stale entries are dropped when they reach the top of the heap, or all at once when they outnumber the scheduled timers.
+  void cancel(timer::data& timer_data) noexcept {
+    ++timer_data.generation;
+    if (!timer_data.scheduled) return;
+    timer_data.scheduled = false;
+    --scheduled_count;
+  }
+  
+  void push(const xtd::sptr<timer::data>& timer_data, clock::time_point due_time) {
+    entries.push_back(entry {due_time, timer_data->generation, timer_data});
+    std::push_heap(entries.begin(), entries.end(), std::greater<entry> {});
+    timer_data->scheduled = true;
+    ++scheduled_count;
+  }
+  
+  entry pop() {
+    std::pop_heap(entries.begin(), entries.end(), std::greater<entry> {});
+    auto result = std::move(entries.back());
+    entries.pop_back();
+    return result;
+  }
+  
+  void schedule(const xtd::sptr<timer::data>& timer_data, clock::time_point due_time) {
+    push(timer_data, due_time);
+    if (entries.size() > 2 * scheduled_count + 1024) {
+      std::erase_if(entries, [](const entry& item) {return item.is_stale();});
+      std::make_heap(entries.begin(), entries.end(), std::greater<entry> {});
+    }
+    if (!service_thread) {
+      service_thread = thread {thread_start {[this] {run();}}};
+      service_thread->name("Timer");
+      service_thread->is_background(true);
+      service_thread->start();
+    }
+    if (entries.front().due_time == due_time) service_condition.notify_one();
+  }
+  
+  void run() {
+    auto lock = std::unique_lock<std::mutex> {mutex};
     while (!closed) {
-      callback(state);
-      sleep.wait_one(period);
+      if (entries.empty()) {
+        service_condition.wait(lock);
+        continue;
+      }
+      auto now = clock::now();
+      if (entries.front().due_time > now) {
+        service_condition.wait_until(lock, entries.front().due_time);
+        continue;
+      }
+      
+      // All the timers that expire together are collected in one pass, then queued to the thread pool outside the lock.
+      while (!entries.empty() && entries.front().due_time <= now) {
+        auto expired_entry = pop();
+        auto timer_data = expired_entry.timer_data.lock();
+        if (!timer_data || timer_data->closed || timer_data->generation != expired_entry.generation) continue;
+        ++timer_data->running_callbacks;
+        timer_data->scheduled = false;
+        --scheduled_count;
+        if (timer_data->period > 0) {
+          auto due_time = expired_entry.due_time + std::chrono::milliseconds {timer_data->period};
+          push(timer_data, due_time > now ? due_time : now + std::chrono::milliseconds {timer_data->period});
+        }
+        expired_timers.push_back(std::move(timer_data));
+      }
+      
+      lock.unlock();
+      for (auto& timer_data : expired_timers)
+        if (!thread_pool::queue_user_work_item(wait_callback {&static_data::dispatch}, timer_data)) complete(*this, *timer_data);
+      expired_timers.clear();
+      lock.lock();
+    }
+  }
+  
+  static void dispatch(std::any state) {
+    auto timer_data = as<xtd::sptr<timer::data>>(state);
+    auto& static_data = get_static_data();
+    {
+      auto lock = std::lock_guard<std::mutex> {static_data.mutex};
+      if (timer_data->closed) {
+        --timer_data->running_callbacks;
+        static_data.callback_condition.notify_all();
+        return;
+      }
     }
-    event.set();
-  }};
+    
+    auto previous_timer_data = std::exchange(current_timer_data, timer_data.get());
+    try {
+      timer_data->callback(timer_data->state);
+    } catch (...) {
+      current_timer_data = previous_timer_data;
+      complete(static_data, *timer_data);
+      throw;
+    }
+    current_timer_data = previous_timer_data;
+    complete(static_data, *timer_data);
+  }
+  
+  static void complete(static_data& static_data, timer::data& timer_data) {
+    auto lock = std::lock_guard<std::mutex> {static_data.mutex};
+    --timer_data.running_callbacks;
+    static_data.callback_condition.notify_all();
+  }
+  
+  std::mutex mutex;
+  std::condition_variable service_condition;
+  std::condition_variable callback_condition;
+  std::vector<entry> entries;
+  size_t scheduled_count = 0;
+  std::vector<xtd::sptr<timer::data>> expired_timers;
+  std::optional<thread> service_thread;
+  bool closed = false;
 };
 
 timer::timer(const timer_callback& callback) : timer(callback, this, -1, -1) {
@@ -74,12 +217,13 @@ void timer::change(int32 due_time, int32 period) {
   if (data_->callback.is_empty()) throw invalid_operation_exception {csf_};
   if (due_time < timeout::infinite || period < timeout::infinite) throw argument_out_of_range_exception {csf_};
   
+  auto& static_data = get_static_data();
+  auto lock = std::lock_guard<std::mutex> {static_data.mutex};
   data_->due_time = due_time;
   data_->period = period;
-  close();
   data_->closed = false;
-  data_->sleep.reset();
-  thread_pool::queue_user_work_item(data_->timer_proc);
+  static_data.cancel(*data_);
+  if (due_time != timeout::infinite) static_data.schedule(data_, static_data::clock::now() + std::chrono::milliseconds {due_time});
 }
 
 void timer::change(int64 due_time, int64 period) {
@@ -95,8 +239,17 @@ void timer::change(uint32 due_time, uint32 period) {
 }
 
 void timer::close() {
+  auto& static_data = get_static_data();
+  auto lock = std::unique_lock<std::mutex> {static_data.mutex};
   if (data_->closed) return;
   data_->closed = true;
-  data_->sleep.set();
-  data_->event.wait_one();
+  static_data.cancel(*data_);
+  // Waits for the callbacks in progress, except the one that may be closing its own timer.
+  auto own_callbacks = current_timer_data == data_.get() ? 1 : 0;
+  static_data.callback_condition.wait(lock, [&] {return data_->running_callbacks <= own_callbacks;});
+}
+
+timer::static_data& timer::get_static_data() {
+  static static_data data;
+  return data;
 }
@@ -1,5 +1,6 @@
 #pragma once
 #include "event_wait_handle_base.h"
+#include "waiter_collection.h"
 #include <condition_variable>
 #include "../../../include/xtd/semaphore.h"
 #include "../../../include/xtd/invalid_operation_exception.h"
@@ -39,6 +40,8 @@ public:
 
   bool set(bool& io_error) override {
     handle_->semaphore.release();
+    if (handle_->manual_reset) handle_->waiters.notify_all();
+    else handle_->waiters.notify_one();
     return true;
   }
   
@@ -51,18 +54,24 @@ public:
     if (milliseconds_timeout == timeout::infinite) handle_->semaphore.acquire();
     else if (handle_->semaphore.try_acquire_for(std::chrono::milliseconds {milliseconds_timeout}) == false) return 0x00000102;
 
-    if (handle_->manual_reset) {
-      auto io_error = false;
-      set(io_error);
-    }
-    
+    if (handle_->manual_reset) handle_->semaphore.release();
     return 0x00000000;
   }
   
+  bool add_waiter(wait_handle::waiter& waiter, size_t index) override {
+    handle_->waiters.add(waiter, index);
+    return true;
+  }
+  
+  void remove_waiter(wait_handle::waiter& waiter, size_t index) override {
+    handle_->waiters.remove(waiter, index);
+  }
+  
 private:
   struct data {
     bool manual_reset = false;
     std::binary_semaphore semaphore {0};
+    wait_handle::waiter_collection waiters;
   };
   xtd::sptr<data> handle_;
 };
@@ -1,5 +1,6 @@
 #pragma once
 #include "mutex_base.h"
+#include "waiter_collection.h"
 #include "../../../include/xtd/invalid_operation_exception.h"
 #include <mutex>
 
@@ -12,11 +13,11 @@ public:
   }
   
   void handle(intptr value) override {
-    handle_.reset(reinterpret_cast<std::recursive_timed_mutex*>(value));
+    handle_.reset(reinterpret_cast<data*>(value));
   }
 
   bool create(bool initially_owned) override {
-    handle_ = xtd::new_sptr<std::recursive_timed_mutex>();
+    handle_ = xtd::new_sptr<data>();
     if (initially_owned) wait(0);
     return true;
   }
@@ -36,17 +37,31 @@ public:
 
   bool signal(bool& io_error) override {
     io_error = false;
-    handle_->unlock();
+    handle_->mutex.unlock();
+    handle_->waiters.notify_one();
     return true;
   }
 
   uint32 wait(int32 milliseconds_timeout) override {
-    if (milliseconds_timeout == timeout::infinite) handle_->lock();
-    else if (handle_->try_lock_for(std::chrono::milliseconds {milliseconds_timeout}) == false) return 0x00000102;
+    if (milliseconds_timeout == timeout::infinite) handle_->mutex.lock();
+    else if (handle_->mutex.try_lock_for(std::chrono::milliseconds {milliseconds_timeout}) == false) return 0x00000102;
     
     return 0x00000000;
   }
   
+  bool add_waiter(wait_handle::waiter& waiter, size_t index) override {
+    handle_->waiters.add(waiter, index);
+    return true;
+  }
+  
+  void remove_waiter(wait_handle::waiter& waiter, size_t index) override {
+    handle_->waiters.remove(waiter, index);
+  }
+  
 private:
-  xtd::sptr<std::recursive_timed_mutex> handle_;
+  struct data {
+    std::recursive_timed_mutex mutex;
+    wait_handle::waiter_collection waiters;
+  };
+  xtd::sptr<data> handle_;
 };
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "semaphore_base.h"
+#include "waiter_collection.h"
 #include "../../../include/xtd/int32_object.h"
 #include "../../../include/xtd/semaphore.h"
 #include "../../../include/xtd/invalid_operation_exception.h"
@@ -46,6 +47,7 @@ public:
     previous_count = handle_->count;
     handle_->semaphore.release(static_cast<std::ptrdiff_t>(release_count));
     handle_->count += release_count;
+    handle_->waiters.notify(as<size_t>(release_count));
     return true;
   }
 
@@ -57,11 +59,21 @@ public:
     return 0x00000000;
   }
   
+  bool add_waiter(wait_handle::waiter& waiter, size_t index) override {
+    handle_->waiters.add(waiter, index);
+    return true;
+  }
+  
+  void remove_waiter(wait_handle::waiter& waiter, size_t index) override {
+    handle_->waiters.remove(waiter, index);
+  }
+  
 private:
   struct data {
     std::atomic<int32> count = 0;
     std::atomic<int32> maximum_count = std::numeric_limits<int>::max();
     std::counting_semaphore<int32_object::max_value> semaphore {0};
+    wait_handle::waiter_collection waiters;
   };
   xtd::sptr<data> handle_;
 };
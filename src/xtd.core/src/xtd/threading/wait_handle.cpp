@@ -1,3 +1,4 @@
+#include "waiter_collection.h"
 #include "../../../include/xtd/threading/thread.h"
 #include "../../../include/xtd/threading/wait_handle.h"
 #include "../../../include/xtd/diagnostics/stopwatch.h"
@@ -5,11 +6,45 @@
 #define __XTD_CORE_NATIVE_LIBRARY__
 #include <xtd/native/types>
 #undef __XTD_CORE_NATIVE_LIBRARY__
+#include <algorithm>
 
 using namespace xtd;
 using namespace xtd::diagnostics;
 using namespace xtd::threading;
 
+// Registers a waiter on the wait handles for the duration of a wait_any or wait_all call.
+class wait_handle::waiter_registration {
+public:
+  waiter_registration(const std::vector<wait_handle*>& wait_handles, wait_handle::waiter& waiter) : wait_handles_(wait_handles), waiter_(waiter) {
+    for (registered_count_ = 0; registered_count_ < wait_handles_.size(); ++registered_count_)
+      if (!wait_handles_[registered_count_]->add_waiter(waiter_, registered_count_)) all_notify_ = false;
+  }
+  
+  ~waiter_registration() {
+    for (auto index = 0_z; index < registered_count_; ++index)
+      wait_handles_[index]->remove_waiter(waiter_, index);
+  }
+  
+  bool wait(int32 milliseconds_timeout, const stopwatch& sw) {
+    auto remaining_timeout = timeout::infinite;
+    if (milliseconds_timeout != timeout::infinite) {
+      auto elapsed_milliseconds = sw.elapsed_milliseconds();
+      if (elapsed_milliseconds >= milliseconds_timeout) return false;
+      remaining_timeout = milliseconds_timeout - as<int32>(elapsed_milliseconds);
+    }
+    // The wait handles that do not notify waiters are polled every millisecond.
+    if (!all_notify_) remaining_timeout = remaining_timeout == timeout::infinite ? 1 : std::min(remaining_timeout, 1);
+    waiter_.wait(remaining_timeout);
+    return true;
+  }
+  
+private:
+  const std::vector<wait_handle*>& wait_handles_;
+  wait_handle::waiter& waiter_;
+  size_t registered_count_ = 0;
+  bool all_notify_ = true;
+};
+
 const intptr wait_handle::invalid_handle = native::types::invalid_handle();
 
 wait_handle::~wait_handle() {
@@ -19,6 +54,13 @@ wait_handle::~wait_handle() {
 void wait_handle::close() {
 }
 
+bool wait_handle::add_waiter(waiter& waiter, size_t index) {
+  return false;
+}
+
+void wait_handle::remove_waiter(waiter& waiter, size_t index) {
+}
+
 bool wait_handle::signal_and_wait(wait_handle& to_signal, wait_handle& to_wait) {
   return signal_and_wait(to_signal, to_wait, timeout::infinite);
 }
@@ -166,36 +208,48 @@ bool wait_handle::wait_one(const time_span& timeout) {
 bool wait_handle::wait_all(const std::vector<wait_handle*>& wait_handles, int32 milliseconds_timeout) {
   if (milliseconds_timeout < timeout::infinite) throw argument_exception {csf_};
   
-  if (milliseconds_timeout == timeout::infinite) {
-    for (auto item : wait_handles)
-      item->wait_one();
-    return true;
-  }
-  
+  // The wait handles are always acquired in the same order so that concurrent wait_all calls on the same wait handles cannot livelock.
+  auto ordered_wait_handles = wait_handles;
+  std::stable_sort(ordered_wait_handles.begin(), ordered_wait_handles.end(), [](const wait_handle* a, const wait_handle* b) {return a->handle() < b->handle();});
+  auto waiter = wait_handle::waiter {ordered_wait_handles.size()};
+  auto registration = waiter_registration {ordered_wait_handles, waiter};
   auto sw = stopwatch::start_new();
-  for (auto& item : wait_handles)
-    if (sw.elapsed_milliseconds() > milliseconds_timeout || item->wait_one(milliseconds_timeout - as<int32>(sw.elapsed_milliseconds()))) return false;
-  return true;
+  while (true) {
+    waiter.reset();
+    auto acquired_count = 0_z;
+    for (; acquired_count < ordered_wait_handles.size(); ++acquired_count) {
+      waiter.reset(acquired_count);
+      if (!ordered_wait_handles[acquired_count]->wait_one(0)) break;
+    }
+    if (acquired_count == ordered_wait_handles.size()) {
+      for (auto index = 0_z; index < acquired_count; ++index)
+        waiter.is_acquired(index, true);
+      return true;
+    }
+    
+    // Either all the wait handles are acquired or none : release the wait handles already acquired without waking the current waiter.
+    for (auto index = 0_z; index < acquired_count; ++index) {
+      waiter.suppress(index);
+      ordered_wait_handles[index]->signal();
+    }
+    if (!registration.wait(milliseconds_timeout, sw)) return false;
+  }
 }
 
 size_t wait_handle::wait_any(const std::vector<wait_handle*>& wait_handles, int32 milliseconds_timeout) {
   if (milliseconds_timeout < timeout::infinite) throw argument_exception {csf_};
   
-  if (milliseconds_timeout == timeout::infinite) {
-    while (true) {
-      for (auto index = 0_z; index < wait_handles.size(); ++index) {
-        if (wait_handles[index]->wait_one(0) == true) return index;
-        thread::sleep(1);
-      }
-    }
-  }
-  
+  auto waiter = wait_handle::waiter {wait_handles.size()};
+  auto registration = waiter_registration {wait_handles, waiter};
   auto sw = stopwatch::start_new();
-  while (sw.elapsed_milliseconds() <= milliseconds_timeout) {
-    for (auto index = 0_z; index < wait_handles.size(); index++) {
-      if (wait_handles[index]->wait_one(0) == true) return index;
-      thread::sleep(1);
+  while (true) {
+    waiter.reset();
+    for (auto index = 0_z; index < wait_handles.size(); ++index) {
+      waiter.reset(index);
+      if (!wait_handles[index]->wait_one(0)) continue;
+      waiter.is_acquired(index, true);
+      return index;
     }
+    if (!registration.wait(milliseconds_timeout, sw)) return wait_timeout;
   }
-  return wait_timeout;
 }
@@ -0,0 +1,49 @@
+#pragma once
+#include "../../../include/xtd/threading/wait_handle.h"
+#include "../../../include/xtd/threading/timeout.h"
+#include "../../../include/xtd/int32_object.h"
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <semaphore>
+
+class xtd::threading::wait_handle::waiter {
+public:
+  explicit waiter(size_t count) : acquired_(std::make_unique<bool[]>(count)), notified_(std::make_unique<std::atomic<bool>[]>(count)) {}
+  waiter(const waiter&) = delete;
+  waiter& operator =(const waiter&) = delete;
+  
+  bool is_acquired(size_t index) const noexcept {return acquired_[index];}
+  void is_acquired(size_t index, bool value) noexcept {acquired_[index] = value;}
+  
+  bool is_notified(size_t index) const noexcept {return notified_[index].load(std::memory_order_acquire);}
+  
+  bool notify(size_t index) noexcept {
+    if (notified_[index].exchange(true, std::memory_order_acq_rel)) return false;
+    semaphore_.release();
+    return true;
+  }
+  
+  void reset() noexcept {
+    while (semaphore_.try_acquire());
+  }
+  
+  void reset(size_t index) noexcept {
+    notified_[index].store(false, std::memory_order_release);
+  }
+  
+  void suppress(size_t index) noexcept {
+    notified_[index].store(true, std::memory_order_release);
+  }
+  
+  bool wait(int32 milliseconds_timeout) {
+    if (milliseconds_timeout != timeout::infinite) return semaphore_.try_acquire_for(std::chrono::milliseconds {milliseconds_timeout});
+    semaphore_.acquire();
+    return true;
+  }
+  
+private:
+  std::unique_ptr<bool[]> acquired_;
+  std::unique_ptr<std::atomic<bool>[]> notified_;
+  std::counting_semaphore<int32_object::max_value> semaphore_ {0};
+};
@@ -0,0 +1,56 @@
+#pragma once
+#include "waiter.h"
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <mutex>
+#include <vector>
+
+class xtd::threading::wait_handle::waiter_collection {
+public:
+  waiter_collection() = default;
+  waiter_collection(const waiter_collection&) = delete;
+  waiter_collection& operator =(const waiter_collection&) = delete;
+  
+  void add(waiter& waiter, size_t index) {
+    auto lock = std::lock_guard<std::mutex> {mutex_};
+    registrations_.push_back({&waiter, index});
+    count_.store(registrations_.size(), std::memory_order_release);
+  }
+  
+  void remove(waiter& waiter, size_t index) {
+    auto lock = std::lock_guard<std::mutex> {mutex_};
+    registrations_.erase(std::remove_if(registrations_.begin(), registrations_.end(), [&](const registration& item) {return item.owner == &waiter && item.index == index;}), registrations_.end());
+    count_.store(registrations_.size(), std::memory_order_release);
+    // The waiter leaves without consuming the signal it was notified of : hand the notification over to another waiter.
+    if (waiter.is_notified(index) && !waiter.is_acquired(index)) notify_unlocked(1);
+  }
+  
+  void notify_all() {notify(registrations_count_max);}
+  
+  void notify_one() {notify(1);}
+  
+  void notify(size_t count) {
+    if (count_.load(std::memory_order_acquire) == 0) return;
+    auto lock = std::lock_guard<std::mutex> {mutex_};
+    notify_unlocked(count);
+  }
+  
+private:
+  static constexpr size_t registrations_count_max = std::numeric_limits<size_t>::max();
+  
+  struct registration {
+    waiter* owner = null;
+    size_t index = 0;
+  };
+  
+  void notify_unlocked(size_t count) {
+    // Registrations are in arrival order : the oldest waiters that are not already notified are woken first.
+    for (auto iterator = registrations_.begin(); count != 0 && iterator != registrations_.end(); ++iterator)
+      if (iterator->owner->notify(iterator->index)) --count;
+  }
+  
+  std::atomic<size_t> count_ {0};
+  std::mutex mutex_;
+  std::vector<registration> registrations_;
+};
@@ -1,33 +1,27 @@
 #include "../../../include/xtd/timers/timer.h"
-#include "../../../include/xtd/threading/auto_reset_event.h"
-#include "../../../include/xtd/threading/thread_pool.h"
-#include "../../../include/xtd/threading/wait_callback.h"
+#include "../../../include/xtd/threading/timer.h"
 #include "../../../include/xtd/object_closed_exception.h"
 #include "../../../include/xtd/math.h"
+#include <atomic>
+#include <optional>
 
 using namespace xtd;
-using namespace xtd::threading;
 using namespace xtd::timers;
 
 struct timer::data {
   bool auto_reset {true};
   bool closed {false};
-  bool enabled {false};
-  auto_reset_event event {true};
+  std::atomic<bool> enabled {false};
   time_span interval {100};
-  auto_reset_event sleep {false};
-  wait_callback timer_proc = wait_callback {[&](std::any arg) {
-    as<timer*>(arg)->data_->event.reset();
-    sleep.wait_one(interval);
-    while (enabled) {
-      as<timer*>(arg)->on_elpased(elapsed_event_args(date_time::now()));
-      sleep.wait_one(interval);
-      if (!auto_reset) enabled = false;
-    }
-    as<timer*>(arg)->data_->event.set();
-  }};
   isynchronize_invoke* synchronizing_object = nullptr;
-  std::any state{this};
+  std::atomic<timer*> owner {nullptr};
+  // The elapsed events are scheduled by the shared xtd::threading::timer service instead of a dedicated thread pool thread.
+  std::optional<threading::timer> threading_timer;
+  
+  void start() {
+    auto milliseconds = as<int32>(math::ceiling(interval.total_milliseconds()));
+    threading_timer->change(milliseconds, auto_reset ? milliseconds : threading::timeout::infinite);
+  }
 };
 
 timer::timer() : timer(100) {
@@ -35,6 +29,10 @@ timer::timer() : timer(100) {
 
 timer::timer(double interval) : data_(xtd::new_sptr<data>()) {
   timer::interval(interval);
+  data_->threading_timer.emplace(threading::timer_callback {[data = data_.get()](std::any) {
+    if (!data->auto_reset) data->enabled = false;
+    if (auto owner = data->owner.load(); owner) owner->on_elpased(elapsed_event_args(date_time::now()));
+  }});
 }
 
 timer::timer(const time_span& interval) : timer(interval.total_milliseconds()) {
@@ -60,6 +58,7 @@ bool timer::auto_reset() const noexcept {
 
 timer& timer::auto_reset(bool value) {
   data_->auto_reset = value;
+  if (data_->enabled) data_->start();
   return *this;
 }
 
@@ -69,9 +68,11 @@ bool timer::enabled() const noexcept {
 
 timer& timer::enabled(bool value) {
   if (data_->closed) throw object_closed_exception {csf_};
-  if (data_->enabled && !value) data_->sleep.set();
   data_->enabled = value;
-  if (value) thread_pool::queue_user_work_item(data_->timer_proc, this);
+  if (value) {
+    data_->owner = this;
+    data_->start();
+  } else data_->threading_timer->change(threading::timeout::infinite, threading::timeout::infinite);
   return *this;
 }
 
@@ -83,6 +84,7 @@ timer& timer::interval(double value) {
   if (data_->closed) throw object_closed_exception {csf_};
   if (math::ceiling(value) < 0 || math::ceiling(value) > int32_object::max_value) throw argument_exception {csf_};
   data_->interval = time_span::from_milliseconds(value);
+  if (data_->enabled) data_->start();
   return *this;
 }
 
@@ -103,7 +105,7 @@ timer& timer::synchronizing_object(std::nullptr_t value) {
 void timer::close() {
   if (data_->closed) throw object_closed_exception {csf_};
   stop();
-  data_->event.wait_one();
+  data_->threading_timer->close();
   data_->closed = true;
 }
 
@@ -0,0 +1,35 @@
+#include <xtd/buffers/operation_status>
+#include <xtd/tunit/assert>
+#include <xtd/tunit/test_class_attribute>
+#include <xtd/tunit/test_method_attribute>
+
+using namespace xtd::buffers;
+using namespace xtd::tunit;
+
+namespace xtd::tests {
+  class test_class_(operation_status_tests) {
+    void test_method_(done) {
+      assert::are_equal(0, enum_object<>::to_int32(operation_status::done), csf_);
+      assert::are_equal("done", enum_object<>::to_string(operation_status::done), csf_);
+      assert::are_equal(operation_status::done, enum_object<>::parse<operation_status>("done"), csf_);
+    }
+    
+    void test_method_(destination_too_small) {
+      assert::are_equal(1, enum_object<>::to_int32(operation_status::destination_too_small), csf_);
+      assert::are_equal("destination_too_small", enum_object<>::to_string(operation_status::destination_too_small), csf_);
+      assert::are_equal(operation_status::destination_too_small, enum_object<>::parse<operation_status>("destination_too_small"), csf_);
+    }
+    
+    void test_method_(need_more_data) {
+      assert::are_equal(2, enum_object<>::to_int32(operation_status::need_more_data), csf_);
+      assert::are_equal("need_more_data", enum_object<>::to_string(operation_status::need_more_data), csf_);
+      assert::are_equal(operation_status::need_more_data, enum_object<>::parse<operation_status>("need_more_data"), csf_);
+    }
+    
+    void test_method_(invalid_data) {
+      assert::are_equal(3, enum_object<>::to_int32(operation_status::invalid_data), csf_);
+      assert::are_equal("invalid_data", enum_object<>::to_string(operation_status::invalid_data), csf_);
+      assert::are_equal(operation_status::invalid_data, enum_object<>::parse<operation_status>("invalid_data"), csf_);
+    }
+  };
+}
@@ -51,16 +51,22 @@ namespace xtd::collections::generic::tests {
       assert::are_equal(typeof_<int*>(), typeof_<list<int>::pointer>(), csf_);
     }
 
+    void test_method_(pointer_bool) {
+      assert::are_equal(typeof_<byte*>(), typeof_<list<bool>::pointer>(), csf_);
+    }
+
     void test_method_(const_pointer) {
       assert::are_equal(typeof_<const int*>(), typeof_<list<int>::const_pointer>(), csf_);
     }
 
     void test_method_(iterator) {
-      assert::are_equal(typeof_<ilist<int>::iterator>(), typeof_<list<int>::iterator>(), csf_);
+      assert::are_equal(typeof_<helpers::wrap_pointer_iterator<int*>>(), typeof_<list<int>::iterator>(), csf_);
+      assert::is_true(std::contiguous_iterator<list<int>::iterator>, csf_);
     }
     
     void test_method_(const_iterator) {
-      assert::are_equal(typeof_<ilist<int>::const_iterator>(), typeof_<list<int>::const_iterator>(), csf_);
+      assert::are_equal(typeof_<helpers::wrap_pointer_iterator<const int*>>(), typeof_<list<int>::const_iterator>(), csf_);
+      assert::is_true(std::contiguous_iterator<list<int>::const_iterator>, csf_);
     }
 
     void test_method_(reverse_iterator) {
@@ -144,6 +150,33 @@ namespace xtd::collections::generic::tests {
       assert::are_equal(84, *items.begin(), csf_);
     }
     
+    void test_method_(begin_and_end_with_range_for) {
+      auto items = list {84, 42, 21};
+      auto result = list<int> {};
+      for (auto& item : items)
+        result.add(item++);
+      collection_assert::are_equal({84, 42, 21}, result, csf_);
+      collection_assert::are_equal({85, 43, 22}, items, csf_);
+    }
+    
+    void test_method_(begin_and_end_with_bool) {
+      auto items = list {true, false, true};
+      auto result = list<bool> {};
+      for (auto item : items)
+        result.add(item);
+      collection_assert::are_equal({true, false, true}, result, csf_);
+      assert::is_true(items.data() == std::to_address(items.begin()), csf_);
+    }
+    
+    void test_method_(begin_and_end_with_ienumerable) {
+      auto items = list {84, 42, 21};
+      auto& enumerable = static_cast<const ienumerable<int>&>(items);
+      auto result = list<int> {};
+      for (auto item : enumerable)
+        result.add(item);
+      collection_assert::are_equal({84, 42, 21}, result, csf_);
+    }
+    
     void test_method_(capaciy) {
       auto items = list {84, 42, 21};
       assert::are_equal(3_z, items.count(), csf_);
@@ -160,7 +193,7 @@ namespace xtd::collections::generic::tests {
 
     void test_method_(cend) {
       auto items = list {84, 42, 21};
-      assert::throws<index_out_of_range_exception>([&] {*items.cend();}, csf_);
+      assert::are_equal(3, items.cend() - items.cbegin(), csf_);
     }
     
     void test_method_(count) {
@@ -226,7 +259,7 @@ namespace xtd::collections::generic::tests {
     
     void test_method_(end) {
       auto items = list {84, 42, 21};
-      assert::throws<index_out_of_range_exception>([&] {*items.end();}, csf_);
+      assert::are_equal(3, items.end() - items.begin(), csf_);
     }
     
     void test_method_(front) {
@@ -333,5 +366,64 @@ namespace xtd::collections::generic::tests {
       items.add_range(as<ienumerable<int>>(list {9, 10, 11, 12}));
       collection_assert::are_equal({1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}, items);
     }
+    
+    void test_method_(add_range_with_itself) {
+      auto items = list {1, 2, 3};
+      items.add_range(static_cast<const ienumerable<int>&>(items));
+      collection_assert::are_equal({1, 2, 3, 1, 2, 3}, items, csf_);
+    }
+    
+    void test_method_(add_range_with_read_only_collection) {
+      auto items = list {1, 2};
+      items.add_range(list {3, 4, 5}.as_read_only());
+      collection_assert::are_equal({1, 2, 3, 4, 5}, items, csf_);
+    }
+    
+    void test_method_(get_enumerator_move_next_batch) {
+      auto items = list {84, 42, 21};
+      auto enumerator = items.get_enumerator();
+      assert::is_true(enumerator.move_next(), csf_);
+      auto batch = enumerator.move_next_batch();
+      assert::are_equal(2_z, batch.size(), csf_);
+      assert::are_equal(42, batch[0], csf_);
+      assert::are_equal(21, batch[1], csf_);
+      assert::are_equal(21, enumerator.current(), csf_);
+      assert::is_true(enumerator.move_next_batch().empty(), csf_);
+      assert::is_false(enumerator.move_next(), csf_);
+    }
+    
+    void test_method_(get_enumerator_move_next_batch_after_modification) {
+      auto items = list {84, 42, 21};
+      auto enumerator = items.get_enumerator();
+      items.add(10);
+      assert::throws<invalid_operation_exception>([&] {enumerator.move_next_batch();}, csf_);
+    }
+    
+    void test_method_(try_get_span) {
+      auto items = list {84, 42, 21};
+      auto span = std::span<const int> {};
+      assert::is_true(static_cast<const ienumerable<int>&>(items).try_get_span(span), csf_);
+      assert::are_equal(3_z, span.size(), csf_);
+      assert::is_true(items.data() == span.data(), csf_);
+    }
+    
+    void test_method_(try_get_span_with_bool) {
+      // The elements of a list <bool> are stored as xtd::byte : they cannot be viewed as a span of bool.
+      auto items = list {true, false, true};
+      auto span = std::span<const bool> {};
+      assert::is_false(items.try_get_span(span), csf_);
+      assert::is_true(span.empty(), csf_);
+    }
+    
+    void test_method_(get_enumerator_move_next_batch_with_bool) {
+      auto items = list {true, false, true};
+      auto enumerator = items.get_enumerator();
+      auto result = std::vector<bool> {};
+      for (auto batch = enumerator.move_next_batch(); !batch.empty(); batch = enumerator.move_next_batch()) {
+        assert::are_equal(1_z, batch.size(), csf_);
+        result.push_back(batch[0]);
+      }
+      collection_assert::are_equal({true, false, true}, result, csf_);
+    }
   };
 }
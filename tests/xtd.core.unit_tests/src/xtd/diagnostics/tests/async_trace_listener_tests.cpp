@@ -0,0 +1,141 @@
+#define TRACE
+#include <xtd/diagnostics/async_trace_listener>
+#include <xtd/argument_null_exception>
+#include <xtd/argument_out_of_range_exception>
+#include <xtd/new_sptr>
+#include <xtd/tunit/assert>
+#include <xtd/tunit/test_class_attribute>
+#include <xtd/tunit/test_method_attribute>
+#include <atomic>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+using namespace xtd;
+using namespace xtd::diagnostics;
+using namespace xtd::tunit;
+
+namespace xtd::diagnostics::tests {
+  class test_class_(async_trace_listener_tests) {
+    class unit_test_trace_listener : public trace_listener {
+    public:
+      unit_test_trace_listener() = default;
+      xtd::string result() const {return string_stream.str();}
+      bool closed() const {return closed_;}
+      size_t flush_count() const {return flush_count_;}
+      void hold(bool value) {hold_ = value;}
+      
+      void close() override {closed_ = true;}
+      void flush() override {++flush_count_;}
+      
+      using trace_listener::write;
+      void write(const xtd::string& message) override {
+        while (hold_) std::this_thread::yield();
+        if (need_indent())
+          write_indent();
+        string_stream << message;
+      }
+      
+      using trace_listener::write_line;
+      void write_line(const xtd::string& message) override {
+        write(message);
+        string_stream << std::endl;
+        need_indent(true);
+      }
+    
+    private:
+      std::stringstream string_stream;
+      bool closed_ = false;
+      size_t flush_count_ = 0;
+      std::atomic<bool> hold_ = false;
+    };
+    
+    void test_method_(new_async_trace_listener) {
+      auto listener = new_sptr<unit_test_trace_listener>();
+      async_trace_listener async_listener {listener};
+      assert::is_true(listener == async_listener.listener(), csf_);
+      assert::are_equal(async_trace_listener::default_capacity, async_listener.capacity(), csf_);
+      assert::are_equal(trace_overflow_policy::block, async_listener.overflow_policy(), csf_);
+      assert::is_true(async_listener.is_thread_safe(), csf_);
+      assert::is_zero(async_listener.dropped_count(), csf_);
+      assert::is_zero(async_listener.written_count(), csf_);
+      assert::are_equal(time_span {}, async_listener.average_latency(), csf_);
+      assert::are_equal(time_span {}, async_listener.max_latency(), csf_);
+    }
+    
+    void test_method_(capacity_is_rounded_up_to_power_of_two) {
+      async_trace_listener async_listener {new_sptr<unit_test_trace_listener>(), 100};
+      assert::are_equal(128_z, async_listener.capacity(), csf_);
+    }
+    
+    void test_method_(create_with_invalid_arguments) {
+      assert::throws<argument_null_exception>([] {async_trace_listener {nullptr};}, csf_);
+      assert::throws<argument_out_of_range_exception>([] {async_trace_listener {new_sptr<unit_test_trace_listener>(), 1};}, csf_);
+    }
+    
+    void test_method_(write_and_write_line) {
+      auto listener = new_sptr<unit_test_trace_listener>();
+      async_trace_listener async_listener {listener};
+      async_listener.write("Hello, ");
+      async_listener.write_line("World!");
+      async_listener.flush();
+      assert::are_equal("Hello, World!\n", listener->result(), csf_);
+      assert::are_equal(2_z, async_listener.written_count(), csf_);
+      assert::is_not_zero(listener->flush_count(), csf_);
+    }
+    
+    void test_method_(write_line_with_indent_level) {
+      auto listener = new_sptr<unit_test_trace_listener>();
+      async_trace_listener async_listener {listener};
+      async_listener.indent_level(1);
+      async_listener.write_line("first");
+      async_listener.indent_level(2);
+      async_listener.indent_size(2);
+      async_listener.write_line("second");
+      async_listener.flush();
+      assert::are_equal("    first\n    second\n", listener->result(), csf_);
+    }
+    
+    void test_method_(write_line_from_several_threads) {
+      auto listener = new_sptr<unit_test_trace_listener>();
+      async_trace_listener async_listener {listener, 16};
+      auto threads = std::vector<std::thread> {};
+      for (auto index = 0; index < 4; ++index)
+        threads.emplace_back([&] {
+          for (auto count = 0; count < 1000; ++count)
+            async_listener.write_line("message");
+        });
+      for (auto& thread : threads)
+        thread.join();
+      async_listener.flush();
+      assert::are_equal(4000_z, async_listener.written_count(), csf_);
+      assert::is_zero(async_listener.dropped_count(), csf_);
+      assert::are_equal(4000 * xtd::string {"message\n"}.size(), listener->result().size(), csf_);
+    }
+    
+    void test_method_(write_line_with_drop_policy_and_full_queue) {
+      auto listener = new_sptr<unit_test_trace_listener>();
+      async_trace_listener async_listener {listener, 2, trace_overflow_policy::drop};
+      listener->hold(true);
+      for (auto count = 0; count < 10; ++count)
+        async_listener.write_line("message");
+      listener->hold(false);
+      async_listener.flush();
+      assert::is_greater_or_equal(async_listener.dropped_count(), 7_z, csf_);
+      assert::are_equal(10_z, async_listener.written_count() + async_listener.dropped_count(), csf_);
+    }
+    
+    void test_method_(close) {
+      auto listener = new_sptr<unit_test_trace_listener>();
+      async_trace_listener async_listener {listener};
+      async_listener.write_line("before");
+      async_listener.close();
+      async_listener.write_line("after");
+      async_listener.flush();
+      assert::is_true(listener->closed(), csf_);
+      assert::are_equal("before\n", listener->result(), csf_);
+      assert::are_equal(1_z, async_listener.written_count(), csf_);
+      assert::are_equal(1_z, async_listener.dropped_count(), csf_);
+    }
+  };
+}
@@ -0,0 +1,43 @@
+#include <xtd/diagnostics/trace_event_cache>
+#include <xtd/threading/thread>
+#include <xtd/tunit/assert>
+#include <xtd/tunit/test_class_attribute>
+#include <xtd/tunit/test_method_attribute>
+#include <thread>
+
+using namespace xtd;
+using namespace xtd::diagnostics;
+using namespace xtd::tunit;
+
+namespace xtd::diagnostics::tests {
+  class test_class_(trace_event_cache_tests) {
+    void test_method_(timestamp_is_captured_at_creation) {
+      auto event_cache = trace_event_cache {};
+      auto timestamp = event_cache.timestamp();
+      std::this_thread::sleep_for(std::chrono::milliseconds {2});
+      assert::are_equal(timestamp, event_cache.timestamp(), csf_);
+      assert::are_equal(timestamp.count(), event_cache.timestamp_nanoseconds(), csf_);
+      assert::are_equal(std::chrono::duration_cast<std::chrono::milliseconds>(timestamp).count(), event_cache.timestamp_milliseconds(), csf_);
+    }
+    
+    void test_method_(thread_id) {
+      auto event_cache = trace_event_cache {};
+      assert::are_equal(threading::thread::current_thread().managed_thread_id(), event_cache.managed_thread_id(), csf_);
+      assert::are_equal(string::format("{}", event_cache.managed_thread_id()), event_cache.thread_id(), csf_);
+    }
+    
+    void test_method_(copy_keeps_captured_data) {
+      auto event_cache = trace_event_cache {};
+      auto copy = trace_event_cache {};
+      std::thread {[&] {copy = event_cache;}}.join();
+      assert::are_equal(event_cache.managed_thread_id(), copy.managed_thread_id(), csf_);
+      assert::are_equal(event_cache.timestamp(), copy.timestamp(), csf_);
+    }
+    
+    void test_method_(call_stack_is_kept) {
+      auto event_cache = trace_event_cache {};
+      auto call_stack = event_cache.call_stack();
+      assert::are_equal(call_stack, event_cache.call_stack(), csf_);
+    }
+  };
+}
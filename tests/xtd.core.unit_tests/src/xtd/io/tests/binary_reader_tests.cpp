@@ -0,0 +1,78 @@
+#include <xtd/io/binary_reader>
+#include <xtd/io/binary_writer>
+#include <xtd/io/end_of_stream_exception>
+#include <xtd/tunit/assert>
+#include <xtd/tunit/test_class_attribute>
+#include <xtd/tunit/test_method_attribute>
+#include <limits>
+#include <sstream>
+
+using namespace xtd;
+using namespace xtd::io;
+using namespace xtd::tunit;
+
+namespace xtd::io::tests {
+  class test_class_(binary_reader_tests) {
+    void test_method_(read_primitives_written_by_binary_writer) {
+      auto stream = std::stringstream {};
+      auto writer = binary_writer {stream};
+      writer << true << static_cast<xtd::byte>(42) << 'a' << 3.5 << static_cast<int16>(-2) << -3 << std::numeric_limits<int64>::min() << static_cast<sbyte>(-4) << 2.5f << "Hello" << static_cast<uint16>(5) << 6u << std::numeric_limits<uint64>::max();
+      
+      auto reader = binary_reader {stream};
+      assert::is_true(reader.read_boolean(), csf_);
+      assert::are_equal(static_cast<xtd::byte>(42), reader.read_byte(), csf_);
+      assert::are_equal('a', reader.read_char(), csf_);
+      assert::are_equal(3.5, reader.read_double(), csf_);
+      assert::are_equal(static_cast<int16>(-2), reader.read_int16(), csf_);
+      assert::are_equal(-3, reader.read_int32(), csf_);
+      assert::are_equal(std::numeric_limits<int64>::min(), reader.read_int64(), csf_);
+      assert::are_equal(static_cast<sbyte>(-4), reader.read_sbyte(), csf_);
+      assert::are_equal(2.5f, reader.read_single(), csf_);
+      assert::are_equal("Hello", reader.read_string(), csf_);
+      assert::are_equal(static_cast<uint16>(5), reader.read_uint16(), csf_);
+      assert::are_equal(6u, reader.read_uint32(), csf_);
+      assert::are_equal(std::numeric_limits<uint64>::max(), reader.read_uint64(), csf_);
+      assert::is_true(reader.end_of_stream(), csf_);
+    }
+    
+    void test_method_(read_past_end_of_stream) {
+      auto stream = std::stringstream {"abc"};
+      auto reader = binary_reader {stream};
+      assert::throws<end_of_stream_exception>([&] {reader.read_int32();}, csf_);
+    }
+    
+    void test_method_(read_and_write_spans) {
+      auto stream = std::stringstream {};
+      auto writer = binary_writer {stream};
+      auto bytes = std::vector<xtd::byte> {1, 2, 3, 4, 5};
+      writer.write(std::span<const xtd::byte> {bytes});
+      writer.write(bytes, 1, 2);
+      
+      auto reader = binary_reader {stream};
+      auto buffer = std::vector<xtd::byte>(10);
+      assert::are_equal(7_z, reader.read(std::span<xtd::byte> {buffer}), csf_);
+      assert::are_equal(std::vector<xtd::byte> {1, 2, 3, 4, 5, 2, 3, 0, 0, 0}, buffer, csf_);
+      assert::are_equal(0_z, reader.read(std::span<xtd::byte> {buffer}), csf_);
+    }
+    
+    void test_method_(read_and_write_arrays) {
+      struct point {
+        int32 x;
+        double y;
+      };
+      auto points = std::vector<point>(10000);
+      for (auto index = 0; index < 10000; ++index)
+        points[index] = {index, index / 2.0};
+      
+      auto stream = std::stringstream {};
+      binary_writer {stream}.write_array(std::span<const point> {points});
+      
+      auto result = std::vector<point>(10001);
+      assert::are_equal(10000_z, binary_reader {stream}.read_array(std::span<point> {result}), csf_);
+      for (auto index = 0; index < 10000; ++index) {
+        assert::are_equal(index, result[index].x, csf_);
+        assert::are_equal(index / 2.0, result[index].y, csf_);
+      }
+    }
+  };
+}
@@ -0,0 +1,121 @@
+#include <xtd/io/binary_reader>
+#include <xtd/io/file>
+#include <xtd/io/file_not_found_exception>
+#include <xtd/io/memory_mapped_file>
+#include <xtd/argument_exception>
+#include <xtd/argument_out_of_range_exception>
+#include <xtd/not_supported_exception>
+#include <xtd/unauthorized_access_exception>
+#include <xtd/tunit/assert>
+#include <xtd/tunit/test_class_attribute>
+#include <xtd/tunit/test_method_attribute>
+#include <fstream>
+
+using namespace xtd;
+using namespace xtd::io;
+using namespace xtd::tunit;
+
+namespace xtd::io::tests {
+  class test_class_(memory_mapped_file_tests) {
+    static constexpr auto test_file_name = "memory_mapped_file.bin";
+    
+    static void test_initialize_(test_initialize) {
+      if (file::exists(test_file_name)) file::remove(test_file_name);
+    }
+    
+    static void test_cleanup_(test_clean_up) {
+      if (file::exists(test_file_name)) file::remove(test_file_name);
+    }
+    
+    void test_method_(create_from_file_and_read_content) {
+      std::ofstream(test_file_name, std::ios::binary) << "Hello, World!";
+      auto mapped_file = memory_mapped_file::create_from_file(test_file_name);
+      assert::are_equal(13_z, mapped_file.capacity(), csf_);
+      assert::are_equal(file_access::read, mapped_file.access(), csf_);
+      
+      auto view = mapped_file.create_view_accessor();
+      assert::is_true(view.can_read(), csf_);
+      assert::is_false(view.can_write(), csf_);
+      assert::are_equal(13_z, view.capacity(), csf_);
+      assert::are_equal("Hello, World!", std::string {view.as_string_view()}, csf_);
+      assert::are_equal(13_z, view.as_span().size(), csf_);
+      assert::are_equal(static_cast<xtd::byte>('H'), view.as_span()[0], csf_);
+    }
+    
+    void test_method_(create_view_accessor_with_unaligned_offset) {
+      std::ofstream(test_file_name, std::ios::binary) << "Hello, World!";
+      auto view = memory_mapped_file::create_from_file(test_file_name).create_view_accessor(7, 5);
+      assert::are_equal(5_z, view.capacity(), csf_);
+      assert::are_equal("World", std::string {view.as_string_view()}, csf_);
+    }
+    
+    void test_method_(create_view_accessor_out_of_range) {
+      std::ofstream(test_file_name, std::ios::binary) << "Hello, World!";
+      auto mapped_file = memory_mapped_file::create_from_file(test_file_name);
+      assert::throws<argument_out_of_range_exception>([&] {mapped_file.create_view_accessor(14, 0);}, csf_);
+      assert::throws<argument_out_of_range_exception>([&] {mapped_file.create_view_accessor(7, 7);}, csf_);
+      assert::throws<unauthorized_access_exception>([&] {mapped_file.create_view_accessor(0, 0, file_access::read_write);}, csf_);
+    }
+    
+    void test_method_(create_from_empty_file) {
+      std::ofstream(test_file_name, std::ios::binary).close();
+      assert::throws<argument_exception>([] {memory_mapped_file::create_from_file(test_file_name);}, csf_);
+      assert::throws<file_not_found_exception>([] {memory_mapped_file::create_from_file("not_existing_file.bin");}, csf_);
+    }
+    
+    void test_method_(write_and_read_values) {
+      std::ofstream(test_file_name, std::ios::binary).close();
+      {
+        auto view = memory_mapped_file::create_from_file(test_file_name, file_access::read_write, 64).create_view_accessor();
+        assert::is_true(view.can_write(), csf_);
+        view.write(0, 42);
+        view.write(4, 3.5);
+        auto values = std::vector<int16> {1, 2, 3};
+        view.write_array(12, std::span<const int16> {values});
+        view.flush();
+        assert::throws<argument_out_of_range_exception>([&] {view.write(62, 42);}, csf_);
+      }
+      assert::are_equal(64_z, file::read_all_bytes(test_file_name).size(), csf_);
+      
+      auto view = memory_mapped_file::create_from_file(test_file_name).create_view_accessor();
+      assert::are_equal(42, view.read<int32>(0), csf_);
+      assert::are_equal(3.5, view.read<double>(4), csf_);
+      auto values = std::vector<int16>(3);
+      assert::are_equal(3_z, view.read_array(12, std::span<int16> {values}), csf_);
+      assert::are_equal(std::vector<int16> {1, 2, 3}, values, csf_);
+      assert::throws<not_supported_exception>([&] {view.write(0, 42);}, csf_);
+    }
+    
+    void test_method_(advise) {
+      std::ofstream(test_file_name, std::ios::binary) << std::string(100000, 'x');
+      auto view = file::map_all_bytes(test_file_name);
+      view.advise(memory_mapped_file_advice::sequential);
+      view.advise(memory_mapped_file_advice::will_need);
+      assert::are_equal(std::string(100000, 'x'), std::string {view.as_string_view()}, csf_);
+    }
+    
+    void test_method_(map_all_bytes_of_empty_file) {
+      std::ofstream(test_file_name, std::ios::binary).close();
+      auto view = file::map_all_bytes(test_file_name);
+      assert::are_equal(0_z, view.capacity(), csf_);
+      assert::is_true(view.as_span().empty(), csf_);
+    }
+    
+    void test_method_(binary_reader_over_view) {
+      {
+        auto stream = std::ofstream {test_file_name, std::ios::binary};
+        auto value = 0x12345678;
+        stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+        stream << "abc";
+      }
+      auto reader = binary_reader {file::map_all_bytes(test_file_name)};
+      assert::are_equal(0x12345678, reader.read_int32(), csf_);
+      assert::are_equal('a', reader.read_char(), csf_);
+      reader.seekg(-1, std::ios_base::cur);
+      assert::are_equal(std::vector<char> {'a', 'b', 'c'}, reader.read_chars(3), csf_);
+      assert::is_true(reader.end_of_stream(), csf_);
+      reader.rewind();
+      assert::are_equal(0x12345678, reader.read_int32(), csf_);
+    }
+  };
+}
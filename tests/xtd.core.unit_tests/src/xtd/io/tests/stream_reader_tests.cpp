@@ -0,0 +1,90 @@
+#include <xtd/io/stream_reader>
+#include <xtd/tunit/assert>
+#include <xtd/tunit/test_class_attribute>
+#include <xtd/tunit/test_method_attribute>
+#include <fstream>
+#include <sstream>
+
+using namespace xtd;
+using namespace xtd::io;
+using namespace xtd::tunit;
+
+namespace xtd::io::tests {
+  class test_class_(stream_reader_tests) {
+    static constexpr auto test_file_name = "stream_reader.txt";
+    
+    static void test_initialize_(test_initialize) {
+      if (std::ifstream(test_file_name).good())
+        ::remove(test_file_name);
+    }
+    
+    static void test_cleanup_(test_clean_up) {
+      if (std::ifstream(test_file_name).good())
+        ::remove(test_file_name);
+    }
+    
+    void test_method_(read_line_with_empty_stream) {
+      auto stream = std::stringstream {};
+      auto reader = stream_reader {stream};
+      assert::is_empty(reader.read_line(), csf_);
+      assert::is_true(reader.end_of_stream(), csf_);
+    }
+    
+    void test_method_(read_line_with_carriage_returns) {
+      auto stream = std::stringstream {"line 1\r\nline 2\nline 3"};
+      auto reader = stream_reader {stream};
+      assert::are_equal("line 1", reader.read_line(), csf_);
+      assert::are_equal("line 2", reader.read_line(), csf_);
+      assert::are_equal("line 3", reader.read_line(), csf_);
+      assert::is_true(reader.end_of_stream(), csf_);
+    }
+    
+    void test_method_(read_line_does_not_consume_next_line) {
+      auto stream = std::stringstream {"line 1\nline 2\n"};
+      assert::are_equal("line 1", stream_reader {stream}.read_line(), csf_);
+      assert::are_equal("line 2", stream_reader {stream}.read_line(), csf_);
+    }
+    
+    void test_method_(read_to_end_with_carriage_returns) {
+      auto stream = std::stringstream {"line 1\r\nline 2\r\n"};
+      assert::are_equal("line 1\nline 2\n", stream_reader {stream}.read_to_end(), csf_);
+    }
+    
+    void test_method_(read_to_end_after_read_line) {
+      auto stream = std::stringstream {"line 1\nline 2\nline 3"};
+      auto reader = stream_reader {stream};
+      assert::are_equal("line 1", reader.read_line(), csf_);
+      assert::are_equal("line 2\nline 3", reader.read_to_end(), csf_);
+      assert::is_true(reader.end_of_stream(), csf_);
+    }
+    
+    void test_method_(read_span) {
+      auto stream = std::stringstream {"abcdef"};
+      auto reader = stream_reader {stream};
+      char buffer[4] {};
+      assert::are_equal(4_z, reader.read(std::span<char> {buffer}), csf_);
+      assert::are_equal("abcd", std::string(buffer, 4), csf_);
+      assert::are_equal(2_z, reader.read(std::span<char> {buffer}), csf_);
+      assert::are_equal("ef", std::string(buffer, 2), csf_);
+      assert::are_equal(0_z, reader.read(std::span<char> {buffer}), csf_);
+    }
+    
+    void test_method_(read_lines_from_file_larger_than_buffer) {
+      auto expected = std::string {};
+      for (auto index = 0; index < 20000; ++index)
+        expected += std::to_string(index) + "\n";
+      std::ofstream(test_file_name) << expected;
+      
+      auto reader = stream_reader {test_file_name};
+      for (auto index = 0; index < 20000; ++index)
+        assert::are_equal(std::to_string(index), reader.read_line(), csf_);
+      assert::is_true(reader.end_of_stream(), csf_);
+    }
+    
+    void test_method_(read_to_end_from_file_larger_than_buffer) {
+      auto expected = std::string(200000, 'x');
+      std::ofstream(test_file_name) << expected;
+      assert::are_equal(expected, stream_reader {test_file_name}.read_to_end(), csf_);
+    }
+  };
+}
@@ -0,0 +1,247 @@
+#include <xtd/linq/enumerable>
+#include <xtd/collections/generic/list>
+#include <xtd/argument_out_of_range_exception>
+#include <xtd/invalid_operation_exception>
+#include <xtd/string>
+#include <xtd/tunit/collection_assert>
+#include <xtd/tunit/assert>
+#include <xtd/tunit/test_class_attribute>
+#include <xtd/tunit/test_method_attribute>
+#include <list>
+#include <vector>
+
+using namespace xtd;
+using namespace xtd::collections::generic;
+using namespace xtd::linq;
+using namespace xtd::tunit;
+
+namespace xtd::linq::tests {
+  class test_class_(enumerable_tests) {
+    void test_method_(from_list) {
+      auto items = list<int> {1, 2, 3};
+      collection_assert::are_equal({1, 2, 3}, enumerable::from(items).to_list(), csf_);
+    }
+    
+    void test_method_(from_list_iterator_is_contiguous) {
+      auto items = list<int> {1, 2, 3};
+      assert::is_true(std::contiguous_iterator<decltype(enumerable::from(items).begin())>, csf_);
+    }
+    
+    void test_method_(from_ienumerable) {
+      auto items = list<int> {1, 2, 3};
+      const ienumerable<int>& enumerable = items;
+      collection_assert::are_equal({1, 2, 3}, enumerable::from(enumerable).to_list(), csf_);
+    }
+    
+    void test_method_(from_std_list) {
+      auto items = std::list<int> {1, 2, 3};
+      collection_assert::are_equal({1, 2, 3}, enumerable::from(items).to_list(), csf_);
+    }
+    
+    void test_method_(from_array) {
+      int items[] = {1, 2, 3};
+      collection_assert::are_equal({1, 2, 3}, enumerable::from(items).to_list(), csf_);
+    }
+    
+    template<typename collection_t>
+    static constexpr bool can_query = requires(collection_t&& items) {enumerable::from(std::forward<collection_t>(items));};
+    
+    void test_method_(from_temporary_collection_is_deleted) {
+      assert::is_false(can_query<list<int>>, csf_);
+      assert::is_true(can_query<list<int>&>, csf_);
+      assert::is_true(can_query<const list<int>&>, csf_);
+    }
+    
+    void test_method_(empty) {
+      assert::is_false(enumerable::empty<int>().any(), csf_);
+      assert::is_zero(enumerable::empty<int>().count(), csf_);
+    }
+    
+    void test_method_(range) {
+      collection_assert::are_equal({5, 6, 7, 8}, enumerable::range(5, 4).to_list(), csf_);
+    }
+    
+    void test_method_(repeat) {
+      collection_assert::are_equal({"a", "a", "a"}, enumerable::repeat(string {"a"}, 3).to_list(), csf_);
+    }
+    
+    void test_method_(where) {
+      auto items = list<int> {1, 2, 3, 4, 5, 6};
+      collection_assert::are_equal({2, 4, 6}, enumerable::from(items).where([](int item) {return item % 2 == 0;}).to_list(), csf_);
+    }
+    
+    void test_method_(where_is_deferred) {
+      auto items = list<int> {1, 2, 3};
+      auto query = enumerable::from(items).where([](int item) {return item > 1;});
+      items[0] = 5;
+      collection_assert::are_equal({5, 2, 3}, query.to_list(), csf_);
+    }
+    
+    void test_method_(select) {
+      auto items = list<int> {1, 2, 3};
+      collection_assert::are_equal({"1", "2", "3"}, enumerable::from(items).select([](int item) {return string::format("{}", item);}).to_list(), csf_);
+    }
+    
+    void test_method_(where_and_select_with_range_for) {
+      auto items = list<int> {1, 2, 3, 4, 5, 6};
+      auto result = list<int> {};
+      for (auto item : enumerable::from(items).where([](int item) {return item % 2 == 0;}).select([](int item) {return item * item;}))
+        result.add(item);
+      collection_assert::are_equal({4, 16, 36}, result, csf_);
+    }
+    
+    void test_method_(select_many) {
+      auto items = std::vector<std::vector<int>> {{1, 2}, {}, {3}, {4, 5}};
+      collection_assert::are_equal({1, 2, 3, 4, 5}, enumerable::from(items).select_many([](const std::vector<int>& item) -> const std::vector<int>& {return item;}).to_list(), csf_);
+    }
+    
+    void test_method_(select_many_with_collection_returned_by_value) {
+      auto items = list<int> {1, 2, 3};
+      collection_assert::are_equal({1, 2, 2, 3, 3, 3}, enumerable::from(items).select_many([](int item) {return list<int>(item, item);}).to_list(), csf_);
+    }
+    
+    void test_method_(take) {
+      auto items = list<int> {1, 2, 3, 4};
+      collection_assert::are_equal({1, 2}, enumerable::from(items).take(2).to_list(), csf_);
+      collection_assert::are_equal({1, 2, 3, 4}, enumerable::from(items).take(10).to_list(), csf_);
+      assert::is_zero(enumerable::from(items).take(0).count(), csf_);
+    }
+    
+    void test_method_(take_does_not_enumerate_after_last_element) {
+      auto items = list<int> {1, 2, 3, 4};
+      auto tested = 0;
+      enumerable::from(items).where([&](int) {++tested; return true;}).take(2).to_list();
+      assert::are_equal(2, tested, csf_);
+    }
+    
+    void test_method_(take_while) {
+      auto items = list<int> {1, 2, 3, 1};
+      collection_assert::are_equal({1, 2}, enumerable::from(items).take_while([](int item) {return item < 3;}).to_list(), csf_);
+    }
+    
+    void test_method_(skip) {
+      auto items = std::list<int> {1, 2, 3, 4};
+      collection_assert::are_equal({3, 4}, enumerable::from(items).skip(2).to_list(), csf_);
+      assert::is_zero(enumerable::from(items).skip(10).count(), csf_);
+    }
+    
+    void test_method_(skip_while) {
+      auto items = list<int> {1, 2, 3, 1};
+      collection_assert::are_equal({3, 1}, enumerable::from(items).skip_while([](int item) {return item < 3;}).to_list(), csf_);
+    }
+    
+    void test_method_(distinct) {
+      auto items = list<string> {"b", "a", "b", "c", "a"};
+      collection_assert::are_equal({"b", "a", "c"}, enumerable::from(items).distinct().to_list(), csf_);
+    }
+    
+    void test_method_(order_by) {
+      auto items = list<string> {"ccc", "a", "bb", "dd"};
+      collection_assert::are_equal({"a", "bb", "dd", "ccc"}, enumerable::from(items).order_by([](const string& item) {return item.size();}).to_list(), csf_);
+    }
+    
+    void test_method_(order_by_descending) {
+      auto items = list<string> {"ccc", "a", "bb", "dd"};
+      collection_assert::are_equal({"ccc", "bb", "dd", "a"}, enumerable::from(items).order_by_descending([](const string& item) {return item.size();}).to_list(), csf_);
+    }
+    
+    void test_method_(group_by) {
+      auto items = list<int> {1, 2, 3, 4, 5};
+      auto groups = enumerable::from(items).group_by([](int item) {return item % 2 == 0;}).to_list();
+      assert::are_equal(2_z, groups.count(), csf_);
+      assert::is_false(groups[0].key(), csf_);
+      collection_assert::are_equal({1, 3, 5}, groups[0].elements(), csf_);
+      assert::is_true(groups[1].key(), csf_);
+      collection_assert::are_equal({2, 4}, groups[1].elements(), csf_);
+    }
+    
+    void test_method_(order_by_and_group_by_enumerate_the_source_each_time) {
+      auto items = list<int> {5, 1, 4, 2, 3};
+      auto minimum = 3;
+      auto ordered = enumerable::from(items).where([&](int item) {return item >= minimum;}).order_by([](int item) {return item;});
+      auto grouped = enumerable::from(items).where([&](int item) {return item >= minimum;}).group_by([](int item) {return item % 2 == 0;});
+      collection_assert::are_equal({3, 4, 5}, ordered.to_list(), csf_);
+      assert::are_equal(2_z, grouped.count(), csf_);
+      minimum = 5;
+      collection_assert::are_equal({5}, ordered.to_list(), csf_);
+      assert::are_equal(1_z, grouped.count(), csf_);
+    }
+    
+    void test_method_(aggregate) {
+      auto items = list<int> {1, 2, 3, 4};
+      assert::are_equal(24, enumerable::from(items).aggregate([](int result, int item) {return result * item;}), csf_);
+      assert::are_equal("1234", enumerable::from(items).aggregate(string {}, [](string result, int item) {return result + string::format("{}", item);}), csf_);
+      assert::are_equal(4_z, enumerable::from(items).aggregate(string {}, [](string result, int item) {return result + string::format("{}", item);}, [](const string& result) {return result.size();}), csf_);
+      assert::throws<invalid_operation_exception>([] {enumerable::empty<int>().aggregate([](int result, int item) {return result + item;});}, csf_);
+    }
+    
+    void test_method_(all_and_any) {
+      auto items = list<int> {1, 2, 3};
+      assert::is_true(enumerable::from(items).all([](int item) {return item > 0;}), csf_);
+      assert::is_false(enumerable::from(items).all([](int item) {return item > 1;}), csf_);
+      assert::is_true(enumerable::from(items).any(), csf_);
+      assert::is_true(enumerable::from(items).any([](int item) {return item == 3;}), csf_);
+      assert::is_false(enumerable::from(items).any([](int item) {return item == 4;}), csf_);
+    }
+    
+    void test_method_(contains) {
+      auto items = list<int> {1, 2, 3};
+      assert::is_true(enumerable::from(items).contains(2), csf_);
+      assert::is_false(enumerable::from(items).contains(4), csf_);
+    }
+    
+    void test_method_(count) {
+      auto items = list<int> {1, 2, 3, 4};
+      assert::are_equal(4_z, enumerable::from(items).count(), csf_);
+      assert::are_equal(2_z, enumerable::from(items).count([](int item) {return item % 2 == 0;}), csf_);
+      assert::are_equal(2_z, enumerable::from(items).where([](int item) {return item > 2;}).count(), csf_);
+    }
+    
+    void test_method_(element_at) {
+      auto items = std::list<int> {1, 2, 3};
+      assert::are_equal(2, enumerable::from(items).element_at(1), csf_);
+      assert::are_equal(3, enumerable::range(1, 3).element_at(2), csf_);
+      assert::throws<argument_out_of_range_exception>([&] {enumerable::from(items).element_at(3);}, csf_);
+      assert::throws<argument_out_of_range_exception>([&] {enumerable::range(1, 3).element_at(3);}, csf_);
+    }
+    
+    void test_method_(first_and_last) {
+      auto items = list<int> {1, 2, 3, 4};
+      assert::are_equal(1, enumerable::from(items).first(), csf_);
+      assert::are_equal(2, enumerable::from(items).first([](int item) {return item % 2 == 0;}), csf_);
+      assert::are_equal(4, enumerable::from(items).last(), csf_);
+      assert::throws<invalid_operation_exception>([] {enumerable::empty<int>().first();}, csf_);
+      assert::throws<invalid_operation_exception>([&] {enumerable::from(items).first([](int item) {return item > 4;});}, csf_);
+      assert::throws<invalid_operation_exception>([] {enumerable::empty<int>().last();}, csf_);
+    }
+    
+    void test_method_(first_or_default) {
+      auto items = list<int> {1, 2, 3};
+      assert::are_equal(1, enumerable::from(items).first_or_default(), csf_);
+      assert::is_zero(enumerable::empty<int>().first_or_default(), csf_);
+      assert::are_equal(42, enumerable::empty<int>().first_or_default(42), csf_);
+    }
+    
+    void test_method_(for_each) {
+      auto items = list<int> {1, 2, 3};
+      auto result = 0;
+      enumerable::from(items).for_each([&](int item) {result += item;});
+      assert::are_equal(6, result, csf_);
+    }
+    
+    void test_method_(min_max_sum_and_average) {
+      auto items = list<int> {3, 1, 4, 2};
+      assert::are_equal(1, enumerable::from(items).min(), csf_);
+      assert::are_equal(4, enumerable::from(items).max(), csf_);
+      assert::are_equal(10, enumerable::from(items).sum(), csf_);
+      assert::are_equal(2.5, enumerable::from(items).average(), csf_);
+      assert::throws<invalid_operation_exception>([] {enumerable::empty<int>().min();}, csf_);
+      assert::throws<invalid_operation_exception>([] {enumerable::empty<int>().average();}, csf_);
+    }
+    
+    void test_method_(to_array) {
+      auto items = list<int> {1, 2, 3};
+      collection_assert::are_equal({2, 3}, enumerable::from(items).skip(1).to_array(), csf_);
+    }
+  };
+}
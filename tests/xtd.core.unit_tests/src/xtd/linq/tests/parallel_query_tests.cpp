@@ -0,0 +1,109 @@
+#include <xtd/linq/enumerable>
+#include <xtd/collections/generic/list>
+#include <xtd/argument_out_of_range_exception>
+#include <xtd/invalid_operation_exception>
+#include <xtd/tunit/collection_assert>
+#include <xtd/tunit/assert>
+#include <xtd/tunit/test_class_attribute>
+#include <xtd/tunit/test_method_attribute>
+#include <atomic>
+#include <list>
+
+using namespace xtd;
+using namespace xtd::collections::generic;
+using namespace xtd::linq;
+using namespace xtd::tunit;
+
+namespace xtd::linq::tests {
+  class test_class_(parallel_query_tests) {
+    static list<int64> create_items(int64 count) {
+      return enumerable::range(int64 {0}, static_cast<xtd::size>(count)).to_list();
+    }
+    
+    void test_method_(degree_of_parallelism) {
+      auto items = create_items(10);
+      assert::are_equal(parallel_enumerable::default_degree_of_parallelism(), enumerable::from(items).as_parallel().degree_of_parallelism(), csf_);
+      assert::are_equal(3_z, enumerable::from(items).as_parallel().with_degree_of_parallelism(3).degree_of_parallelism(), csf_);
+      assert::throws<argument_out_of_range_exception>([&] {enumerable::from(items).as_parallel().with_degree_of_parallelism(0);}, csf_);
+    }
+    
+    void test_method_(partition_count) {
+      assert::are_equal(1_z, parallel_enumerable::partition_count(0, 4), csf_);
+      assert::are_equal(1_z, parallel_enumerable::partition_count(2 * parallel_enumerable::min_partition_size - 1, 4), csf_);
+      assert::are_equal(2_z, parallel_enumerable::partition_count(2 * parallel_enumerable::min_partition_size, 4), csf_);
+      assert::are_equal(4_z, parallel_enumerable::partition_count(100 * parallel_enumerable::min_partition_size, 4), csf_);
+    }
+    
+    void test_method_(sum) {
+      auto items = create_items(100'000);
+      assert::are_equal(int64 {4'999'950'000}, enumerable::from(items).as_parallel().with_degree_of_parallelism(4).sum(), csf_);
+    }
+    
+    void test_method_(where_and_select) {
+      auto items = create_items(100'000);
+      auto query = enumerable::from(items).as_parallel().with_degree_of_parallelism(4).where([](int64 item) {return item % 2 == 0;}).select([](int64 item) {return item / 2;});
+      assert::are_equal(50'000_z, query.count(), csf_);
+      assert::are_equal(int64 {1'249'975'000}, query.sum(), csf_);
+    }
+    
+    void test_method_(to_list_keeps_order) {
+      auto items = create_items(100'000);
+      auto result = enumerable::from(items).as_parallel().with_degree_of_parallelism(4).where([](int64 item) {return item % 1000 == 0;}).to_list();
+      assert::are_equal(100_z, result.count(), csf_);
+      for (auto index = 0_z; index < result.count(); ++index)
+        assert::are_equal(static_cast<int64>(index * 1000), result[index], csf_);
+    }
+    
+    void test_method_(to_array) {
+      auto items = create_items(10'000);
+      assert::are_equal(items.count(), enumerable::from(items).as_parallel().with_degree_of_parallelism(4).to_array().size(), csf_);
+    }
+    
+    void test_method_(from_ienumerable) {
+      auto items = create_items(10'000);
+      const ienumerable<int64>& enumerable = items;
+      assert::are_equal(10_z, enumerable::from(enumerable).as_parallel().with_degree_of_parallelism(4).count([](int64 item) {return item < 10;}), csf_);
+    }
+    
+    void test_method_(from_not_contiguous_query) {
+      auto items = std::list<int64> {1, 2, 3, 4};
+      assert::are_equal(int64 {6}, enumerable::from(items).where([](int64 item) {return item % 2 == 0;}).as_parallel().sum(), csf_);
+    }
+    
+    void test_method_(aggregate) {
+      auto items = create_items(10'000);
+      assert::are_equal(10'000_z, enumerable::from(items).as_parallel().with_degree_of_parallelism(4).aggregate(0_z, [](xtd::size result, int64) {return result + 1;}, [](xtd::size a, xtd::size b) {return a + b;}), csf_);
+    }
+    
+    void test_method_(min_max_and_average) {
+      auto items = create_items(10'000);
+      auto query = enumerable::from(items).as_parallel().with_degree_of_parallelism(4);
+      assert::is_zero(query.min(), csf_);
+      assert::are_equal(int64 {9'999}, query.max(), csf_);
+      assert::are_equal(4'999.5, query.average(), csf_);
+      assert::throws<invalid_operation_exception>([&] {query.where([](int64) {return false;}).min();}, csf_);
+    }
+    
+    void test_method_(any_and_all) {
+      auto items = create_items(10'000);
+      auto query = enumerable::from(items).as_parallel().with_degree_of_parallelism(4);
+      assert::is_true(query.any(), csf_);
+      assert::is_true(query.any([](int64 item) {return item == 9'999;}), csf_);
+      assert::is_false(query.any([](int64 item) {return item < 0;}), csf_);
+      assert::is_true(query.all([](int64 item) {return item >= 0;}), csf_);
+      assert::is_false(query.all([](int64 item) {return item < 9'999;}), csf_);
+    }
+    
+    void test_method_(for_each) {
+      auto items = create_items(10'000);
+      auto result = std::atomic<int64> {0};
+      enumerable::from(items).as_parallel().with_degree_of_parallelism(4).for_each([&](int64 item) {result += item;});
+      assert::are_equal(int64 {49'995'000}, result.load(), csf_);
+    }
+    
+    void test_method_(exception_is_rethrown) {
+      auto items = create_items(10'000);
+      assert::throws<invalid_operation_exception>([&] {enumerable::from(items).as_parallel().with_degree_of_parallelism(4).for_each([](int64 item) {if (item == 7'777) throw invalid_operation_exception {};});}, csf_);
+    }
+  };
+}
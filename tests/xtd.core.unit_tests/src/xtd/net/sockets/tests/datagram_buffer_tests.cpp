@@ -0,0 +1,53 @@
+#include <xtd/net/sockets/datagram_buffer>
+#include <xtd/argument_out_of_range_exception>
+#include <xtd/tunit/assert>
+#include <xtd/tunit/test_class_attribute>
+#include <xtd/tunit/test_method_attribute>
+
+using namespace xtd;
+using namespace xtd::net;
+using namespace xtd::net::sockets;
+using namespace xtd::tunit;
+
+namespace xtd::net::sockets::tests {
+  class test_class_(datagram_buffer_tests) {
+    void test_method_(default_constructor) {
+      auto datagram = datagram_buffer {};
+      assert::are_equal(datagram_buffer::default_capacity, datagram.capacity(), csf_);
+      assert::are_equal(datagram_buffer::default_capacity, datagram.buffer().size(), csf_);
+      assert::is_zero(datagram.size(), csf_);
+      assert::is_zero(datagram.segment_size(), csf_);
+      assert::is_true(datagram.data().empty(), csf_);
+      assert::is_false(datagram.truncated(), csf_);
+    }
+    
+    void test_method_(constructor_with_capacity) {
+      auto datagram = datagram_buffer {128};
+      assert::are_equal(128_z, datagram.capacity(), csf_);
+      assert::are_equal(128_z, datagram.buffer().size(), csf_);
+      assert::is_zero(datagram.size(), csf_);
+    }
+    
+    void test_method_(set_size) {
+      auto datagram = datagram_buffer {128};
+      datagram.buffer()[0] = 42;
+      datagram.size(10);
+      assert::are_equal(10_z, datagram.size(), csf_);
+      assert::are_equal(10_z, datagram.segment_size(), csf_);
+      assert::are_equal(10_z, datagram.data().size(), csf_);
+      assert::are_equal(42, datagram.data()[0], csf_);
+    }
+    
+    void test_method_(set_size_greater_than_capacity) {
+      auto datagram = datagram_buffer {128};
+      assert::throws<argument_out_of_range_exception>([&] {datagram.size(129);}, csf_);
+    }
+    
+    void test_method_(set_remote_end_point) {
+      auto datagram = datagram_buffer {128};
+      datagram.remote_end_point(ip_end_point {ip_address::loopback, 9400});
+      assert::are_equal(ip_address::loopback, datagram.remote_end_point().address(), csf_);
+      assert::are_equal(9400, datagram.remote_end_point().port(), csf_);
+    }
+  };
+}
@@ -0,0 +1,18 @@
+#pragma once
+#include <xtd/net/sockets/socket>
+#include <xtd/net/ip_end_point>
+#include <utility>
+
+namespace xtd::net::sockets::tests {
+  // Connects a client to a server through the loopback interface; the listening socket is closed once the connection is accepted.
+  inline std::pair<xtd::net::sockets::socket, xtd::net::sockets::socket> create_loopback_connection() {
+    auto listener = xtd::net::sockets::socket {xtd::net::sockets::address_family::inter_network, xtd::net::sockets::socket_type::stream, xtd::net::sockets::protocol_type::tcp};
+    listener.bind(xtd::net::ip_end_point {xtd::net::ip_address::loopback, 0});
+    listener.listen();
+    auto client = xtd::net::sockets::socket {xtd::net::sockets::address_family::inter_network, xtd::net::sockets::socket_type::stream, xtd::net::sockets::protocol_type::tcp};
+    client.connect(xtd::net::ip_address::loopback, std::dynamic_pointer_cast<xtd::net::ip_end_point>(listener.local_end_point())->port());
+    auto server = listener.accept();
+    listener.close();
+    return {client, server};
+  }
+}
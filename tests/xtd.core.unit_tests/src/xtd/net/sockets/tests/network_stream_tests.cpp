@@ -0,0 +1,104 @@
+#include <xtd/io/stream_reader>
+#include <xtd/io/stream_writer>
+#include <xtd/net/sockets/network_stream>
+#include "loopback_connection.h"
+#include <xtd/tunit/assert>
+#include <xtd/tunit/test_class_attribute>
+#include <xtd/tunit/test_method_attribute>
+#include <numeric>
+#include <thread>
+
+using namespace xtd;
+using namespace xtd::io;
+using namespace xtd::net;
+using namespace xtd::net::sockets;
+using namespace xtd::tunit;
+
+namespace xtd::net::sockets::tests {
+  class test_class_(network_stream_tests) {
+    void test_method_(write_and_read_lines) {
+      auto [client, server] = create_loopback_connection();
+      auto client_stream = network_stream {client, true};
+      auto server_stream = network_stream {server, true};
+      auto writer = stream_writer {client_stream};
+      auto reader = stream_reader {server_stream};
+      
+      // Each write is sent immediately : the reader must not wait for the send buffer to be full.
+      writer.write_line("line 1");
+      assert::are_equal("line 1", reader.read_line(), csf_);
+      writer.write_line("line 2");
+      writer.write_line("line 3");
+      assert::are_equal("line 2", reader.read_line(), csf_);
+      assert::is_true(server_stream.data_available(), csf_);
+      assert::are_equal("line 3", reader.read_line(), csf_);
+    }
+    
+    void test_method_(write_and_read_spans_throughput) {
+      auto [client, server] = create_loopback_connection();
+      auto data = std::vector<xtd::byte>(16 * 1024 * 1024);
+      for (auto index = 0_z; index < data.size(); ++index)
+        data[index] = static_cast<xtd::byte>(index * 31);
+      
+      auto sender = std::thread {[&, client = client] {
+        auto stream = network_stream {client, true};
+        for (auto offset = 0_z; offset < data.size(); offset += 100000)
+          stream.write(std::span<const xtd::byte> {data}.subspan(offset, std::min(100000_z, data.size() - offset)));
+      }};
+      
+      auto stream = network_stream {server, true};
+      auto received = std::vector<xtd::byte>(data.size());
+      auto total = 0_z;
+      while (total < received.size()) {
+        auto count = stream.read(std::span<xtd::byte> {received}.subspan(total));
+        if (count == 0) break;
+        total += count;
+      }
+      sender.join();
+      assert::are_equal(data.size(), total, csf_);
+      assert::is_true(data == received, csf_);
+    }
+    
+    void test_method_(write_span_larger_than_send_buffer_after_buffered_data) {
+      auto [client, server] = create_loopback_connection();
+      auto data = std::vector<xtd::byte>(100);
+      std::iota(data.begin(), data.end(), xtd::byte {0});
+      
+      auto client_stream = network_stream {client, true, 16, 16};
+      client_stream.unsetf(std::ios_base::unitbuf);
+      client_stream.write(reinterpret_cast<const char*>(data.data()), 10);
+      client_stream.write(std::span<const xtd::byte> {data}.subspan(10));
+      
+      auto server_stream = network_stream {server, true};
+      auto received = std::vector<xtd::byte>(data.size());
+      auto total = 0_z;
+      while (total < received.size()) {
+        auto count = server_stream.read(std::span<xtd::byte> {received}.subspan(total));
+        if (count == 0) break;
+        total += count;
+      }
+      assert::are_equal(data.size(), total, csf_);
+      assert::is_true(data == received, csf_);
+    }
+    
+    void test_method_(write_and_read_with_iostream) {
+      auto [client, server] = create_loopback_connection();
+      auto data = std::string(1024 * 1024, ' ');
+      std::iota(data.begin(), data.end(), 'a');
+      
+      auto sender = std::thread {[&, client = client] {
+        auto stream = network_stream {client, true};
+        stream.unsetf(std::ios_base::unitbuf);
+        stream.write(data.data(), static_cast<std::streamsize>(data.size()));
+        stream.flush();
+      }};
+      
+      auto stream = network_stream {server, true};
+      auto received = std::string(data.size(), '\0');
+      stream.read(received.data(), static_cast<std::streamsize>(received.size()));
+      sender.join();
+      assert::are_equal(static_cast<std::streamsize>(data.size()), stream.gcount(), csf_);
+      assert::is_true(data == received, csf_);
+      assert::are_equal(std::char_traits<char>::eof(), stream.get(), csf_);
+    }
+  };
+}
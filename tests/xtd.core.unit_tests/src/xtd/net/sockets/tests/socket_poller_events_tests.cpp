@@ -0,0 +1,41 @@
+#include <xtd/net/sockets/socket_poller_events>
+#include <xtd/tunit/assert>
+#include <xtd/tunit/test_class_attribute>
+#include <xtd/tunit/test_method_attribute>
+
+using namespace xtd::net::sockets;
+using namespace xtd::tunit;
+
+namespace xtd::tests {
+  class test_class_(socket_poller_events_tests) {
+    void test_method_(none) {
+      assert::are_equal(0, enum_object<>::to_int32(socket_poller_events::none), csf_);
+      assert::are_equal("none", enum_object<>::to_string(socket_poller_events::none), csf_);
+      assert::are_equal(socket_poller_events::none, enum_object<>::parse<socket_poller_events>("none"), csf_);
+    }
+    
+    void test_method_(read) {
+      assert::are_equal(1, enum_object<>::to_int32(socket_poller_events::read), csf_);
+      assert::are_equal("read", enum_object<>::to_string(socket_poller_events::read), csf_);
+      assert::are_equal(socket_poller_events::read, enum_object<>::parse<socket_poller_events>("read"), csf_);
+    }
+    
+    void test_method_(write) {
+      assert::are_equal(2, enum_object<>::to_int32(socket_poller_events::write), csf_);
+      assert::are_equal("write", enum_object<>::to_string(socket_poller_events::write), csf_);
+      assert::are_equal(socket_poller_events::write, enum_object<>::parse<socket_poller_events>("write"), csf_);
+    }
+    
+    void test_method_(error) {
+      assert::are_equal(4, enum_object<>::to_int32(socket_poller_events::error), csf_);
+      assert::are_equal("error", enum_object<>::to_string(socket_poller_events::error), csf_);
+      assert::are_equal(socket_poller_events::error, enum_object<>::parse<socket_poller_events>("error"), csf_);
+    }
+    
+    void test_method_(hang_up) {
+      assert::are_equal(8, enum_object<>::to_int32(socket_poller_events::hang_up), csf_);
+      assert::are_equal("hang_up", enum_object<>::to_string(socket_poller_events::hang_up), csf_);
+      assert::are_equal(socket_poller_events::hang_up, enum_object<>::parse<socket_poller_events>("hang_up"), csf_);
+    }
+  };
+}
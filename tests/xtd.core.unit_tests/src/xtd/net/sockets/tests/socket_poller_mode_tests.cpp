@@ -0,0 +1,23 @@
+#include <xtd/net/sockets/socket_poller_mode>
+#include <xtd/tunit/assert>
+#include <xtd/tunit/test_class_attribute>
+#include <xtd/tunit/test_method_attribute>
+
+using namespace xtd::net::sockets;
+using namespace xtd::tunit;
+
+namespace xtd::tests {
+  class test_class_(socket_poller_mode_tests) {
+    void test_method_(level_triggered) {
+      assert::are_equal(0, enum_object<>::to_int32(socket_poller_mode::level_triggered), csf_);
+      assert::are_equal("level_triggered", enum_object<>::to_string(socket_poller_mode::level_triggered), csf_);
+      assert::are_equal(socket_poller_mode::level_triggered, enum_object<>::parse<socket_poller_mode>("level_triggered"), csf_);
+    }
+    
+    void test_method_(edge_triggered) {
+      assert::are_equal(1, enum_object<>::to_int32(socket_poller_mode::edge_triggered), csf_);
+      assert::are_equal("edge_triggered", enum_object<>::to_string(socket_poller_mode::edge_triggered), csf_);
+      assert::are_equal(socket_poller_mode::edge_triggered, enum_object<>::parse<socket_poller_mode>("edge_triggered"), csf_);
+    }
+  };
+}
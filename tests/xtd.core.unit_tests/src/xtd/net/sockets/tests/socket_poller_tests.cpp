@@ -0,0 +1,141 @@
+#include <xtd/net/sockets/socket_poller>
+#include <xtd/argument_exception>
+#include <xtd/object_closed_exception>
+#include <xtd/threading/thread>
+#include "loopback_connection.h"
+#include <xtd/tunit/assert>
+#include <xtd/tunit/test_class_attribute>
+#include <xtd/tunit/test_method_attribute>
+
+using namespace xtd;
+using namespace xtd::net;
+using namespace xtd::net::sockets;
+using namespace xtd::tunit;
+
+namespace xtd::net::sockets::tests {
+  class test_class_(socket_poller_tests) {
+    void test_method_(create) {
+      auto poller = socket_poller {};
+      assert::are_equal(0_z, poller.count(), csf_);
+    }
+    
+    void test_method_(add_and_remove) {
+      auto [client, server] = create_loopback_connection();
+      auto poller = socket_poller {};
+      poller.add(server, socket_poller_events::read);
+      assert::are_equal(1_z, poller.count(), csf_);
+      assert::is_true(poller.remove(server), csf_);
+      assert::is_false(poller.remove(server), csf_);
+      assert::are_equal(0_z, poller.count(), csf_);
+    }
+    
+    void test_method_(add_twice) {
+      auto [client, server] = create_loopback_connection();
+      auto poller = socket_poller {};
+      poller.add(server, socket_poller_events::read);
+      assert::throws<argument_exception>([&] {poller.add(server, socket_poller_events::read);}, csf_);
+    }
+    
+    void test_method_(add_closed_socket) {
+      auto s = socket {address_family::inter_network, socket_type::stream, protocol_type::tcp};
+      s.close();
+      auto poller = socket_poller {};
+      assert::throws<object_closed_exception>([&] {poller.add(s, socket_poller_events::read);}, csf_);
+    }
+    
+    void test_method_(modify_not_registered_socket) {
+      auto [client, server] = create_loopback_connection();
+      auto poller = socket_poller {};
+      assert::throws<argument_exception>([&] {poller.modify(server, socket_poller_events::write);}, csf_);
+    }
+    
+    void test_method_(wait_timeout) {
+      auto [client, server] = create_loopback_connection();
+      auto poller = socket_poller {};
+      poller.add(server, socket_poller_events::read);
+      auto ready_sockets = std::vector<socket_poller::ready_socket> {};
+      assert::are_equal(0_z, poller.wait(ready_sockets, 10), csf_);
+      assert::is_empty(ready_sockets, csf_);
+    }
+    
+    void test_method_(wait_read_level_triggered) {
+      auto [client, server] = create_loopback_connection();
+      auto poller = socket_poller {};
+      poller.add(server, socket_poller_events::read);
+      client.send(std::vector<xtd::byte> {42});
+      auto ready_sockets = std::vector<socket_poller::ready_socket> {};
+      assert::are_equal(1_z, poller.wait(ready_sockets, 1000), csf_);
+      assert::are_equal(server.handle(), ready_sockets[0].socket.handle(), csf_);
+      assert::are_equal(socket_poller_events::read, ready_sockets[0].events & socket_poller_events::read, csf_);
+      // The data has not been read : the socket is reported again.
+      assert::are_equal(1_z, poller.wait(ready_sockets, 1000), csf_);
+      auto buffer = std::vector<xtd::byte>(1);
+      server.receive(buffer);
+      assert::are_equal(0_z, poller.wait(ready_sockets, 10), csf_);
+    }
+    
+    void test_method_(wait_write) {
+      auto [client, server] = create_loopback_connection();
+      auto poller = socket_poller {};
+      poller.add(client, socket_poller_events::read | socket_poller_events::write);
+      auto ready_sockets = std::vector<socket_poller::ready_socket> {};
+      assert::are_equal(1_z, poller.wait(ready_sockets, 1000), csf_);
+      assert::are_equal(socket_poller_events::write, ready_sockets[0].events, csf_);
+      poller.modify(client, socket_poller_events::read);
+      assert::are_equal(0_z, poller.wait(ready_sockets, 10), csf_);
+    }
+    
+    void test_method_(wait_hang_up) {
+      auto [client, server] = create_loopback_connection();
+      auto poller = socket_poller {};
+      poller.add(server, socket_poller_events::read);
+      client.close();
+      auto ready_sockets = std::vector<socket_poller::ready_socket> {};
+      assert::are_equal(1_z, poller.wait(ready_sockets, 1000), csf_);
+      auto buffer = std::vector<xtd::byte>(1);
+      assert::are_equal(0_z, server.receive(buffer), csf_);
+    }
+    
+    void test_method_(wait_many_sockets) {
+      constexpr auto connection_count = 64;
+      auto pairs = std::vector<std::pair<socket, socket>> {};
+      auto poller = socket_poller {};
+      for (auto index = 0; index < connection_count; ++index) {
+        pairs.push_back(create_loopback_connection());
+        poller.add(pairs.back().second, socket_poller_events::read);
+      }
+      for (auto index = 0; index < connection_count; index += 2)
+        pairs[index].first.send(std::vector<xtd::byte> {static_cast<xtd::byte>(index)});
+      
+      auto ready_count = 0_z;
+      auto ready_sockets = std::vector<socket_poller::ready_socket> {};
+      for (auto attempt = 0; attempt < 100 && ready_count < connection_count / 2; ++attempt) {
+        ready_count = poller.wait(ready_sockets, 100);
+      }
+      assert::are_equal(static_cast<size_t>(connection_count / 2), ready_count, csf_);
+    }
+    
+    void test_method_(close) {
+      auto poller = socket_poller {};
+      poller.close();
+      auto ready_sockets = std::vector<socket_poller::ready_socket> {};
+      assert::throws<object_closed_exception>([&] {poller.wait(ready_sockets, 0);}, csf_);
+    }
+    
+    void test_method_(close_while_waiting) {
+      auto poller = socket_poller {};
+      auto [client, server] = create_loopback_connection();
+      poller.add(server, socket_poller_events::read);
+      auto ready_count = 1_z;
+      auto waiter = xtd::threading::thread::start_new([&] {
+        auto ready_sockets = std::vector<socket_poller::ready_socket> {};
+        ready_count = poller.wait(ready_sockets, -1);
+      });
+      xtd::threading::thread::sleep(50);
+      poller.close();
+      
+      assert::is_true(waiter.join(5000), csf_);
+      assert::are_equal(0_z, ready_count, csf_);
+    }
+  };
+}
@@ -1,20 +1,40 @@
 #include <xtd/net/sockets/socket>
+#include <xtd/net/sockets/socket_async_event_args>
 #include <xtd/net/sockets/socket_exception>
 #include <xtd/net/ip_end_point>
+#include <xtd/threading/countdown_event>
+#include <xtd/threading/manual_reset_event>
+#include <xtd/io/file>
+#include <xtd/io/file_not_found_exception>
+#include <xtd/io/path>
 #include <xtd/environment>
 #include <xtd/object_closed_exception>
+#include "loopback_connection.h"
 #include <xtd/tunit/assert>
 #include <xtd/tunit/assume>
+#include <xtd/tunit/collection_assert>
 #include <xtd/tunit/test_class_attribute>
 #include <xtd/tunit/test_method_attribute>
 
 using namespace xtd;
 using namespace xtd::net;
 using namespace xtd::net::sockets;
+using namespace xtd::threading;
 using namespace xtd::tunit;
 
 namespace xtd::net::sockets::tests {
   class test_class_(socket_tests) {
+    static std::string receive_string(socket& s, size_t size) {
+      auto result = std::string {};
+      auto buffer = std::vector<xtd::byte>(4096);
+      while (result.size() < size) {
+        auto count = s.receive(buffer, 0, std::min(buffer.size(), size - result.size()), socket_flags::none);
+        if (count == 0) break;
+        result.append(reinterpret_cast<const char*>(buffer.data()), count);
+      }
+      return result;
+    }
+    
     void test_method_(os_supports_ip_v4) {
       assume::is_true(socket::os_supports_ip_v4(), csf_);
     }
@@ -286,5 +306,203 @@ namespace xtd::net::sockets::tests {
       s.send_timeout(1000);
       assert::are_equal(1000, s.send_timeout(), csf_);
     }
+    
+    void test_method_(bind_to_port_zero) {
+      auto s = socket {address_family::inter_network, socket_type::stream, protocol_type::tcp};
+      s.bind(ip_end_point {ip_address::loopback, 0});
+      auto local_end_point = std::dynamic_pointer_cast<ip_end_point>(s.local_end_point());
+      assert::are_equal(ip_address::loopback, local_end_point->address(), csf_);
+      assert::are_not_equal(uint16 {0}, local_end_point->port(), csf_);
+    }
+    
+    void test_method_(local_end_point_after_send_to) {
+      auto receiver = socket {address_family::inter_network, socket_type::dgram, protocol_type::udp};
+      receiver.bind(ip_end_point {ip_address::loopback, 0});
+      auto sender = socket {address_family::inter_network, socket_type::dgram, protocol_type::udp};
+      assert::is_null(sender.local_end_point(), csf_);
+      sender.send_to(std::vector<xtd::byte> {1, 2, 3}, *receiver.local_end_point());
+      auto local_end_point = std::dynamic_pointer_cast<ip_end_point>(sender.local_end_point());
+      assert::is_not_null(local_end_point, csf_);
+      assert::are_not_equal(uint16 {0}, local_end_point->port(), csf_);
+    }
+    
+    void test_method_(begin_accept_begin_connect_begin_send_and_begin_receive) {
+      auto listener = socket {address_family::inter_network, socket_type::stream, protocol_type::tcp};
+      listener.bind(ip_end_point {ip_address::loopback, 0});
+      listener.listen();
+      auto accept_result = listener.begin_accept(async_callback {}, std::any {});
+      auto client = socket {address_family::inter_network, socket_type::stream, protocol_type::tcp};
+      client.end_connect(client.begin_connect(ip_address::loopback, std::dynamic_pointer_cast<ip_end_point>(listener.local_end_point())->port(), async_callback {}, std::any {}));
+      assert::is_true(client.connected(), csf_);
+      assert::is_true(client.blocking(), csf_);
+      auto server = listener.end_accept(accept_result);
+      
+      auto received = std::vector<xtd::byte>(4);
+      auto receive_result = server.begin_receive(received, 0, received.size(), socket_flags::none, async_callback {}, std::any {});
+      assert::are_equal(4_z, client.end_send(client.begin_send(std::vector<xtd::byte> {1, 2, 3, 4}, 0, 4, socket_flags::none, async_callback {}, std::any {})), csf_);
+      assert::are_equal(4_z, server.end_receive(receive_result), csf_);
+      assert::are_equal(std::vector<xtd::byte> {1, 2, 3, 4}, received, csf_);
+    }
+    
+    void test_method_(begin_connect_to_closed_port) {
+      auto unused = socket {address_family::inter_network, socket_type::stream, protocol_type::tcp};
+      unused.bind(ip_end_point {ip_address::loopback, 0});
+      auto port = std::dynamic_pointer_cast<ip_end_point>(unused.local_end_point())->port();
+      auto client = socket {address_family::inter_network, socket_type::stream, protocol_type::tcp};
+      auto completed = countdown_event {1};
+      auto result = client.begin_connect(ip_address::loopback, port, async_callback {[&](xtd::sptr<xtd::iasync_result>) {completed.signal();}}, std::any {});
+      // The callback is called even if the connection fails.
+      assert::is_true(completed.wait(5000), csf_);
+      assert::throws<socket_exception>([&] {client.end_connect(result);}, csf_);
+      assert::is_false(client.connected(), csf_);
+    }
+    
+    void test_method_(close_completes_pending_begin_receive) {
+      auto listener = socket {address_family::inter_network, socket_type::stream, protocol_type::tcp};
+      listener.bind(ip_end_point {ip_address::loopback, 0});
+      listener.listen();
+      auto client = socket {address_family::inter_network, socket_type::stream, protocol_type::tcp};
+      client.connect(ip_address::loopback, std::dynamic_pointer_cast<ip_end_point>(listener.local_end_point())->port());
+      auto server = listener.accept();
+      
+      auto buffer = std::vector<xtd::byte>(16);
+      auto result = server.begin_receive(buffer, 0, buffer.size(), socket_flags::none, async_callback {}, std::any {});
+      server.close();
+      assert::is_true(result->async_wait_handle().wait_one(5000), csf_);
+      assert::throws<object_closed_exception>([&] {server.end_receive(result);}, csf_);
+    }
+    
+    void test_method_(send_and_receive_buffer_lists) {
+      auto [client, server] = create_loopback_connection();
+      auto header = std::vector<xtd::byte> {1, 2, 3};
+      auto body = std::vector<xtd::byte> {4, 5, 6, 7};
+      assert::are_equal(7_z, client.send(std::vector<std::span<const xtd::byte>> {header, body}), csf_);
+      
+      auto first = std::vector<xtd::byte>(2);
+      auto second = std::vector<xtd::byte>(5);
+      assert::are_equal(7_z, server.receive(std::vector<std::span<xtd::byte>> {first, second}), csf_);
+      collection_assert::are_equal(std::vector<xtd::byte> {1, 2}, first, csf_);
+      collection_assert::are_equal(std::vector<xtd::byte> {3, 4, 5, 6, 7}, second, csf_);
+    }
+    
+    void test_method_(send_and_receive_more_buffers_than_io_vector_limit) {
+      auto [client, server] = create_loopback_connection();
+      auto data = std::vector<xtd::byte>(5000);
+      for (auto index = 0_z; index < data.size(); ++index)
+        data[index] = static_cast<xtd::byte>(index);
+      auto send_buffers = std::vector<std::span<const xtd::byte>> {};
+      for (auto index = 0_z; index < data.size(); ++index)
+        send_buffers.emplace_back(&data[index], 1);
+      assert::are_equal(data.size(), client.send(send_buffers), csf_);
+      
+      auto received = std::vector<xtd::byte>(data.size());
+      auto receive_buffers = std::vector<std::span<xtd::byte>> {};
+      for (auto index = 0_z; index < received.size(); ++index)
+        receive_buffers.emplace_back(&received[index], 1);
+      auto total = 0_z;
+      while (total < received.size())
+        total += server.receive(std::vector<std::span<xtd::byte>> {receive_buffers.begin() + total, receive_buffers.end()});
+      collection_assert::are_equal(data, received, csf_);
+    }
+    
+    void test_method_(send_file) {
+      auto file_name = io::path::combine(io::path::get_temp_path(), "xtd_socket_send_file.txt");
+      auto content = std::string {};
+      for (auto index = 0; index < 2000; ++index)
+        content += "0123456789";
+      io::file::write_all_text(file_name, content);
+      auto [client, server] = create_loopback_connection();
+      client.send_file(file_name);
+      assert::are_equal(content, receive_string(server, content.size()), csf_);
+      io::file::remove(file_name);
+    }
+    
+    void test_method_(send_file_with_pre_and_post_buffers) {
+      auto file_name = io::path::combine(io::path::get_temp_path(), "xtd_socket_send_file_with_buffers.txt");
+      io::file::write_all_text(file_name, "body");
+      auto [client, server] = create_loopback_connection();
+      client.send_file(file_name, {'<'}, {'>'}, transmit_file_options::use_default_worker_thread);
+      assert::are_equal("<body>", receive_string(server, 6), csf_);
+      io::file::remove(file_name);
+    }
+    
+    void test_method_(send_file_not_found) {
+      auto [client, server] = create_loopback_connection();
+      assert::throws<io::file_not_found_exception>([&] {client.send_file(io::path::combine(io::path::get_temp_path(), "xtd_socket_not_found.txt"));}, csf_);
+    }
+    
+    void test_method_(send_packets_async) {
+      auto file_name = io::path::combine(io::path::get_temp_path(), "xtd_socket_send_packets.txt");
+      io::file::write_all_text(file_name, "0123456789");
+      auto [client, server] = create_loopback_connection();
+      auto completed = manual_reset_event {false};
+      auto e = socket_async_event_args {};
+      e.send_packets_elements({send_packets_element {std::vector<xtd::byte> {'['}}, send_packets_element {file_name, 2, 5}, send_packets_element {std::vector<xtd::byte> {'a', 'b', ']'}, 2, 1}});
+      e.completed += [&](const socket_async_event_args&) {completed.set();};
+      assert::is_true(client.send_packets_async(e), csf_);
+      assert::is_true(completed.wait_one(10000), csf_);
+      assert::are_equal(socket_error::success, e.socket_error(), csf_);
+      assert::are_equal(7_z, e.bytes_transferred(), csf_);
+      assert::are_equal("[23456]", receive_string(server, 7), csf_);
+      io::file::remove(file_name);
+    }
+    
+    void test_method_(select_keeps_only_ready_sockets) {
+      constexpr auto connection_count = 64;
+      auto listener = socket {address_family::inter_network, socket_type::stream, protocol_type::tcp};
+      listener.bind(ip_end_point {ip_address::loopback, 0});
+      listener.listen(connection_count);
+      auto port = std::dynamic_pointer_cast<ip_end_point>(listener.local_end_point())->port();
+      auto clients = std::vector<socket> {};
+      auto servers = std::vector<socket> {};
+      for (auto index = 0; index < connection_count; ++index) {
+        clients.emplace_back(address_family::inter_network, socket_type::stream, protocol_type::tcp);
+        clients.back().connect(ip_address::loopback, port);
+        servers.push_back(listener.accept());
+      }
+      for (auto index = 1; index < connection_count; index += 2)
+        clients[index].send(std::vector<xtd::byte> {static_cast<xtd::byte>(index)});
+      
+      auto check_read = servers;
+      auto check_write = std::vector<socket> {};
+      auto check_error = std::vector<socket> {};
+      for (auto attempt = 0; attempt < 100 && check_read.size() != connection_count / 2; ++attempt) {
+        check_read = servers;
+        socket::select(check_read, check_write, check_error, 100000);
+      }
+      assert::are_equal(static_cast<size_t>(connection_count / 2), check_read.size(), csf_);
+      for (auto index = 0_z; index < check_read.size(); ++index)
+        assert::are_equal(servers[index * 2 + 1].handle(), check_read[index].handle(), csf_);
+    }
+    
+    void test_method_(many_concurrent_begin_receive) {
+      // Each pending receive used to block its own thread. The connection count stays below the default limit of 1024 open files.
+      constexpr auto connection_count = 256;
+      auto listener = socket {address_family::inter_network, socket_type::stream, protocol_type::tcp};
+      listener.bind(ip_end_point {ip_address::loopback, 0});
+      listener.listen(connection_count);
+      auto port = std::dynamic_pointer_cast<ip_end_point>(listener.local_end_point())->port();
+      auto clients = std::vector<socket> {};
+      auto servers = std::vector<socket> {};
+      for (auto index = 0; index < connection_count; ++index) {
+        clients.emplace_back(address_family::inter_network, socket_type::stream, protocol_type::tcp);
+        clients.back().connect(ip_address::loopback, port);
+        servers.push_back(listener.accept());
+      }
+      
+      auto buffers = std::vector<std::vector<xtd::byte>>(connection_count, std::vector<xtd::byte>(1));
+      auto received = countdown_event {connection_count};
+      auto results = std::vector<xtd::sptr<xtd::iasync_result>> {};
+      for (auto index = 0; index < connection_count; ++index)
+        results.push_back(servers[index].begin_receive(buffers[index], 0, 1, socket_flags::none, async_callback {[&](xtd::sptr<xtd::iasync_result>) {received.signal();}}, std::any {}));
+      for (auto index = 0; index < connection_count; ++index)
+        clients[index].send(std::vector<xtd::byte> {static_cast<xtd::byte>(index)});
+      
+      assert::is_true(received.wait(10000), csf_);
+      for (auto index = 0; index < connection_count; ++index) {
+        assert::are_equal(1_z, servers[index].end_receive(results[index]), csf_);
+        assert::are_equal(static_cast<xtd::byte>(index), buffers[index][0], csf_);
+      }
+    }
   };
 }
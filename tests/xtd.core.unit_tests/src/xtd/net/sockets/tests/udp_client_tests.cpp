@@ -0,0 +1,154 @@
+#include <xtd/net/sockets/udp_client>
+#include <xtd/net/ip_end_point>
+#include <xtd/object_closed_exception>
+#include <xtd/tunit/assert>
+#include <xtd/tunit/collection_assert>
+#include <xtd/tunit/test_class_attribute>
+#include <xtd/tunit/test_method_attribute>
+
+using namespace xtd;
+using namespace xtd::net;
+using namespace xtd::net::sockets;
+using namespace xtd::tunit;
+
+namespace xtd::net::sockets::tests {
+  class test_class_(udp_client_tests) {
+    static udp_client create_receiver() {
+      auto receiver = udp_client {ip_end_point {ip_address::loopback, 0}};
+      receiver.client().receive_timeout(5000);
+      return receiver;
+    }
+    
+    static ip_end_point local_end_point(const udp_client& client) {
+      return *std::dynamic_pointer_cast<ip_end_point>(client.client().local_end_point());
+    }
+    
+    static std::vector<datagram_buffer> receive_all(udp_client& receiver, size_t count, size_t capacity) {
+      auto result = std::vector<datagram_buffer> {};
+      auto datagrams = std::vector<datagram_buffer>(count, datagram_buffer {capacity});
+      while (result.size() < count) {
+        auto received = receiver.receive_batch(std::span<datagram_buffer> {datagrams.data(), count - result.size()});
+        result.insert(result.end(), datagrams.begin(), datagrams.begin() + received);
+      }
+      return result;
+    }
+    
+    static datagram_buffer create_datagram(const std::string& value) {
+      auto datagram = datagram_buffer {value.size()};
+      std::copy(value.begin(), value.end(), datagram.buffer().begin());
+      datagram.size(value.size());
+      return datagram;
+    }
+    
+    static std::string to_string(const datagram_buffer& datagram) {
+      return std::string {datagram.data().begin(), datagram.data().end()};
+    }
+    
+    void test_method_(receive_offload_is_false_by_default) {
+      auto client = udp_client {};
+      assert::is_false(client.receive_offload(), csf_);
+    }
+    
+    void test_method_(receive_offload_on_closed_client) {
+      auto client = udp_client {};
+      client.close();
+      assert::throws<object_closed_exception>([&] {client.receive_offload(true);}, csf_);
+    }
+    
+    void test_method_(receive_batch_with_empty_span) {
+      auto receiver = create_receiver();
+      assert::is_zero(receiver.receive_batch(std::span<datagram_buffer> {}), csf_);
+    }
+    
+    void test_method_(receive_batch_on_closed_client) {
+      auto receiver = create_receiver();
+      auto datagrams = std::vector<datagram_buffer>(2, datagram_buffer {16});
+      receiver.close();
+      assert::throws<object_closed_exception>([&] {receiver.receive_batch(datagrams);}, csf_);
+    }
+    
+    void test_method_(send_batch_on_closed_client) {
+      auto sender = udp_client {};
+      auto datagrams = std::vector<datagram_buffer>(2, datagram_buffer {16});
+      sender.close();
+      assert::throws<object_closed_exception>([&] {sender.send_batch(datagrams);}, csf_);
+    }
+    
+    void test_method_(send_batch_and_receive_batch) {
+      auto receiver = create_receiver();
+      auto sender = udp_client {};
+      auto datagrams = std::vector {create_datagram("one"), create_datagram("two"), create_datagram("three")};
+      for (auto& datagram : datagrams)
+        datagram.remote_end_point(local_end_point(receiver));
+      
+      assert::are_equal(11_z, sender.send_batch(datagrams), csf_);
+      auto received = receive_all(receiver, 3, 64);
+      assert::are_equal("one", to_string(received[0]), csf_);
+      assert::are_equal("two", to_string(received[1]), csf_);
+      assert::are_equal("three", to_string(received[2]), csf_);
+      for (const auto& datagram : received) {
+        assert::is_false(datagram.truncated(), csf_);
+        assert::are_equal(datagram.size(), datagram.segment_size(), csf_);
+        assert::are_equal(ip_address::loopback, datagram.remote_end_point().address(), csf_);
+        assert::are_equal(local_end_point(sender).port(), datagram.remote_end_point().port(), csf_);
+      }
+    }
+    
+    void test_method_(send_batch_to_connected_remote_host) {
+      auto receiver = create_receiver();
+      auto sender = udp_client {};
+      sender.connect(local_end_point(receiver));
+      auto datagrams = std::vector {create_datagram("first"), create_datagram("second")};
+      
+      sender.send_batch(datagrams);
+      auto received = receive_all(receiver, 2, 64);
+      assert::are_equal("first", to_string(received[0]), csf_);
+      assert::are_equal("second", to_string(received[1]), csf_);
+    }
+    
+    void test_method_(send_batch_keeps_datagram_boundaries) {
+      // Datagrams of the same size sent to the same remote host can be gathered by segmentation offload : the receiver must still get them one by one.
+      auto receiver = create_receiver();
+      auto sender = udp_client {};
+      auto datagrams = std::vector<datagram_buffer> {};
+      for (auto index = 0; index < 20; ++index) {
+        auto datagram = create_datagram(std::string(100, static_cast<char>('a' + index)));
+        datagram.remote_end_point(local_end_point(receiver));
+        datagrams.push_back(datagram);
+      }
+      datagrams.back().size(50);
+      
+      assert::are_equal(19_z * 100 + 50, sender.send_batch(datagrams), csf_);
+      auto received = receive_all(receiver, 20, 1024);
+      for (auto index = 0_z; index < received.size(); ++index)
+        assert::are_equal(std::string(index == 19 ? 50 : 100, static_cast<char>('a' + index)), to_string(received[index]), csf_);
+    }
+    
+    void test_method_(receive_batch_truncates_large_datagram) {
+      auto receiver = create_receiver();
+      auto sender = udp_client {};
+      sender.send(std::vector<xtd::byte> {1, 2, 3, 4, 5, 6, 7, 8}, 8, local_end_point(receiver));
+      
+      auto received = receive_all(receiver, 1, 4);
+      assert::is_true(received[0].truncated(), csf_);
+      assert::are_equal(4_z, received[0].size(), csf_);
+      collection_assert::are_equal(std::vector<xtd::byte> {1, 2, 3, 4}, std::vector<xtd::byte> {received[0].data().begin(), received[0].data().end()}, csf_);
+    }
+    
+    void test_method_(receive_batch_reuses_datagram_buffers) {
+      auto receiver = create_receiver();
+      auto first_sender = udp_client {};
+      auto second_sender = udp_client {};
+      auto datagrams = std::vector<datagram_buffer>(1, datagram_buffer {64});
+      
+      first_sender.send(std::vector<xtd::byte> {1}, 1, local_end_point(receiver));
+      assert::are_equal(1_z, receiver.receive_batch(datagrams), csf_);
+      assert::are_equal(local_end_point(first_sender).port(), datagrams[0].remote_end_point().port(), csf_);
+      
+      second_sender.send(std::vector<xtd::byte> {2, 3}, 2, local_end_point(receiver));
+      assert::are_equal(1_z, receiver.receive_batch(datagrams), csf_);
+      assert::are_equal(2_z, datagrams[0].size(), csf_);
+      assert::are_equal(local_end_point(second_sender).port(), datagrams[0].remote_end_point().port(), csf_);
+    }
+  };
+}
@@ -3,6 +3,7 @@
 #include <xtd/char16>
 #include <xtd/char32>
 #include <xtd/char8>
+#include <xtd/format_exception>
 #include <xtd/index_out_of_range_exception.h>
 #include <xtd/size_object>
 #include <xtd/wchar>
@@ -80,11 +81,13 @@ namespace xtd::tests {
     }
     
     void test_method_(iterator) {
-      assert::are_equal(typeof_<typename ienumerable<char_t>::iterator>(), typeof_<typename basic_string<char_t>::iterator>(), csf_);
+      assert::are_equal(typeof_<helpers::wrap_pointer_iterator<char_t*>>(), typeof_<typename basic_string<char_t>::iterator>(), csf_);
+      assert::is_true(std::contiguous_iterator<typename basic_string<char_t>::iterator>, csf_);
     }
     
     void test_method_(const_iterator) {
-      assert::are_equal(typeof_<typename ienumerable<char_t>::const_iterator>(), typeof_<typename basic_string<char_t>::const_iterator>(), csf_);
+      assert::are_equal(typeof_<helpers::wrap_pointer_iterator<const char_t*>>(), typeof_<typename basic_string<char_t>::const_iterator>(), csf_);
+      assert::is_true(std::contiguous_iterator<typename basic_string<char_t>::const_iterator>, csf_);
     }
     
     void test_method_(reverse_iterator) {
@@ -393,6 +396,15 @@ namespace xtd::tests {
       assert::are_equal(char_t {'e'}, *iterator++, csf_);
       assert::are_equal(char_t {'s'}, *iterator, csf_);
       assert::are_equal(char_t {'i'}, *(iterator + 6), csf_);
+      assert::is_true(s.data() == std::to_address(s.begin()), csf_);
+    }
+    
+    void test_method_(begin_and_end_with_range_for) {
+      auto s = basic_string<char_t> {"A test"};
+      auto result = std::basic_string<char_t> {};
+      for (auto c : s)
+        result += c;
+      assert::are_equal(s.chars(), result, csf_);
     }
     
     void test_method_(c_str) {
@@ -426,7 +438,7 @@ namespace xtd::tests {
     void test_method_(cend) {
       auto s = basic_string<char_t> {"A test string"};
       auto iterator = s.cend();
-      assert::throws<index_out_of_range_exception>([&]{ [[maybe_unused]] auto v = *iterator;}, csf_);
+      assert::are_equal(13, iterator - s.cbegin(), csf_);
     }
     
     void test_method_(data) {
@@ -445,7 +457,7 @@ namespace xtd::tests {
     void test_method_(end) {
       auto s = basic_string<char_t> {"A test string"};
       auto iterator = s.end();
-      assert::throws<index_out_of_range_exception>([&]{ [[maybe_unused]] auto v = *iterator;}, csf_);
+      assert::are_equal(13, iterator - s.begin(), csf_);
     }
 
     void test_method_(front) {
@@ -498,6 +510,15 @@ namespace xtd::tests {
       assert::is_positive(basic_string<char_t> {"B test strong"}.compare("A test string"), csf_);
     }
     
+    void test_method_(compare_with_ignore_case) {
+      assert::is_zero(basic_string<char_t>::compare("A test string", "a TEST String", true), csf_);
+      assert::is_negative(basic_string<char_t>::compare("A test string", "a TEST String", false), csf_);
+      assert::is_negative(basic_string<char_t>::compare("a test", "B TEST", true), csf_);
+      assert::is_positive(basic_string<char_t>::compare("a test string", "A TEST", true), csf_);
+      assert::is_zero(basic_string<char_t>::compare(U"\u00C0 t\u00C9st \u03A3tring", U"\u00E0 T\u00E9ST \u03C3TRING", string_comparison::ordinal_ignore_case), csf_);
+      assert::is_not_zero(basic_string<char_t>::compare(U"\u00C0 t\u00C9st \u03A3tring", U"\u00E0 T\u00E9ST \u03C3TRING", string_comparison::ordinal), csf_);
+    }
+    
     void test_method_(compare_to_object) {
       auto s1 = basic_string<char_t> {"A test string"};
       auto s2 = basic_string<char_t> {"A test string"};
@@ -544,6 +565,11 @@ namespace xtd::tests {
       assert::are_equal(false, basic_string<char_t> {"A test string"}.ends_with(char_t {'N'}, true), csf_);
     }
 
+    void test_method_(ends_with_value_type_on_empty_string) {
+      assert::is_false(basic_string<char_t> {}.ends_with(char_t {'g'}), csf_);
+      assert::is_false(basic_string<char_t> {}.ends_with(char_t {'g'}, true), csf_);
+    }
+
     void test_method_(ends_with_basic_string) {
       assert::are_equal(true, basic_string<char_t> {"A test string"}.ends_with("string"), csf_);
       assert::are_equal(false, basic_string<char_t> {"A test string"}.ends_with("StRiNg"), csf_);
@@ -578,6 +604,11 @@ namespace xtd::tests {
       assert::are_equal(false, basic_string<char_t> {"A test string"}.ends_with("test", string_comparison::ordinal_ignore_case), csf_);
       assert::are_equal(false, basic_string<char_t> {"A test string"}.ends_with("TeSt", string_comparison::ordinal_ignore_case), csf_);
     }
+    
+    void test_method_(ends_with_non_ascii_basic_string_and_string_comparison_ordinal_ignore_case) {
+      assert::is_true(basic_string<char_t> {U"Une cr\u00E8me br\u00FBL\u00C9E"}.ends_with(U"BR\u00DBL\u00E9e", string_comparison::ordinal_ignore_case), csf_);
+      assert::is_false(basic_string<char_t> {U"Une cr\u00E8me br\u00FBL\u00C9E"}.ends_with(U"BRUL\u00E9e", string_comparison::ordinal_ignore_case), csf_);
+    }
 
     void test_method_(equals_object) {
       auto s1 = basic_string<char_t> {"A test string"};
@@ -599,6 +630,8 @@ namespace xtd::tests {
       assert::is_true(basic_string<char_t> {"A test string"}.equals("A test string", false), csf_);
       assert::is_true(basic_string<char_t> {"A tEsT sTrInG"}.equals("a TeSt StRiNg", true), csf_);
       assert::is_false(basic_string<char_t> {"A tEsT sTrInG"}.equals("a TeSt StRiNg", false), csf_);
+      assert::is_true(basic_string<char_t> {U"\u0394\u03B9\u03BA\u03B1\u03B9\u03BF\u03C3\u03CD\u03BD\u03B7"}.equals(U"\u0394\u0399\u039A\u0391\u0399\u039F\u03A3\u038E\u039D\u0397", true), csf_);
+      assert::is_false(basic_string<char_t> {U"\u0394\u03B9\u03BA\u03B1\u03B9\u03BF\u03C3\u03CD\u03BD\u03B7"}.equals(U"\u0394\u0399\u039A\u0391\u0399\u039F\u03A3\u038E\u039D\u0397", false), csf_);
     }
 
     void test_method_(find) {
@@ -668,6 +701,42 @@ namespace xtd::tests {
       assert::are_equal("A test string to test", basic_string<char_t>::format(L"{}", L"A test string to test"), csf_);
     }
 
+    void test_method_(format_with_same_pattern_several_times) {
+      for (auto index = 0; index < 3; ++index)
+        assert::are_equal(basic_string<char_t>::format("{{{0}}} {1,3} {0} {2,-3}|", index, 42, "ab"), basic_string<char_t>::format("{{{0}}} {1,3} {0} {2,-3}|", index, 42, "ab"), csf_);
+      assert::are_equal("{1}  42 1 ab |", basic_string<char_t>::format("{{{0}}} {1,3} {0} {2,-3}|", 1, 42, "ab"), csf_);
+    }
+    
+    void test_method_(format_with_invalid_pattern) {
+      assert::throws<format_exception>([] {basic_string<char_t>::format("{0", 42);}, csf_);
+      assert::throws<format_exception>([] {basic_string<char_t>::format("0}", 42);}, csf_);
+      assert::throws<format_exception>([] {basic_string<char_t>::format("{a}", 42);}, csf_);
+      assert::throws<format_exception>([] {basic_string<char_t>::format("{0,a}", 42);}, csf_);
+    }
+
+    void test_method_(format_literal) {
+      assert::are_equal("{1}  42 1 ab |", basic_string<char_t>::template format<"{{{0}}} {1,3} {0} {2,-3}|">(1, 42, "ab"), csf_);
+      assert::are_equal("42 items from source", basic_string<char_t>::template format<"{} items from {}">(42, "source"), csf_);
+      assert::are_equal("[  2A]", basic_string<char_t>::template format<"[{0, 4:X}]">(42), csf_);
+      assert::are_equal(basic_string<char_t>::format("{0,-5:D3}|{0:X}", 42), basic_string<char_t>::template format<"{0,-5:D3}|{0:X}">(42), csf_);
+    }
+
+    void test_method_(format_literal_with_invalid_pattern_does_not_compile) {
+      auto can_format_index_0 = [](auto... args) {return requires {basic_string<char_t>::template format<"{0}">(args...);};};
+      auto can_format_index_1 = [](auto... args) {return requires {basic_string<char_t>::template format<"{1}">(args...);};};
+      auto can_format_two_items = [](auto... args) {return requires {basic_string<char_t>::template format<"{} {}">(args...);};};
+      auto can_format_open_bracket = [](auto... args) {return requires {basic_string<char_t>::template format<"{0">(args...);};};
+      auto can_format_invalid_index = [](auto... args) {return requires {basic_string<char_t>::template format<"{a}">(args...);};};
+      auto can_format_invalid_alignment = [](auto... args) {return requires {basic_string<char_t>::template format<"{0,a}">(args...);};};
+      assert::is_true(can_format_index_0(42), csf_);
+      assert::is_false(can_format_index_1(42), csf_);
+      assert::is_true(can_format_index_1(42, 24), csf_);
+      assert::is_false(can_format_two_items(42), csf_);
+      assert::is_false(can_format_open_bracket(42), csf_);
+      assert::is_false(can_format_invalid_index(42), csf_);
+      assert::is_false(can_format_invalid_alignment(42), csf_);
+    }
+
     void test_method_(get_allocator) {
       assert::are_equal(typeof_<typename std::allocator<char_t>>(), typeof_(basic_string<char_t> {"A test string"}.get_allocator()), csf_);
     }
@@ -709,6 +778,17 @@ namespace xtd::tests {
       assert::are_equal("A,  , t, e, s, t,  , s, t, r, i, n, g, ", r, csf_);
     }
     
+    void test_method_(get_enumerator_move_next_batch) {
+      auto s = basic_string<char_t> {"A test"};
+      auto e = s.get_enumerator();
+      assert::is_true(e.move_next(), csf_);
+      auto batch = e.move_next_batch();
+      assert::are_equal(5_z, batch.size(), csf_);
+      assert::are_equal(basic_string<char_t> {" test"}, basic_string<char_t>(batch.begin(), batch.end()), csf_);
+      assert::are_equal(char_t {'t'}, e.current(), csf_);
+      assert::is_true(e.move_next_batch().empty(), csf_);
+    }
+    
     void test_method_(index_of_string) {
       assert::are_equal(2_z, basic_string<char_t> {"A test string to test"}.index_of("test"), csf_);
       assert::are_equal(basic_string<char_t>::npos, basic_string<char_t> {"A test string to test"}.index_of("tist"), csf_);
@@ -805,6 +885,13 @@ namespace xtd::tests {
       assert::throws<index_out_of_range_exception>([] {basic_string<char_t> {"A test string to test"}.last_index_of('s', 22);}, csf_);
     }
 
+    void test_method_(index_of_any_with_one_value) {
+      assert::are_equal(4_z, basic_string<char_t> {"A test string to test"}.index_of_any({'s'}), csf_);
+      assert::are_equal(7_z, basic_string<char_t> {"A test string to test"}.index_of_any(std::vector<char_t> {'s'}, 5), csf_);
+      assert::are_equal(basic_string<char_t>::npos, basic_string<char_t> {"A test string to test"}.index_of_any({'z'}), csf_);
+      assert::are_equal(basic_string<char_t>::npos, basic_string<char_t> {"A test string to test"}.index_of_any({}), csf_);
+    }
+    
     void test_method_(last_index_of_any) {
       assert::are_equal(20_z, basic_string<char_t> {"A test string to test"}.last_index_of_any({'i', 'o', 's', 't'}), csf_);
       assert::are_equal(basic_string<char_t>::npos, basic_string<char_t> {"A test string to test"}.last_index_of_any({'b', 'c', 'h', 'v'}), csf_);
@@ -897,6 +984,8 @@ namespace xtd::tests {
       assert::are_equal("Thare are the beast of the beast", basic_string<char_t> {"This is the beast of the beast"}.replace("is", "are"));
       assert::are_equal("Th  the beast of the beast", basic_string<char_t> {"This is the beast of the beast"}.replace("is", ""));
       assert::are_equal("This text has\\_unescaped\\_\\_underscores !", basic_string<char_t> {"This text has_unescaped__underscores !"}.replace("_", "\\_"));
+      assert::are_equal("a--b----c", basic_string<char_t> {"aXbXXc"}.replace("X", "--"), csf_);
+      assert::are_equal("abc", basic_string<char_t> {"abc"}.replace("", "-"), csf_);
     }
 
     void test_method_(rfind) {
@@ -929,6 +1018,29 @@ namespace xtd::tests {
     void test_method_(split_with_string_split_optio_none) {
       assert::are_equal(std::vector<basic_string<char_t>> {"a", "", "", "b", "", "c"}, basic_string<char_t> {"a,,,b,,c"}.split(',', string_split_options::none));
     }
+    
+    void test_method_(split_view) {
+      auto to_strings = [](const std::vector<std::basic_string_view<char_t>>& views) {
+        auto result = std::vector<basic_string<char_t>> {};
+        for (const auto& view : views)
+          result.push_back(std::basic_string<char_t> {view});
+        return result;
+      };
+      assert::is_zero(basic_string<char_t> {""}.split_view({'+', '-', '='}).size(), csf_);
+      assert::are_equal((std::vector<basic_string<char_t>> {"100", "42", "142"}), to_strings(basic_string<char_t> {"100 42\t142"}.split_view()), csf_);
+      assert::are_equal((std::vector<basic_string<char_t>> {"100", "42", "142"}), to_strings(basic_string<char_t> {"100+42=142"}.split_view({'+', '-', '='})), csf_);
+      assert::are_equal((std::vector<basic_string<char_t>> {"a", "", "", "b", "", "c"}), to_strings(basic_string<char_t> {"a,,,b,,c"}.split_view(',')), csf_);
+      assert::are_equal((std::vector<basic_string<char_t>> {"a", "b", "c"}), to_strings(basic_string<char_t> {"a,,,b,,c"}.split_view(',', string_split_options::remove_empty_entries)), csf_);
+      assert::are_equal((std::vector<basic_string<char_t>> {"42", " 12, 19"}), to_strings(basic_string<char_t> {"42, 12, 19"}.split_view({',', ' '}, 2, string_split_options::none)), csf_);
+    }
+    
+    void test_method_(split_view_refers_to_the_characters_of_the_string) {
+      auto str = basic_string<char_t> {"a,b"};
+      auto views = str.split_view(',');
+      assert::are_equal(2_z, views.size(), csf_);
+      assert::is_true(views[0].data() == str.data(), csf_);
+      assert::is_true(views[1].data() == str.data() + 2, csf_);
+    }
 
     void test_method_(starts_with_value_type) {
       assert::are_equal(true, basic_string<char_t> {"A test string"}.starts_with(char_t {'A'}), csf_);
@@ -985,6 +1097,11 @@ namespace xtd::tests {
       assert::are_equal(false, basic_string<char_t> {"A test string"}.starts_with("A string", string_comparison::ordinal_ignore_case), csf_);
       assert::are_equal(false, basic_string<char_t> {"A test string"}.starts_with("a StRiNg", string_comparison::ordinal_ignore_case), csf_);
     }
+    
+    void test_method_(starts_with_value_type_on_empty_string) {
+      assert::is_false(basic_string<char_t> {}.starts_with(char_t {'A'}), csf_);
+      assert::is_false(basic_string<char_t> {}.starts_with(char_t {'A'}, true), csf_);
+    }
 
     void test_method_(substr) {
       assert::are_equal("A test string", basic_string<char_t> {"A test string"}.substr(), csf_);
@@ -998,6 +1115,11 @@ namespace xtd::tests {
       assert::are_equal("a test string", basic_string<char_t> {"A tEsT sTrInG"}.to_lower(), csf_);
       assert::are_equal("a test string", basic_string<char_t> {"A tEsT sTrInG"}.to_lower(), csf_);
     }
+    
+    void test_method_(to_lower_with_non_ascii_characters) {
+      assert::are_equal(U"\u00E0 t\u00E9st \u03C3tring \u0434\u043E\u043C", basic_string<char_t> {U"\u00C0 T\u00C9ST \u03A3TRING \u0414\u041E\u041C"}.to_lower(), csf_);
+      assert::are_equal(U"\u00E0 t\u00E9st", basic_string<char_t>::to_lower(std::basic_string_view<char_t> {basic_string<char_t> {U"\u00C0 T\u00C9ST"}.chars()}), csf_);
+    }
 
     void test_method_(to_string) {
       auto s = basic_string<char_t> {"A test string"};
@@ -1038,12 +1160,25 @@ namespace xtd::tests {
       assert::are_equal("A TEST STRING", basic_string<char_t> {"A tEsT sTrInG"}.to_upper(), csf_);
       assert::are_equal("A TEST STRING", basic_string<char_t> {"A tEsT sTrInG"}.to_upper(), csf_);
     }
+    
+    void test_method_(to_upper_with_non_ascii_characters) {
+      assert::are_equal(U"\u00C0 T\u00C9ST \u03A3TRING \u0414\u041E\u041C", basic_string<char_t> {U"\u00E0 t\u00E9st \u03C3tring \u0434\u043E\u043C"}.to_upper(), csf_);
+      assert::are_equal(U"\u00C0 T\u00C9ST", basic_string<char_t>::to_upper(std::basic_string_view<char_t> {basic_string<char_t> {U"\u00E0 t\u00E9st"}.chars()}), csf_);
+    }
 
     void test_method_(to_wstring) {
       auto s = basic_string<char_t> {"A test string"};
       assert::is_instance_of<wstring>(s.to_wstring(), csf_);
       assert::are_equal(u"A test string", s.to_wstring(), csf_);
     }
+    
+    void test_method_(try_get_span) {
+      auto s = basic_string<char_t> {"A test string"};
+      auto span = std::span<const char_t> {};
+      assert::is_true(static_cast<const ienumerable<char_t>&>(s).try_get_span(span), csf_);
+      assert::are_equal(13_z, span.size(), csf_);
+      assert::is_true(s.data() == span.data(), csf_);
+    }
 
     // ______________________________________________________________________________________________________________________________________________
     //                                                                                                                                 Static Methods
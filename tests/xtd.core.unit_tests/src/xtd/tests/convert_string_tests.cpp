@@ -202,6 +202,14 @@ namespace xtd::tests {
       collection_assert::are_equal({u'a', u'e', u'i', u'o', u'u', u'à', u'ç', u'é', u'è', u'ê', u'ë', u'ï', u'î', u'\xD83D', u'\xDC28'}, convert_string::to_u16string(std::string("aeiouàçéèêëïî\U0001F428")), csf_);
     }
     
+    void test_method_(string_with_null_character_to_u16string) {
+      collection_assert::are_equal({u'a', u'\0', u'é'}, convert_string::to_u16string(std::string("a\0\xC3\xA9", 4)), csf_);
+    }
+    
+    void test_method_(string_with_invalid_sequences_to_u16string) {
+      collection_assert::are_equal({u'a', u'\xFFFD', u'b', u'\xFFFD', u'\xFFFD', u'c'}, convert_string::to_u16string(std::string("a\xE4\xB8" "b\xC0\xAF" "c")), csf_);
+    }
+    
 #if defined(__xtd__cpp_lib_char8_t)
     void test_method_(u8string_to_u16string) {
       collection_assert::are_equal({u'a', u'e', u'i', u'o', u'u', u'à', u'ç', u'é', u'è', u'ê', u'ë', u'ï', u'î', u'\xD83D', u'\xDC28'}, convert_string::to_u16string(std::u8string(u8"aeiouàçéèêëïî\U0001F428")), csf_);
@@ -1,7 +1,10 @@
 #include <xtd/delegate>
+#include <xtd/threading/thread>
 #include <xtd/tunit/assert>
 #include <xtd/tunit/test_class_attribute>
 #include <xtd/tunit/test_method_attribute>
+#include <atomic>
+#include <vector>
 
 using namespace xtd;
 using namespace xtd::tunit;
@@ -33,6 +36,9 @@ namespace xtd::tests {
       result += "static_method2;";
     }
     
+    static void static_method3() {
+    }
+    
     void test_method_(create_empty_delegate_and_test_is_empty) {
       delegate<void()> d;
       assert::is_true(d.is_empty(), csf_);
@@ -174,7 +180,7 @@ namespace xtd::tests {
       d += delegate<void(string&)> {static_method2};
       d += delegate<void(string&)> {c, &container::member_method2};
       d += delegate<void(string&)> {l};
-    
+      
       d = delegate<void(string&)>::remove(d, {static_method2});
       
       assert::are_equal(2_z, d.size());
@@ -226,5 +232,138 @@ namespace xtd::tests {
       d = delegate<void(string&)> {};
       assert::is_true(d.is_empty(), csf_);
     }
+    
+    void test_method_(add_to_delegate_does_not_change_copy) {
+      delegate<void(string&)> d;
+      d += delegate<void(string&)> {static_method2};
+      auto copy = d;
+      d += [](string& result) {result += "lambda_expression2;";};
+      
+      assert::are_equal(2_z, d.size(), csf_);
+      assert::are_equal(1_z, copy.size(), csf_);
+      string result;
+      copy(result);
+      assert::are_equal("static_method2;", result, csf_);
+    }
+    
+    void test_method_(remove_from_delegate_does_not_change_copy) {
+      delegate<void(string&)> d;
+      d += delegate<void(string&)> {static_method2};
+      auto copy = d;
+      d -= delegate<void(string&)> {static_method2};
+      
+      assert::is_true(d.is_empty(), csf_);
+      assert::are_equal(1_z, copy.size(), csf_);
+    }
+    
+    void test_method_(remove_all_static_method) {
+      delegate<void(string&)> d;
+      d += delegate<void(string&)> {static_method2};
+      d += [](string& result) {result += "lambda_expression2;";};
+      d += delegate<void(string&)> {static_method2};
+      
+      d = delegate<void(string&)>::remove_all(d, {static_method2});
+      
+      assert::are_equal(1_z, d.size(), csf_);
+      string result;
+      d(result);
+      assert::are_equal("lambda_expression2;", result, csf_);
+    }
+    
+    void test_method_(add_remove_and_invoke_from_several_threads) {
+      auto counter = std::atomic<int> {0};
+      delegate<void()> d;
+      d += [&] {++counter;};
+      auto threads = std::vector<threading::thread> {};
+      for (auto index = 0; index < 4; ++index)
+        threads.push_back(threading::thread::start_new([&] {
+          for (auto iteration = 0; iteration < 1000; ++iteration) {
+            d += static_method3;
+            d();
+            d -= static_method3;
+          }
+        }));
+      for (auto& thread : threads)
+        thread.join();
+      
+      assert::are_equal(1_z, d.size(), csf_);
+      assert::are_equal(4000, counter.load(), csf_);
+    }
+    
+    void test_method_(remove_by_subscription_from_several_threads) {
+      auto counter = std::make_shared<std::atomic<int>>(0);
+      delegate<void()> d;
+      d += static_method3;
+      auto threads = std::vector<threading::thread> {};
+      for (auto index = 0; index < 4; ++index)
+        threads.push_back(threading::thread::start_new([&] {
+          for (auto iteration = 0; iteration < 1000; ++iteration) {
+            auto subscription = d += [counter] {++*counter;};
+            d();
+            d -= subscription;
+          }
+        }));
+      for (auto& thread : threads)
+        thread.join();
+      
+      assert::are_equal(1_z, d.size(), csf_);
+      assert::is_greater_or_equal(counter->load(), 4000, csf_);
+    }
+    
+    void test_method_(functions_is_not_changed_by_add_or_remove) {
+      delegate<void(string&)> d;
+      d += delegate<void(string&)> {static_method2};
+      auto functions = d.functions();
+      d += [](string& result) {result += "lambda_expression2;";};
+      d = delegate<void(string&)> {};
+      
+      assert::are_equal(1_z, functions.size(), csf_);
+      string result;
+      functions[0](result);
+      assert::are_equal("static_method2;", result, csf_);
+    }
+    
+    void test_method_(move_delegate) {
+      delegate<void(string&)> d;
+      d += delegate<void(string&)> {static_method2};
+      auto moved = std::move(d);
+      
+      assert::are_equal(1_z, moved.size(), csf_);
+      assert::is_true(d.is_empty(), csf_);
+    }
+    
+    void test_method_(remove_single_function_by_subscription) {
+      auto counter = 0;
+      delegate<void()> d;
+      auto subscription = d += [&] {++counter;};
+      d();
+      d -= subscription;
+      d();
+      
+      assert::are_equal(1, counter, csf_);
+      assert::is_true(d.is_empty(), csf_);
+    }
+    
+    void test_method_(remove_function_by_subscription_keeps_other_equal_functions) {
+      delegate<void(string&)> d;
+      d += static_method2;
+      auto subscription = d += static_method2;
+      d += [](string& result) {result += "lambda_expression;";};
+      d -= subscription;
+      
+      string result;
+      d(result);
+      assert::are_equal(2_z, d.size(), csf_);
+      assert::are_equal("static_method2;lambda_expression;", result, csf_);
+    }
+    
+    void test_method_(functions_returns_a_reference_until_delegate_is_changed) {
+      delegate<void(string&)> d;
+      d += static_method2;
+      const auto& functions = d.functions();
+      
+      assert::is_true(&functions == &d.functions(), csf_);
+      assert::are_equal(1_z, functions.size(), csf_);
+    }
   };
 }
@@ -1,3 +1,6 @@
+#include <xtd/format_exception>
+#include <xtd/overflow_exception>
+#include <xtd/parse>
 #include <xtd/string>
 #include <xtd/tunit/assert>
 #include <xtd/tunit/test_class_attribute>
@@ -11,5 +14,63 @@ namespace xtd::tests {
     void test_method_(parse_string) {
       assert::are_equal("string", xtd::parse<std::string>("string"), csf_);
     }
+    
+    void test_method_(parse_int_with_white_spaces_and_sign) {
+      assert::are_equal(-42, xtd::parse<int>(" \t-42 "), csf_);
+      assert::are_equal(42, xtd::parse<int>("+42"), csf_);
+    }
+    
+    void test_method_(parse_int_with_invalid_string) {
+      assert::throws<format_exception>([] {xtd::parse<int>("4 2");}, csf_);
+      assert::throws<format_exception>([] {xtd::parse<int>("--42");}, csf_);
+      assert::throws<format_exception>([] {xtd::parse<int>("-42-", number_styles::allow_trailing_sign | number_styles::allow_leading_sign);}, csf_);
+    }
+    
+    void test_method_(parse_int_with_overflow) {
+      assert::throws<overflow_exception>([] {xtd::parse<sbyte>("128");}, csf_);
+      assert::throws<overflow_exception>([] {xtd::parse<uint16>("65536");}, csf_);
+    }
+    
+    void test_method_(parse_hex_number) {
+      assert::are_equal(0x1F, xtd::parse<int>(" 0x1F", number_styles::hex_number), csf_);
+      assert::are_equal(0xFFFFFFFFu, xtd::parse<uint32>("ffffffff", number_styles::hex_number), csf_);
+    }
+    
+    void test_method_(parse_double_with_fixed_point) {
+      assert::are_equal(-125.0, xtd::parse<double>(" -1.25e2 "), csf_);
+      assert::are_equal(0.5, xtd::parse<double>(".5"), csf_);
+    }
+    
+    void test_method_(try_parse_int) {
+      auto value = 0;
+      assert::is_true(xtd::try_parse("-42", value), csf_);
+      assert::are_equal(-42, value, csf_);
+      assert::is_true(xtd::try_parse(std::string {"42 "}, value), csf_);
+      assert::are_equal(42, value, csf_);
+    }
+    
+    void test_method_(try_parse_int_with_invalid_string) {
+      auto value = 24;
+      assert::is_false(xtd::try_parse("", value), csf_);
+      assert::is_false(xtd::try_parse("4x", value), csf_);
+      assert::is_false(xtd::try_parse("2147483648", value), csf_);
+      assert::is_false(xtd::try_parse("-1", value, number_styles::none), csf_);
+      assert::are_equal(24, value, csf_);
+    }
+    
+    void test_method_(try_parse_unsigned_with_minus_sign) {
+      auto value = 24u;
+      assert::is_false(xtd::try_parse("-1", value), csf_);
+      assert::are_equal(24u, value, csf_);
+    }
+    
+    void test_method_(try_parse_double) {
+      auto value = 0.0;
+      assert::is_true(xtd::try_parse("3.25", value), csf_);
+      assert::are_equal(3.25, value, csf_);
+      assert::is_false(xtd::try_parse("3.25x", value), csf_);
+      assert::is_false(xtd::try_parse("1-5", value), csf_);
+      assert::are_equal(3.25, value, csf_);
+    }
   };
 }
@@ -3,6 +3,7 @@
 #include <xtd/tunit/assert>
 #include <xtd/tunit/test_class_attribute>
 #include <xtd/tunit/test_method_attribute>
+#include <limits>
 
 using namespace xtd;
 using namespace xtd::tunit;
@@ -357,6 +358,11 @@ namespace xtd::tests {
       assert::throws<xtd::format_exception>([] {string::format("{0:Xa}", static_cast<value_t>(42));}, csf_);
     }
     
+    void test_method_(format_min_and_max_values_with_decimal_argument) {
+      assert::are_equal(std::to_string(std::numeric_limits<value_t>::min()), string::format("{0:D}", std::numeric_limits<value_t>::min()), csf_);
+      assert::are_equal(std::to_string(std::numeric_limits<value_t>::max()), string::format("{0:D}", std::numeric_limits<value_t>::max()), csf_);
+    }
+    
     void test_method_(format_with_alignment_before_format) {
       assert::are_equal("    42", string::format("{0,6:D}", static_cast<value_t>(42)), csf_);
     }
@@ -3,6 +3,8 @@
 #include <xtd/tunit/assert>
 #include <xtd/tunit/test_class_attribute>
 #include <xtd/tunit/test_method_attribute>
+#include <thread>
+#include <vector>
 
 using namespace xtd;
 using namespace xtd::tunit;
@@ -313,5 +315,19 @@ namespace xtd::tests {
       s << e;
       assert::are_equal(s.str(), e.to_string(), csf_);
     }
+    
+    void test_method_(stack_trace_from_several_threads) {
+      system_exception::enable_stack_trace(true);
+      auto e = system_exception {};
+      system_exception::enable_stack_trace(false);
+      auto stack_traces = std::vector<string>(8);
+      auto threads = std::vector<std::thread> {};
+      for (auto index = 0_z; index < stack_traces.size(); ++index)
+        threads.emplace_back([&, index] {stack_traces[index] = e.stack_trace();});
+      for (auto& thread : threads)
+        thread.join();
+      for (const auto& stack_trace : stack_traces)
+        assert::are_equal(e.stack_trace(), stack_trace, csf_);
+    }
   };
 }
@@ -736,6 +736,7 @@ namespace xtd::tests {
     
     void test_method_(compare_ignore_case_true) {
       assert::is_zero(string::compare("a", "A", true), csf_);
+      assert::is_zero(string::compare("\xC3\xA0 la cr\xC3\xA8me", "\xC3\x80 LA CR\xC3\x88ME", true), csf_);
     }
     
     void test_method_(compare_index_length) {
@@ -784,6 +785,7 @@ namespace xtd::tests {
       assert::is_true(string("abcd").ends_with('d'), csf_);
       assert::is_false(string("abcd").ends_with('D'), csf_);
       assert::is_false(string("abcd").ends_with('B'), csf_);
+      assert::is_false(string("").ends_with('d'), csf_);
     }
     
     void test_method_(ends_with_string) {
@@ -801,6 +803,7 @@ namespace xtd::tests {
       assert::is_true(string("abcd").ends_with("cd", true), csf_);
       assert::is_true(string("abcd").ends_with("CD", true), csf_);
       assert::is_false(string("abcd").ends_with("AB", true), csf_);
+      assert::is_true(string("cr\xC3\xA8me br\xC3\xBBl\xC3\xA9""e").ends_with("BR\xC3\x9BL\xC3\x89""E", true), csf_);
     }
     
     void test_method_(string_format_with_automatic_arguments) {
@@ -1084,6 +1087,7 @@ namespace xtd::tests {
     
     void test_method_(to_lower) {
       assert::are_equal("abcdef", string("ABCDEF").to_lower(), csf_);
+      assert::are_equal("\xC3\xA0 la cr\xC3\xA8me", string("\xC3\x80 LA CR\xC3\x88ME").to_lower(), csf_);
     }
     
     void test_method_(to_title_case) {
@@ -1092,6 +1096,7 @@ namespace xtd::tests {
     
     void test_method_(to_upper) {
       assert::are_equal("ABCDEF", string("abcdef").to_upper(), csf_);
+      assert::are_equal("\xC3\x80 LA CR\xC3\x88ME", string("\xC3\xA0 la cr\xC3\xA8me").to_upper(), csf_);
     }
     
     void test_method_(trim_end) {
@@ -350,12 +350,26 @@ namespace xtd::tests {
       assert::are_equal("test", basic_string_builder<char_t> {"A test string"}.substr(2, 4).to_string(), csf_);
     }
     
+    void test_method_(to_lower) {
+      auto s = basic_string_builder<char_t> {"A tEsT sTrInG"};
+      assert::are_equal("a test string", s.to_lower().to_string(), csf_);
+      assert::are_equal("a test string", s.to_string(), csf_);
+      assert::are_equal(U"\u00E0 t\u00E9st \u0131 i", basic_string_builder<char_t> {U"\u00C0 T\u00C9ST \u0131 \u0130"}.to_lower().to_string(), csf_);
+    }
+    
     void test_method_(to_string) {
       auto s = basic_string_builder<char_t> {"A test string"};
       assert::is_instance_of<string>(s.to_string(), csf_);
       assert::are_equal("A test string", s.to_string(), csf_);
     }
     
+    void test_method_(to_upper) {
+      auto s = basic_string_builder<char_t> {"A tEsT sTrInG"};
+      assert::are_equal("A TEST STRING", s.to_upper().to_string(), csf_);
+      assert::are_equal("A TEST STRING", s.to_string(), csf_);
+      assert::are_equal(U"\u00C0 T\u00C9ST I \u0130", basic_string_builder<char_t> {U"\u00E0 t\u00E9st \u0131 \u0130"}.to_upper().to_string(), csf_);
+    }
+    
     // ______________________________________________________________________________________________________________________________________________
     //                                                                                                                                      Operators
     void test_method_(indexer_operator) {
@@ -0,0 +1,164 @@
+#include <xtd/text/unicode/utf8>
+#include <xtd/tunit/assert>
+#include <xtd/tunit/collection_assert>
+#include <xtd/tunit/test_class_attribute>
+#include <xtd/tunit/test_method_attribute>
+#include <array>
+#include <string>
+
+using namespace xtd::buffers;
+using namespace xtd::text::unicode;
+using namespace xtd::tunit;
+
+namespace xtd::tests {
+  class test_class_(utf8_tests) {
+    void test_method_(from_utf16) {
+      auto destination = std::array<char, 32> {};
+      auto chars_read = 0_z;
+      auto bytes_written = 0_z;
+      auto source = std::u16string {u"aé中\U0001F428"};
+      assert::are_equal(operation_status::done, utf8::from_utf16(source, destination, chars_read, bytes_written), csf_);
+      assert::are_equal(5_z, chars_read, csf_);
+      assert::are_equal(10_z, bytes_written, csf_);
+      assert::are_equal(std::string {"a\xC3\xA9\xE4\xB8\xAD\xF0\x9F\x90\xA8"}, std::string(destination.data(), bytes_written), csf_);
+    }
+    
+    void test_method_(from_utf16_with_invalid_sequences) {
+      auto destination = std::array<char, 32> {};
+      auto chars_read = 0_z;
+      auto bytes_written = 0_z;
+      auto source = std::u16string {u'a', u'\xDC28', u'b', u'\xD83D', u'c'};
+      assert::are_equal(operation_status::done, utf8::from_utf16(source, destination, chars_read, bytes_written), csf_);
+      assert::are_equal(5_z, chars_read, csf_);
+      assert::are_equal(std::string {"a\xEF\xBF\xBD" "b\xEF\xBF\xBD" "c"}, std::string(destination.data(), bytes_written), csf_);
+      assert::are_equal(operation_status::invalid_data, utf8::from_utf16(source, destination, chars_read, bytes_written, false), csf_);
+      assert::are_equal(1_z, chars_read, csf_);
+      assert::are_equal(1_z, bytes_written, csf_);
+    }
+    
+    void test_method_(from_utf16_with_need_more_data) {
+      auto destination = std::array<char, 32> {};
+      auto chars_read = 0_z;
+      auto bytes_written = 0_z;
+      auto source = std::u16string {u'a', u'\xD83D'};
+      assert::are_equal(operation_status::need_more_data, utf8::from_utf16(source, destination, chars_read, bytes_written, true, false), csf_);
+      assert::are_equal(1_z, chars_read, csf_);
+      assert::are_equal(1_z, bytes_written, csf_);
+      assert::are_equal(operation_status::done, utf8::from_utf16(source, destination, chars_read, bytes_written, true, true), csf_);
+      assert::are_equal(2_z, chars_read, csf_);
+      assert::are_equal(4_z, bytes_written, csf_);
+    }
+    
+    void test_method_(from_utf16_with_destination_too_small) {
+      auto destination = std::array<char, 4> {};
+      auto chars_read = 0_z;
+      auto bytes_written = 0_z;
+      auto source = std::u16string {u"ab中"};
+      assert::are_equal(operation_status::destination_too_small, utf8::from_utf16(source, destination, chars_read, bytes_written), csf_);
+      assert::are_equal(2_z, chars_read, csf_);
+      assert::are_equal(2_z, bytes_written, csf_);
+    }
+    
+    void test_method_(from_utf32) {
+      auto destination = std::array<char, 32> {};
+      auto chars_read = 0_z;
+      auto bytes_written = 0_z;
+      auto source = std::u32string {U'a', U'\U0001F428', static_cast<char32>(0xD800), static_cast<char32>(0x110000)};
+      assert::are_equal(operation_status::done, utf8::from_utf32(source, destination, chars_read, bytes_written), csf_);
+      assert::are_equal(4_z, chars_read, csf_);
+      assert::are_equal(std::string {"a\xF0\x9F\x90\xA8\xEF\xBF\xBD\xEF\xBF\xBD"}, std::string(destination.data(), bytes_written), csf_);
+      assert::are_equal(operation_status::invalid_data, utf8::from_utf32(source, destination, chars_read, bytes_written, false), csf_);
+      assert::are_equal(2_z, chars_read, csf_);
+      assert::are_equal(5_z, bytes_written, csf_);
+    }
+    
+    void test_method_(get_byte_count) {
+      assert::are_equal(0_z, utf8::get_byte_count(std::u16string {}), csf_);
+      assert::are_equal(12_z, utf8::get_byte_count(std::u16string {u"abcdefghijé"}), csf_);
+      assert::are_equal(10_z, utf8::get_byte_count(std::u16string {u"aé中\U0001F428"}), csf_);
+      assert::are_equal(3_z, utf8::get_byte_count(std::u16string {u'\xD83D'}), csf_);
+      assert::are_equal(10_z, utf8::get_byte_count(std::u32string {U"aé中\U0001F428"}), csf_);
+    }
+    
+    void test_method_(get_char16_count) {
+      assert::are_equal(0_z, utf8::get_char16_count(std::string {}), csf_);
+      assert::are_equal(5_z, utf8::get_char16_count(std::string {"a\xC3\xA9\xE4\xB8\xAD\xF0\x9F\x90\xA8"}), csf_);
+      assert::are_equal(3_z, utf8::get_char16_count(std::string {"\xE4\xB8" "a\xFF"}), csf_);
+    }
+    
+    void test_method_(get_char32_count) {
+      assert::are_equal(0_z, utf8::get_char32_count(std::string {}), csf_);
+      assert::are_equal(4_z, utf8::get_char32_count(std::string {"a\xC3\xA9\xE4\xB8\xAD\xF0\x9F\x90\xA8"}), csf_);
+      assert::are_equal(3_z, utf8::get_char32_count(std::string {"\xE4\xB8" "a\xFF"}), csf_);
+    }
+    
+    void test_method_(is_valid) {
+      assert::is_true(utf8::is_valid(std::string {}), csf_);
+      assert::is_true(utf8::is_valid(std::string {"The quick brown fox jumps over the lazy dog"}), csf_);
+      assert::is_true(utf8::is_valid(std::string {"a\xC3\xA9\xE4\xB8\xAD\xF0\x9F\x90\xA8"}), csf_);
+      assert::is_true(utf8::is_valid(std::string {"a\0b", 3}), csf_);
+      assert::is_false(utf8::is_valid(std::string {"\xC0\xAF"}), csf_);
+      assert::is_false(utf8::is_valid(std::string {"\xED\xA0\x80"}), csf_);
+      assert::is_false(utf8::is_valid(std::string {"\xF4\x90\x80\x80"}), csf_);
+      assert::is_false(utf8::is_valid(std::string {"\xE4\xB8"}), csf_);
+      assert::is_false(utf8::is_valid(std::string {"abcdefgh\x80"}), csf_);
+    }
+    
+    void test_method_(to_utf16) {
+      auto destination = std::array<char16, 32> {};
+      auto bytes_read = 0_z;
+      auto chars_written = 0_z;
+      auto source = std::string {"a\xC3\xA9\xE4\xB8\xAD\xF0\x9F\x90\xA8"};
+      assert::are_equal(operation_status::done, utf8::to_utf16(source, destination, bytes_read, chars_written), csf_);
+      assert::are_equal(10_z, bytes_read, csf_);
+      collection_assert::are_equal({u'a', u'é', u'中', u'\xD83D', u'\xDC28'}, std::u16string(destination.data(), chars_written), csf_);
+    }
+    
+    void test_method_(to_utf16_with_invalid_sequences) {
+      auto destination = std::array<char16, 32> {};
+      auto bytes_read = 0_z;
+      auto chars_written = 0_z;
+      // One replacement character per maximal subpart : "\xE2\x82", "\xF0\x9F\x90", "\xC0", "\xAF" and "\xED", "\xA0", "\x80".
+      auto source = std::string {"\xE2\x82" "a\xF0\x9F\x90" "b\xC0\xAF" "c\xED\xA0\x80"};
+      assert::are_equal(operation_status::done, utf8::to_utf16(source, destination, bytes_read, chars_written), csf_);
+      assert::are_equal(source.size(), bytes_read, csf_);
+      collection_assert::are_equal({u'\xFFFD', u'a', u'\xFFFD', u'b', u'\xFFFD', u'\xFFFD', u'c', u'\xFFFD', u'\xFFFD', u'\xFFFD'}, std::u16string(destination.data(), chars_written), csf_);
+      assert::are_equal(operation_status::invalid_data, utf8::to_utf16(source, destination, bytes_read, chars_written, false), csf_);
+      assert::are_equal(0_z, bytes_read, csf_);
+      assert::are_equal(0_z, chars_written, csf_);
+    }
+    
+    void test_method_(to_utf16_with_need_more_data) {
+      auto destination = std::array<char16, 32> {};
+      auto bytes_read = 0_z;
+      auto chars_written = 0_z;
+      auto source = std::string {"ab\xF0\x9F\x90"};
+      assert::are_equal(operation_status::need_more_data, utf8::to_utf16(source, destination, bytes_read, chars_written, true, false), csf_);
+      assert::are_equal(2_z, bytes_read, csf_);
+      assert::are_equal(2_z, chars_written, csf_);
+      assert::are_equal(operation_status::done, utf8::to_utf16(source + "\xA8", destination, bytes_read, chars_written, true, false), csf_);
+      assert::are_equal(6_z, bytes_read, csf_);
+      assert::are_equal(4_z, chars_written, csf_);
+    }
+    
+    void test_method_(to_utf16_with_destination_too_small) {
+      auto destination = std::array<char16, 2> {};
+      auto bytes_read = 0_z;
+      auto chars_written = 0_z;
+      auto source = std::string {"a\xF0\x9F\x90\xA8"};
+      assert::are_equal(operation_status::destination_too_small, utf8::to_utf16(source, destination, bytes_read, chars_written), csf_);
+      assert::are_equal(1_z, bytes_read, csf_);
+      assert::are_equal(1_z, chars_written, csf_);
+    }
+    
+    void test_method_(to_utf32) {
+      auto destination = std::array<char32, 32> {};
+      auto bytes_read = 0_z;
+      auto chars_written = 0_z;
+      auto source = std::string {"abcdefghij\xC3\xA9\xE4\xB8\xAD\xF0\x9F\x90\xA8\xFF"};
+      assert::are_equal(operation_status::done, utf8::to_utf32(source, destination, bytes_read, chars_written), csf_);
+      assert::are_equal(source.size(), bytes_read, csf_);
+      collection_assert::are_equal({U'a', U'b', U'c', U'd', U'e', U'f', U'g', U'h', U'i', U'j', U'é', U'中', U'\U0001F428', U'\xFFFD'}, std::u32string(destination.data(), chars_written), csf_);
+    }
+  };
+}
@@ -5,6 +5,7 @@
 #include <xtd/tunit/test_class_attribute>
 #include <xtd/tunit/test_method_attribute>
 #include <utility>
+#include <vector>
 
 using namespace xtd::threading;
 using namespace xtd::tunit;
@@ -93,5 +94,69 @@ namespace xtd::tests {
       assert::is_true(thread_ran, csf_);
       monitor::exit("lock_string");
     }
+    
+    void test_method_(exit_from_other_thread) {
+      object lock_object;
+      monitor::enter(lock_object);
+      auto thread = threading::thread::start_new([&] {
+        assert::throws<synchronization_lock_exception>([&] {monitor::exit(lock_object);}, csf_);
+      });
+      thread.join();
+      assert::is_true(monitor::is_entered(lock_object), csf_);
+      monitor::exit(lock_object);
+      assert::is_false(monitor::is_entered(lock_object), csf_);
+    }
+    
+    void test_method_(try_enter_already_locked_does_not_keep_monitor_entered) {
+      object lock_object;
+      monitor::enter(lock_object);
+      auto thread = threading::thread::start_new([&] {
+        assert::is_false(monitor::try_enter(lock_object, 0), csf_);
+      });
+      thread.join();
+      monitor::exit(lock_object);
+      assert::is_false(monitor::is_entered(lock_object), csf_);
+    }
+    
+    void test_method_(enter_shared_object_from_1_to_64_threads) {
+      for (auto thread_count = 1; thread_count <= 64; thread_count *= 2) {
+        object lock_object;
+        auto counter = 0;
+        auto threads = std::vector<threading::thread> {};
+        for (auto index = 0; index < thread_count; ++index)
+          threads.push_back(threading::thread::start_new([&] {
+            for (auto iteration = 0; iteration < 1000; ++iteration) {
+              monitor::enter(lock_object);
+              ++counter;
+              monitor::exit(lock_object);
+            }
+          }));
+        for (auto& thread : threads)
+          thread.join();
+        assert::are_equal(thread_count * 1000, counter, csf_);
+        assert::is_false(monitor::is_entered(lock_object), csf_);
+      }
+    }
+    
+    void test_method_(enter_distinct_objects_from_1_to_64_threads) {
+      for (auto thread_count = 1; thread_count <= 64; thread_count *= 2) {
+        auto counters = std::vector<int32>(thread_count, 0);
+        auto threads = std::vector<threading::thread> {};
+        for (auto index = 0; index < thread_count; ++index)
+          threads.push_back(threading::thread::start_new([&, index] {
+            for (auto iteration = 0; iteration < 1000; ++iteration) {
+              monitor::enter(counters[index]);
+              ++counters[index];
+              monitor::exit(counters[index]);
+            }
+          }));
+        for (auto& thread : threads)
+          thread.join();
+        for (auto index = 0; index < thread_count; ++index) {
+          assert::are_equal(1000, counters[index], csf_);
+          assert::is_false(monitor::is_entered(counters[index]), csf_);
+        }
+      }
+    }
   };
 }
@@ -81,5 +81,31 @@ namespace xtd::tests {
       thread_pool::close();
       assert::are_equal(max_worker_threads, as<size_t>(count), csf_);
     }
+    
+    void test_method_(queue_user_work_item_from_thread_pool_thread) {
+      auto count = 0;
+      auto action = wait_callback {[&] {
+        interlocked::increment(count);
+      }};
+      thread_pool::queue_user_work_item(wait_callback {[&] {
+        for (auto index = 0; index < 100; ++index)
+          thread_pool::queue_user_work_item(action);
+      }});
+      for (auto retry = 0; retry < 200 && interlocked::compare_exchange(count, 0, 0) != 100; ++retry)
+        thread::sleep(5);
+      thread_pool::close();
+      assert::are_equal(100, count, csf_);
+    }
+    
+    void test_method_(get_available_threads) {
+      size_t max_worker_threads = 0;
+      size_t max_completion_port_threads = 0;
+      thread_pool::get_max_threads(max_worker_threads, max_completion_port_threads);
+      thread_pool::close();
+      size_t available_worker_threads = 0;
+      size_t available_completion_port_threads = 0;
+      thread_pool::get_available_threads(available_worker_threads, available_completion_port_threads);
+      assert::are_equal(max_worker_threads, available_worker_threads, csf_);
+    }
   };
 }
@@ -0,0 +1,90 @@
+#include <xtd/threading/timer>
+#include <xtd/threading/auto_reset_event>
+#include <xtd/threading/interlocked>
+#include <xtd/threading/thread>
+#include <xtd/argument_out_of_range_exception>
+#include <xtd/tunit/assert>
+#include <xtd/tunit/test_class_attribute>
+#include <xtd/tunit/test_method_attribute>
+#include <vector>
+
+using namespace xtd::threading;
+using namespace xtd::tunit;
+
+namespace xtd::tests {
+  class test_class_(timer_tests) {
+    void test_method_(create_with_infinite_due_time) {
+      auto count = 0;
+      auto t = timer {timer_callback {[&] {interlocked::increment(count);}}, timeout::infinite, timeout::infinite};
+      thread::sleep(20);
+      assert::are_equal(0, count, csf_);
+    }
+    
+    void test_method_(create_with_due_time_and_infinite_period) {
+      auto count = 0;
+      auto elapsed = auto_reset_event {false};
+      auto t = timer {timer_callback {[&] {
+        interlocked::increment(count);
+        elapsed.set();
+      }}, 5, timeout::infinite};
+      assert::is_true(elapsed.wait_one(1000), csf_);
+      thread::sleep(20);
+      assert::are_equal(1, count, csf_);
+    }
+    
+    void test_method_(create_with_period) {
+      auto count = 0;
+      auto elapsed = auto_reset_event {false};
+      auto t = timer {timer_callback {[&] {
+        if (interlocked::increment(count) == 3) elapsed.set();
+      }}, 0, 5};
+      assert::is_true(elapsed.wait_one(1000), csf_);
+      t.close();
+      assert::is_greater_or_equal(count, 3, csf_);
+    }
+    
+    void test_method_(change_to_infinite_stops_timer) {
+      auto count = 0;
+      auto t = timer {timer_callback {[&] {interlocked::increment(count);}}, 200, 200};
+      t.change(timeout::infinite, timeout::infinite);
+      thread::sleep(300);
+      assert::are_equal(0, count, csf_);
+    }
+    
+    void test_method_(change_restarts_timer) {
+      auto elapsed = auto_reset_event {false};
+      auto t = timer {timer_callback {[&] {elapsed.set();}}, timeout::infinite, timeout::infinite};
+      t.change(5, timeout::infinite);
+      assert::is_true(elapsed.wait_one(1000), csf_);
+    }
+    
+    void test_method_(change_with_invalid_due_time) {
+      auto t = timer {timer_callback {[&] {}}, timeout::infinite, timeout::infinite};
+      assert::throws<argument_out_of_range_exception>([&] {t.change(-2, timeout::infinite);}, csf_);
+    }
+    
+    void test_method_(close_waits_running_callback) {
+      auto started = auto_reset_event {false};
+      auto completed = false;
+      auto t = timer {timer_callback {[&] {
+        started.set();
+        thread::sleep(50);
+        completed = true;
+      }}, 0, timeout::infinite};
+      assert::is_true(started.wait_one(1000), csf_);
+      t.close();
+      assert::is_true(completed, csf_);
+    }
+    
+    void test_method_(many_timers_fire_together) {
+      auto count = 0;
+      auto timers = std::vector<timer> {};
+      timers.reserve(1000);
+      for (auto index = 0; index < 1000; ++index)
+        timers.emplace_back(timer_callback {[&] {interlocked::increment(count);}}, 10, timeout::infinite);
+      for (auto retry = 0; retry < 100 && interlocked::compare_exchange(count, 0, 0) != 1000; ++retry)
+        thread::sleep(10);
+      assert::are_equal(1000, count, csf_);
+    }
+  };
+}
@@ -1,3 +1,7 @@
+#include <xtd/threading/auto_reset_event>
+#include <xtd/threading/manual_reset_event>
+#include <xtd/threading/semaphore>
+#include <xtd/threading/thread>
 #include <xtd/threading/wait_handle>
 #include <xtd/tunit/assert>
 #include <xtd/tunit/test_class_attribute>
@@ -144,5 +148,45 @@ namespace xtd::tests {
       auto m3 = unnamed_mutex {};
       assert::are_equal(0ul, wait_handle::wait_any({m1, m2, m3}), csf_);
     }
+    
+    void test_method_(wait_any_with_timeout) {
+      auto e1 = auto_reset_event {false};
+      auto e2 = manual_reset_event {false};
+      assert::are_equal(wait_handle::wait_timeout, wait_handle::wait_any(std::vector<wait_handle*> {&e1, &e2}, 10), csf_);
+    }
+    
+    void test_method_(wait_any_signaled_from_other_thread) {
+      auto e1 = auto_reset_event {false};
+      auto s1 = semaphore {0, 1};
+      auto t1 = thread {[&] {
+        thread::sleep(10);
+        s1.release();
+      }};
+      t1.start();
+      assert::are_equal(1ul, wait_handle::wait_any(std::vector<wait_handle*> {&e1, &s1}, 5000), csf_);
+      t1.join();
+      assert::is_false(s1.wait_one(0), csf_);
+    }
+    
+    void test_method_(wait_all_with_timeout_acquires_nothing) {
+      auto s1 = semaphore {1, 1};
+      auto e1 = auto_reset_event {false};
+      assert::is_false(wait_handle::wait_all(std::vector<wait_handle*> {&s1, &e1}, 10), csf_);
+      assert::is_true(s1.wait_one(0), csf_);
+    }
+    
+    void test_method_(wait_all_signaled_from_other_thread) {
+      auto s1 = semaphore {1, 1};
+      auto e1 = auto_reset_event {false};
+      auto t1 = thread {[&] {
+        thread::sleep(10);
+        e1.set();
+      }};
+      t1.start();
+      assert::is_true(wait_handle::wait_all(std::vector<wait_handle*> {&s1, &e1}, 5000), csf_);
+      t1.join();
+      assert::is_false(s1.wait_one(0), csf_);
+      assert::is_false(e1.wait_one(0), csf_);
+    }
   };
 }